@@ -2,6 +2,7 @@ TEMPLATE = subdirs
 
 SUBDIRS +=  \
     tt3 \
+    tt3-bench \
     tt3-db-api \
     tt3-db-xml \
     tt3-gui \
@@ -10,12 +11,16 @@ SUBDIRS +=  \
     tt3-report-worksummary \
     tt3-skin-admin \
     tt3-skin-slim \
+    tt3-test \
     tt3-tools-backup \
     tt3-tools-restore \
+    tt3-tools-validate \
     tt3-util \
     tt3-ws
 
-tt3.depends = tt3-gui tt3-ws tt3-util
+tt3.depends = tt3-report tt3-gui tt3-ws tt3-util
+tt3-bench.depends = tt3-report-worksummary tt3-report tt3-gui tt3-ws tt3-db-xml tt3-db-api tt3-util
+tt3-test.depends = tt3-tools-restore tt3-tools-backup tt3-gui tt3-ws tt3-db-xml tt3-db-api tt3-util
 tt3-gui.depends = tt3-help tt3-ws tt3-db-api tt3-util
 tt3-ws.depends = tt3-db-api tt3-util
 tt3-db-api.depends = tt3-util
@@ -23,7 +28,8 @@ tt3-db-api.depends = tt3-util
 tt3-db-xml.depends = tt3-db-api tt3-util
 
 tt3-tools-backup.depends = tt3-gui tt3-ws tt3-util
-tt3-tools-restore.depends = tt3-gui tt3-ws tt3-util
+tt3-tools-restore.depends = tt3-tools-backup tt3-gui tt3-ws tt3-util
+tt3-tools-validate.depends = tt3-gui tt3-ws tt3-util
 
 tt3-report-worksummary.depends = tt3-report tt3-gui tt3-ws tt3-util
 tt3-report.depends = tt3-gui tt3-ws tt3-util
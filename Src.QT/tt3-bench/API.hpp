@@ -0,0 +1,41 @@
+//
+//  tt3-bench/API.hpp - tt3-bench API
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#pragma once
+
+//////////
+//  Dependencies
+#include "tt3-report-worksummary/API.hpp"
+#include "tt3-ws/API.hpp"
+#include "tt3-db-xml/API.hpp"
+#include "tt3-db-api/API.hpp"
+#include "tt3-util/API.hpp"
+
+#include <functional>
+#include <random>
+#include <thread>
+
+#include <QCommandLineParser>
+#include <QRegularExpression>
+#include <QTemporaryDir>
+#include <QTextStream>
+
+//////////
+//  tt3-bench components
+#include "tt3-bench/Benchmark.hpp"
+#include "tt3-bench/Fixtures.hpp"
+
+//  End of tt3-bench/API.hpp
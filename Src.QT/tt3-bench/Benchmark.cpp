@@ -0,0 +1,429 @@
+//
+//  tt3-bench/Benchmark.cpp - tt3::bench::Benchmark class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-bench/API.hpp"
+using namespace tt3::bench;
+#if defined(Q_OS_WINDOWS)
+    #include <windows.h>
+    #include <psapi.h>
+#elif defined(Q_OS_LINUX)
+    #include <unistd.h>
+#else
+    #error Unsupported platform
+#endif
+
+namespace
+{
+    QString formatDuration(double ns)
+    {
+        if (ns < 1e3)
+        {
+            return QString::number(ns, 'f', 1) + " ns";
+        }
+        if (ns < 1e6)
+        {
+            return QString::number(ns / 1e3, 'f', 2) + " us";
+        }
+        if (ns < 1e9)
+        {
+            return QString::number(ns / 1e6, 'f', 2) + " ms";
+        }
+        return QString::number(ns / 1e9, 'f', 2) + " s";
+    }
+
+    QString formatQuantity(double value, double base, const QString & unit)
+    {
+        static const char *const prefixes[] = { "", "k", "M", "G", "T" };
+        size_t prefix = 0;
+        while (value >= base && prefix + 1 < std::size(prefixes))
+        {
+            value /= base;
+            prefix++;
+        }
+        QString result = QString::number(value, 'f', (value < 10) ? 2 : 1) + prefixes[prefix];
+        if (base == 1024 && prefix > 0)
+        {   //  kiB, MiB, etc.
+            result += "i";
+        }
+        return result + unit;
+    }
+}
+
+//////////
+//  State
+State::State(const QList<qint64> & ranges, qint64 iterations)
+    :   _ranges(ranges),
+        _iterations(iterations),
+        _iterationsLeft(iterations)
+{
+}
+
+State::~State()
+{
+}
+
+auto State::begin() -> Iterator
+{
+    Q_ASSERT(!_timing && !_finished);
+    if (_errorMessage.isEmpty())
+    {
+        _timing = true;
+        _timer.start();
+    }
+    return Iterator(this);
+}
+
+qint64 State::range(int index) const
+{
+    return (index >= 0 && index < _ranges.size()) ? _ranges[index] : 0;
+}
+
+void State::pauseTiming()
+{
+    Q_ASSERT(_timing);
+    _elapsedNs += _timer.nsecsElapsed();
+    _timing = false;
+}
+
+void State::resumeTiming()
+{
+    Q_ASSERT(!_timing);
+    _timing = true;
+    _timer.start();
+}
+
+void State::setCounter(const QString & name, double value)
+{
+    _counters.append(
+        QPair<QString, QString>(
+            name,
+            (value == std::floor(value) && std::abs(value) < 1e15) ?
+                QString::number(qint64(value)) :
+                QString::number(value, 'g', 4)));
+}
+
+void State::setMemoryCounter(const QString & name, qint64 bytes)
+{
+    _counters.append(
+        QPair<QString, QString>(
+            name,
+            (bytes < 0) ?
+                QString("n/a") :
+                formatQuantity(double(bytes), 1024, "B")));
+}
+
+void State::skipWithError(const QString & errorMessage)
+{
+    _errorMessage = errorMessage;
+    _iterationsLeft = 0;
+}
+
+void State::_finishTiming()
+{
+    if (_timing)
+    {
+        _elapsedNs += _timer.nsecsElapsed();
+        _timing = false;
+    }
+    _finished = true;
+}
+
+//////////
+//  Construction/destruction
+Benchmark::Benchmark(const char * name, Function function)
+    :   _name(name),
+        _function(function)
+{
+    Q_ASSERT(_function != nullptr);
+    _registry().append(this);
+}
+
+//////////
+//  Operations
+Benchmark * Benchmark::arg(qint64 arg)
+{
+    _argLists.append(QList<qint64>{arg});
+    return this;
+}
+
+Benchmark * Benchmark::args(const QList<qint64> & args)
+{
+    _argLists.append(args);
+    return this;
+}
+
+Benchmark * Benchmark::range(qint64 start, qint64 limit)
+{
+    Q_ASSERT(start > 0 && start <= limit);
+    for (qint64 arg = start; arg < limit; arg *= RangeMultiplier)
+    {
+        _argLists.append(QList<qint64>{arg});
+    }
+    _argLists.append(QList<qint64>{limit});
+    return this;
+}
+
+Benchmark * Benchmark::iterations(qint64 count)
+{
+    Q_ASSERT(count > 0);
+    _fixedIterations = count;
+    return this;
+}
+
+auto Benchmark::all() -> QList<Benchmark*>
+{
+    return _registry();
+}
+
+int Benchmark::runAll(
+        const QRegularExpression & filter,
+        qint64 minTimeMs,
+        QTextStream & out
+    )
+{
+    out << QString("Benchmark").leftJustified(48)
+        << QString("Time").rightJustified(12)
+        << QString("Iterations").rightJustified(12)
+        << "  Counters"
+        << Qt::endl;
+    out << QString(48 + 12 + 12 + 10, '-') << Qt::endl;
+
+    int failedRuns = 0;
+    for (Benchmark * benchmark : std::as_const(_registry()))
+    {
+        for (const auto & [runName, args] : benchmark->_runNames())
+        {
+            if (filter.match(runName).hasMatch() &&
+                !benchmark->_run(runName, args, minTimeMs, out))
+            {
+                failedRuns++;
+            }
+        }
+    }
+    return failedRuns;
+}
+
+void Benchmark::listAll(
+        const QRegularExpression & filter,
+        QTextStream & out
+    )
+{
+    for (Benchmark * benchmark : std::as_const(_registry()))
+    {
+        for (const auto & [runName, args] : benchmark->_runNames())
+        {
+            if (filter.match(runName).hasMatch())
+            {
+                out << runName << Qt::endl;
+            }
+        }
+    }
+}
+
+//////////
+//  Implementation helpers
+auto Benchmark::_registry() -> QList<Benchmark*> &
+{
+    static QList<Benchmark*> registry;
+    return registry;
+}
+
+auto Benchmark::_runNames() const -> QList<QPair<QString, QList<qint64>>>
+{
+    QList<QPair<QString, QList<qint64>>> result;
+    if (_argLists.isEmpty())
+    {
+        result.append(QPair<QString, QList<qint64>>(_name, QList<qint64>()));
+    }
+    for (const auto & args : _argLists)
+    {
+        QString runName = _name;
+        for (qint64 arg : args)
+        {
+            runName += "/" + QString::number(arg);
+        }
+        result.append(QPair<QString, QList<qint64>>(runName, args));
+    }
+    return result;
+}
+
+bool Benchmark::_run(
+        const QString & runName,
+        const QList<qint64> & args,
+        qint64 minTimeMs,
+        QTextStream & out
+    )
+{
+    //  Grow the number of iterations until a run
+    //  takes long enough to be measured reliably
+    qint64 iterations = (_fixedIterations > 0) ? _fixedIterations : 1;
+    for (; ; )
+    {
+        State state(args, iterations);
+        try
+        {
+            _function(state);
+        }
+        catch (const tt3::util::Exception & ex)
+        {   //  OOPS! Report as a benchmark error
+            state.skipWithError(ex.errorMessage());
+        }
+        if (state._errorMessage.isEmpty() && !state._finished)
+        {   //  OOPS! The benchmark function has no loop!
+            state.skipWithError("The benchmark loop has not been run");
+        }
+        if (!state._errorMessage.isEmpty())
+        {
+            out << runName.leftJustified(48)
+                << "  ERROR: " << state._errorMessage
+                << Qt::endl;
+            return false;
+        }
+        const qint64 minTimeNs = minTimeMs * 1000000;
+        if (_fixedIterations == 0 &&
+            state._elapsedNs < minTimeNs &&
+            iterations < MaxIterations)
+        {   //  Try again with more iterations, aiming a bit
+            //  over the minimum time, but growing by 10x at most
+            double multiplier =
+                (state._elapsedNs <= 0) ?
+                    10.0 :
+                    std::min(10.0, 1.4 * double(minTimeNs) / double(state._elapsedNs));
+            iterations =
+                std::min(
+                    MaxIterations,
+                    std::max(iterations + 1, qint64(double(iterations) * multiplier)));
+            continue;
+        }
+        //  Done - report
+        double seconds = double(state._elapsedNs) / 1e9;
+        QString counters;
+        if (state._bytesProcessed > 0 && seconds > 0)
+        {
+            counters += " bytes/s=" + formatQuantity(double(state._bytesProcessed) / seconds, 1024, "B");
+        }
+        if (state._itemsProcessed > 0 && seconds > 0)
+        {
+            counters += " items/s=" + formatQuantity(double(state._itemsProcessed) / seconds, 1000, "");
+        }
+        for (const auto & [name, value] : std::as_const(state._counters))
+        {
+            counters += " " + name + "=" + value;
+        }
+        if (!state._label.isEmpty())
+        {
+            counters += " " + state._label;
+        }
+        out << runName.leftJustified(48)
+            << formatDuration(double(state._elapsedNs) / double(iterations)).rightJustified(12)
+            << QString::number(iterations).rightJustified(12)
+            << " " << counters
+            << Qt::endl;
+        return true;
+    }
+}
+
+//////////
+//  PeakMemoryMeter
+void PeakMemoryMeter::start()
+{
+    Q_ASSERT(!_measuring);
+    _measuring = true;
+    _baseline = resetPeakResidentSetSize() ? currentResidentSetSize() : -1;
+}
+
+void PeakMemoryMeter::stop()
+{
+    Q_ASSERT(_measuring);
+    _measuring = false;
+    qint64 peak = peakResidentSetSize();
+    if (_baseline >= 0 && peak >= 0)
+    {
+        _maxGrowth = std::max(_maxGrowth, std::max(peak - _baseline, qint64(0)));
+    }
+}
+
+void PeakMemoryMeter::report(State & state, const QString & name) const
+{
+    state.setMemoryCounter(name, _maxGrowth);
+}
+
+//////////
+//  Helpers
+void tt3::bench::useAddress(const volatile void * address)
+{
+    Q_UNUSED(address)
+}
+
+qint64 tt3::bench::currentResidentSetSize()
+{
+#if defined(Q_OS_WINDOWS)
+    PROCESS_MEMORY_COUNTERS counters;
+    return K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ?
+                qint64(counters.WorkingSetSize) :
+                -1;
+#elif defined(Q_OS_LINUX)
+    QFile file("/proc/self/status");
+    if (file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        for (QByteArray line = file.readLine(); !line.isEmpty(); line = file.readLine())
+        {
+            if (line.startsWith("VmRSS:"))
+            {   //  "VmRSS:     1234 kB"
+                return line.mid(6).trimmed().split(' ').first().toLongLong() * 1024;
+            }
+        }
+    }
+    return -1;
+#endif
+}
+
+qint64 tt3::bench::peakResidentSetSize()
+{
+#if defined(Q_OS_WINDOWS)
+    PROCESS_MEMORY_COUNTERS counters;
+    return K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ?
+                qint64(counters.PeakWorkingSetSize) :
+                -1;
+#elif defined(Q_OS_LINUX)
+    QFile file("/proc/self/status");
+    if (file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        for (QByteArray line = file.readLine(); !line.isEmpty(); line = file.readLine())
+        {
+            if (line.startsWith("VmHWM:"))
+            {   //  "VmHWM:     1234 kB"
+                return line.mid(6).trimmed().split(' ').first().toLongLong() * 1024;
+            }
+        }
+    }
+    return -1;
+#endif
+}
+
+bool tt3::bench::resetPeakResidentSetSize()
+{
+#if defined(Q_OS_WINDOWS)
+    return false;   //  Windows can't do that
+#elif defined(Q_OS_LINUX)
+    //  Writing "5" to clear_refs resets VmHWM to VmRSS
+    QFile file("/proc/self/clear_refs");
+    return file.open(QIODevice::WriteOnly) &&
+           file.write("5") == 1;
+#endif
+}
+
+//  End of tt3-bench/Benchmark.cpp
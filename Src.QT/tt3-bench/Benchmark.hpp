@@ -0,0 +1,461 @@
+//
+//  tt3-bench/Benchmark.hpp - tt3 micro-benchmarking harness
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#pragma once
+#include "tt3-bench/API.hpp"
+
+namespace tt3::bench
+{
+    class Benchmark;
+
+    /// \class State tt3-bench/API.hpp
+    /// \brief The state of a benchmark run.
+    /// \details
+    ///     A benchmark function is called with a State and
+    ///     runs the code being measured once per iteration
+    ///     of that State:
+    ///     \code
+    ///     for (auto _ : state)
+    ///     {
+    ///         ...
+    ///     }
+    ///     \endcode
+    ///     Only the time spent in the loop counts, less
+    ///     the time between pauseTiming() and resumeTiming().
+    class State final
+    {
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(State)
+
+        friend class Benchmark;
+
+        //////////
+        //  Types
+    public:
+        /// \class Iterator tt3-bench/API.hpp
+        /// \brief Drives the iterations of a benchmark run.
+        class Iterator final
+        {
+            friend class State;
+
+            //////////
+            //  Types
+        public:
+            /// \brief
+            ///     What the loop variable of the benchmark
+            ///     loop is; carries no information, but has
+            ///     a non-trivial lifetime so that the loop
+            ///     variable is never reported as unused.
+            struct Value
+            {
+                Value() {}
+                ~Value() {}
+            };
+
+            //////////
+            //  Construction/destruction - from friends only
+        private:
+            explicit Iterator(State * state) : _state(state) {}
+
+            //////////
+            //  Operators
+        public:
+            Value       operator * () const { return Value(); }
+            Iterator &  operator ++ () { _state->_iterationsLeft--; return *this; }
+            bool        operator != (const Iterator &) const
+            {
+                if (_state->_iterationsLeft > 0)
+                {
+                    return true;
+                }
+                _state->_finishTiming();
+                return false;
+            }
+
+            //////////
+            //  Implementation
+        private:
+            State *     _state;
+        };
+
+        //////////
+        //  Construction/destruction - from friends only
+    private:
+        State(const QList<qint64> & ranges, qint64 iterations);
+        ~State();
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Starts timing the benchmark loop.
+        /// \return
+        ///     The iterator at the first iteration.
+        Iterator        begin();
+
+        /// \brief
+        ///     Returns the iterator past the last iteration.
+        /// \return
+        ///     The iterator past the last iteration.
+        Iterator        end() { return Iterator(this); }
+
+        /// \brief
+        ///     Returns the argument of this benchmark run.
+        /// \param index
+        ///     The 0-based index of the argument.
+        /// \return
+        ///     The argument; 0 if there's no such argument.
+        qint64          range(int index = 0) const;
+
+        /// \brief
+        ///     Returns the number of iterations of this run.
+        /// \return
+        ///     The number of iterations of this run.
+        qint64          iterations() const { return _iterations; }
+
+        /// \brief
+        ///     Stops counting the time spent in the loop,
+        ///     e.g. while preparing data for the next iteration.
+        void            pauseTiming();
+
+        /// \brief
+        ///     Resumes counting the time spent in the loop.
+        void            resumeTiming();
+
+        /// \brief
+        ///     Records the number of items processed by the
+        ///     whole run; reported as items per second.
+        /// \param items
+        ///     The number of items processed by the whole run.
+        void            setItemsProcessed(qint64 items) { _itemsProcessed = items; }
+
+        /// \brief
+        ///     Records the number of bytes processed by the
+        ///     whole run; reported as bytes per second.
+        /// \param bytes
+        ///     The number of bytes processed by the whole run.
+        void            setBytesProcessed(qint64 bytes) { _bytesProcessed = bytes; }
+
+        /// \brief
+        ///     Records a custom measurement; reported as is.
+        /// \param name
+        ///     The name of the measurement.
+        /// \param value
+        ///     The value of the measurement.
+        void            setCounter(const QString & name, double value);
+
+        /// \brief
+        ///     Records a memory measurement; reported in bytes.
+        /// \param name
+        ///     The name of the measurement.
+        /// \param bytes
+        ///     The value of the measurement, in bytes; a
+        ///     negative value means "could not be measured".
+        void            setMemoryCounter(const QString & name, qint64 bytes);
+
+        /// \brief
+        ///     Sets the free-form label of this run.
+        /// \param label
+        ///     The free-form label of this run.
+        void            setLabel(const QString & label) { _label = label; }
+
+        /// \brief
+        ///     Abandons this run, reporting an error instead
+        ///     of measurements. The benchmark loop, if not
+        ///     yet entered, is skipped.
+        /// \param errorMessage
+        ///     The error message to report.
+        void            skipWithError(const QString & errorMessage);
+
+        //////////
+        //  Implementation
+    private:
+        const QList<qint64> _ranges;
+        const qint64    _iterations;
+        qint64          _iterationsLeft;
+        QElapsedTimer   _timer;
+        qint64          _elapsedNs = 0;     //  not counting current timed interval
+        bool            _timing = false;
+        bool            _finished = false;
+        qint64          _itemsProcessed = 0;
+        qint64          _bytesProcessed = 0;
+        QList<QPair<QString, QString>>  _counters;  //  name -> formatted value
+        QString         _label;
+        QString         _errorMessage;
+
+        //  Helpers
+        void            _finishTiming();
+    };
+
+    /// \class Benchmark tt3-bench/API.hpp
+    /// \brief A registered benchmark.
+    /// \details
+    ///     Benchmarks are registered by the TT3_BENCHMARK
+    ///     macro and are never destroyed. A benchmark is run
+    ///     once per argument (or argument list) it has been
+    ///     given, or once if it has been given none.
+    class Benchmark final
+    {
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Benchmark)
+
+        //////////
+        //  Types
+    public:
+        /// \brief
+        ///     The benchmark function.
+        using Function = void (*)(State & state);
+
+        //////////
+        //  Constants
+    public:
+        /// \brief
+        ///     The default minimum duration of a benchmark run;
+        ///     the number of iterations is increased until
+        ///     a run takes at least that long.
+        static const qint64 DefaultMinTimeMs = 500;
+
+        /// \brief
+        ///     The maximum number of iterations of a run.
+        static const qint64 MaxIterations = 1000000000;
+
+        /// \brief
+        ///     The multiplier between consecutive arguments
+        ///     generated by range().
+        static const qint64 RangeMultiplier = 8;
+
+        //////////
+        //  Construction/destruction
+    public:
+        /// \brief
+        ///     Constructs and registers a benchmark.
+        /// \param name
+        ///     The name of the benchmark.
+        /// \param function
+        ///     The benchmark function.
+        Benchmark(const char * name, Function function);
+
+        //  Benchmarks are never destroyed
+    private:
+        ~Benchmark() = default;
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Returns the name of this benchmark.
+        /// \return
+        ///     The name of this benchmark.
+        QString         name() const { return _name; }
+
+        /// \brief
+        ///     Adds a run with the specified argument.
+        /// \param arg
+        ///     The argument of the run.
+        /// \return
+        ///     This benchmark, to chain calls.
+        Benchmark *     arg(qint64 arg);
+
+        /// \brief
+        ///     Adds a run with the specified arguments.
+        /// \param args
+        ///     The arguments of the run.
+        /// \return
+        ///     This benchmark, to chain calls.
+        Benchmark *     args(const QList<qint64> & args);
+
+        /// \brief
+        ///     Adds a run per argument from start to limit
+        ///     (both inclusive), each RangeMultiplier times
+        ///     the previous one.
+        /// \param start
+        ///     The smallest argument.
+        /// \param limit
+        ///     The largest argument.
+        /// \return
+        ///     This benchmark, to chain calls.
+        Benchmark *     range(qint64 start, qint64 limit);
+
+        /// \brief
+        ///     Makes every run do exactly the specified number
+        ///     of iterations, e.g. for expensive benchmarks.
+        /// \param count
+        ///     The number of iterations per run.
+        /// \return
+        ///     This benchmark, to chain calls.
+        Benchmark *     iterations(qint64 count);
+
+        /// \brief
+        ///     Returns all registered benchmarks, in
+        ///     the order of registration.
+        /// \return
+        ///     All registered benchmarks.
+        static auto     all() -> QList<Benchmark*>;
+
+        /// \brief
+        ///     Runs all registered benchmarks whose run
+        ///     names match the filter, reporting results.
+        /// \param filter
+        ///     The filter for run names ("name/arg/...").
+        /// \param minTimeMs
+        ///     The minimum duration of a run, in milliseconds.
+        /// \param out
+        ///     The stream to report results to.
+        /// \return
+        ///     The number of runs that have reported errors.
+        static int      runAll(
+                                const QRegularExpression & filter,
+                                qint64 minTimeMs,
+                                QTextStream & out
+                            );
+
+        /// \brief
+        ///     Lists the names of all registered benchmark
+        ///     runs that match the filter.
+        /// \param filter
+        ///     The filter for run names ("name/arg/...").
+        /// \param out
+        ///     The stream to list the run names to.
+        static void     listAll(
+                                const QRegularExpression & filter,
+                                QTextStream & out
+                            );
+
+        //////////
+        //  Implementation
+    private:
+        const QString   _name;
+        const Function  _function;
+        QList<QList<qint64>>    _argLists;  //  empty == run once with no args
+        qint64          _fixedIterations = 0;   //  0 == adaptive
+
+        //  Helpers
+        static auto     _registry() -> QList<Benchmark*> &;
+        auto            _runNames() const -> QList<QPair<QString, QList<qint64>>>;
+        bool            _run(
+                                const QString & runName,
+                                const QList<qint64> & args,
+                                qint64 minTimeMs,
+                                QTextStream & out
+                            );
+    };
+
+    /// \class PeakMemoryMeter tt3-bench/API.hpp
+    /// \brief Measures the peak extra memory used by the code
+    ///        between start() and stop(), over all such intervals.
+    /// \details
+    ///     Memory is measured as the growth of the process's peak
+    ///     resident set size over its resident set size at start().
+    ///     This needs resetPeakResidentSetSize(); where the platform
+    ///     does not support that, nothing is measured.
+    class PeakMemoryMeter final
+    {
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(PeakMemoryMeter)
+
+        //////////
+        //  Construction/destruction
+    public:
+        PeakMemoryMeter() = default;
+        ~PeakMemoryMeter() = default;
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Starts a measured interval.
+        void            start();
+
+        /// \brief
+        ///     Stops a measured interval.
+        void            stop();
+
+        /// \brief
+        ///     Records the largest peak extra memory used
+        ///     during any measured interval with the State.
+        /// \param state
+        ///     The state of the benchmark run.
+        /// \param name
+        ///     The name of the memory counter to record.
+        void            report(State & state, const QString & name = "PeakRSS+") const;
+
+        //////////
+        //  Implementation
+    private:
+        bool            _measuring = false;
+        qint64          _baseline = -1;     //  RSS at start(), -1 == unknown
+        qint64          _maxGrowth = -1;    //  -1 == unknown
+    };
+
+    //////////
+    //  Helpers
+
+    /// \brief
+    ///     Does nothing with an address, but the compiler
+    ///     cannot know that; used by doNotOptimize().
+    /// \param address
+    ///     The address to "use".
+    void        useAddress(const volatile void * address);
+
+    /// \brief
+    ///     Prevents the compiler from optimizing away
+    ///     the computation of a value.
+    /// \param value
+    ///     The value that must be computed.
+    template <class T>
+    inline void doNotOptimize(const T & value)
+    {
+#if defined(__GNUC__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#elif defined(_MSC_VER)
+        useAddress(&value);
+#else
+    #error Unsupported C++ toolchain
+#endif
+    }
+
+    /// \brief
+    ///     Returns the current resident set size of this process.
+    /// \return
+    ///     The current resident set size of this process,
+    ///     in bytes; -1 if it cannot be determined.
+    qint64      currentResidentSetSize();
+
+    /// \brief
+    ///     Returns the peak resident set size of this process.
+    /// \return
+    ///     The peak resident set size of this process since
+    ///     it has started or since the last successful
+    ///     resetPeakResidentSetSize(), in bytes; -1 if it
+    ///     cannot be determined.
+    qint64      peakResidentSetSize();
+
+    /// \brief
+    ///     Resets the peak resident set size of this
+    ///     process to its current resident set size.
+    /// \return
+    ///     True on success, false if the platform does not
+    ///     support that (in which case the peak resident set
+    ///     size is the one since the process has started).
+    bool        resetPeakResidentSetSize();
+}
+
+//  Benchmark registration, e.g.
+//      TT3_BENCHMARK(sha1Digest)->range(1024, 1024 * 1024);
+#define TT3_BENCHMARK_CONCAT_(a, b) a##b
+#define TT3_BENCHMARK_CONCAT(a, b)  TT3_BENCHMARK_CONCAT_(a, b)
+#define TT3_BENCHMARK(function)     \
+    [[maybe_unused]] static tt3::bench::Benchmark * TT3_BENCHMARK_CONCAT(_benchmark, __LINE__) =   \
+        (new tt3::bench::Benchmark(#function, function))
+
+//  End of tt3-bench/Benchmark.hpp
@@ -0,0 +1,178 @@
+//
+//  tt3-bench/ChangeNotifierBenchmarks.cpp - change notification benchmarks
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-bench/API.hpp"
+using namespace tt3::bench;
+
+//  A restore re-creates a database object by object; every
+//  Work it creates posts 3 notifications (the Work created,
+//  its Account and its Activity modified). The benchmarks
+//  time posting such a stream until the notifier's worker
+//  thread has delivered all of it - first through the
+//  notifier alone, then through the database as a restore
+//  would drive it (outside a bulk-load session, which drops
+//  notifications). The argument is the number of works.
+namespace
+{
+    class NotificationListener final
+    {
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(NotificationListener)
+
+    public:
+        explicit NotificationListener(tt3::db::api::ChangeNotifier * changeNotifier)
+            :   _changeNotifier(changeNotifier)
+        {   //  Slots run on the notifier's worker thread
+            _connections.append(
+                QObject::connect(
+                    _changeNotifier,
+                    &tt3::db::api::ChangeNotifier::objectCreated,
+                    [this](tt3::db::api::ObjectCreatedNotification notification)
+                    {
+                        _signals++;
+                        if (notification.oid() == _sentinelOid)
+                        {
+                            _sentinelDelivered.release();
+                        }
+                    }));
+            _connections.append(
+                QObject::connect(
+                    _changeNotifier,
+                    &tt3::db::api::ChangeNotifier::objectModified,
+                    [this](tt3::db::api::ObjectModifiedNotification)
+                    {
+                        _signals++;
+                    }));
+            _connections.append(
+                QObject::connect(
+                    _changeNotifier,
+                    &tt3::db::api::ChangeNotifier::changesCommitted,
+                    [this](tt3::db::api::ChangeNotificationBatch)
+                    {
+                        _batches++;
+                    }));
+        }
+
+        ~NotificationListener()
+        {
+            for (const auto & connection : std::as_const(_connections))
+            {
+                QObject::disconnect(connection);
+            }
+        }
+
+        //  Posts a notification that follows everything posted
+        //  so far and waits until it has been delivered
+        void        flush(tt3::db::api::IDatabase * database)
+        {
+            _changeNotifier->post(
+                new tt3::db::api::ObjectCreatedNotification(
+                    database,
+                    tt3::db::api::ObjectTypes::Work::instance(),
+                    _sentinelOid));
+            _sentinelDelivered.acquire();
+        }
+
+        void        report(State & state) const
+        {
+            state.setCounter("Signals/iter", double(_signals.load()) / double(state.iterations()));
+            state.setCounter("Batches/iter", double(_batches.load()) / double(state.iterations()));
+        }
+
+    private:
+        tt3::db::api::ChangeNotifier *const _changeNotifier;
+        const tt3::db::api::Oid     _sentinelOid = tt3::db::api::Oid::createRandom();
+        QList<QMetaObject::Connection>  _connections;
+        QSemaphore                  _sentinelDelivered;
+        std::atomic<qint64>         _signals = 0;
+        std::atomic<qint64>         _batches = 0;
+    };
+}
+
+static void changeNotifierRestoreStream(State & state)
+{
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(1, 0);    //  may throw
+    std::unique_ptr<tt3::db::api::IDatabase> database
+        { tt3::db::xml::DatabaseType::instance()->openDatabase(fixture->address(), tt3::db::api::OpenMode::ReadOnly) }; //  may throw
+    tt3::db::api::IObjectType * workType = tt3::db::api::ObjectTypes::Work::instance();
+    tt3::db::api::IObjectType * accountType = tt3::db::api::ObjectTypes::Account::instance();
+    tt3::db::api::IObjectType * activityType = tt3::db::api::ObjectTypes::PublicActivity::instance();
+    const tt3::db::api::Oid accountOid = tt3::db::api::Oid::createRandom();
+    const tt3::db::api::Oid activityOid = tt3::db::api::Oid::createRandom();
+    tt3::db::api::ChangeNotifier * changeNotifier = database->changeNotifier();
+    NotificationListener listener(changeNotifier);
+
+    for (auto _ : state)
+    {
+        for (qint64 i = 0; i < state.range(0); i++)
+        {
+            changeNotifier->post(
+                new tt3::db::api::ObjectCreatedNotification(
+                    database.get(), workType, tt3::db::api::Oid::createRandom()));
+            changeNotifier->post(
+                new tt3::db::api::ObjectModifiedNotification(
+                    database.get(), accountType, accountOid));
+            changeNotifier->post(
+                new tt3::db::api::ObjectModifiedNotification(
+                    database.get(), activityType, activityOid));
+        }
+        listener.flush(database.get());
+    }
+    state.setItemsProcessed(state.iterations() * state.range(0) * 3);
+    listener.report(state);
+    database->close();
+}
+TT3_BENCHMARK(changeNotifierRestoreStream)->range(1000, 1000000);
+
+static void xmlDatabaseCreateWorkNotifications(State & state)
+{
+    const qint64 startMs =
+        QDateTime(QDate(2020, 1, 1), QTime(0, 0), QTimeZone::UTC).toMSecsSinceEpoch();
+
+    for (auto _ : state)
+    {
+        state.pauseTiming();
+        //  A fresh database each time, so that the works
+        //  created do not pile up
+        auto fixture = std::make_unique<XmlDatabaseFixture>(1, 0);  //  may throw
+        std::unique_ptr<tt3::db::api::IDatabase> database
+            { tt3::db::xml::DatabaseType::instance()->openDatabase(fixture->address(), tt3::db::api::OpenMode::ReadWrite) };   //  may throw
+        tt3::db::api::IAccount * account = database->findAccount(XmlDatabaseFixture::login(0)); //  may throw
+        tt3::db::api::IActivity * activity = database->findPublicActivity(XmlDatabaseFixture::ActivityName);    //  may throw
+        Q_ASSERT(account != nullptr && activity != nullptr);
+        auto listener = std::make_unique<NotificationListener>(database->changeNotifier());
+        state.resumeTiming();
+
+        for (qint64 i = 0; i < state.range(0); i++)
+        {
+            account->createWork(    //  may throw
+                QDateTime::fromMSecsSinceEpoch(startMs + i * 60 * 1000, QTimeZone::UTC),
+                QDateTime::fromMSecsSinceEpoch(startMs + i * 60 * 1000 + 59 * 1000, QTimeZone::UTC),
+                activity);
+        }
+        listener->flush(database.get());
+
+        state.pauseTiming();
+        listener.reset();
+        database->close();
+        database.reset();
+        fixture.reset();
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(state.iterations() * state.range(0));
+}
+TT3_BENCHMARK(xmlDatabaseCreateWorkNotifications)->range(1000, 100000);
+
+//  End of tt3-bench/ChangeNotifierBenchmarks.cpp
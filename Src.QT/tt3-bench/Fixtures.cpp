@@ -0,0 +1,139 @@
+//
+//  tt3-bench/Fixtures.cpp - tt3 benchmark fixtures implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-bench/API.hpp"
+using namespace tt3::bench;
+
+//////////
+//  XmlDatabaseFixture
+XmlDatabaseFixture::XmlDatabaseFixture(
+        qint64 accountCount,
+        qint64 workCount
+    )
+{
+    Q_ASSERT(accountCount > 0 && workCount >= 0);
+
+    if (!_directory.isValid())
+    {   //  OOPS!
+        throw tt3::db::api::CustomDatabaseException(_directory.errorString());
+    }
+    _address =
+        tt3::db::xml::DatabaseType::instance()->parseDatabaseAddress(
+            QDir(_directory.path()).absoluteFilePath(
+                "bench" + tt3::db::xml::DatabaseType::PreferredExtension));  //  may throw
+    _address->addReference();
+
+    std::unique_ptr<tt3::db::api::IDatabase> database
+        { tt3::db::xml::DatabaseType::instance()->createDatabase(_address) };  //  may throw
+    database->beginBulkLoad();
+    auto activity =
+        database->createPublicActivity(
+            ActivityName,
+            QString(),
+            tt3::db::api::InactivityTimeout(),
+            false,
+            false,
+            false,
+            nullptr,
+            nullptr);
+    //  Works are a minute long each, back to back
+    const qint64 startMs =
+        QDateTime(QDate(2020, 1, 1), QTime(0, 0), QTimeZone::UTC).toMSecsSinceEpoch();
+    for (qint64 i = 0; i < accountCount; i++)
+    {
+        auto user =
+            database->createUser(
+                true,
+                QStringList(),
+                "User " + QString::number(i),
+                tt3::db::api::InactivityTimeout(),
+                tt3::db::api::UiLocale(),
+                tt3::db::api::Workloads());
+        auto account =
+            user->createAccount(
+                true,
+                QStringList(),
+                login(i),
+                Password,
+                (i == 0) ?
+                    tt3::db::api::Capabilities(tt3::db::api::Capability::Administrator) :
+                    tt3::db::api::Capability::LogWork | tt3::db::api::Capability::GenerateReports);
+        const qint64 accountWorkCount =
+            workCount / accountCount + ((i < workCount % accountCount) ? 1 : 0);
+        for (qint64 j = 0; j < accountWorkCount; j++)
+        {
+            account->createWork(
+                QDateTime::fromMSecsSinceEpoch(startMs + j * 60 * 1000, QTimeZone::UTC),
+                QDateTime::fromMSecsSinceEpoch(startMs + j * 60 * 1000 + 59 * 1000, QTimeZone::UTC),
+                activity);
+        }
+    }
+    database->endBulkLoad();
+    database->close();  //  saves
+}
+
+XmlDatabaseFixture::~XmlDatabaseFixture()
+{
+    if (_address != nullptr)
+    {
+        _address->removeReference();
+    }
+}
+
+//////////
+//  Operations
+QString XmlDatabaseFixture::path() const
+{
+    return _address->externalForm();
+}
+
+QString XmlDatabaseFixture::login(qint64 index)
+{
+    return "user" + QString::number(index);
+}
+
+auto XmlDatabaseFixture::shared(
+        qint64 accountCount,
+        qint64 workCount
+    ) -> XmlDatabaseFixture *
+{
+    _SharedFixtures & fixtures = _sharedFixtures();
+
+    QPair<qint64, qint64> key(accountCount, workCount);
+    if (!fixtures.contains(key))
+    {
+        fixtures[key] = new XmlDatabaseFixture(accountCount, workCount);    //  may throw
+    }
+    return fixtures[key];
+}
+
+void XmlDatabaseFixture::deleteShared()
+{
+    _SharedFixtures & fixtures = _sharedFixtures();
+
+    qDeleteAll(fixtures);
+    fixtures.clear();
+}
+
+//////////
+//  Implementation helpers
+auto XmlDatabaseFixture::_sharedFixtures() -> _SharedFixtures &
+{
+    static _SharedFixtures sharedFixtures;
+    return sharedFixtures;
+}
+
+//  End of tt3-bench/Fixtures.cpp
@@ -0,0 +1,121 @@
+//
+//  tt3-bench/Fixtures.hpp - tt3 benchmark fixtures
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#pragma once
+#include "tt3-bench/API.hpp"
+
+namespace tt3::bench
+{
+    /// \class XmlDatabaseFixture tt3-bench/API.hpp
+    /// \brief A temporary XML database with generated content.
+    /// \details
+    ///     The database has the specified number of users, with
+    ///     one account each, and the specified number of works,
+    ///     spread evenly over the accounts and all logged against
+    ///     the same public activity. The first account is an
+    ///     administrator. The database is generated in a single
+    ///     bulk-load session, closed, and deleted (with its
+    ///     temporary directory) when the fixture is.
+    class XmlDatabaseFixture final
+    {
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(XmlDatabaseFixture)
+
+        //////////
+        //  Constants
+    public:
+        /// \brief
+        ///     The password of every account.
+        static inline const QString Password = "password";
+
+        /// \brief
+        ///     The display name of the public activity.
+        static inline const QString ActivityName = "Benchmarking";
+
+        //////////
+        //  Construction/destruction
+    public:
+        /// \brief
+        ///     Generates the database.
+        /// \param accountCount
+        ///     The number of users/accounts to generate (at least 1).
+        /// \param workCount
+        ///     The number of works to generate.
+        /// \exception Exception
+        ///     If an error occurs.
+        XmlDatabaseFixture(qint64 accountCount, qint64 workCount);
+
+        /// \brief
+        ///     The class destructor; deletes the database.
+        ~XmlDatabaseFixture();
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Returns the path to the database file.
+        /// \return
+        ///     The path to the database file.
+        QString         path() const;
+
+        /// \brief
+        ///     Returns the address of the database.
+        /// \return
+        ///     The address of the database.
+        auto            address() const -> tt3::db::api::IDatabaseAddress * { return _address; }
+
+        /// \brief
+        ///     Returns the login of the specified account.
+        /// \param index
+        ///     The 0-based index of the account.
+        /// \return
+        ///     The login of the specified account.
+        static QString  login(qint64 index);
+
+        /// \brief
+        ///     Returns a fixture with the specified content,
+        ///     generating it on the first call; the fixture
+        ///     is kept until deleteShared(), so that benchmark
+        ///     runs can share it.
+        /// \param accountCount
+        ///     The number of users/accounts to generate.
+        /// \param workCount
+        ///     The number of works to generate.
+        /// \return
+        ///     The shared fixture.
+        /// \exception Exception
+        ///     If an error occurs.
+        static auto     shared(
+                                qint64 accountCount,
+                                qint64 workCount
+                            ) -> XmlDatabaseFixture *;
+
+        /// \brief
+        ///     Deletes all shared fixtures.
+        static void     deleteShared();
+
+        //////////
+        //  Implementation
+    private:
+        QTemporaryDir   _directory;
+        tt3::db::api::IDatabaseAddress *    _address = nullptr;
+
+        //  Helpers
+        using _SharedFixtures = QMap<QPair<qint64, qint64>, XmlDatabaseFixture*>;
+        static auto     _sharedFixtures() -> _SharedFixtures &;
+    };
+}
+
+//  End of tt3-bench/Fixtures.hpp
@@ -0,0 +1,77 @@
+//
+//  tt3-bench/Main.cpp - tt3-bench entry point
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-bench/API.hpp"
+using namespace tt3::bench;
+
+//////////
+//  TT3 benchmarks entry point
+int main(int argc, char *argv[])
+{
+    //  Benchmarks have no windows, so don't
+    //  insist on a display being available
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("TimeTracker3 benchmarks");
+    parser.addHelpOption();
+    QCommandLineOption filterOption(
+        "filter",
+        "Run only benchmarks whose names match <regex>.",
+        "regex",
+        ".*");
+    QCommandLineOption minTimeOption(
+        "min-time-ms",
+        "Run each benchmark for at least <ms> milliseconds.",
+        "ms",
+        QString::number(Benchmark::DefaultMinTimeMs));
+    QCommandLineOption listOption(
+        "list",
+        "List the benchmarks instead of running them.");
+    parser.addOption(filterOption);
+    parser.addOption(minTimeOption);
+    parser.addOption(listOption);
+    parser.process(app);
+
+    QRegularExpression filter(parser.value(filterOption));
+    bool minTimeOk = false;
+    qint64 minTimeMs = parser.value(minTimeOption).toLongLong(&minTimeOk);
+    if (!filter.isValid() || !minTimeOk || minTimeMs < 0)
+    {   //  OOPS!
+        qCritical() << "Invalid command line; see --help";
+        return EXIT_FAILURE;
+    }
+
+    QTextStream out(stdout);
+    if (parser.isSet(listOption))
+    {
+        Benchmark::listAll(filter, out);
+        return EXIT_SUCCESS;
+    }
+    //  Benchmarks use the components linked in,
+    //  e.g. for database types and resources
+    tt3::util::ComponentManager::initializeComponents();
+    int failedRuns = Benchmark::runAll(filter, minTimeMs, out);
+    XmlDatabaseFixture::deleteShared();
+    tt3::util::ComponentManager::deinitializeComponents();
+    return (failedRuns == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//  End of tt3-bench/Main.cpp
@@ -0,0 +1,85 @@
+//
+//  tt3-bench/MessageDigestBenchmarks.cpp - message digest benchmarks
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-bench/API.hpp"
+using namespace tt3::bench;
+
+//  SHA-1 and SHA-256 throughput, with the portable code and
+//  with the CPU's SHA extensions; on a CPU without the latter
+//  both run the portable code, as labelled. The argument is
+//  the message size; messages over 1MiB are digested in 1MiB
+//  fragments, like files are.
+namespace
+{
+    const qint64 MaxFragmentSize = 1024 * 1024;
+
+    void digestThroughput(
+            State & state,
+            tt3::util::IMessageDigest * messageDigest,
+            bool useShaInstructions
+        )
+    {
+        tt3::util::StandardMessageDigests::setShaInstructionsEnabled(useShaInstructions);
+        if (useShaInstructions && !tt3::util::StandardMessageDigests::isUsingShaInstructions())
+        {
+            state.setLabel("(no SHA extensions - portable)");
+        }
+        const qint64 messageSize = state.range(0);
+        const QByteArray fragment(qsizetype(std::min(messageSize, MaxFragmentSize)), '\xA5');
+        std::unique_ptr<tt3::util::IMessageDigest::Builder> builder
+            { messageDigest->createBuilder() };
+
+        for (auto _ : state)
+        {
+            builder->reset();
+            for (qint64 remaining = messageSize; remaining > 0; remaining -= fragment.size())
+            {
+                builder->digestFragment(
+                    fragment.constData(),
+                    size_t(std::min(remaining, qint64(fragment.size()))));
+            }
+            doNotOptimize(builder->digestAsBytes());
+        }
+        state.setBytesProcessed(state.iterations() * messageSize);
+        tt3::util::StandardMessageDigests::setShaInstructionsEnabled(true);
+    }
+}
+
+static void sha1Portable(State & state)
+{
+    digestThroughput(state, tt3::util::StandardMessageDigests::Sha1::instance(), false);
+}
+TT3_BENCHMARK(sha1Portable)->range(1024, 1024 * 1024 * 1024);
+
+static void sha1ShaInstructions(State & state)
+{
+    digestThroughput(state, tt3::util::StandardMessageDigests::Sha1::instance(), true);
+}
+TT3_BENCHMARK(sha1ShaInstructions)->range(1024, 1024 * 1024 * 1024);
+
+static void sha256Portable(State & state)
+{
+    digestThroughput(state, tt3::util::StandardMessageDigests::Sha256::instance(), false);
+}
+TT3_BENCHMARK(sha256Portable)->range(1024, 1024 * 1024 * 1024);
+
+static void sha256ShaInstructions(State & state)
+{
+    digestThroughput(state, tt3::util::StandardMessageDigests::Sha256::instance(), true);
+}
+TT3_BENCHMARK(sha256ShaInstructions)->range(1024, 1024 * 1024 * 1024);
+
+//  End of tt3-bench/MessageDigestBenchmarks.cpp
@@ -0,0 +1,170 @@
+//
+//  tt3-bench/OidBenchmarks.cpp - OID benchmarks
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-bench/API.hpp"
+using namespace tt3::bench;
+
+//  Saving a database sorts every aggregation and association
+//  by OID and formats every OID; loading it parses them all.
+//  The "ByString" and "Uuid" benchmarks time the way this used
+//  to be done - comparing formatted OIDs and going through
+//  QUuid's own (allocating) string conversions - for comparison.
+//  The argument is the number of OIDs.
+namespace
+{
+    QList<tt3::db::api::Oid> randomOids(qint64 count)
+    {
+        QList<tt3::db::api::Oid> result;
+        result.reserve(count);
+        for (qint64 i = 0; i < count; i++)
+        {
+            result.append(tt3::db::api::Oid::createRandom());
+        }
+        return result;
+    }
+
+    QStringList formattedOids(const QList<tt3::db::api::Oid> & oids)
+    {
+        QStringList result;
+        result.reserve(oids.size());
+        for (const auto & oid : oids)
+        {
+            result.append(tt3::util::toString(oid));
+        }
+        return result;
+    }
+}
+
+static void oidSort(State & state)
+{
+    const QList<tt3::db::api::Oid> oids = randomOids(state.range(0));
+
+    for (auto _ : state)
+    {
+        state.pauseTiming();
+        QList<tt3::db::api::Oid> sortedOids = oids;
+        state.resumeTiming();
+        std::sort(sortedOids.begin(), sortedOids.end());
+        doNotOptimize(sortedOids.constData());
+    }
+    state.setItemsProcessed(state.iterations() * state.range(0));
+}
+TT3_BENCHMARK(oidSort)->arg(1000000);
+
+static void oidSortByString(State & state)
+{
+    const QList<tt3::db::api::Oid> oids = randomOids(state.range(0));
+
+    for (auto _ : state)
+    {
+        state.pauseTiming();
+        QList<tt3::db::api::Oid> sortedOids = oids;
+        state.resumeTiming();
+        std::sort(
+            sortedOids.begin(),
+            sortedOids.end(),
+            [](const auto & a, const auto & b)
+            {
+                return tt3::util::toString(a) < tt3::util::toString(b);
+            });
+        doNotOptimize(sortedOids.constData());
+    }
+    state.setItemsProcessed(state.iterations() * state.range(0));
+}
+TT3_BENCHMARK(oidSortByString)->arg(1000000);
+
+static void oidFormatInto(State & state)
+{
+    const QList<tt3::db::api::Oid> oids = randomOids(state.range(0));
+    QString buffer(tt3::db::api::Oid::StringLength, QChar(' '));
+
+    for (auto _ : state)
+    {
+        for (const auto & oid : oids)
+        {
+            oid.formatInto(buffer.data());
+            doNotOptimize(buffer.constData());
+        }
+    }
+    state.setItemsProcessed(state.iterations() * state.range(0));
+}
+TT3_BENCHMARK(oidFormatInto)->arg(1000000);
+
+static void oidToString(State & state)
+{
+    const QList<tt3::db::api::Oid> oids = randomOids(state.range(0));
+
+    for (auto _ : state)
+    {
+        for (const auto & oid : oids)
+        {
+            doNotOptimize(tt3::util::toString(oid));
+        }
+    }
+    state.setItemsProcessed(state.iterations() * state.range(0));
+}
+TT3_BENCHMARK(oidToString)->arg(1000000);
+
+static void oidToStringUuid(State & state)
+{
+    QList<QUuid> uuids;
+    for (qint64 i = 0; i < state.range(0); i++)
+    {
+        uuids.append(QUuid::createUuid());
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto & uuid : std::as_const(uuids))
+        {
+            doNotOptimize(uuid.toString().toUpper());
+        }
+    }
+    state.setItemsProcessed(state.iterations() * state.range(0));
+}
+TT3_BENCHMARK(oidToStringUuid)->arg(1000000);
+
+static void oidParse(State & state)
+{
+    const QStringList oidStrings = formattedOids(randomOids(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (const auto & oidString : oidStrings)
+        {
+            doNotOptimize(tt3::db::api::Oid::parse(oidString));
+        }
+    }
+    state.setItemsProcessed(state.iterations() * state.range(0));
+}
+TT3_BENCHMARK(oidParse)->arg(1000000);
+
+static void oidParseUuid(State & state)
+{
+    const QStringList oidStrings = formattedOids(randomOids(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (const auto & oidString : oidStrings)
+        {
+            doNotOptimize(QUuid(oidString.mid(0, tt3::db::api::Oid::StringLength)));
+        }
+    }
+    state.setItemsProcessed(state.iterations() * state.range(0));
+}
+TT3_BENCHMARK(oidParseUuid)->arg(1000000);
+
+//  End of tt3-bench/OidBenchmarks.cpp
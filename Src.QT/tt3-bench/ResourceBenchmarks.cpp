@@ -0,0 +1,107 @@
+//
+//  tt3-bench/ResourceBenchmarks.cpp - resource factory benchmarks
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-bench/API.hpp"
+using namespace tt3::bench;
+
+//  The GUI looks up resource strings all the time, e.g. on every
+//  refresh; the tt3-gui resources are the largest there are. The
+//  startup benchmark times what the first lookup of a component
+//  resource costs (finding the per-locale files and loading the
+//  catalog), the others what every lookup after that costs - in
+//  the base locale, in a translated locale and in a locale that
+//  there is no translation for, which falls back to the base one.
+namespace
+{
+    class GuiResources final
+        :   public tt3::util::FileResourceFactory
+    {
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(GuiResources)
+
+    public:
+        GuiResources()
+            :   FileResourceFactory(":/tt3-gui/Resources/tt3-gui.txt") {}
+        virtual ~GuiResources() = default;
+    };
+
+    const QList<QPair<tt3::util::ResourceSectionId, tt3::util::ResourceId>> Lookups
+    {
+        { tt3::util::ResourceSectionId("AboutDialog"), tt3::util::ResourceId("Title") },
+        { tt3::util::ResourceSectionId("ActivityTypeManager"), tt3::util::ResourceId("FilterLabel") },
+        { tt3::util::ResourceSectionId("AddEmailAddressDialog"), tt3::util::ResourceId("Prompt") },
+        { tt3::util::ResourceSectionId("AskYesNoDialog"), tt3::util::ResourceId("YesPushButton") },
+        { tt3::util::ResourceSectionId("BeneficiaryManager"), tt3::util::ResourceId("CreateBeneficiaryPushButton") },
+        { tt3::util::ResourceSectionId("ChooseReloginDialog"), tt3::util::ResourceId("Title") },
+        { tt3::util::ResourceSectionId("ConfirmCloseWorkspaceDialog"), tt3::util::ResourceId("Prompt") },
+        { tt3::util::ResourceSectionId("Component"), tt3::util::ResourceId("DisplayName") }
+    };
+
+    void resourceLookup(State & state, const QLocale & locale)
+    {
+        QLocale savedDefaultLocale;
+        QLocale::setDefault(locale);
+        GuiResources resources;
+        doNotOptimize(resources.string(Lookups[0].first, Lookups[0].second));  //  may throw
+
+        qsizetype index = 0;
+        for (auto _ : state)
+        {
+            doNotOptimize(resources.string(Lookups[index].first, Lookups[index].second)); //  may throw
+            index = (index + 1) % Lookups.size();
+        }
+        state.setItemsProcessed(state.iterations());
+        QLocale::setDefault(savedDefaultLocale);
+    }
+}
+
+static void resourceStartup(State & state)
+{
+    QLocale savedDefaultLocale;
+    QLocale::setDefault(QLocale(QLocale::German, QLocale::Germany));
+
+    std::unique_ptr<GuiResources> resources;
+    for (auto _ : state)
+    {
+        state.pauseTiming();
+        resources.reset();  //  not part of the startup
+        state.resumeTiming();
+        resources = std::make_unique<GuiResources>();
+        doNotOptimize(resources->string(Lookups[0].first, Lookups[0].second)); //  may throw
+    }
+    state.setItemsProcessed(state.iterations());
+    QLocale::setDefault(savedDefaultLocale);
+}
+TT3_BENCHMARK(resourceStartup);
+
+static void resourceLookupBaseLocale(State & state)
+{
+    resourceLookup(state, QLocale(QLocale::English, QLocale::UnitedKingdom));
+}
+TT3_BENCHMARK(resourceLookupBaseLocale);
+
+static void resourceLookupTranslatedLocale(State & state)
+{
+    resourceLookup(state, QLocale(QLocale::German, QLocale::Germany));
+}
+TT3_BENCHMARK(resourceLookupTranslatedLocale);
+
+static void resourceLookupFallbackLocale(State & state)
+{
+    resourceLookup(state, QLocale(QLocale::French, QLocale::France));
+}
+TT3_BENCHMARK(resourceLookupFallbackLocale);
+
+//  End of tt3-bench/ResourceBenchmarks.cpp
@@ -0,0 +1,200 @@
+//
+//  tt3-bench/StringConversionBenchmarks.cpp - toString()/fromString() benchmarks
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-bench/API.hpp"
+using namespace tt3::bench;
+
+//  Every toString() and fromString() specialization, formatting
+//  a typical value and parsing it back. Database objects are
+//  saved and loaded through these, so the ones for QDateTime,
+//  integers, booleans and OIDs matter most.
+namespace
+{
+    template <class T>
+    T sample();
+
+    //  C++ types
+    template <> bool sample<bool>() { return true; }
+    template <> char sample<char>() { return 'x'; }
+    template <> signed char sample<signed char>() { return -12; }
+    template <> unsigned char sample<unsigned char>() { return 234; }
+    template <> signed short sample<signed short>() { return -12345; }
+    template <> unsigned short sample<unsigned short>() { return 54321; }
+    template <> signed int sample<signed int>() { return -1234567890; }
+    template <> unsigned int sample<unsigned int>() { return 3456789012U; }
+    template <> signed long sample<signed long>() { return -1234567890L; }
+    template <> unsigned long sample<unsigned long>() { return 3456789012UL; }
+    template <> signed long long sample<signed long long>() { return -1234567890123456789LL; }
+    template <> unsigned long long sample<unsigned long long>() { return 12345678901234567890ULL; }
+    template <> float sample<float>() { return 3.14159f; }
+    template <> double sample<double>() { return 2.718281828459045; }
+
+    //  QT types
+    template <> QChar sample<QChar>() { return QChar(0x0416); }
+    template <> QString sample<QString>() { return "A \"quoted\" string\twith\\escapes\n"; }
+    template <> QRect sample<QRect>() { return QRect(10, 20, 300, 400); }
+    template <> QVersionNumber sample<QVersionNumber>() { return QVersionNumber(3, 1, 4); }
+    template <> QLocale sample<QLocale>() { return QLocale(QLocale::English, QLocale::UnitedKingdom); }
+    template <> QColor sample<QColor>() { return QColor(12, 34, 56); }
+    template <> QDateTime sample<QDateTime>() { return QDateTime(QDate(2026, 10, 17), QTime(12, 34, 56, 789), QTimeZone::UTC); }
+    template <> QDate sample<QDate>() { return QDate(2026, 10, 17); }
+    template <> Qt::DayOfWeek sample<Qt::DayOfWeek>() { return Qt::Wednesday; }
+    template <> QByteArray sample<QByteArray>() { return QByteArray(64, '\x5A'); }
+
+    //  tt3::util types
+    template <> tt3::util::TimeSpan sample<tt3::util::TimeSpan>() { return tt3::util::TimeSpan::minutes(135); }
+    template <> tt3::util::Mnemonic sample<tt3::util::Mnemonic>() { return tt3::util::Mnemonic("XmlFile"); }
+    template <> tt3::util::ResourceSectionId sample<tt3::util::ResourceSectionId>() { return tt3::util::ResourceSectionId("MainFrame"); }
+    template <> tt3::util::ResourceId sample<tt3::util::ResourceId>() { return tt3::util::ResourceId("Title"); }
+
+    //  tt3::db::api types
+    template <> tt3::db::api::Oid sample<tt3::db::api::Oid>() { return tt3::db::api::Oid::createRandom(); }
+    template <> tt3::db::api::Capabilities sample<tt3::db::api::Capabilities>() { return tt3::db::api::Capability::Administrator | tt3::db::api::Capability::ManageUsers; }
+
+    //  tt3::report::worksummary types
+    template <> tt3::report::worksummary::Scope sample<tt3::report::worksummary::Scope>() { return tt3::report::worksummary::Scope::MultipleUsers; }
+    template <> tt3::report::worksummary::DateRange sample<tt3::report::worksummary::DateRange>() { return tt3::report::worksummary::DateRange::YearToDate; }
+    template <> tt3::report::worksummary::Grouping sample<tt3::report::worksummary::Grouping>() { return tt3::report::worksummary::Grouping::ByActivity; }
+
+    template <class T>
+    void toStringBenchmark(State & state)
+    {
+        const T value = sample<T>();
+
+        for (auto _ : state)
+        {
+            doNotOptimize(tt3::util::toString(value));
+        }
+        state.setItemsProcessed(state.iterations());
+        state.setLabel(tt3::util::toString(value));
+    }
+
+    template <class T>
+    void fromStringBenchmark(State & state)
+    {
+        const QString s = tt3::util::toString(sample<T>());
+        qsizetype scan = 0;
+        tt3::util::fromString<T>(s, scan);  //  may throw
+        if (scan != s.length())
+        {   //  OOPS! Not a round trip
+            state.skipWithError(s + ": not parsed in full");
+        }
+
+        for (auto _ : state)
+        {
+            scan = 0;
+            doNotOptimize(tt3::util::fromString<T>(s, scan));   //  may throw
+        }
+        state.setItemsProcessed(state.iterations());
+        state.setBytesProcessed(state.iterations() * s.length() * qsizetype(sizeof(QChar)));
+    }
+}
+
+#define TT3_STRING_CONVERSION_BENCHMARKS(T)     \
+    [[maybe_unused]] static tt3::bench::Benchmark * TT3_BENCHMARK_CONCAT(_toStringBenchmark, __LINE__) =    \
+        (new tt3::bench::Benchmark("toString<" #T ">", toStringBenchmark<T>));   \
+    [[maybe_unused]] static tt3::bench::Benchmark * TT3_BENCHMARK_CONCAT(_fromStringBenchmark, __LINE__) =  \
+        (new tt3::bench::Benchmark("fromString<" #T ">", fromStringBenchmark<T>))
+
+//  C++ types
+TT3_STRING_CONVERSION_BENCHMARKS(bool);
+TT3_STRING_CONVERSION_BENCHMARKS(char);
+TT3_STRING_CONVERSION_BENCHMARKS(signed char);
+TT3_STRING_CONVERSION_BENCHMARKS(unsigned char);
+TT3_STRING_CONVERSION_BENCHMARKS(signed int);
+TT3_STRING_CONVERSION_BENCHMARKS(unsigned int);
+TT3_STRING_CONVERSION_BENCHMARKS(signed long);
+TT3_STRING_CONVERSION_BENCHMARKS(unsigned long);
+TT3_STRING_CONVERSION_BENCHMARKS(signed long long);
+TT3_STRING_CONVERSION_BENCHMARKS(unsigned long long);
+TT3_STRING_CONVERSION_BENCHMARKS(float);
+TT3_STRING_CONVERSION_BENCHMARKS(double);
+
+//  C++ types that can only be formatted
+static void toStringNullptr(State & state)
+{
+    for (auto _ : state)
+    {
+        doNotOptimize(tt3::util::toString(nullptr));
+    }
+    state.setItemsProcessed(state.iterations());
+}
+TT3_BENCHMARK(toStringNullptr);
+
+static void toStringSignedShort(State & state)
+{
+    toStringBenchmark<signed short>(state);
+}
+TT3_BENCHMARK(toStringSignedShort);
+
+static void toStringUnsignedShort(State & state)
+{
+    toStringBenchmark<unsigned short>(state);
+}
+TT3_BENCHMARK(toStringUnsignedShort);
+
+static void toStringCharPointer(State & state)
+{
+    const char * value = "A C string";
+
+    for (auto _ : state)
+    {
+        doNotOptimize(tt3::util::toString(value));
+    }
+    state.setItemsProcessed(state.iterations());
+}
+TT3_BENCHMARK(toStringCharPointer);
+
+static void toStringVoidPointer(State & state)
+{
+    const void * value = &state;
+
+    for (auto _ : state)
+    {
+        doNotOptimize(tt3::util::toString(value));
+    }
+    state.setItemsProcessed(state.iterations());
+}
+TT3_BENCHMARK(toStringVoidPointer);
+
+//  QT types
+TT3_STRING_CONVERSION_BENCHMARKS(QChar);
+TT3_STRING_CONVERSION_BENCHMARKS(QString);
+TT3_STRING_CONVERSION_BENCHMARKS(QRect);
+TT3_STRING_CONVERSION_BENCHMARKS(QVersionNumber);
+TT3_STRING_CONVERSION_BENCHMARKS(QLocale);
+TT3_STRING_CONVERSION_BENCHMARKS(QColor);
+TT3_STRING_CONVERSION_BENCHMARKS(QDateTime);
+TT3_STRING_CONVERSION_BENCHMARKS(QDate);
+TT3_STRING_CONVERSION_BENCHMARKS(Qt::DayOfWeek);
+TT3_STRING_CONVERSION_BENCHMARKS(QByteArray);
+
+//  tt3::util types
+TT3_STRING_CONVERSION_BENCHMARKS(tt3::util::TimeSpan);
+TT3_STRING_CONVERSION_BENCHMARKS(tt3::util::Mnemonic);
+TT3_STRING_CONVERSION_BENCHMARKS(tt3::util::ResourceSectionId);
+TT3_STRING_CONVERSION_BENCHMARKS(tt3::util::ResourceId);
+
+//  tt3::db::api types
+TT3_STRING_CONVERSION_BENCHMARKS(tt3::db::api::Oid);
+TT3_STRING_CONVERSION_BENCHMARKS(tt3::db::api::Capabilities);
+
+//  tt3::report::worksummary types
+TT3_STRING_CONVERSION_BENCHMARKS(tt3::report::worksummary::Scope);
+TT3_STRING_CONVERSION_BENCHMARKS(tt3::report::worksummary::DateRange);
+TT3_STRING_CONVERSION_BENCHMARKS(tt3::report::worksummary::Grouping);
+
+//  End of tt3-bench/StringConversionBenchmarks.cpp
@@ -0,0 +1,361 @@
+//
+//  tt3-bench/WorkspaceBenchmarks.cpp - workspace benchmarks
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-bench/API.hpp"
+using namespace tt3::bench;
+
+//  Every access check (canRead(), etc.) validates the caller's
+//  credentials. A cached session costs a map lookup plus the
+//  check that its Account and User have not changed since; a
+//  cache miss costs a full login, password hashing included.
+//  The database has 1,000 users; the argument is the number of
+//  distinct credentials the checks rotate through, so that the
+//  runs past the session cache size show the cost of misses.
+namespace
+{
+    const qint64 AccountCount = 1000;
+
+    tt3::ws::Workspace openWorkspace(
+            XmlDatabaseFixture * fixture,
+            tt3::ws::OpenMode openMode
+        )
+    {
+        tt3::ws::WorkspaceType workspaceType =
+            tt3::ws::WorkspaceTypeManager::find(tt3::util::Mnemonic("XmlFile"));
+        Q_ASSERT(workspaceType != nullptr);
+        return workspaceType->openWorkspace(
+            workspaceType->parseWorkspaceAddress(fixture->path()),  //  may throw
+            openMode);  //  may throw
+    }
+
+    tt3::ws::PublicActivity findPublicActivity(
+            tt3::ws::Workspace workspace,
+            const tt3::ws::Credentials & credentials
+        )
+    {
+        for (auto publicActivity : workspace->publicActivities(credentials))   //  may throw
+        {
+            if (publicActivity->displayName(credentials) == XmlDatabaseFixture::ActivityName)  //  may throw
+            {
+                return publicActivity;
+            }
+        }
+        return nullptr;
+    }
+
+    tt3::ws::Credentials credentials(qint64 index)
+    {
+        return tt3::ws::Credentials(XmlDatabaseFixture::login(index), XmlDatabaseFixture::Password);
+    }
+}
+
+static void workspaceCanRead(State & state)
+{
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(AccountCount, 0);  //  may throw
+    tt3::ws::Workspace workspace = openWorkspace(fixture, tt3::ws::OpenMode::ReadOnly); //  may throw
+    tt3::ws::PublicActivity publicActivity = findPublicActivity(workspace, credentials(0)); //  may throw
+    if (publicActivity == nullptr)
+    {   //  OOPS!
+        state.skipWithError(XmlDatabaseFixture::ActivityName + ": not found");
+    }
+    QList<tt3::ws::Credentials> credentialsList;
+    for (qint64 i = 0; i < state.range(0); i++)
+    {
+        credentialsList.append(credentials(i));
+    }
+
+    qsizetype index = 0;
+    for (auto _ : state)
+    {
+        doNotOptimize(publicActivity->canRead(credentialsList[index])); //  may throw
+        index = (index + 1) % credentialsList.size();
+    }
+    state.setItemsProcessed(state.iterations());
+    workspace->close();
+}
+TT3_BENCHMARK(workspaceCanRead)->arg(1)->arg(64)->arg(256)->arg(257)->arg(1000);
+
+static void workspaceCanReadBadCredentials(State & state)
+{   //  Cached as bad until the database changes
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(AccountCount, 0);  //  may throw
+    tt3::ws::Workspace workspace = openWorkspace(fixture, tt3::ws::OpenMode::ReadOnly); //  may throw
+    tt3::ws::PublicActivity publicActivity = findPublicActivity(workspace, credentials(0)); //  may throw
+    if (publicActivity == nullptr)
+    {   //  OOPS!
+        state.skipWithError(XmlDatabaseFixture::ActivityName + ": not found");
+    }
+    tt3::ws::Credentials badCredentials(XmlDatabaseFixture::login(0), "wrong password");
+
+    for (auto _ : state)
+    {
+        doNotOptimize(publicActivity->canRead(badCredentials)); //  may throw
+    }
+    state.setItemsProcessed(state.iterations());
+    workspace->close();
+}
+TT3_BENCHMARK(workspaceCanReadBadCredentials);
+
+static void workspaceCanReadReportCredentials(State & state)
+{   //  Report credentials bypass the session cache
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(AccountCount, 0);  //  may throw
+    tt3::ws::Workspace workspace = openWorkspace(fixture, tt3::ws::OpenMode::ReadOnly); //  may throw
+    tt3::ws::PublicActivity publicActivity = findPublicActivity(workspace, credentials(0)); //  may throw
+    if (publicActivity == nullptr)
+    {   //  OOPS!
+        state.skipWithError(XmlDatabaseFixture::ActivityName + ": not found");
+    }
+    tt3::ws::ReportCredentials reportCredentials =
+        workspace->beginReport(credentials(0), 60 * 60 * 1000);    //  may throw
+
+    for (auto _ : state)
+    {
+        doNotOptimize(publicActivity->canRead(reportCredentials));  //  may throw
+    }
+    state.setItemsProcessed(state.iterations());
+    workspace->releaseCredentials(reportCredentials);   //  may throw
+    workspace->close();
+}
+TT3_BENCHMARK(workspaceCanReadReportCredentials);
+
+static void workspaceCanReadAfterUserChange(State & state)
+{   //  Every change to the User makes its session stale
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(AccountCount, 0);  //  may throw
+    tt3::ws::Workspace workspace = openWorkspace(fixture, tt3::ws::OpenMode::ReadWrite);    //  may throw
+    tt3::ws::PublicActivity publicActivity = findPublicActivity(workspace, credentials(0)); //  may throw
+    if (publicActivity == nullptr)
+    {   //  OOPS!
+        state.skipWithError(XmlDatabaseFixture::ActivityName + ": not found");
+    }
+    tt3::ws::Credentials adminCredentials = credentials(0);
+    tt3::ws::Credentials userCredentials = credentials(1);
+    tt3::ws::User user =
+        workspace->findAccount(adminCredentials, XmlDatabaseFixture::login(1))  //  may throw
+            ->user(adminCredentials);   //  may throw
+    QString realName = user->realName(adminCredentials);    //  may throw
+
+    int changeNumber = 0;
+    for (auto _ : state)
+    {
+        state.pauseTiming();
+        user->setRealName(adminCredentials, realName + " " + QString::number(++changeNumber));  //  may throw
+        state.resumeTiming();
+        doNotOptimize(publicActivity->canRead(userCredentials));    //  may throw
+    }
+    state.setItemsProcessed(state.iterations());
+    user->setRealName(adminCredentials, realName);  //  may throw
+    workspace->close();
+}
+TT3_BENCHMARK(workspaceCanReadAfterUserChange);
+
+//  Report generation, backup and the GUI refresh timer all
+//  only read the workspace, so they should proceed in parallel
+//  instead of taking turns. Each of them is timed alone, then
+//  all three at once on separate threads; if they do not
+//  contend, the latter takes about as long as the slowest of
+//  the former rather than as long as all of them together.
+//  The database has 100 users; the argument is the number of
+//  works, spread evenly over their accounts.
+namespace
+{
+    const qint64 ContentionAccountCount = 100;
+
+    class ReadJobs final
+    {
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ReadJobs)
+
+    public:
+        explicit ReadJobs(XmlDatabaseFixture * fixture)
+            :   _workspace(openWorkspace(fixture, tt3::ws::OpenMode::ReadOnly)),  //  may throw
+                _credentials(credentials(0)),
+                _reportCredentials(_workspace->beginReport(_credentials, 60 * 60 * 1000)),  //  may throw
+                _backupCredentials(_workspace->beginBackup(_credentials, 60 * 60 * 1000))   //  may throw
+        {
+        }
+
+        ~ReadJobs()
+        {
+            try
+            {
+                _workspace->releaseCredentials(_backupCredentials);   //  may throw
+                _workspace->releaseCredentials(_reportCredentials);   //  may throw
+                _workspace->close();    //  may throw
+            }
+            catch (const tt3::util::Exception & ex)
+            {   //  OOPS! Log & suppress
+                qCritical() << ex;
+            }
+        }
+
+        //  Like a work summary report - Work snapshots of all Accounts
+        qint64      report() const
+        {
+            const QDateTime from(QDate(2000, 1, 1), QTime(0, 0), QTimeZone::UTC);
+            const QDateTime to(QDate(2100, 1, 1), QTime(0, 0), QTimeZone::UTC);
+            qint64 result = 0;
+            for (auto user : _workspace->users(_reportCredentials))    //  may throw
+            {
+                for (auto account : user->accounts(_reportCredentials))    //  may throw
+                {
+                    result += account->workRecords(_reportCredentials, from, to).size(); //  may throw
+                }
+            }
+            return result;
+        }
+
+        //  Like the backup writer - every property of every object
+        qint64      backup() const
+        {
+            qint64 result = 0;
+            for (auto user : _workspace->users(_backupCredentials))    //  may throw
+            {
+                result += user->realName(_backupCredentials).size();   //  may throw
+                for (auto account : user->accounts(_backupCredentials))    //  may throw
+                {
+                    result += account->login(_backupCredentials).size();   //  may throw
+                    result += account->passwordHash(_backupCredentials).size();    //  may throw
+                    for (auto work : account->works(_backupCredentials))   //  may throw
+                    {
+                        result += work->startedAt(_backupCredentials).toSecsSinceEpoch();  //  may throw
+                        result += work->finishedAt(_backupCredentials).toSecsSinceEpoch(); //  may throw
+                        result += (work->activity(_backupCredentials) != nullptr);  //  may throw
+                    }
+                }
+            }
+            return result;
+        }
+
+        //  Like the managers' refresh - the visible objects, many times
+        qint64      refresh() const
+        {
+            qint64 result = 0;
+            for (int i = 0; i < 100; i++)
+            {
+                for (auto user : _workspace->users(_credentials))  //  may throw
+                {
+                    result += user->realName(_credentials).size(); //  may throw
+                    for (auto account : user->accounts(_credentials))  //  may throw
+                    {
+                        result += account->login(_credentials).size(); //  may throw
+                    }
+                }
+                for (auto publicActivity : _workspace->publicActivities(_credentials)) //  may throw
+                {
+                    result += publicActivity->displayName(_credentials).size();    //  may throw
+                }
+            }
+            return result;
+        }
+
+    private:
+        tt3::ws::Workspace          _workspace;
+        tt3::ws::Credentials        _credentials;
+        tt3::ws::ReportCredentials  _reportCredentials;
+        tt3::ws::BackupCredentials  _backupCredentials;
+    };
+
+    //  Runs the jobs on separate threads; returns the first
+    //  error message or an empty string if all succeed
+    QString runConcurrently(const QList<std::function<qint64()>> & jobs)
+    {
+        QMutex errorGuard;
+        QString errorMessage;
+        std::vector<std::thread> threads;
+        for (const auto & job : jobs)
+        {
+            threads.emplace_back(
+                [&]()
+                {
+                    try
+                    {
+                        doNotOptimize(job());
+                    }
+                    catch (const tt3::util::Exception & ex)
+                    {
+                        QMutexLocker lock(&errorGuard);
+                        if (errorMessage.isEmpty())
+                        {
+                            errorMessage = ex.errorMessage();
+                        }
+                    }
+                });
+        }
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+        return errorMessage;
+    }
+}
+
+static void workspaceReportReads(State & state)
+{
+    ReadJobs jobs(XmlDatabaseFixture::shared(ContentionAccountCount, state.range(0)));  //  may throw
+
+    for (auto _ : state)
+    {
+        doNotOptimize(jobs.report());   //  may throw
+    }
+    state.setItemsProcessed(state.iterations() * state.range(0));
+}
+TT3_BENCHMARK(workspaceReportReads)->arg(100000);
+
+static void workspaceBackupReads(State & state)
+{
+    ReadJobs jobs(XmlDatabaseFixture::shared(ContentionAccountCount, state.range(0)));  //  may throw
+
+    for (auto _ : state)
+    {
+        doNotOptimize(jobs.backup());   //  may throw
+    }
+    state.setItemsProcessed(state.iterations() * state.range(0));
+}
+TT3_BENCHMARK(workspaceBackupReads)->arg(100000);
+
+static void workspaceRefreshReads(State & state)
+{
+    ReadJobs jobs(XmlDatabaseFixture::shared(ContentionAccountCount, state.range(0)));  //  may throw
+
+    for (auto _ : state)
+    {
+        doNotOptimize(jobs.refresh());  //  may throw
+    }
+}
+TT3_BENCHMARK(workspaceRefreshReads)->arg(100000);
+
+static void workspaceConcurrentReads(State & state)
+{
+    ReadJobs jobs(XmlDatabaseFixture::shared(ContentionAccountCount, state.range(0)));  //  may throw
+
+    for (auto _ : state)
+    {
+        QString errorMessage =
+            runConcurrently(
+                {
+                    [&]() { return jobs.report(); },
+                    [&]() { return jobs.backup(); },
+                    [&]() { return jobs.refresh(); }
+                });
+        if (!errorMessage.isEmpty())
+        {   //  OOPS!
+            state.skipWithError(errorMessage);
+            break;
+        }
+    }
+    state.setCounter("Threads", 3);
+}
+TT3_BENCHMARK(workspaceConcurrentReads)->arg(100000);
+
+//  End of tt3-bench/WorkspaceBenchmarks.cpp
@@ -0,0 +1,273 @@
+//
+//  tt3-bench/XmlDatabaseBenchmarks.cpp - XML database benchmarks
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-bench/API.hpp"
+using namespace tt3::bench;
+
+//  The XML database used to be loaded into (and saved from) a
+//  DOM; that code is gone, so the "Dom" benchmarks below time
+//  what it could not do without - parsing the file into a DOM
+//  and keeping an element per object for association resolution
+//  on load, building a DOM as large as the file and writing it
+//  on save. They are therefore lower bounds for the DOM path,
+//  while the "Streaming" benchmarks time the real thing.
+//  The argument is the number of works in the database.
+namespace
+{
+    void collectObjectElements(
+            const QDomElement & parentElement,
+            QHash<QString, QDomElement> & objectElements
+        )
+    {
+        for (QDomElement element = parentElement.firstChildElement();
+             !element.isNull();
+             element = element.nextSiblingElement())
+        {
+            if (element.hasAttribute("OID"))
+            {
+                objectElements.insert(element.attribute("OID"), element);
+            }
+            collectObjectElements(element, objectElements);
+        }
+    }
+
+    std::unique_ptr<tt3::db::api::IDatabase> openDatabase(
+            XmlDatabaseFixture * fixture,
+            tt3::db::api::OpenMode openMode
+        )
+    {
+        return std::unique_ptr<tt3::db::api::IDatabase>
+            { tt3::db::xml::DatabaseType::instance()->openDatabase(fixture->address(), openMode) };  //  may throw
+    }
+
+    void reportThroughput(State & state, XmlDatabaseFixture * fixture)
+    {
+        state.setItemsProcessed(state.iterations() * state.range(0));
+        state.setBytesProcessed(state.iterations() * QFileInfo(fixture->path()).size());
+    }
+}
+
+static void xmlDatabaseLoadStreaming(State & state)
+{
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(1, state.range(0));  //  may throw
+    PeakMemoryMeter peakMemoryMeter;
+
+    for (auto _ : state)
+    {
+        peakMemoryMeter.start();
+        auto database = openDatabase(fixture, tt3::db::api::OpenMode::ReadOnly);   //  may throw
+        doNotOptimize(database->objectCount());
+        database->close();
+        database.reset();
+        peakMemoryMeter.stop();
+    }
+    peakMemoryMeter.report(state);
+    reportThroughput(state, fixture);
+}
+TT3_BENCHMARK(xmlDatabaseLoadStreaming)->arg(100000)->arg(1000000);
+
+static void xmlDatabaseLoadDom(State & state)
+{
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(1, state.range(0));  //  may throw
+    PeakMemoryMeter peakMemoryMeter;
+
+    for (auto _ : state)
+    {
+        peakMemoryMeter.start();
+        QFile file(fixture->path());
+        QDomDocument document;
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text) ||
+            !document.setContent(&file))
+        {   //  OOPS!
+            state.skipWithError(fixture->path() + ": cannot parse");
+            break;
+        }
+        QHash<QString, QDomElement> objectElements;
+        collectObjectElements(document.documentElement(), objectElements);
+        doNotOptimize(objectElements.size());
+        objectElements.clear();
+        document.clear();
+        peakMemoryMeter.stop();
+    }
+    peakMemoryMeter.report(state);
+    reportThroughput(state, fixture);
+}
+TT3_BENCHMARK(xmlDatabaseLoadDom)->arg(100000)->arg(1000000);
+
+static void xmlDatabaseSaveStreaming(State & state)
+{
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(1, state.range(0));  //  may throw
+    PeakMemoryMeter peakMemoryMeter;
+    int saveNumber = 0;
+
+    for (auto _ : state)
+    {
+        state.pauseTiming();
+        auto database = openDatabase(fixture, tt3::db::api::OpenMode::ReadWrite);  //  may throw
+        //  Any change makes close() re-write the whole file
+        database->findPublicActivity(XmlDatabaseFixture::ActivityName)
+            ->setDescription("Save " + QString::number(++saveNumber));    //  may throw
+        peakMemoryMeter.start();
+        state.resumeTiming();
+        database->close();
+        state.pauseTiming();
+        peakMemoryMeter.stop();
+        database.reset();
+        state.resumeTiming();
+    }
+    peakMemoryMeter.report(state);
+    reportThroughput(state, fixture);
+}
+TT3_BENCHMARK(xmlDatabaseSaveStreaming)->arg(100000)->arg(1000000);
+
+static void xmlDatabaseSaveDom(State & state)
+{
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(1, state.range(0));  //  may throw
+    PeakMemoryMeter peakMemoryMeter;
+
+    QFile file(fixture->path());
+    QDomDocument sourceDocument;
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text) ||
+        !sourceDocument.setContent(&file))
+    {   //  OOPS!
+        state.skipWithError(fixture->path() + ": cannot parse");
+    }
+    file.close();
+
+    for (auto _ : state)
+    {
+        peakMemoryMeter.start();
+        //  Deep-copying allocates as many nodes as building
+        //  the DOM from the objects did
+        QDomDocument document = sourceDocument.cloneNode(true).toDocument();
+        QFile newFile(fixture->path() + ".new");
+        if (!newFile.open(QIODevice::WriteOnly | QIODevice::Text) ||
+            newFile.write(document.toByteArray(4)) < 0)
+        {   //  OOPS!
+            state.skipWithError(newFile.fileName() + ": " + newFile.errorString());
+            break;
+        }
+        newFile.close();
+        document.clear();
+        peakMemoryMeter.stop();
+    }
+    QFile::remove(fixture->path() + ".new");
+    peakMemoryMeter.report(state);
+    reportThroughput(state, fixture);
+}
+TT3_BENCHMARK(xmlDatabaseSaveDom)->arg(100000)->arg(1000000);
+
+//  Lookups go through hash indexes, so their cost should not
+//  grow with the database. The argument is the number of
+//  users, each with an account, so there are twice as many
+//  objects; keys are looked up in a random order, so that
+//  the benchmark does not just hit the same cache lines.
+namespace
+{
+    template <class T>
+    QList<T> shuffled(QList<T> list)
+    {
+        std::mt19937 generator(12345);  //  repeatable
+        std::shuffle(list.begin(), list.end(), generator);
+        return list;
+    }
+}
+
+static void xmlDatabaseFindObjectByOid(State & state)
+{
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(state.range(0), 0);  //  may throw
+    auto database = openDatabase(fixture, tt3::db::api::OpenMode::ReadOnly);   //  may throw
+    QList<tt3::db::api::Oid> oids;
+    for (auto account : database->accounts())
+    {
+        oids.append(account->oid());
+    }
+    oids = shuffled(oids);
+
+    qsizetype index = 0;
+    for (auto _ : state)
+    {
+        doNotOptimize(database->findObjectByOid(oids[index]));
+        index = (index + 1) % oids.size();
+    }
+    state.setItemsProcessed(state.iterations());
+    state.setCounter("Objects", double(database->objectCount()));
+    database->close();
+}
+TT3_BENCHMARK(xmlDatabaseFindObjectByOid)->range(1000, 100000);
+
+static void xmlDatabaseFindAccount(State & state)
+{
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(state.range(0), 0);  //  may throw
+    auto database = openDatabase(fixture, tt3::db::api::OpenMode::ReadOnly);   //  may throw
+    QStringList logins;
+    for (qint64 i = 0; i < state.range(0); i++)
+    {
+        logins.append(XmlDatabaseFixture::login(i));
+    }
+    logins = shuffled(logins);
+
+    qsizetype index = 0;
+    for (auto _ : state)
+    {
+        doNotOptimize(database->findAccount(logins[index]));
+        index = (index + 1) % logins.size();
+    }
+    state.setItemsProcessed(state.iterations());
+    state.setCounter("Objects", double(database->objectCount()));
+    database->close();
+}
+TT3_BENCHMARK(xmlDatabaseFindAccount)->range(1000, 100000);
+
+static void xmlDatabaseFindPublicActivity(State & state)
+{
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(state.range(0), 0);  //  may throw
+    auto database = openDatabase(fixture, tt3::db::api::OpenMode::ReadOnly);   //  may throw
+
+    for (auto _ : state)
+    {
+        doNotOptimize(database->findPublicActivity(XmlDatabaseFixture::ActivityName));
+    }
+    state.setItemsProcessed(state.iterations());
+    state.setCounter("Objects", double(database->objectCount()));
+    database->close();
+}
+TT3_BENCHMARK(xmlDatabaseFindPublicActivity)->range(1000, 100000);
+
+static void xmlDatabaseTryLogin(State & state)
+{   //  Includes hashing the password
+    XmlDatabaseFixture * fixture = XmlDatabaseFixture::shared(state.range(0), 0);  //  may throw
+    auto database = openDatabase(fixture, tt3::db::api::OpenMode::ReadOnly);   //  may throw
+    QStringList logins;
+    for (qint64 i = 0; i < state.range(0); i++)
+    {
+        logins.append(XmlDatabaseFixture::login(i));
+    }
+    logins = shuffled(logins);
+
+    qsizetype index = 0;
+    for (auto _ : state)
+    {
+        doNotOptimize(database->tryLogin(logins[index], XmlDatabaseFixture::Password));
+        index = (index + 1) % logins.size();
+    }
+    state.setItemsProcessed(state.iterations());
+    state.setCounter("Objects", double(database->objectCount()));
+    database->close();
+}
+TT3_BENCHMARK(xmlDatabaseTryLogin)->range(1000, 100000);
+
+//  End of tt3-bench/XmlDatabaseBenchmarks.cpp
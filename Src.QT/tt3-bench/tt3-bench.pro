@@ -0,0 +1,31 @@
+include(../tt3.pri)
+
+CONFIG += console
+
+SOURCES += \
+    Benchmark.cpp \
+    ChangeNotifierBenchmarks.cpp \
+    Fixtures.cpp \
+    Main.cpp \
+    MessageDigestBenchmarks.cpp \
+    OidBenchmarks.cpp \
+    ResourceBenchmarks.cpp \
+    StringConversionBenchmarks.cpp \
+    WorkspaceBenchmarks.cpp \
+    XmlDatabaseBenchmarks.cpp
+
+HEADERS += \
+    API.hpp \
+    Benchmark.hpp \
+    Fixtures.hpp
+
+PRECOMPILED_HEADER = API.hpp
+
+LIBS += \
+    -ltt3-report-worksummary$$TARGET_SUFFIX \
+    -ltt3-report$$TARGET_SUFFIX \
+    -ltt3-gui$$TARGET_SUFFIX \
+    -ltt3-ws$$TARGET_SUFFIX \
+    -ltt3-db-xml$$TARGET_SUFFIX \
+    -ltt3-db-api$$TARGET_SUFFIX \
+    -ltt3-util$$TARGET_SUFFIX
@@ -55,40 +55,75 @@ void ChangeNotifier::post(ChangeNotification * notification)
 void ChangeNotifier::_WorkerThread::run()
 {
     //  Go!
-    for (; ; )
+    QList<ChangeNotification*> changeNotifications;
+    for (bool stopRequested = false; !stopRequested; )
     {
-        ChangeNotification * changeNotification = nullptr;
-        if (_changeNotifier->_pendingNotifications.tryDequeue(changeNotification, WaitChunkMs))
-        {   //  Handle the pending notification
+        changeNotifications.clear();
+        if (!_changeNotifier->_pendingNotifications.tryDequeueAll(changeNotifications, WaitChunkMs))
+        {   //  Nothing pending
+            continue;
+        }
+        //  Build the batch from all pending notifications,
+        //  reporting each modified object only once
+        ChangeNotificationBatch batch;
+        QSet<QPair<IDatabase*, Oid>> modifiedObjects;
+        for (ChangeNotification * changeNotification : std::as_const(changeNotifications))
+        {
             if (changeNotification == nullptr)
-            {   //  Thread stop requested
-                break;
-            }
-            if (auto databaseClosed =
-                dynamic_cast<DatabaseClosedNotification *>(changeNotification))
-            {
-                emit _changeNotifier->databaseClosed(*databaseClosed);
-            }
-            else if (auto objectCreated =
-                     dynamic_cast<ObjectCreatedNotification *>(changeNotification))
-            {
-                emit _changeNotifier->objectCreated(*objectCreated);
+            {   //  Thread stop requested, but still deliver the
+                //  notifications that were posted before
+                stopRequested = true;
+                continue;
             }
-            else if (auto objectDestroyed =
-                     dynamic_cast<ObjectDestroyedNotification *>(changeNotification))
+            std::shared_ptr<const ChangeNotification> notification(changeNotification);
+            if (notification->kind() == ChangeNotification::Kind::ObjectModified)
             {
-                emit _changeNotifier->objectDestroyed(*objectDestroyed);
+                auto objectModified =
+                    static_cast<const ObjectModifiedNotification *>(changeNotification);
+                auto modifiedObject =
+                    qMakePair(objectModified->database(), objectModified->oid());
+                if (modifiedObjects.contains(modifiedObject))
+                {   //  Already reported in this batch
+                    continue;
+                }
+                modifiedObjects.insert(modifiedObject);
             }
-            else if (auto objectModified =
-                     dynamic_cast<ObjectModifiedNotification *>(changeNotification))
-            {
-                emit _changeNotifier->objectModified(*objectModified);
-            }
-            else
+            batch._notifications.append(notification);
+        }
+        //  Deliver the batch - one notification at a time...
+        for (const auto & notification : std::as_const(batch._notifications))
+        {
+            switch (notification->kind())
             {
-                Q_ASSERT(false);
+                case ChangeNotification::Kind::DatabaseClosed:
+                    emit _changeNotifier->databaseClosed(
+                        static_cast<const DatabaseClosedNotification &>(*notification));
+                    break;
+                case ChangeNotification::Kind::DatabaseReloaded:
+                    emit _changeNotifier->databaseReloaded(
+                        static_cast<const DatabaseReloadedNotification &>(*notification));
+                    break;
+                case ChangeNotification::Kind::ObjectCreated:
+                    emit _changeNotifier->objectCreated(
+                        static_cast<const ObjectCreatedNotification &>(*notification));
+                    break;
+                case ChangeNotification::Kind::ObjectDestroyed:
+                    emit _changeNotifier->objectDestroyed(
+                        static_cast<const ObjectDestroyedNotification &>(*notification));
+                    break;
+                case ChangeNotification::Kind::ObjectModified:
+                    emit _changeNotifier->objectModified(
+                        static_cast<const ObjectModifiedNotification &>(*notification));
+                    break;
+                default:
+                    Q_ASSERT(false);
+                    break;
             }
-            delete changeNotification;
+        }
+        //  ...and as a whole
+        if (!batch.isEmpty())
+        {
+            emit _changeNotifier->changesCommitted(batch);
         }
     }
 }
@@ -61,6 +61,14 @@ Component::ISubsystem * Component::subsystem() const
     return tt3::util::StandardSubsystems::Storage::instance();
 }
 
+Component::Mnemonics Component::dependencies() const
+{
+    return Mnemonics
+        {
+            M(tt3-util)
+        };
+}
+
 Component::Resources * Component::resources() const
 {
     return Resources::instance();
@@ -80,9 +88,11 @@ void Component::initialize()
 {
     qRegisterMetaType<ChangeNotification>();
     qRegisterMetaType<DatabaseClosedNotification>();
+    qRegisterMetaType<DatabaseReloadedNotification>();
     qRegisterMetaType<ObjectCreatedNotification>();
     qRegisterMetaType<ObjectDestroyedNotification>();
     qRegisterMetaType<ObjectModifiedNotification>();
+    qRegisterMetaType<ChangeNotificationBatch>();
 }
 
 void Component::deinitialize()
@@ -90,6 +90,15 @@ namespace tt3::db::api
         ///     If an error occurs.
         virtual void    refresh() = 0;
 
+        /// \brief
+        ///     Performs a full consistency check of this database.
+        /// \details
+        ///     Databases may check changes as they are made, but
+        ///     only a full check covers the objects they did not touch.
+        /// \exception DatabaseException
+        ///     If the database is closed or found to be inconsistent.
+        virtual void    validate() = 0;
+
         //////////
         //  Operations (associations)
     public:
@@ -529,6 +538,150 @@ namespace tt3::db::api
                                 unsigned long timeoutMs = ULONG_MAX
                             ) -> IDatabaseLock * = 0;
 
+        //////////
+        //  Operations (bulk loading)
+    public:
+        /// \brief
+        ///     Starts a bulk-load session on this database.
+        /// \details
+        ///     While a bulk-load session is underway, objects
+        ///     can be created with the OIDs supplied by the caller
+        ///     (see setBulkLoadOid()), validation is deferred until
+        ///     the session ends and no per-object change notifications
+        ///     are issued; instead, a single DatabaseReloadedNotification
+        ///     is issued when the session ends.
+        ///     Bulk-load sessions are meant for restoring a database
+        ///     from a backup and cannot be nested.
+        /// \exception DatabaseException
+        ///     If an error occurs.
+        virtual void    beginBulkLoad() = 0;
+
+        /// \brief
+        ///     Ends the bulk-load session underway on this database.
+        /// \details
+        ///     Validates everything loaded during the session, then
+        ///     issues a DatabaseReloadedNotification. The session is
+        ///     ended even if the validation fails.
+        ///     Has no effect if no bulk-load session is underway.
+        /// \exception DatabaseException
+        ///     If an error occurs.
+        virtual void    endBulkLoad() = 0;
+
+        /// \brief
+        ///     Checks whether a bulk-load session is underway
+        ///     on this database.
+        /// \return
+        ///     True if a bulk-load session is underway on
+        ///     this database, else false.
+        virtual bool    isBulkLoading() const = 0;
+
+        /// \brief
+        ///     Specifies the OID to assign to the next object
+        ///     created in this database during a bulk-load session.
+        /// \param oid
+        ///     The OID to assign to the next object created.
+        /// \exception DatabaseException
+        ///     If no bulk-load session is underway, or the OID
+        ///     is invalid or already in use, or another error occurs.
+        virtual void    setBulkLoadOid(
+                                const Oid & oid
+                            ) = 0;
+
+        //////////
+        //  Operations (change tracking)
+    public:
+        /// \brief
+        ///     Returns the latest modification stamp issued
+        ///     by this database.
+        /// \details
+        ///     Every change to a database object (its creation,
+        ///     modification or destruction) is given the next
+        ///     stamp from an ever-increasing sequence kept by the
+        ///     database, so the changes made after some point in
+        ///     time are those with stamps exceeding the value this
+        ///     method returned at that time.
+        /// \return
+        ///     The latest modification stamp issued by this
+        ///     database; 0 if none.
+        /// \exception DatabaseException
+        ///     If an error occurs.
+        virtual quint64 modificationStamp() const = 0;
+
+        /// \brief
+        ///     Returns the OIDs of all live objects created or
+        ///     modified since the specified modification stamp.
+        /// \param modificationStamp
+        ///     The modification stamp to look after.
+        /// \return
+        ///     The OIDs of all live objects whose modification
+        ///     stamps exceed "modificationStamp".
+        /// \exception DatabaseException
+        ///     If an error occurs.
+        virtual auto    modifiedOidsSince(
+                                quint64 modificationStamp
+                            ) const -> Oids = 0;
+
+        /// \brief
+        ///     Returns the OIDs of all objects destroyed (or
+        ///     given different OIDs) since the specified
+        ///     modification stamp.
+        /// \param modificationStamp
+        ///     The modification stamp to look after.
+        /// \return
+        ///     The OIDs that have ceased to belong to live
+        ///     objects after "modificationStamp" was issued.
+        /// \exception DatabaseException
+        ///     If an error occurs.
+        virtual auto    destroyedOidsSince(
+                                quint64 modificationStamp
+                            ) const -> Oids = 0;
+
+        /// \brief
+        ///     Returns the UUID that identifies this database.
+        /// \details
+        ///     The UUID is generated when the database is created
+        ///     and never changes after that, so modification stamps
+        ///     issued by two databases are only comparable if their
+        ///     instance IDs are the same.
+        /// \return
+        ///     The UUID that identifies this database.
+        /// \exception DatabaseException
+        ///     If an error occurs.
+        virtual QUuid   instanceId() const = 0;
+
+        /// \brief
+        ///     Records that a full backup of this database has
+        ///     been taken, and forgets what is no longer needed
+        ///     for writing delta backups.
+        /// \details
+        ///     Delta backups are written against the latest full
+        ///     backup, the one before it, or deltas since. The OIDs
+        ///     of objects destroyed before the full backup before
+        ///     the latest one are therefore no longer needed, and
+        ///     are forgotten here.
+        /// \param modificationStamp
+        ///     The modification stamp the full backup was taken at;
+        ///     stamps not exceeding that of the latest recorded full
+        ///     backup, or not yet issued, are ignored.
+        /// \exception DatabaseException
+        ///     If an error occurs.
+        virtual void    recordFullBackup(
+                                quint64 modificationStamp
+                            ) = 0;
+
+        /// \brief
+        ///     Returns the oldest modification stamp that a delta
+        ///     backup can be written against.
+        /// \details
+        ///     destroyedOidsSince() only reports all destroyed
+        ///     objects for this and later modification stamps.
+        /// \return
+        ///     The oldest modification stamp that a delta backup
+        ///     can be written against; 0 == any.
+        /// \exception DatabaseException
+        ///     If an error occurs.
+        virtual quint64 oldestBaseModificationStamp() const = 0;
+
         //////////
         //  Operations (change notification handling)
     public:
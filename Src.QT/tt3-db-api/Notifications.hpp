@@ -25,6 +25,21 @@ namespace tt3::db::api
     ///     change notifications.
     class TT3_DB_API_PUBLIC ChangeNotification
     {
+        //////////
+        //  Types
+    public:
+        /// \brief
+        ///     The kind of a change notification, which
+        ///     also determines its concrete class.
+        enum class Kind
+        {
+            DatabaseClosed, ///< A DatabaseClosedNotification.
+            DatabaseReloaded,   ///< A DatabaseReloadedNotification.
+            ObjectCreated,  ///< An ObjectCreatedNotification.
+            ObjectDestroyed,///< An ObjectDestroyedNotification.
+            ObjectModified  ///< An ObjectModifiedNotification.
+        };
+
         //////////
         //  Construction/destruction/assignment
     protected:
@@ -32,8 +47,10 @@ namespace tt3::db::api
         ///     Constructs the change notification.
         /// \param db
         ///     The database where the change has occurred.
-        ChangeNotification(IDatabase * db)
-            :   _database(db) { Q_ASSERT(_database != nullptr); }
+        /// \param kind
+        ///     The kind of the change notification.
+        ChangeNotification(IDatabase * db, Kind kind)
+            :   _database(db), _kind(kind) { Q_ASSERT(_database != nullptr); }
     public:
         /// \brief
         ///     The dfault [empty] destructor.
@@ -50,10 +67,20 @@ namespace tt3::db::api
         ///     The database where the change has occurred
         IDatabase *     database() const { return _database; }
 
+        /// \brief
+        ///     Returns the kind of this change notification.
+        /// \details
+        ///     Use this rather than dynamic_cast to find out
+        ///     the concrete class of a notification.
+        /// \return
+        ///     The kind of this change notification.
+        Kind            kind() const { return _kind; }
+
         //////////
         //  Implementation
     private:
         IDatabase *     _database;
+        Kind            _kind;
     };
 
     /// \class DatabaseClosedNotification tt3-db-api/API.hpp
@@ -69,7 +96,31 @@ namespace tt3::db::api
         /// \param db
         ///     The database that has been closed.
         DatabaseClosedNotification(IDatabase * db)
-            :   ChangeNotification(db) {}
+            :   ChangeNotification(db, Kind::DatabaseClosed) {}
+
+        //  Default copy-constructor and assigmnent are OK
+    };
+
+    /// \class DatabaseReloadedNotification tt3-db-api/API.hpp
+    /// \brief
+    ///     Issued after the contents of a database have
+    ///     changed wholesale (e.g. at the end of a bulk load).
+    /// \details
+    ///     No per-object notifications are issued for such
+    ///     changes; anyone caching database objects or data
+    ///     derived from them should drop these caches.
+    class TT3_DB_API_PUBLIC DatabaseReloadedNotification
+        :   public ChangeNotification
+    {
+        //////////
+        //  Construction/destruction/assignment
+    public:
+        /// \brief
+        ///     Constructs the change notification.
+        /// \param db
+        ///     The database that has been reloaded.
+        DatabaseReloadedNotification(IDatabase * db)
+            :   ChangeNotification(db, Kind::DatabaseReloaded) {}
 
         //  Default copy-constructor and assigmnent are OK
     };
@@ -91,7 +142,7 @@ namespace tt3::db::api
         /// \param oid
         ///     The OID of the newly created object.
         ObjectCreatedNotification(IDatabase * db, IObjectType * objectType, const Oid & oid)
-            :   ChangeNotification(db), _objectType(objectType), _oid(oid)
+            :   ChangeNotification(db, Kind::ObjectCreated), _objectType(objectType), _oid(oid)
         { Q_ASSERT(_objectType != nullptr && _oid != Oid::Invalid); }
 
         //  Default copy-constructor and assigmnent are OK
@@ -135,7 +186,7 @@ namespace tt3::db::api
         /// \param oid
         ///     The OID of the destroyed object.
         ObjectDestroyedNotification(IDatabase * db, IObjectType * objectType, const Oid & oid)
-            :   ChangeNotification(db), _objectType(objectType), _oid(oid)
+            :   ChangeNotification(db, Kind::ObjectDestroyed), _objectType(objectType), _oid(oid)
         { Q_ASSERT(_objectType != nullptr && _oid != Oid::Invalid); }
 
         //  Default copy-constructor and assigmnent are OK
@@ -183,7 +234,7 @@ namespace tt3::db::api
         /// \param oid
         ///     The OID of the modified object.
         ObjectModifiedNotification(IDatabase * db, IObjectType * objectType, const Oid & oid)
-            :   ChangeNotification(db), _objectType(objectType), _oid(oid)
+            :   ChangeNotification(db, Kind::ObjectModified), _objectType(objectType), _oid(oid)
         { Q_ASSERT(_objectType != nullptr && _oid != Oid::Invalid); }
 
         //  Default copy-constructor and assigmnent are OK
@@ -210,6 +261,68 @@ namespace tt3::db::api
         Oid             _oid;
     };
 
+    /// \class ChangeNotificationBatch tt3-db-api/API.hpp
+    /// \brief
+    ///     All change notifications delivered by a
+    ///     ChangeNotifier in one go.
+    /// \details
+    ///     Notifications are kept in the order they were
+    ///     posted, except that repeated ObjectModifiedNotifications
+    ///     for the same object are only reported once.
+    class TT3_DB_API_PUBLIC ChangeNotificationBatch final
+    {
+        friend class ChangeNotifier;
+
+        //////////
+        //  Types
+    public:
+        /// \brief
+        ///     The list of change notifications in a batch.
+        using Notifications = QList<std::shared_ptr<const ChangeNotification>>;
+
+        //////////
+        //  Construction/destruction/assignment
+    public:
+        /// \brief
+        ///     Constructs an empty batch.
+        ChangeNotificationBatch() = default;
+
+        //  Default copy-constructor and assigmnent are OK
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Checks whether this batch is empty.
+        /// \return
+        ///     True if this batch is empty, false if not.
+        bool            isEmpty() const { return _notifications.isEmpty(); }
+
+        /// \brief
+        ///     Returns the number of notifications in this batch.
+        /// \return
+        ///     The number of notifications in this batch.
+        qsizetype       size() const { return _notifications.size(); }
+
+        /// \brief
+        ///     Returns the notifications in this batch.
+        /// \details
+        ///     Use ChangeNotification::kind() to find out the
+        ///     concrete class of each notification.
+        /// \return
+        ///     The notifications in this batch, in order.
+        auto            notifications(
+                            ) const -> const Notifications &
+        {
+            return _notifications;
+        }
+
+        //////////
+        //  Implementation
+    private:
+        Notifications   _notifications;
+    };
+
     /// \class ChangeNotifier tt3-db-api/API.hpp
     /// \brief
     ///     A per-database agent that emits change
@@ -248,6 +361,10 @@ namespace tt3::db::api
         ///     notification dispatch thread, which automatically
         ///     means that connections of any slots to these signals
         ///     become queued connections.
+        ///     All notifications pending at dispatch time are
+        ///     delivered together (see ChangeNotificationBatch),
+        ///     so repeated modifications of the same object
+        ///     result in a single objectModified() signal.
         /// \param notification
         ///     The notification to post for eventual dispatch.
         void            post(ChangeNotification * notification);
@@ -268,6 +385,13 @@ namespace tt3::db::api
         ///     The details of the change notification.
         void        databaseClosed(DatabaseClosedNotification notification);
 
+        /// \brief
+        ///     Emitted after the contents of a database have
+        ///     changed wholesale.
+        /// \param notification
+        ///     The details of the change notification.
+        void        databaseReloaded(DatabaseReloadedNotification notification);
+
         /// \brief
         ///     Emitted after a new object is created
         /// \param notification
@@ -286,6 +410,13 @@ namespace tt3::db::api
         ///     The details of the change notification.
         void        objectModified(ObjectModifiedNotification notification);
 
+        /// \brief
+        ///     Emitted once for all notifications delivered
+        ///     together, after the per-notification signals.
+        /// \param batch
+        ///     The notifications delivered together.
+        void        changesCommitted(ChangeNotificationBatch batch);
+
         //////////
         //  Implementation
     private:
@@ -326,8 +457,10 @@ namespace tt3::db::api
 
 Q_DECLARE_METATYPE(tt3::db::api::ChangeNotification)
 Q_DECLARE_METATYPE(tt3::db::api::DatabaseClosedNotification)
+Q_DECLARE_METATYPE(tt3::db::api::DatabaseReloadedNotification)
 Q_DECLARE_METATYPE(tt3::db::api::ObjectCreatedNotification)
 Q_DECLARE_METATYPE(tt3::db::api::ObjectDestroyedNotification)
 Q_DECLARE_METATYPE(tt3::db::api::ObjectModifiedNotification)
+Q_DECLARE_METATYPE(tt3::db::api::ChangeNotificationBatch)
 
 //  End of tt3-db-api/Notifications.hpp
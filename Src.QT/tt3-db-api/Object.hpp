@@ -35,18 +35,24 @@ namespace tt3::util
 namespace tt3::db::api
 {
     TT3_DB_API_PUBLIC size_t qHash(const Oid & key, size_t seed = 0);
+    //  Binary (de)serialization as 16 raw bytes
+    TT3_DB_API_PUBLIC QDataStream & operator << (QDataStream & stream, const Oid & oid);
+    TT3_DB_API_PUBLIC QDataStream & operator >> (QDataStream & stream, Oid & oid);
 
     /// \class Oid tt3-db-api/API.hpp
     /// \brief
     ///      The OID; unique per database.
     /// \details
     ///     OIDsre based on UUIDs, wich is required for e.g.
-    ///     merging two databases
+    ///     merging two databases. OIDs are ordered the same
+    ///     way as their string representations are.
     class TT3_DB_API_PUBLIC Oid final
     {
         friend TT3_DB_API_PUBLIC QString tt3::util::toString<Oid>(const Oid & value);
         friend TT3_DB_API_PUBLIC Oid tt3::util::fromString<Oid>(const QString & s, qsizetype & scan);
         friend TT3_DB_API_PUBLIC size_t qHash(const Oid & key, size_t seed);
+        friend TT3_DB_API_PUBLIC QDataStream & operator << (QDataStream & stream, const Oid & oid);
+        friend TT3_DB_API_PUBLIC QDataStream & operator >> (QDataStream & stream, Oid & oid);
 
         //////////
         //  Constants
@@ -55,6 +61,10 @@ namespace tt3::db::api
         ///     The special "invalid" OID.
         static const Oid    Invalid;
 
+        /// \brief
+        ///     The length of the string representation of an OID.
+        static constexpr qsizetype  StringLength = 38;
+
         //////////
         //  Construction
     private:
@@ -104,7 +114,7 @@ namespace tt3::db::api
         /// \return
         ///     True if the first OID is numerically
         ///     "less than" the 2nd OID, else false.
-        bool            operator <  (const Oid & op2) const { return _impl <  op2._impl; }
+        bool            operator <  (const Oid & op2) const { return _compare(op2) < 0; }
 
         /// \brief
         ///     Compares two OIDs for order.
@@ -113,7 +123,7 @@ namespace tt3::db::api
         /// \return
         ///     True if the first OID is numerically
         ///     "less than or equal to" the 2nd OID, else false.
-        bool            operator <= (const Oid & op2) const { return _impl <= op2._impl; }
+        bool            operator <= (const Oid & op2) const { return _compare(op2) <= 0; }
 
         /// \brief
         ///     Compares two OIDs for order.
@@ -122,7 +132,7 @@ namespace tt3::db::api
         /// \return
         ///     True if the first OID is numerically
         ///     "greater than" the 2nd OID, else false.
-        bool            operator >  (const Oid & op2) const { return _impl >  op2._impl; }
+        bool            operator >  (const Oid & op2) const { return _compare(op2) > 0; }
 
         /// \brief
         ///     Compares two OIDs for order.
@@ -131,7 +141,7 @@ namespace tt3::db::api
         /// \return
         ///     True if the first OID is numerically
         ///     "greater than or equal to" the 2nd OID, else false.
-        bool            operator >= (const Oid & op2) const { return _impl >= op2._impl; }
+        bool            operator >= (const Oid & op2) const { return _compare(op2) >= 0; }
 
         //////////
         //  Operations
@@ -150,10 +160,53 @@ namespace tt3::db::api
         ///     The newly generated random OID.
         static Oid      createRandom();
 
+        /// \brief
+        ///     Parses a OID string in the same form as returned
+        ///     by toString(); accepts both upper- and lower-case.
+        /// \details
+        ///     Unlike the Oid(const QString &) constructor, does
+        ///     not allocate; use when parsing OIDs in bulk.
+        /// \param oidString
+        ///     The OID string to parse; must be exactly
+        ///     StringLength characters long.
+        /// \return
+        ///     The parsed OID; an "invalid" OID if the string
+        ///     is not a valid OID.
+        static Oid      parse(QStringView oidString);
+
+        /// \brief
+        ///     Formats this OID in the same form as toString()
+        ///     into a preallocated buffer.
+        /// \param buffer
+        ///     The buffer to write StringLength characters to.
+        void            formatInto(QChar * buffer) const;
+
         //////////
         //  Implementation
     private:
         QUuid           _impl;
+
+        //  Compares the OIDs as 128-bit unsigned big-endian
+        //  numbers, which is the same as comparing their
+        //  string representations, but without formatting them.
+        int             _compare(const Oid & op2) const
+        {
+            if (_impl.data1 != op2._impl.data1)
+            {
+                return (_impl.data1 < op2._impl.data1) ? -1 : 1;
+            }
+            if (_impl.data2 != op2._impl.data2)
+            {
+                return (_impl.data2 < op2._impl.data2) ? -1 : 1;
+            }
+            if (_impl.data3 != op2._impl.data3)
+            {
+                return (_impl.data3 < op2._impl.data3) ? -1 : 1;
+            }
+            return std::memcmp(_impl.data4, op2._impl.data4, sizeof(_impl.data4));
+        }
+        //  false == not a valid OID string
+        static bool     _parse(QStringView oidString, Oid & oid);
     };
 
     /// \class IObject tt3-db-api/API.hpp
@@ -255,6 +308,21 @@ namespace tt3::db::api
         ///     data object residing in a database, else false.
         virtual bool    isLive() const = 0;
 
+        /// \brief
+        ///     Returns the modification stamp of this object.
+        /// \details
+        ///     Every change to an object, including its creation,
+        ///     gives it the next stamp from the ever-increasing
+        ///     sequence kept by its database (see
+        ///     IDatabase::modificationStamp()).
+        /// \return
+        ///     The modification stamp of this object; 0 if the
+        ///     object has not changed since its database started
+        ///     keeping modification stamps.
+        /// \exception DatabaseException
+        ///     If an error occurs.
+        virtual quint64 modificationStamp() const = 0;
+
         //////////
         //  Operations (life cycle)
     public:
@@ -19,11 +19,53 @@ using namespace tt3::db::api;
 
 namespace
 {
-    bool isHexDigit(QChar c)
+    const char16_t hexDigits[] = u"0123456789ABCDEF";
+
+    //  -1 if "c" is not a hex digit
+    int hexDigitValue(QChar c)
+    {
+        char16_t u = c.unicode();
+        if (u >= '0' && u <= '9')
+        {
+            return u - '0';
+        }
+        if (u >= 'A' && u <= 'F')
+        {
+            return u - 'A' + 10;
+        }
+        if (u >= 'a' && u <= 'f')
+        {
+            return u - 'a' + 10;
+        }
+        return -1;
+    }
+
+    //  Parses "digits" hex digits starting at "s[from]"
+    bool parseHex(QStringView s, qsizetype from, int digits, quint64 & value)
     {
-        return (c >= '0' && c <= '9') ||
-               (c >= 'a' && c <= 'f') ||
-               (c >= 'A' && c <= 'F');
+        value = 0;
+        for (qsizetype i = from; i < from + digits; i++)
+        {
+            int digit = hexDigitValue(s[i]);
+            if (digit < 0)
+            {
+                return false;
+            }
+            value = (value << 4) | quint64(digit);
+        }
+        return true;
+    }
+
+    //  Writes "digits" least significant hex digits of "value",
+    //  returns the pointer just past the last written character
+    QChar * formatHex(QChar * buffer, quint64 value, int digits)
+    {
+        for (int i = digits - 1; i >= 0; i--)
+        {
+            buffer[i] = QChar(hexDigits[value & 0x0F]);
+            value >>= 4;
+        }
+        return buffer + digits;
     }
 }
 
@@ -45,6 +87,76 @@ Oid Oid::createRandom()
     }
 }
 
+Oid Oid::parse(QStringView oidString)
+{
+    Oid result;
+    return _parse(oidString, result) ? result : Invalid;
+}
+
+void Oid::formatInto(QChar * buffer) const
+{
+    quint64 data4High =
+        (quint64(_impl.data4[0]) << 8) |
+        quint64(_impl.data4[1]);
+    quint64 data4Low = 0;
+    for (int i = 2; i < 8; i++)
+    {
+        data4Low = (data4Low << 8) | quint64(_impl.data4[i]);
+    }
+
+    *buffer++ = '{';
+    buffer = formatHex(buffer, _impl.data1, 8);
+    *buffer++ = '-';
+    buffer = formatHex(buffer, _impl.data2, 4);
+    *buffer++ = '-';
+    buffer = formatHex(buffer, _impl.data3, 4);
+    *buffer++ = '-';
+    buffer = formatHex(buffer, data4High, 4);
+    *buffer++ = '-';
+    buffer = formatHex(buffer, data4Low, 12);
+    *buffer = '}';
+}
+
+//////////
+//  Implementation helpers
+bool Oid::_parse(QStringView oidString, Oid & oid)
+{
+    //  The form is {XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX}
+    if (oidString.size() != StringLength ||
+        oidString[0] != '{' ||
+        oidString[9] != '-' ||
+        oidString[14] != '-' ||
+        oidString[19] != '-' ||
+        oidString[24] != '-' ||
+        oidString[37] != '}')
+    {   //  OOPS!
+        return false;
+    }
+    quint64 data1, data2, data3, data4High, data4Low;
+    if (!parseHex(oidString, 1, 8, data1) ||
+        !parseHex(oidString, 10, 4, data2) ||
+        !parseHex(oidString, 15, 4, data3) ||
+        !parseHex(oidString, 20, 4, data4High) ||
+        !parseHex(oidString, 25, 12, data4Low))
+    {   //  OOPS!
+        return false;
+    }
+    oid._impl =
+        QUuid(
+            uint(data1),
+            ushort(data2),
+            ushort(data3),
+            uchar(data4High >> 8),
+            uchar(data4High),
+            uchar(data4Low >> 40),
+            uchar(data4Low >> 32),
+            uchar(data4Low >> 24),
+            uchar(data4Low >> 16),
+            uchar(data4Low >> 8),
+            uchar(data4Low));
+    return true;
+}
+
 //////////
 //  Formatting and parsing
 template <> TT3_DB_API_PUBLIC
@@ -52,7 +164,9 @@ QString tt3::util::toString<tt3::db::api::Oid>(
         const tt3::db::api::Oid & value
     )
 {
-    return value._impl.toString().toUpper();
+    QString result(Oid::StringLength, Qt::Uninitialized);
+    value.formatInto(result.data());
+    return result;
 }
 
 template <> TT3_DB_API_PUBLIC
@@ -61,54 +175,17 @@ auto tt3::util::fromString<tt3::db::api::Oid>(
         qsizetype & scan
     ) -> tt3::db::api::Oid
 {
-    if (scan < 0 || scan + 38 > s.length())
+    if (scan < 0 || scan + Oid::StringLength > s.length())
     {
         throw tt3::util::ParseException(s, scan);
     }
-    if (s[scan] == '{' &&
-        isHexDigit(s[scan + 1]) &&
-        isHexDigit(s[scan + 2]) &&
-        isHexDigit(s[scan + 3]) &&
-        isHexDigit(s[scan + 4]) &&
-        isHexDigit(s[scan + 5]) &&
-        isHexDigit(s[scan + 6]) &&
-        isHexDigit(s[scan + 7]) &&
-        isHexDigit(s[scan + 8]) &&
-        s[scan + 9] == '-' &&
-        isHexDigit(s[scan + 10]) &&
-        isHexDigit(s[scan + 11]) &&
-        isHexDigit(s[scan + 12]) &&
-        isHexDigit(s[scan + 13]) &&
-        s[scan + 14] == '-' &&
-        isHexDigit(s[scan + 15]) &&
-        isHexDigit(s[scan + 16]) &&
-        isHexDigit(s[scan + 17]) &&
-        isHexDigit(s[scan + 18]) &&
-        s[scan + 19] == '-' &&
-        isHexDigit(s[scan + 20]) &&
-        isHexDigit(s[scan + 21]) &&
-        isHexDigit(s[scan + 22]) &&
-        isHexDigit(s[scan + 23]) &&
-        s[scan + 24] == '-' &&
-        isHexDigit(s[scan + 25]) &&
-        isHexDigit(s[scan + 26]) &&
-        isHexDigit(s[scan + 27]) &&
-        isHexDigit(s[scan + 28]) &&
-        isHexDigit(s[scan + 29]) &&
-        isHexDigit(s[scan + 20]) &&
-        isHexDigit(s[scan + 31]) &&
-        isHexDigit(s[scan + 32]) &&
-        isHexDigit(s[scan + 33]) &&
-        isHexDigit(s[scan + 34]) &&
-        isHexDigit(s[scan + 35]) &&
-        isHexDigit(s[scan + 36]) &&
-        s[scan + 37] == '}')
-    {
-        QUuid uuid(s.mid(scan, 38));
-        scan += 38;
-        return Oid(uuid);
+    Oid oid;
+    if (!Oid::_parse(QStringView(s).mid(scan, Oid::StringLength), oid))
+    {   //  OOPS!
+        throw tt3::util::ParseException(s, scan);
     }
-    throw tt3::util::ParseException(s, scan);
+    scan += Oid::StringLength;
+    return oid;
 }
 
 //////////
@@ -118,4 +195,14 @@ TT3_DB_API_PUBLIC size_t tt3::db::api::qHash(const Oid & key, size_t seed)
     return qHash(key._impl, seed);
 }
 
+TT3_DB_API_PUBLIC QDataStream & tt3::db::api::operator << (QDataStream & stream, const Oid & oid)
+{
+    return stream << oid._impl;
+}
+
+TT3_DB_API_PUBLIC QDataStream & tt3::db::api::operator >> (QDataStream & stream, Oid & oid)
+{
+    return stream >> oid._impl;
+}
+
 //  End of tt3-db-api/Oid.cpp
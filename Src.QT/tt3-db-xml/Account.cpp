@@ -40,7 +40,7 @@ Account::~Account()
 //  tt3::db::api::IAccount (properties)
 QString Account::login() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -78,10 +78,12 @@ void Account::setLogin(
 
     if (login != _login)
     {   //  Make the change...
+        _removeFromIndexes();
         _login = login;
+        _addToIndexes();
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -93,7 +95,7 @@ void Account::setLogin(
 
 QString Account::passwordHash() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -131,7 +133,7 @@ void Account::setPassword(
     _passwordHash = passwordHash;
     _database->_markModified();
     //  ...schedule change notifications...
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectModifiedNotification(
             _database, type(), _oid));
     //  ...and we're done
@@ -143,7 +145,7 @@ void Account::setPassword(
 auto Account::capabilities(
     ) const -> tt3::db::api::Capabilities
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -165,7 +167,7 @@ void Account::setCapabilities(
         _capabilities = capabilities;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -180,7 +182,7 @@ void Account::setCapabilities(
 auto Account::user(
     ) const -> tt3::db::api::IUser *
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -190,7 +192,7 @@ auto Account::user(
 auto Account::quickPicksList(
     ) const -> QList<tt3::db::api::IActivity*>
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -255,7 +257,7 @@ void Account::setQuickPicksList(
         _quickPicksList = xmlQuickPicksList;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -268,7 +270,7 @@ void Account::setQuickPicksList(
 auto Account::works(
     ) const -> tt3::db::api::Works
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -280,18 +282,21 @@ auto Account::works(
         const QDateTime & to
     ) const -> tt3::db::api::Works
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
     tt3::db::api::Works result;
     if (from.isValid() && to.isValid() && from <= to)
     {
-        for (Work * work : _works)
+        qint64 maxWorkDurationMs = _workDurations.isEmpty() ? 0 : _workDurations.lastKey();
+        for (auto it = _worksByStartedAt.lowerBound(from.addMSecs(-maxWorkDurationMs));
+             it != _worksByStartedAt.cend() && it.key() <= to;
+             ++it)
         {
-            if (!(work->_startedAt > to || work->_finishedAt < from))
+            if (it.value()->_finishedAt >= from)
             {
-                result.insert(work);
+                result.insert(it.value());
             }
         }
     }
@@ -301,7 +306,7 @@ auto Account::works(
 auto Account::events(
     ) const -> tt3::db::api::Events
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -313,19 +318,18 @@ auto Account::events(
         const QDateTime & to
     ) const -> tt3::db::api::Events
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
     tt3::db::api::Events result;
     if (from.isValid() && to.isValid() && from <= to)
     {
-        for (Event * event : _events)
+        for (auto it = _eventsByOccurredAt.lowerBound(from);
+             it != _eventsByOccurredAt.cend() && it.key() <= to;
+             ++it)
         {
-            if (event->_occurredAt >= from && event->_occurredAt <= to)
-            {
-                result.insert(event);
-            }
+            result.insert(it.value());
         }
     }
     return result;
@@ -366,6 +370,7 @@ auto Account::createWork(
     Work * work = new Work(this, _database->_generateOid());   //  registers with User
     work->_startedAt = startedAt;
     work->_finishedAt = finishedAt;
+    _indexWork(work);
     //  Link with Activity
     work->_activity = xmlActivity;
     xmlActivity->_works.insert(work);
@@ -373,13 +378,13 @@ auto Account::createWork(
     work->addReference();
     _database->_markModified();
     //  ...schedule change notifications...
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectModifiedNotification(
             _database, this->type(), this->_oid));
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             _database, work->type(), work->_oid));
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectModifiedNotification(
             _database, xmlActivity->type(), xmlActivity->_oid));
 
@@ -437,6 +442,7 @@ auto Account::createEvent(
     Event * event = new Event(this, _database->_generateOid());   //  registers with User
     event->_occurredAt = occurredAt;
     event->_summary = summary;
+    _indexEvent(event);
     //  Link with Activities
     for (Activity * xmlActivity : std::as_const(xmlActivities))
     {
@@ -447,15 +453,15 @@ auto Account::createEvent(
     }
     _database->_markModified();
     //  ...schedule change notifications...
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectModifiedNotification(
             _database, this->type(), this->_oid));
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             _database, event->type(), event->_oid));
     for (Activity * xmlActivity : std::as_const(xmlActivities))
     {
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlActivity->type(), xmlActivity->_oid));
     }
@@ -500,6 +506,66 @@ void Account::_makeDead()
     Principal::_makeDead();
 }
 
+void Account::_addToIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    _database->_accountsByLogin.insert(_login, this);
+}
+
+void Account::_removeFromIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    if (_database->_accountsByLogin.value(_login) == this)
+    {
+        _database->_accountsByLogin.remove(_login);
+    }
+}
+
+void Account::_indexWork(
+        Work * work
+    )
+{
+    Q_ASSERT(_works.contains(work));
+
+    _worksByStartedAt.insert(work->_startedAt, work);
+    _workDurations[work->_startedAt.msecsTo(work->_finishedAt)]++;
+}
+
+void Account::_unindexWork(
+        Work * work
+    )
+{
+    Q_ASSERT(_worksByStartedAt.contains(work->_startedAt, work));
+
+    _worksByStartedAt.remove(work->_startedAt, work);
+    auto it = _workDurations.find(work->_startedAt.msecsTo(work->_finishedAt));
+    Q_ASSERT(it != _workDurations.end() && it.value() > 0);
+    if (--it.value() == 0)
+    {   //  No more Works this long
+        _workDurations.erase(it);
+    }
+}
+
+void Account::_indexEvent(
+        Event * event
+    )
+{
+    Q_ASSERT(_events.contains(event));
+
+    _eventsByOccurredAt.insert(event->_occurredAt, event);
+}
+
+void Account::_unindexEvent(
+        Event * event
+    )
+{
+    Q_ASSERT(_eventsByOccurredAt.contains(event->_occurredAt, event));
+
+    _eventsByOccurredAt.remove(event->_occurredAt, event);
+}
+
 void Account::_setPasswordHash(
         const QString & passwordHash
     )
@@ -530,7 +596,7 @@ void Account::_setPasswordHash(
     _passwordHash = passwordHash;
     _database->_markModified();
     //  ...schedule change notifications...
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectModifiedNotification(
             _database, type(), _oid));
     //  ...and we're done
@@ -541,64 +607,75 @@ void Account::_setPasswordHash(
 
 //////////
 //  Serialization
+auto Account::_serializationParent(
+    ) const -> Object *
+{
+    return _user;
+}
+
+QString Account::_serializationAggregationName() const
+{
+    return "Accounts";
+}
+
 void Account::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Principal::_serializeProperties(objectElement);
+    Principal::_serializeProperties(writer);
 
-    objectElement.setAttribute("Login", _login);
-    objectElement.setAttribute("PasswordHash", _passwordHash);
-    objectElement.setAttribute("Capabilities", tt3::util::toString(_capabilities));
+    writer.writeAttribute("Login", _login);
+    writer.writeAttribute("PasswordHash", _passwordHash);
+    writer.writeAttribute("Capabilities", tt3::util::toString(_capabilities));
 }
 
 void Account::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Principal::_serializeAggregations(objectElement);
+    Principal::_serializeAggregations(writer);
 
     _database->_serializeAggregation(
-        objectElement,
+        writer,
         "Works",
         _works);
     _database->_serializeAggregation(
-        objectElement,
+        writer,
         "Events",
         _events);
 }
 
 void Account::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Principal::_serializeAssociations(objectElement);
+    Principal::_serializeAssociations(writer);
 
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "QuickPicksList",
         _quickPicksList);
 }
 
 void Account::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Principal::_deserializeProperties(objectElement);
+    Principal::_deserializeProperties(attributes);
 
-    _login = objectElement.attribute("Login");
-    _passwordHash = objectElement.attribute("PasswordHash");
-    _capabilities = tt3::util::fromString(objectElement.attribute("Capabilities"), _capabilities);
+    _login = attributes.value("Login").toString();
+    _passwordHash = attributes.value("PasswordHash").toString();
+    _capabilities = tt3::util::fromString(attributes.value("Capabilities").toString(), _capabilities);
 }
 
 void Account::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Principal::_deserializeAggregations(objectElement);
+    Principal::_deserializeAggregations(reader);
 
     _database->_deserializeAggregation<Work>(
-        objectElement,
+        reader,
         "Works",
         _works,
         [&](auto oid)
@@ -606,7 +683,7 @@ void Account::_deserializeAggregations(
             return new Work(this, oid);
         });
     _database->_deserializeAggregation<Event>(
-        objectElement,
+        reader,
         "Events",
         _events,
         [&](auto oid)
@@ -616,13 +693,13 @@ void Account::_deserializeAggregations(
 }
 
 void Account::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Principal::_deserializeAssociations(objectElement);
+    Principal::_deserializeAssociations(attributes);
 
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "QuickPicksList",
         _quickPicksList);
 }
@@ -650,7 +727,7 @@ void Account::_validate(
         {   //  OOPS!
             throw tt3::db::api::DatabaseCorruptException(_database->_address);
         }
-        work->_validate(validatedObjects);
+        _database->_validateAggregated(work, validatedObjects);
     }
     for (Event * event : std::as_const(_events))
     {
@@ -660,7 +737,34 @@ void Account::_validate(
         {   //  OOPS!
             throw tt3::db::api::DatabaseCorruptException(_database->_address);
         }
-        event->_validate(validatedObjects);
+        _database->_validateAggregated(event, validatedObjects);
+    }
+    if (_worksByStartedAt.size() != _works.size() ||
+        _eventsByOccurredAt.size() != _events.size())
+    {   //  OOPS! Primary and secondary caches do not match
+        throw tt3::db::api::DatabaseCorruptException(_database->_address);
+    }
+    QMap<qint64, qsizetype> workDurations;
+    for (auto it = _worksByStartedAt.cbegin(); it != _worksByStartedAt.cend(); ++it)
+    {
+        if (!_works.contains(it.value()) ||
+            it.key() != it.value()->_startedAt)
+        {   //  OOPS!
+            throw tt3::db::api::DatabaseCorruptException(_database->_address);
+        }
+        workDurations[it.value()->_startedAt.msecsTo(it.value()->_finishedAt)]++;
+    }
+    if (workDurations != _workDurations)
+    {   //  OOPS! Secondary caches do not match
+        throw tt3::db::api::DatabaseCorruptException(_database->_address);
+    }
+    for (auto it = _eventsByOccurredAt.cbegin(); it != _eventsByOccurredAt.cend(); ++it)
+    {
+        if (!_events.contains(it.value()) ||
+            it.key() != it.value()->_occurredAt)
+        {   //  OOPS!
+            throw tt3::db::api::DatabaseCorruptException(_database->_address);
+        }
     }
 
     //  Validate associations
@@ -686,4 +790,21 @@ void Account::_validate(
     }
 }
 
+void Account::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    Principal::_collectLinkedObjects(linkedObjects);
+
+    linkedObjects.insert(_user);
+    for (Work * work : std::as_const(_works))
+    {
+        linkedObjects.insert(work);
+    }
+    for (Event * event : std::as_const(_events))
+    {
+        linkedObjects.insert(event);
+    }
+}
+
 //  End of tt3-db-xml/Account.cpp
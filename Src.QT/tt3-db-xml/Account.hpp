@@ -106,8 +106,24 @@ namespace tt3::db::xml
         User *          _user;          //  counts as "reference"
         QList<Activity*>_quickPicksList; //  count as "reference"
 
+        //  Secondary caches - these do NOT count as "references".
+        //  A Work overlapping [from..to] cannot have started
+        //  before "from" minus the longest Work duration, which
+        //  is the last key of _workDurations (duration in ms ->
+        //  number of Works that long), so that it shrinks back
+        //  when the longest Works go.
+        QMultiMap<QDateTime, Work*>     _worksByStartedAt;
+        QMultiMap<QDateTime, Event*>    _eventsByOccurredAt;
+        QMap<qint64, qsizetype>         _workDurations;
+
         //  Helpers
         virtual void    _makeDead() override;
+        virtual void    _addToIndexes() override;
+        virtual void    _removeFromIndexes() override;
+        void            _indexWork(Work * work);
+        void            _unindexWork(Work * work);
+        void            _indexEvent(Event * event);
+        void            _unindexEvent(Event * event);
         virtual void    _setPasswordHash(
                                 const QString & passwordHash
                             ) override;
@@ -115,24 +131,28 @@ namespace tt3::db::xml
         //////////
         //  Serialization
     private:
+        virtual auto    _serializationParent(
+                            ) const -> Object * override;
+        virtual QString _serializationAggregationName(
+                            ) const override;
         virtual void    _serializeProperties(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
         virtual void    _serializeAggregations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
         virtual void    _serializeAssociations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
 
         virtual void    _deserializeProperties(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             ) override; //  throws tt3::util::ParseException
         virtual void    _deserializeAggregations(
-                                const QDomElement & objectElement
+                                QXmlStreamReader & reader
                             ) override; //  throws tt3::util::ParseException
         virtual void    _deserializeAssociations(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             ) override;  //  throws tt3::util::ParseException
 
         //////////
@@ -141,6 +161,9 @@ namespace tt3::db::xml
         virtual void    _validate(
                                 Objects & validatedObjects
                              ) override; //  throws tt3::db::api::DatabaseException
+        virtual void    _collectLinkedObjects(
+                                Objects & linkedObjects
+                            ) const override;
     };
 }
 
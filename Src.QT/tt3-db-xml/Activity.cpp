@@ -34,7 +34,7 @@ Activity::~Activity()
 //  tt3::db::api::IActivity (general)
 QString Activity::displayName() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -68,10 +68,12 @@ void Activity::setDisplayName(
                 "displayName",
                 displayName);
         }
+        _removeFromIndexes();
         _displayName = displayName;
+        _addToIndexes();
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -83,7 +85,7 @@ void Activity::setDisplayName(
 
 QString Activity::description() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -113,7 +115,7 @@ void Activity::setDescription(
         _description = description;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -126,7 +128,7 @@ void Activity::setDescription(
 auto Activity::timeout(
     ) const -> tt3::db::api::InactivityTimeout
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -157,7 +159,7 @@ void Activity::setTimeout(
         _timeout = timeout;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -170,7 +172,7 @@ void Activity::setTimeout(
 bool Activity::requireCommentOnStart(
     ) const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -192,7 +194,7 @@ void Activity::setRequireCommentOnStart(
         _requireCommentOnStart = requireCommentOnStart;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -205,7 +207,7 @@ void Activity::setRequireCommentOnStart(
 bool Activity::requireCommentOnStop(
     ) const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -227,7 +229,7 @@ void Activity::setRequireCommentOnStop(
         _requireCommentOnStop = requireCommentOnStop;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -240,7 +242,7 @@ void Activity::setRequireCommentOnStop(
 bool Activity::fullScreenReminder(
     ) const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -262,7 +264,7 @@ void Activity::setFullScreenReminder(
         _fullScreenReminder = fullScreenReminder;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -277,7 +279,7 @@ void Activity::setFullScreenReminder(
 auto Activity::activityType(
     ) const -> tt3::db::api::IActivityType *
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -312,7 +314,7 @@ void Activity::setActivityType(
             _activityType->_activities.remove(this);
             this->removeReference();
             _activityType->removeReference();
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, _activityType->type(), _activityType->_oid));
         }
@@ -322,13 +324,13 @@ void Activity::setActivityType(
             _activityType->_activities.insert(this);
             this->addReference();
             _activityType->addReference();
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, _activityType->type(), _activityType->_oid));
         }
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -341,7 +343,7 @@ void Activity::setActivityType(
 auto Activity::workload(
     ) const -> tt3::db::api::IWorkload *
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -376,7 +378,7 @@ void Activity::setWorkload(
             _workload->_contributingActivities.remove(this);
             this->removeReference();
             _workload->removeReference();
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, _workload->type(), _workload->_oid));
         }
@@ -386,13 +388,13 @@ void Activity::setWorkload(
             _workload->_contributingActivities.insert(this);
             this->addReference();
             _workload->addReference();
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, _workload->type(), _workload->_oid));
         }
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -405,7 +407,7 @@ void Activity::setWorkload(
 auto Activity::works(
     ) const -> tt3::db::api::Works
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -415,7 +417,7 @@ auto Activity::works(
 auto Activity::events(
     ) const -> tt3::db::api::Events
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -480,110 +482,110 @@ void Activity::_makeDead()
 //////////
 //  Serialization
 void Activity::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeProperties(objectElement);
+    Object::_serializeProperties(writer);
 
-    objectElement.setAttribute("DisplayName", _displayName);
-    objectElement.setAttribute("Description", _description);
+    writer.writeAttribute("DisplayName", _displayName);
+    writer.writeAttribute("Description", _description);
     if (_timeout.has_value())
     {
-        objectElement.setAttribute("Timeout", tt3::util::toString(_timeout.value()));
+        writer.writeAttribute("Timeout", tt3::util::toString(_timeout.value()));
     }
-    objectElement.setAttribute("RequireCommentOnStart", tt3::util::toString(_requireCommentOnStart));
-    objectElement.setAttribute("RequireCommentOnStop", tt3::util::toString(_requireCommentOnStop));
-    objectElement.setAttribute("FullScreenReminder", tt3::util::toString(_fullScreenReminder));
+    writer.writeAttribute("RequireCommentOnStart", tt3::util::toString(_requireCommentOnStart));
+    writer.writeAttribute("RequireCommentOnStop", tt3::util::toString(_requireCommentOnStop));
+    writer.writeAttribute("FullScreenReminder", tt3::util::toString(_fullScreenReminder));
 }
 
 void Activity::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAggregations(objectElement);
+    Object::_serializeAggregations(writer);
     //  Works and Events are serialized via Account
 }
 
 void Activity::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAssociations(objectElement);
+    Object::_serializeAssociations(writer);
 
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "ActivityType",
         _activityType);
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "Workload",
         _workload);
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "Works",
         _works);
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "Events",
         _events);
 }
 
 void Activity::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeProperties(objectElement);
+    Object::_deserializeProperties(attributes);
 
-    _displayName = objectElement.attribute("DisplayName");
-    _description = objectElement.attribute("Description");
-    if (objectElement.hasAttribute("Timeout"))
+    _displayName = attributes.value("DisplayName").toString();
+    _description = attributes.value("Description").toString();
+    if (attributes.hasAttribute("Timeout"))
     {
         _timeout =
             tt3::util::fromString<tt3::util::TimeSpan>(
-                objectElement.attribute("Timeout"));
+                attributes.value("Timeout").toString());
     }
     _requireCommentOnStart =
         tt3::util::fromString(
-            objectElement.attribute("RequireCommentOnStart"),
+            attributes.value("RequireCommentOnStart").toString(),
             _requireCommentOnStart);
     _requireCommentOnStop =
         tt3::util::fromString(
-            objectElement.attribute("RequireCommentOnStop"),
+            attributes.value("RequireCommentOnStop").toString(),
             _requireCommentOnStop);
     _fullScreenReminder =
         tt3::util::fromString(
-            objectElement.attribute("FullScreenReminder"),
+            attributes.value("FullScreenReminder").toString(),
             _fullScreenReminder);
 }
 
 void Activity::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Object::_deserializeAggregations(objectElement);
+    Object::_deserializeAggregations(reader);
     //  Works and Events are deserialized via Account
 }
 
 void Activity::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeAssociations(objectElement);
+    Object::_deserializeAssociations(attributes);
 
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "ActivityType",
         _activityType);
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "Workload",
         _workload);
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "Works",
         _works);
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "Events",
         _events);
 }
@@ -654,4 +656,38 @@ void Activity::_validate(
     }
 }
 
+void Activity::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    Object::_collectLinkedObjects(linkedObjects);
+
+    if (_activityType != nullptr)
+    {
+        linkedObjects.insert(_activityType);
+    }
+    if (_workload != nullptr)
+    {
+        linkedObjects.insert(_workload);
+    }
+    for (Work * work : std::as_const(_works))
+    {
+        linkedObjects.insert(work);
+    }
+    for (Event * event : std::as_const(_events))
+    {
+        linkedObjects.insert(event);
+    }
+    for (User * user : std::as_const(_database->_users))
+    {   //  The "quick picks" association is one-directional
+        for (Account * account : std::as_const(user->_accounts))
+        {
+            if (account->_quickPicksList.contains(this))
+            {
+                linkedObjects.insert(account);
+            }
+        }
+    }
+}
+
 //  End of tt3-db-xml/Activity.cpp
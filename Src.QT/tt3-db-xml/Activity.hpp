@@ -119,23 +119,23 @@ namespace tt3::db::xml
         //  Serialization
     private:
         virtual void    _serializeProperties(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
         virtual void    _serializeAggregations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
         virtual void    _serializeAssociations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
 
         virtual void    _deserializeProperties(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             ) override; //  throws tt3::util::ParseException) overrid
         virtual void    _deserializeAggregations(
-                                const QDomElement & objectElement
+                                QXmlStreamReader & reader
                             ) override; //  throws tt3::util::ParseException) overrid
         virtual void    _deserializeAssociations(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             ) override;  //  throws tt3::util::ParseException
 
         //////////
@@ -144,6 +144,9 @@ namespace tt3::db::xml
         virtual void    _validate(
                                 Objects & validatedObjects
                             ) override; //  throws tt3::db::api::DatabaseException) overrid
+        virtual void    _collectLinkedObjects(
+                                Objects & linkedObjects
+                            ) const override;
     };
 }
 
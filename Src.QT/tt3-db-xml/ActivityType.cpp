@@ -39,7 +39,7 @@ ActivityType::~ActivityType()
 //  tt3::db::api::IActivityType (properties)
 QString ActivityType::displayName() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -73,10 +73,12 @@ void ActivityType::setDisplayName(
                 "displayName",
                 displayName);
         }
+        _removeFromIndexes();
         _displayName = displayName;
+        _addToIndexes();
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -88,7 +90,7 @@ void ActivityType::setDisplayName(
 
 QString ActivityType::description() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -118,7 +120,7 @@ void ActivityType::setDescription(
         _description = description;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -133,7 +135,7 @@ void ActivityType::setDescription(
 auto ActivityType::activities(
     ) const -> tt3::db::api::Activities
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -167,6 +169,23 @@ void ActivityType::_makeDead()
     Object::_makeDead();
 }
 
+void ActivityType::_addToIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    _database->_activityTypesByDisplayName.insert(_displayName, this);
+}
+
+void ActivityType::_removeFromIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    if (_database->_activityTypesByDisplayName.value(_displayName) == this)
+    {
+        _database->_activityTypesByDisplayName.remove(_displayName);
+    }
+}
+
 bool ActivityType::_siblingExists(
         const QString & displayName
     ) const
@@ -179,60 +198,71 @@ bool ActivityType::_siblingExists(
 
 //////////
 //  Serialization
+auto ActivityType::_serializationParent(
+    ) const -> Object *
+{
+    return nullptr;  //  a root object
+}
+
+QString ActivityType::_serializationAggregationName() const
+{
+    return "ActivityTypes";
+}
+
 void ActivityType::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeProperties(objectElement);
+    Object::_serializeProperties(writer);
 
-    objectElement.setAttribute("DisplayName", _displayName);
-    objectElement.setAttribute("Description", _description);
+    writer.writeAttribute("DisplayName", _displayName);
+    writer.writeAttribute("Description", _description);
 }
 
 void ActivityType::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAggregations(objectElement);
+    Object::_serializeAggregations(writer);
 }
 
 void ActivityType::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAssociations(objectElement);
+    Object::_serializeAssociations(writer);
 
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "Activities",
         _activities);
 }
 
 void ActivityType::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeProperties(objectElement);
+    Object::_deserializeProperties(attributes);
 
-    _displayName = objectElement.attribute("DisplayName");
-    _description = objectElement.attribute("Description");
+    _displayName = attributes.value("DisplayName").toString();
+    _description = attributes.value("Description").toString();
 }
 
 void ActivityType::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Object::_deserializeAggregations(objectElement);
+    Object::_deserializeAggregations(reader);
 }
 
 void ActivityType::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeAssociations(objectElement);
+    Object::_deserializeAssociations(attributes);
 
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "Activities",
         _activities);
 }
@@ -270,4 +300,16 @@ void ActivityType::_validate(
     }
 }
 
+void ActivityType::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    Object::_collectLinkedObjects(linkedObjects);
+
+    for (Activity * activity : std::as_const(_activities))
+    {
+        linkedObjects.insert(activity);
+    }
+}
+
 //  End of tt3-db-xml/ActivityType.cpp
@@ -69,29 +69,35 @@ namespace tt3::db::xml
 
         //  Helpers
         virtual void    _makeDead() override;
+        virtual void    _addToIndexes() override;
+        virtual void    _removeFromIndexes() override;
         bool            _siblingExists(const QString & displayName) const;
 
         //////////
         //  Serialization
     private:
+        virtual auto    _serializationParent(
+                            ) const -> Object * override;
+        virtual QString _serializationAggregationName(
+                            ) const override;
         virtual void    _serializeProperties(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
         virtual void    _serializeAggregations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
         virtual void    _serializeAssociations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
 
         virtual void    _deserializeProperties(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             ) override; //  throws tt3::util::ParseException
         virtual void    _deserializeAggregations(
-                                const QDomElement & objectElement
+                                QXmlStreamReader & reader
                             ) override; //  throws tt3::util::ParseException
         virtual void    _deserializeAssociations(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             ) override;  //  throws tt3::util::ParseException
 
         //////////
@@ -100,6 +106,9 @@ namespace tt3::db::xml
         virtual void    _validate(
                                 Objects & validatedObjects
                             ) override; //  throws(tt3::db::api::DatabaseException
+        virtual void    _collectLinkedObjects(
+                                Objects & linkedObjects
+                            ) const override;
     };
 }
 
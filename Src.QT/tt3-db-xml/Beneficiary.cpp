@@ -39,7 +39,7 @@ Beneficiary::~Beneficiary()
 //  tt3::db::api::IBeneficiary (properties)
 QString Beneficiary::displayName() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -73,10 +73,12 @@ void Beneficiary::setDisplayName(
                 "displayName",
                 displayName);
         }
+        _removeFromIndexes();
         _displayName = displayName;
+        _addToIndexes();
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -88,7 +90,7 @@ void Beneficiary::setDisplayName(
 
 QString Beneficiary::description() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -118,7 +120,7 @@ void Beneficiary::setDescription(
         _description = description;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -133,7 +135,7 @@ void Beneficiary::setDescription(
 auto Beneficiary::workloads(
     ) const -> tt3::db::api::Workloads
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -197,12 +199,12 @@ void Beneficiary::setWorkloads(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         for (Workload * xmlWorkload : addedWorkloads + removedWorkloads)
         {
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, xmlWorkload->type(), xmlWorkload->_oid));
         }
@@ -249,10 +251,10 @@ void Beneficiary::addWorkload(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlWorkload->type(), xmlWorkload->_oid));
         //  ...and we're done
@@ -298,10 +300,10 @@ void Beneficiary::removeWorkload(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlWorkload->type(), xmlWorkload->_oid));
         //  ...and we're done
@@ -338,6 +340,23 @@ void Beneficiary::_makeDead()
     Object::_makeDead();
 }
 
+void Beneficiary::_addToIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    _database->_beneficiariesByDisplayName.insert(_displayName, this);
+}
+
+void Beneficiary::_removeFromIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    if (_database->_beneficiariesByDisplayName.value(_displayName) == this)
+    {
+        _database->_beneficiariesByDisplayName.remove(_displayName);
+    }
+}
+
 bool Beneficiary::_siblingExists(
         const QString & displayName
     ) const
@@ -350,60 +369,71 @@ bool Beneficiary::_siblingExists(
 
 //////////
 //  Serialization
+auto Beneficiary::_serializationParent(
+    ) const -> Object *
+{
+    return nullptr;  //  a root object
+}
+
+QString Beneficiary::_serializationAggregationName() const
+{
+    return "Beneficiaries";
+}
+
 void Beneficiary::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeProperties(objectElement);
+    Object::_serializeProperties(writer);
 
-    objectElement.setAttribute("DisplayName", _displayName);
-    objectElement.setAttribute("Description", _description);
+    writer.writeAttribute("DisplayName", _displayName);
+    writer.writeAttribute("Description", _description);
 }
 
 void Beneficiary::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAggregations(objectElement);
+    Object::_serializeAggregations(writer);
 }
 
 void Beneficiary::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAssociations(objectElement);
+    Object::_serializeAssociations(writer);
 
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "Workloads",
         _workloads);
 }
 
 void Beneficiary::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeProperties(objectElement);
+    Object::_deserializeProperties(attributes);
 
-    _displayName = objectElement.attribute("DisplayName");
-    _description = objectElement.attribute("Description");
+    _displayName = attributes.value("DisplayName").toString();
+    _description = attributes.value("Description").toString();
 }
 
 void Beneficiary::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Object::_deserializeAggregations(objectElement);
+    Object::_deserializeAggregations(reader);
 }
 
 void Beneficiary::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeAssociations(objectElement);
+    Object::_deserializeAssociations(attributes);
 
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "Workloads",
         _workloads);
 }
@@ -441,4 +471,16 @@ void Beneficiary::_validate(
     }
 }
 
+void Beneficiary::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    Object::_collectLinkedObjects(linkedObjects);
+
+    for (Workload * workload : std::as_const(_workloads))
+    {
+        linkedObjects.insert(workload);
+    }
+}
+
 //  End of tt3-db-xml/Beneficiary.cpp
@@ -16,6 +16,13 @@
 //////////
 #include "tt3-db-xml/API.hpp"
 using namespace tt3::db::xml;
+#if defined(Q_OS_WINDOWS)
+    #include <io.h>
+#elif defined(Q_OS_LINUX)
+    #include <unistd.h>
+#else
+    #error Unsupported platform
+#endif
 
 //////////
 //  Construction/destruction
@@ -53,6 +60,7 @@ Database::Database(
             }
             //  Need to save empty DB content, but
             //  obtain the lock first
+            _instanceId = QUuid::createUuid();
             try
             {
                 _lockRefresher = new _LockRefresher(this);  //  may throw
@@ -99,7 +107,15 @@ Database::Database(
                     throw tt3::db::api::AccessDeniedException();
                 }
                 _lockRefresher = new _LockRefresher(this);  //  may throw
-                _load();    //  may throw
+                if (_load())    //  may throw
+                {   //  Fold the replayed journal (or the newly
+                    //  issued instance ID) into the XML file
+                    _save();    //  may throw
+                }
+                else
+                {   //  Start journalling from scratch
+                    _resetJournal();    //  may throw
+                }
                 _lockRefresher->start();
             }
             catch (const tt3::util::Exception & ex)
@@ -213,7 +229,7 @@ auto Database::validator(
 
 bool Database::isOpen() const
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
 
     return _isOpen;
 }
@@ -251,6 +267,10 @@ void Database::close()
         &_changeNotifier,
         &tt3::db::api::ChangeNotifier::databaseClosed,
         nullptr, nullptr);
+    QObject::disconnect(
+        &_changeNotifier,
+        &tt3::db::api::ChangeNotifier::databaseReloaded,
+        nullptr, nullptr);
     QObject::disconnect(
         &_changeNotifier,
         &tt3::db::api::ChangeNotifier::objectCreated,
@@ -263,6 +283,18 @@ void Database::close()
         &_changeNotifier,
         &tt3::db::api::ChangeNotifier::objectModified,
         nullptr, nullptr);
+    QObject::disconnect(
+        &_changeNotifier,
+        &tt3::db::api::ChangeNotifier::changesCommitted,
+        nullptr, nullptr);
+
+    //  Whatever an unfinished bulk load has loaded is kept
+    if (_bulkLoading)
+    {
+        _bulkLoading = false;
+        _bulkLoadOid = tt3::db::api::Oid::Invalid;
+        _markModified();
+    }
 
     //  Save ?
     if (_needsSaving)
@@ -275,10 +307,24 @@ void Database::close()
         catch (const tt3::util::Exception & ex)
         {   //  Cleanup & re-throw
             qCritical() << ex;
-            _markClosed();
+            try
+            {   //  The journal is all we have now - make sure
+                //  it includes the changes not yet journalled
+                _flushJournal();    //  may throw
+            }
+            catch (const tt3::util::Exception & ex1)
+            {   //  OOPS! Log, though
+                qCritical() << ex1;
+            }
+            _markClosed();  //  ...but keep the journal!
             throw;
         }
     }
+    //  The XML file is now up to date
+    if (_journalFile.isOpen())
+    {
+        _journalFile.remove();
+    }
 
     //  Destroy all Object instances...
     //  (we pretend to be read/wrote for the duration -
@@ -337,12 +383,20 @@ void Database::refresh()
     //  ...otherwise an all-in-RAM database performs no caching
 }
 
+void Database::validate()
+{
+    tt3::util::Lock _(_guard);
+
+    _ensureOpen();  //  may throw
+    _validateAll(); //  may throw
+}
+
 //////////
 //  tt3::db::api::IDatabase (associations)
 quint64 Database::objectCount(
     ) const
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -353,7 +407,7 @@ auto Database::findObjectByOid(
         const tt3::db::api::Oid & oid
     ) const -> tt3::db::api::IObject *
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -363,7 +417,7 @@ auto Database::findObjectByOid(
 auto Database::users(
     ) const -> tt3::db::api::Users
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -373,7 +427,7 @@ auto Database::users(
 auto Database::accounts(
     ) const -> tt3::db::api::Accounts
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -389,7 +443,7 @@ auto Database::findAccount(
         const QString & login
     ) const -> tt3::db::api::IAccount *
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -399,7 +453,7 @@ auto Database::findAccount(
 auto Database::activityTypes(
     ) const -> tt3::db::api::ActivityTypes
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -420,7 +474,7 @@ auto Database::findActivityType(
 auto Database::publicActivities(
     ) const -> tt3::db::api::PublicActivities
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -441,7 +495,7 @@ auto Database::findPublicActivity(
 auto Database::publicActivitiesAndTasks(
     ) const -> tt3::db::api::PublicActivities
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -457,7 +511,7 @@ auto Database::publicActivitiesAndTasks(
 auto Database::publicTasks(
     ) const -> tt3::db::api::PublicTasks
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -469,7 +523,7 @@ auto Database::publicTasks(
 auto Database::rootPublicTasks(
     ) const -> tt3::db::api::PublicTasks
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -479,7 +533,7 @@ auto Database::rootPublicTasks(
 auto Database::projects(
     ) const -> tt3::db::api::Projects
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -491,7 +545,7 @@ auto Database::projects(
 auto Database::rootProjects(
     ) const -> tt3::db::api::Projects
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -501,7 +555,7 @@ auto Database::rootProjects(
 auto Database::workStreams(
     ) const -> tt3::db::api::WorkStreams
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -511,7 +565,7 @@ auto Database::workStreams(
 auto Database::beneficiaries(
     ) const -> tt3::db::api::Beneficiaries
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -527,7 +581,7 @@ auto Database::tryLogin(
 {
     static tt3::util::IMessageDigest * sha1 = tt3::util::StandardMessageDigests::Sha1::instance();  //  idempotent
 
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
     //  We assume database is consistent since last change
 
@@ -536,18 +590,12 @@ auto Database::tryLogin(
     sha1Builder->digestFragment(password);
     QString passwordHash = sha1Builder->digestAsString();
 
-    for (User * user : _users)
+    Account * account = _findAccount(login);
+    if (account != nullptr &&
+        account->_enabled && account->_user->_enabled &&
+        account->_passwordHash == passwordHash)
     {
-        if (user->_enabled)
-        {
-            for (Account * account : std::as_const(user->_accounts))
-            {
-                if (account->_enabled && account->_login == login && account->_passwordHash == passwordHash)
-                {
-                    return account;
-                }
-            }
-        }
+        return account;
     }
     return nullptr;
 }
@@ -650,12 +698,12 @@ auto Database::createUser(
     }
     _markModified();
     //  ...schedule change notifications...
-    _changeNotifier.post(
+    _postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             this, user->type(), user->_oid));
     for (Workload * xmlWorkload : std::as_const(xmlPermittedWorkloads))
     {
-        _changeNotifier.post(
+        _postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 this, xmlWorkload->type(), xmlWorkload->_oid));
     }
@@ -706,9 +754,10 @@ auto Database::createActivityType(
     ActivityType * activityType = new ActivityType(this, _generateOid()); //  registers with Database
     activityType->_displayName = displayName;
     activityType->_description = description;
+    activityType->_addToIndexes();
     _markModified();
     //  ...schedule change notifications...
-    _changeNotifier.post(
+    _postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             this, activityType->type(), activityType->_oid));
     //  ...and we're done
@@ -798,6 +847,7 @@ auto Database::createPublicActivity(
     publicActivity->_requireCommentOnStart = requireCommentOnStart;
     publicActivity->_requireCommentOnStop = requireCommentOnStop;
     publicActivity->_fullScreenReminder = fullScreenReminder;
+    publicActivity->_addToIndexes();
     if (xmlActivityType != nullptr)
     {   //  Link with ActivityType
         publicActivity->_activityType = xmlActivityType;
@@ -814,18 +864,18 @@ auto Database::createPublicActivity(
     }
     _markModified();
     //  ...schedule change notifications...
-    _changeNotifier.post(
+    _postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             this, publicActivity->type(), publicActivity->_oid));
     if (xmlActivityType != nullptr)
     {
-        _changeNotifier.post(
+        _postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 this, xmlActivityType->type(), xmlActivityType->_oid));
     }
     if (xmlWorkload != nullptr)
     {
-        _changeNotifier.post(
+        _postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 this, xmlWorkload->type(), xmlWorkload->_oid));
     }
@@ -920,6 +970,7 @@ auto Database::createPublicTask(
     publicTask->_fullScreenReminder = fullScreenReminder;
     publicTask->_completed = completed;
     publicTask->_requireCommentOnCompletion = requireCommentOnCompletion;
+    publicTask->_addToIndexes();
     if (xmlActivityType != nullptr)
     {   //  Link with ActivityType
         publicTask->_activityType = xmlActivityType;
@@ -936,18 +987,18 @@ auto Database::createPublicTask(
     }
     _markModified();
     //  ...schedule change notifications...
-    _changeNotifier.post(
+    _postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             this, publicTask->type(), publicTask->_oid));
     if (xmlActivityType != nullptr)
     {
-        _changeNotifier.post(
+        _postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 this, xmlActivityType->type(), xmlActivityType->_oid));
     }
     if (xmlWorkload != nullptr)
     {
-        _changeNotifier.post(
+        _postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 this, xmlWorkload->type(), xmlWorkload->_oid));
     }
@@ -1024,6 +1075,7 @@ auto Database::createProject(
     project->_displayName = displayName;
     project->_description = description;
     project->_completed = completed;
+    project->_addToIndexes();
     for (Beneficiary * xmlBeneficiary : std::as_const(xmlBeneficiaries))
     {   //  Link with Beneficiary
         project->_beneficiaries.insert(xmlBeneficiary);
@@ -1033,12 +1085,12 @@ auto Database::createProject(
     }
     _markModified();
     //  ...schedule change notifications...
-    _changeNotifier.post(
+    _postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             this, project->type(), project->_oid));
     for (Beneficiary * xmlBeneficiary : std::as_const(xmlBeneficiaries))
     {
-        _changeNotifier.post(
+        _postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 this, xmlBeneficiary->type(), xmlBeneficiary->_oid));
     }
@@ -1113,6 +1165,7 @@ auto Database::createWorkStream(
     WorkStream * workStream = new WorkStream(this, _generateOid()); //  registers with Database
     workStream->_displayName = displayName;
     workStream->_description = description;
+    workStream->_addToIndexes();
     for (Beneficiary * xmlBeneficiary : std::as_const(xmlBeneficiaries))
     {   //  Link with Beneficiary
         workStream->_beneficiaries.insert(xmlBeneficiary);
@@ -1122,12 +1175,12 @@ auto Database::createWorkStream(
     }
     _markModified();
     //  ...schedule change notifications...
-    _changeNotifier.post(
+    _postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             this, workStream->type(), workStream->_oid));
     for (Beneficiary * xmlBeneficiary : std::as_const(xmlBeneficiaries))
     {
-        _changeNotifier.post(
+        _postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 this, xmlBeneficiary->type(), xmlBeneficiary->_oid));
     }
@@ -1202,6 +1255,7 @@ auto Database::createBeneficiary(
     Beneficiary * beneficiary = new Beneficiary(this, _generateOid()); //  registers with Database
     beneficiary->_displayName = displayName;
     beneficiary->_description = description;
+    beneficiary->_addToIndexes();
     for (Workload * xmlWorkload : std::as_const(xmlWorkloads))
     {   //  Link with Workload
         beneficiary->_workloads.insert(xmlWorkload);
@@ -1211,12 +1265,12 @@ auto Database::createBeneficiary(
     }
     _markModified();
     //  ...schedule change notifications...
-    _changeNotifier.post(
+    _postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             this, beneficiary->type(), beneficiary->_oid));
     for (Workload * xmlWorkload : std::as_const(xmlWorkloads))
     {
-        _changeNotifier.post(
+        _postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 this, xmlWorkload->type(), xmlWorkload->_oid));
     }
@@ -1268,6 +1322,181 @@ auto Database::lock(
     return databaseLock;
 }
 
+//////////
+//  tt3::db::api::IDatabase (bulk loading)
+void Database::beginBulkLoad()
+{
+    tt3::util::Lock _(_guard);
+    _ensureOpenAndWritable();   //  may throw
+#ifdef Q_DEBUG
+    _validate();    //  may throw
+#endif
+
+    if (_bulkLoading)
+    {   //  OOPS! Bulk-load sessions cannot nest
+        throw tt3::db::api::AccessDeniedException();
+    }
+    _bulkLoading = true;
+    _bulkLoadOid = tt3::db::api::Oid::Invalid;
+}
+
+void Database::endBulkLoad()
+{
+    tt3::util::Lock _(_guard);
+
+    if (!_bulkLoading)
+    {   //  Nothing to do
+        return;
+    }
+    _bulkLoading = false;
+    _bulkLoadOid = tt3::db::api::Oid::Invalid;
+    _ensureOpenAndWritable();   //  may throw
+
+    //  Whatever has been loaded is there now, valid or not,
+    //  so mark the database modified once - nothing loaded
+    //  was journalled, so the XML file must be re-written
+    //  at the next opportunity...
+    _markModified();
+    _nextSaveAt = QDateTime::currentDateTimeUtc();
+    //  ...replace all the per-object change notifications
+    //  we've dropped with a single one...
+    _changeNotifier.post(
+        new tt3::db::api::DatabaseReloadedNotification(this));
+    //  ...and validate everything loaded at once
+    _validate();    //  may throw
+}
+
+bool Database::isBulkLoading() const
+{
+    tt3::util::ReadLock _(_guard);
+    return _bulkLoading;
+}
+
+void Database::setBulkLoadOid(
+        const tt3::db::api::Oid & oid
+    )
+{
+    tt3::util::Lock _(_guard);
+    _ensureOpenAndWritable();   //  may throw
+
+    if (!_bulkLoading)
+    {   //  OOPS! Only bulk loaders can choose OIDs
+        throw tt3::db::api::AccessDeniedException();
+    }
+    if (!oid.isValid())
+    {   //  OOPS!
+        throw tt3::db::api::InvalidPropertyValueException(
+            "Object",
+            "OID",
+            oid);
+    }
+    if (_liveObjects.contains(oid) ||
+        _graveyard.contains(oid) ||
+        _tombstones.contains(oid))  //  can't reuse OIDs!
+    {   //  OOPS!
+        throw tt3::db::api::AlreadyExistsException(
+            "Object",
+            "OID",
+            oid);
+    }
+    _bulkLoadOid = oid;
+}
+
+//////////
+//  tt3::db::api::IDatabase (change tracking)
+quint64 Database::modificationStamp(
+    ) const
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();  //  may throw
+
+    return _modificationStamp;
+}
+
+auto Database::modifiedOidsSince(
+        quint64 modificationStamp
+    ) const -> tt3::db::api::Oids
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();  //  may throw
+
+    tt3::db::api::Oids result;
+    for (Object * object : _liveObjects)
+    {
+        if (object->_modificationStamp > modificationStamp)
+        {
+            result.insert(object->_oid);
+        }
+    }
+    return result;
+}
+
+auto Database::destroyedOidsSince(
+        quint64 modificationStamp
+    ) const -> tt3::db::api::Oids
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();  //  may throw
+
+    tt3::db::api::Oids result;
+    for (auto it = _tombstones.cbegin(); it != _tombstones.cend(); ++it)
+    {
+        if (it.value() > modificationStamp)
+        {
+            result.insert(it.key());
+        }
+    }
+    return result;
+}
+
+QUuid Database::instanceId(
+    ) const
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();  //  may throw
+
+    return _instanceId;
+}
+
+void Database::recordFullBackup(
+        quint64 modificationStamp
+    )
+{
+    tt3::util::Lock _(_guard);
+    _ensureOpenAndWritable();   //  may throw
+
+    if (modificationStamp <= _latestFullBackupModificationStamp ||
+        modificationStamp > _modificationStamp)
+    {   //  Out of order, or not a stamp of this database
+        return;
+    }
+    //  Deltas against the previous full backup can still be
+    //  written, but nothing older than it is needed any more
+    for (auto it = _tombstones.begin(); it != _tombstones.end(); )
+    {
+        if (it.value() <= _latestFullBackupModificationStamp)
+        {
+            it = _tombstones.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    _oldestBaseModificationStamp = _latestFullBackupModificationStamp;
+    _latestFullBackupModificationStamp = modificationStamp;
+    _markModified();
+}
+
+quint64 Database::oldestBaseModificationStamp(
+    ) const
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();  //  may throw
+
+    return _oldestBaseModificationStamp;
+}
+
 //////////
 //  Implementation helpers
 void Database::_ensureOpen() const
@@ -1282,7 +1511,7 @@ void Database::_ensureOpen() const
 
 void Database::_ensureOpenAndWritable() const
 {
-    Q_ASSERT(_guard.isLockedByCurrentThread());
+    Q_ASSERT(_guard.isLockedForWritingByCurrentThread());
 
     if (!_isOpen)
     {   //  OOPS!
@@ -1295,10 +1524,75 @@ void Database::_ensureOpenAndWritable() const
 }
 
 void Database::_markModified()
+{
+    Q_ASSERT(_guard.isLockedForWritingByCurrentThread());
+
+    if (!_bulkLoading)
+    {   //  ...else the database is marked modified
+        //  once, when the bulk-load session ends
+        _needsSaving = true;
+    }
+}
+
+void Database::_recordChange(
+        const tt3::db::api::Oid & oid
+    )
 {
     Q_ASSERT(_guard.isLockedByCurrentThread());
 
-    _needsSaving = true;
+    //  Remember the affected object for the next validation
+    //  and, if journalling, for the next journal batch...
+    _unvalidatedOids.insert(oid);
+    if (_journalFile.isOpen() && !_bulkLoading)
+    {
+        _journalDirtyOids.insert(oid);
+    }
+    //  ...and stamp the change
+    if (Object * object = _liveObjects.value(oid))
+    {
+        object->_modificationStamp = ++_modificationStamp;
+    }
+    else
+    {   //  Destroyed or re-OIDed
+        _tombstones.insert(oid, ++_modificationStamp);
+    }
+}
+
+void Database::_postChangeNotification(
+        tt3::db::api::ChangeNotification * notification
+    )
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+    Q_ASSERT(notification != nullptr);
+
+    //  Record the change to the affected object, if any
+    tt3::db::api::Oid oid;
+    if (auto objectCreated =
+        dynamic_cast<tt3::db::api::ObjectCreatedNotification*>(notification))
+    {
+        oid = objectCreated->oid();
+    }
+    else if (auto objectDestroyed =
+             dynamic_cast<tt3::db::api::ObjectDestroyedNotification*>(notification))
+    {
+        oid = objectDestroyed->oid();
+    }
+    else if (auto objectModified =
+             dynamic_cast<tt3::db::api::ObjectModifiedNotification*>(notification))
+    {
+        oid = objectModified->oid();
+    }
+    if (oid != tt3::db::api::Oid::Invalid)
+    {
+        _recordChange(oid);
+    }
+    if (_bulkLoading)
+    {   //  A single "reloaded" notification will be
+        //  posted when the bulk-load session ends
+        delete notification;
+        return;
+    }
+    _changeNotifier.post(notification);
 }
 
 void Database::_markClosed()
@@ -1316,6 +1610,8 @@ void Database::_markClosed()
         delete _lockRefresher;
         _lockRefresher = nullptr;
     }
+    _journalFile.close();
+    _unvalidatedOids.clear();
     _isOpen = false;
 }
 
@@ -1323,10 +1619,18 @@ tt3::db::api::Oid Database::_generateOid()
 {
     Q_ASSERT(_guard.isLockedByCurrentThread());
 
+    if (_bulkLoadOid != tt3::db::api::Oid::Invalid)
+    {   //  Supplied by the bulk loader; already checked
+        //  to be unique, and good for one object only
+        tt3::db::api::Oid oid = _bulkLoadOid;
+        _bulkLoadOid = tt3::db::api::Oid::Invalid;
+        return oid;
+    }
     for (; ; )
     {
         tt3::db::api::Oid oid = tt3::db::api::Oid::createRandom();
-        if (!_liveObjects.contains(oid) && !_graveyard.contains(oid))
+        if (!_liveObjects.contains(oid) && !_graveyard.contains(oid) &&
+            !_tombstones.contains(oid))
         {
             return oid;
         }
@@ -1351,17 +1655,7 @@ Account * Database::_findAccount(const QString & login) const
     Q_ASSERT(_guard.isLockedByCurrentThread());
     _ensureOpen();  //  may throw
 
-    for (User * user : _users)
-    {
-        for (Account * account : std::as_const(user->_accounts))
-        {
-            if (account->_login == login)
-            {
-                return account;
-            }
-        }
-    }
-    return nullptr;
+    return _accountsByLogin.value(login, nullptr);
 }
 
 ActivityType * Database::_findActivityType(const QString & displayName) const
@@ -1369,14 +1663,7 @@ ActivityType * Database::_findActivityType(const QString & displayName) const
     Q_ASSERT(_guard.isLockedByCurrentThread());
     _ensureOpen();  //  may throw
 
-    for (ActivityType * activityType : _activityTypes)
-    {
-        if (activityType->_displayName == displayName)
-        {
-            return activityType;
-        }
-    }
-    return nullptr;
+    return _activityTypesByDisplayName.value(displayName, nullptr);
 }
 
 auto Database::_findPublicActivity(
@@ -1386,14 +1673,7 @@ auto Database::_findPublicActivity(
     Q_ASSERT(_guard.isLockedByCurrentThread());
     _ensureOpen();  //  may throw
 
-    for (PublicActivity * publicActivity : _publicActivities)
-    {
-        if (publicActivity->_displayName == displayName)
-        {
-            return publicActivity;
-        }
-    }
-    return nullptr;
+    return _publicActivitiesByDisplayName.value(displayName, nullptr);
 }
 
 auto Database::_findRootPublicTask(
@@ -1403,14 +1683,7 @@ auto Database::_findRootPublicTask(
     Q_ASSERT(_guard.isLockedByCurrentThread());
     _ensureOpen();  //  may throw
 
-    for (PublicTask * publicTask : _rootPublicTasks)
-    {
-        if (publicTask->_displayName == displayName)
-        {
-            return publicTask;
-        }
-    }
-    return nullptr;
+    return _rootPublicTasksByDisplayName.value(displayName, nullptr);
 }
 
 auto Database::_findRootProject(
@@ -1420,14 +1693,7 @@ auto Database::_findRootProject(
     Q_ASSERT(_guard.isLockedByCurrentThread());
     _ensureOpen();  //  may throw
 
-    for (Project * project : _rootProjects)
-    {
-        if (project->_displayName == displayName)
-        {
-            return project;
-        }
-    }
-    return nullptr;
+    return _rootProjectsByDisplayName.value(displayName, nullptr);
 }
 
 WorkStream * Database::_findWorkStream(const QString & displayName) const
@@ -1435,14 +1701,7 @@ WorkStream * Database::_findWorkStream(const QString & displayName) const
     Q_ASSERT(_guard.isLockedByCurrentThread());
     _ensureOpen();  //  may throw
 
-    for (WorkStream * workStream : _workStreams)
-    {
-        if (workStream->_displayName == displayName)
-        {
-            return workStream;
-        }
-    }
-    return nullptr;
+    return _workStreamsByDisplayName.value(displayName, nullptr);
 }
 
 Beneficiary * Database::_findBeneficiary(const QString & displayName) const
@@ -1450,31 +1709,33 @@ Beneficiary * Database::_findBeneficiary(const QString & displayName) const
     Q_ASSERT(_guard.isLockedByCurrentThread());
     _ensureOpen();  //  may throw
 
-    for (Beneficiary * beneficiary : _beneficiaries)
-    {
-        if (beneficiary->_displayName == displayName)
-        {
-            return beneficiary;
-        }
-    }
-    return nullptr;
+    return _beneficiariesByDisplayName.value(displayName, nullptr);
 }
 
 void Database::_savePeriodically()
 {
     Q_ASSERT(_guard.isLockedByCurrentThread());
 
+    if (_bulkLoading)
+    {   //  The journal does not cover what is being
+        //  loaded, so wait for the bulk load to end
+        return;
+    }
     if (_needsSaving)
     {
         QDateTime now = QDateTime::currentDateTimeUtc();
-        if (now >= _nextSaveAt)
-        {   //  It's time to save
+        if (now >= _nextSaveAt || _journalFile.size() > _MaxJournalSize)
+        {   //  It's time to fold the journal into the XML file
             _save();    //  may throw
             _needsSaving = false;
             QDateTime then = QDateTime::currentDateTimeUtc();
             _lastSaveDurationMs = now.msecsTo(then);
             _nextSaveAt = then.addMSecs(_SaveIntervalMs);
         }
+        else
+        {   //  Just journal the recent changes
+            _flushJournal();    //  may throw
+        }
     }
 }
 
@@ -1510,45 +1771,6 @@ void Database::_save()
     //  Make sure we're consistent
     _validate();    //  may throw
 
-    //  Create DOM document with a root node
-    QDomDocument document;
-    QDomProcessingInstruction xmlDeclaration = document.createProcessingInstruction("xml", "version='1.0' encoding='UTF-8' standalone='yes'");
-    document.appendChild(xmlDeclaration);
-
-    QDomElement rootElement = document.createElement("TT3");
-    rootElement.setAttribute("FormatVersion", "1");
-    document.appendChild(rootElement);
-
-    _serializeAggregation(
-        rootElement,
-        "Users",
-        _users);    //  + accounts, works, events, etc.
-    _serializeAggregation(
-        rootElement,
-        "ActivityTypes",
-        _activityTypes);
-    _serializeAggregation(
-        rootElement,
-        "PublicActivities",
-        _publicActivities);
-    _serializeAggregation(
-        rootElement,
-        "PublicTasks",
-        _rootPublicTasks);
-    _serializeAggregation(
-        rootElement,
-        "Projects",
-        _rootProjects);
-    _serializeAggregation(
-        rootElement,
-        "WorkStreams",
-        _workStreams);
-    _serializeAggregation(
-        rootElement,
-        "Beneficiaries",
-        _beneficiaries);
-
-    //  Save DOM
     //  Use the renaming scheme for data safety:
     //  1.  Generate "old" and "new" XML file name
     //      from the "_address", making sure neither one exists.
@@ -1575,8 +1797,67 @@ void Database::_save()
     {   //  OOPS!
         throw tt3::db::api::CustomDatabaseException(newFile.fileName() + ": " +  newFile.errorString());
     }
-    QTextStream stream(&newFile);
-    document.save(stream, 4);
+    //  Objects are streamed straight to the file; the
+    //  XML declaration is written verbatim to keep the
+    //  file looking exactly as it always has.
+    newFile.write("<?xml version='1.0' encoding='UTF-8' standalone='yes'?>\n");
+    QXmlStreamWriter writer(&newFile);
+    writer.setAutoFormatting(true);
+    writer.setAutoFormattingIndent(4);
+
+    writer.writeStartElement("TT3");
+    writer.writeAttribute("FormatVersion", "1");
+    writer.writeAttribute("InstanceId", _instanceId.toString(QUuid::WithoutBraces));
+    _serializeAggregation(
+        writer,
+        "Users",
+        _users);    //  + accounts, works, events, etc.
+    _serializeAggregation(
+        writer,
+        "ActivityTypes",
+        _activityTypes);
+    _serializeAggregation(
+        writer,
+        "PublicActivities",
+        _publicActivities);
+    _serializeAggregation(
+        writer,
+        "PublicTasks",
+        _rootPublicTasks);
+    _serializeAggregation(
+        writer,
+        "Projects",
+        _rootProjects);
+    _serializeAggregation(
+        writer,
+        "WorkStreams",
+        _workStreams);
+    _serializeAggregation(
+        writer,
+        "Beneficiaries",
+        _beneficiaries);
+    writer.writeStartElement("Tombstones");
+    writer.writeAttribute("LatestFullBackupModificationStamp", tt3::util::toString(_latestFullBackupModificationStamp));
+    writer.writeAttribute("OldestBaseModificationStamp", tt3::util::toString(_oldestBaseModificationStamp));
+    QList<tt3::db::api::Oid> tombstoneOids = _tombstones.keys();
+    std::sort(tombstoneOids.begin(), tombstoneOids.end());
+    for (const auto & oid : std::as_const(tombstoneOids))
+    {   //  Sorting by OID to reduce changes
+        writer.writeStartElement("Tombstone");
+        writer.writeAttribute("FormerOID", tt3::util::toString(oid));
+        writer.writeAttribute("ModificationStamp", tt3::util::toString(_tombstones[oid]));
+        writer.writeEndElement();
+    }
+    writer.writeEndElement();
+    writer.writeEndDocument();
+
+    if (writer.hasError() || !newFile.flush())
+    {   //  OOPS! Cleanup & throw
+        QString errorString = newFile.errorString();
+        newFile.close();
+        newFile.remove();
+        throw tt3::db::api::CustomDatabaseException(newFile.fileName() + ": " +  errorString);
+    }
     newFile.close();
     //  Step 3
     {
@@ -1603,41 +1884,92 @@ void Database::_save()
     //  Step 5
     oldFile.remove();
 
+    //  The XML file now includes everything journalled so far
+    _resetJournal();    //  may throw
+
     //  All done
     _needsSaving = false;
 }
 
 //////////
 //  Deserialization
-void Database::_load()
+bool Database::_load()
 {
     Q_ASSERT(_guard.isLockedByCurrentThread());
     _ensureOpen();  //  may throw
 
-    _deserializationMap.clear();
-    //  Load XML DOM
-    QDomDocument document;
     QFile file(_address->_path);
     if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
     {   //  OOPS!
         throw tt3::db::api::CustomDatabaseException(_address->displayForm() + ": " + file.errorString());
     }
-    if (!document.setContent(&file))
-    {   //  OOPS!
-        throw tt3::db::api::DatabaseCorruptException(_address);
+
+    //  Changes made since the XML file was last saved
+    //  must be applied to the XML DOM. This only happens
+    //  after a crash - normally we stream from the file.
+    bool journalReplayed = false;
+    QFile journalFile(_address->_path + ".journal");
+    if (_openCurrentJournal(journalFile))   //  may throw
+    {
+        QDomDocument document;
+        if (!document.setContent(&file))
+        {   //  OOPS!
+            throw tt3::db::api::DatabaseCorruptException(_address);
+        }
+        if (document.documentElement().tagName() != "TT3")
+        {   //  OOPS!
+            throw tt3::db::api::DatabaseCorruptException(_address);
+        }
+        journalReplayed = _replayJournal(journalFile, document);    //  may throw
+        QXmlStreamReader reader(document.toByteArray(-1));
+        _deserialize(reader);   //  may throw
     }
+    else
+    {
+        QXmlStreamReader reader(&file);
+        _deserialize(reader);   //  may throw
+    }
+
+    //  Done loading - make sure we're consistent
+    _validateAll(); //  may throw
+
+    //  Files written before instance IDs get one now
+    bool instanceIdIssued = _instanceId.isNull();
+    if (instanceIdIssued)
+    {
+        _instanceId = QUuid::createUuid();
+    }
+    return journalReplayed || instanceIdIssued;
+}
+
+void Database::_deserialize(
+        QXmlStreamReader & reader
+    )
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+
+    _deserializationMap.clear();
 
     //  Validate root element
-    QDomElement rootElement = document.documentElement();
-    if (rootElement.isNull() ||
-        rootElement.tagName() != "TT3" ||
-        rootElement.attribute("FormatVersion") != "1")
+    if (!reader.readNextStartElement() ||
+        reader.name() != u"TT3" ||
+        reader.attributes().value("FormatVersion") != u"1")
     {   //  OOPS!
         throw tt3::db::api::DatabaseCorruptException(_address);
     }
+    QString instanceId = reader.attributes().value("InstanceId").toString();
+    _instanceId = QUuid();
+    if (!instanceId.isEmpty())
+    {
+        _instanceId = QUuid::fromString(instanceId);
+        if (_instanceId.isNull())
+        {   //  OOPS!
+            throw tt3::db::api::DatabaseCorruptException(_address);
+        }
+    }
 
     _deserializeAggregation<User>(
-        rootElement,
+        reader,
         "Users",
         _users,
         [&](auto oid)
@@ -1645,7 +1977,7 @@ void Database::_load()
             return new User(this, oid);
         }); //  + accounts, works, events, etc.
     _deserializeAggregation<ActivityType>(
-        rootElement,
+        reader,
         "ActivityTypes",
         _activityTypes,
         [&](auto oid)
@@ -1653,7 +1985,7 @@ void Database::_load()
             return new ActivityType(this, oid);
         });
     _deserializeAggregation<PublicActivity>(
-        rootElement,
+        reader,
         "PublicActivities",
         _publicActivities,
         [&](auto oid)
@@ -1661,7 +1993,7 @@ void Database::_load()
             return new PublicActivity(this, oid);
         });
     _deserializeAggregation<PublicTask>(
-        rootElement,
+        reader,
         "PublicTasks",
         _rootPublicTasks,
         [&](auto oid)
@@ -1669,7 +2001,7 @@ void Database::_load()
             return new PublicTask(this, oid);
         });
     _deserializeAggregation<Project>(
-        rootElement,
+        reader,
         "Projects",
         _rootProjects,
         [&](auto oid)
@@ -1677,7 +2009,7 @@ void Database::_load()
             return new Project(this, oid);
         });
     _deserializeAggregation<WorkStream>(
-        rootElement,
+        reader,
         "WorkStreams",
         _workStreams,
         [&](auto oid)
@@ -1685,65 +2017,471 @@ void Database::_load()
             return new WorkStream(this, oid);
         });
     _deserializeAggregation<Beneficiary>(
-        rootElement,
+        reader,
         "Beneficiaries",
         _beneficiaries,
         [&](auto oid)
         {
             return new Beneficiary(this, oid);
         });
+    //  Files written before change tracking have no tombstones
+    if (reader.readNextStartElement())
+    {
+        if (reader.name() == u"Tombstones")
+        {
+            QXmlStreamAttributes attributes = reader.attributes();
+            _latestFullBackupModificationStamp =
+                tt3::util::fromString(attributes.value("LatestFullBackupModificationStamp").toString(), quint64(0));
+            _oldestBaseModificationStamp =
+                tt3::util::fromString(attributes.value("OldestBaseModificationStamp").toString(), quint64(0));
+            if (_oldestBaseModificationStamp > _latestFullBackupModificationStamp)
+            {   //  OOPS!
+                throw tt3::db::api::DatabaseCorruptException(_address);
+            }
+            //  Pruned tombstones may have had the latest stamps
+            _modificationStamp = qMax(_modificationStamp, _latestFullBackupModificationStamp);
+            while (reader.readNextStartElement())
+            {
+                if (reader.name() == u"Tombstone")
+                {
+                    QXmlStreamAttributes attributes = reader.attributes();
+                    tt3::db::api::Oid oid =
+                        tt3::db::api::Oid::parse(attributes.value("FormerOID"));
+                    quint64 modificationStamp =
+                        tt3::util::fromString(attributes.value("ModificationStamp").toString(), quint64(0));
+                    if (!oid.isValid() || _liveObjects.contains(oid))
+                    {   //  OOPS!
+                        throw tt3::db::api::DatabaseCorruptException(_address);
+                    }
+                    _tombstones.insert(oid, modificationStamp);
+                    _modificationStamp = qMax(_modificationStamp, modificationStamp);
+                }
+                reader.skipCurrentElement();
+            }
+        }
+        else
+        {   //  Not ours - ignore
+            reader.skipCurrentElement();
+        }
+    }
+
+    //  The rest of the document must still be well-formed
+    while (!reader.atEnd())
+    {
+        reader.readNext();
+    }
+    if (reader.hasError())
+    {   //  OOPS!
+        throw tt3::db::api::DatabaseCorruptException(_address);
+    }
 
     //  Now we can do the asociations
     Q_ASSERT(_liveObjects.size() == _deserializationMap.size());
-    for (Object * object : _deserializationMap.keys())
+    for (auto it = _deserializationMap.cbegin(); it != _deserializationMap.cend(); ++it)
     {
-        object->_deserializeAssociations(_deserializationMap[object]);
+        it.key()->_deserializeAssociations(it.value());
     }
-
-    //  Done loading - make sure we're consistent
     _deserializationMap.clear();
-    _validate();    //  may throw
 }
 
-QList<QDomElement> Database::_childElements(
-        const QDomElement & parentElement,
-        const QString & tagName
+//////////
+//  Journalling
+void Database::_resetJournal()
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+
+    if (!_journalFile.isOpen())
+    {
+        _journalFile.setFileName(_address->_path + ".journal");
+        if (!_journalFile.open(QIODevice::ReadWrite))
+        {   //  OOPS!
+            throw tt3::db::api::CustomDatabaseException(_journalFile.fileName() + ": " + _journalFile.errorString());
+        }
+    }
+    if (!_journalFile.resize(0) || !_journalFile.seek(0))
+    {   //  OOPS!
+        throw tt3::db::api::CustomDatabaseException(_journalFile.fileName() + ": " + _journalFile.errorString());
+    }
+
+    //  The journal header identifies the XML file the
+    //  journal applies to - a journal left behind by a
+    //  crash after the XML file was re-written is stale
+    QFileInfo fileInfo(_address->_path);
+    QByteArray header;
+    QXmlStreamWriter writer(&header);
+    writer.writeStartElement("Journal");
+    writer.writeAttribute("BaseSize", tt3::util::toString(fileInfo.size()));
+    writer.writeAttribute("BaseModifiedAt", tt3::util::toString(fileInfo.lastModified(QTimeZone::UTC)));
+    writer.writeEndElement();
+    _writeJournal(header);  //  may throw
+
+    _journalDirtyOids.clear();
+    _journalRenames.clear();
+}
+
+void Database::_flushJournal()
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+
+    if (!_journalFile.isOpen() ||
+        (_journalDirtyOids.isEmpty() && _journalRenames.isEmpty()))
+    {   //  Nothing to do
+        return;
+    }
+
+    QByteArray batch;
+    QXmlStreamWriter writer(&batch);
+    writer.writeStartElement("Batch");
+
+    //  OID changes go first, as subsequent records
+    //  refer to objects by their new OIDs...
+    for (const auto & [oldOid, newOid] : std::as_const(_journalRenames))
+    {
+        writer.writeStartElement("Rename");
+        writer.writeAttribute("OID", tt3::util::toString(oldOid));
+        writer.writeAttribute("NewOID", tt3::util::toString(newOid));
+        writer.writeEndElement();
+    }
+
+    //  ...then live objects, parents before children...
+    QList<Object*> liveObjects;
+    QList<tt3::db::api::Oid> deadOids;
+    for (const auto & oid : std::as_const(_journalDirtyOids))
+    {
+        if (_liveObjects.contains(oid))
+        {
+            liveObjects.append(_liveObjects[oid]);
+        }
+        else
+        {
+            deadOids.append(oid);
+        }
+    }
+    auto depth = [](Object * object)
+    {
+        int result = 0;
+        for (Object * parent = object->_serializationParent();
+             parent != nullptr;
+             parent = parent->_serializationParent())
+        {
+            result++;
+        }
+        return result;
+    };
+    std::stable_sort(
+        liveObjects.begin(),
+        liveObjects.end(),
+        [&](auto a, auto b) { return depth(a) < depth(b); });
+    _shallowSerialization = true;
+    for (Object * object : std::as_const(liveObjects))
+    {
+        writer.writeStartElement("Put");
+        if (Object * parent = object->_serializationParent())
+        {
+            writer.writeAttribute("Parent", tt3::util::toString(parent->_oid));
+        }
+        writer.writeAttribute("Aggregation", object->_serializationAggregationName());
+        _serializeObject(writer, object);
+        writer.writeEndElement();
+    }
+    _shallowSerialization = false;
+
+    //  ...and destroyed objects last
+    for (const auto & oid : std::as_const(deadOids))
+    {
+        writer.writeStartElement("Delete");
+        writer.writeAttribute("OID", tt3::util::toString(oid));
+        writer.writeAttribute("ModificationStamp", tt3::util::toString(_tombstones.value(oid)));
+        writer.writeEndElement();
+    }
+    writer.writeEndElement();
+
+    //  A batch is a single line, so a batch torn
+    //  by a crash is easily recognized on replay
+    _writeJournal(batch);   //  may throw
+    _journalDirtyOids.clear();
+    _journalRenames.clear();
+}
+
+void Database::_writeJournal(const QByteArray & bytes)
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+    Q_ASSERT(_journalFile.isOpen());
+    Q_ASSERT(!bytes.contains('\n'));
+
+    QByteArray line = bytes + '\n';
+    if (_journalFile.write(line) != line.size() ||
+        !_journalFile.flush())
+    {   //  OOPS!
+        throw tt3::db::api::CustomDatabaseException(_journalFile.fileName() + ": " + _journalFile.errorString());
+    }
+    //  Make sure the batch survives a crash
+#if defined(Q_OS_WINDOWS)
+    int syncResult = ::_commit(_journalFile.handle());
+#elif defined(Q_OS_LINUX)
+    int syncResult = ::fsync(_journalFile.handle());
+#else
+    #error Unsupported platform
+#endif
+    if (syncResult != 0)
+    {   //  OOPS!
+        throw tt3::db::api::CustomDatabaseException(_journalFile.fileName() + ": " + _journalFile.errorString());
+    }
+}
+
+bool Database::_openCurrentJournal(
+        QFile & journalFile
     )
 {
-    QList<QDomElement> result;
-    for (QDomNode childNode = parentElement.firstChild();
-         !childNode.isNull();
-         childNode = childNode.nextSibling())
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+
+    if (!journalFile.exists())
+    {   //  Nothing to replay
+        return false;
+    }
+    if (!journalFile.open(QIODevice::ReadOnly))
+    {   //  OOPS!
+        throw tt3::db::api::CustomDatabaseException(journalFile.fileName() + ": " + journalFile.errorString());
+    }
+
+    //  Is the journal for THIS XML file ?
+    QFileInfo fileInfo(_address->_path);
+    QDomDocument headerDocument;
+    if (!headerDocument.setContent(journalFile.readLine()))
+    {   //  Torn header - nothing was ever journalled
+        return false;
+    }
+    QDomElement headerElement = headerDocument.documentElement();
+    if (headerElement.tagName() != "Journal" ||
+        headerElement.attribute("BaseSize") != tt3::util::toString(fileInfo.size()) ||
+        headerElement.attribute("BaseModifiedAt") != tt3::util::toString(fileInfo.lastModified(QTimeZone::UTC)))
+    {   //  Stale - the XML file already includes the journalled changes
+        return false;
+    }
+    return true;
+}
+
+bool Database::_replayJournal(
+        QFile & journalFile,
+        QDomDocument & document
+    )
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+    Q_ASSERT(journalFile.isOpen());
+
+    //  Apply batches to the XML DOM
+    QDomElement rootElement = document.documentElement();
+    QHash<QString, QDomElement> objectElements;
+    _indexObjectElements(rootElement, objectElements);
+    auto tombstonesElement = [&]()
+    {
+        QDomElement result = rootElement.firstChildElement("Tombstones");
+        if (result.isNull())
+        {   //  Files written before change tracking have none
+            result = document.createElement("Tombstones");
+            rootElement.appendChild(result);
+        }
+        return result;
+    };
+    auto aggregationElement = [&](const QDomElement & putElement)
     {
-        if (childNode.isElement())
+        QDomElement parentElement = rootElement;
+        if (putElement.hasAttribute("Parent"))
         {
-            QDomElement childElement = childNode.toElement();
-            if (childElement.tagName() == tagName)
+            parentElement = objectElements.value(putElement.attribute("Parent"));
+        }
+        QDomElement result =
+            parentElement.isNull() ?
+                QDomElement() :
+                parentElement.firstChildElement(putElement.attribute("Aggregation"));
+        if (result.isNull())
+        {   //  OOPS!
+            throw tt3::db::api::DatabaseCorruptException(_address);
+        }
+        return result;
+    };
+
+    bool replayed = false;
+    while (!journalFile.atEnd())
+    {
+        QDomDocument batchDocument;
+        if (!batchDocument.setContent(journalFile.readLine()))
+        {   //  A batch torn by a crash - it can only be the last one
+            break;
+        }
+        QDomElement batchElement = batchDocument.documentElement();
+        if (batchElement.tagName() != "Batch")
+        {   //  OOPS!
+            throw tt3::db::api::DatabaseCorruptException(_address);
+        }
+        for (QDomElement recordElement = batchElement.firstChildElement();
+             !recordElement.isNull();
+             recordElement = recordElement.nextSiblingElement())
+        {
+            if (recordElement.tagName() == "Rename")
+            {
+                QString oid = recordElement.attribute("OID");
+                QString newOid = recordElement.attribute("NewOID");
+                if (objectElements.contains(oid))
+                {
+                    QDomElement objectElement = objectElements.take(oid);
+                    objectElement.setAttribute("OID", newOid);
+                    objectElements.insert(newOid, objectElement);
+                }
+            }
+            else if (recordElement.tagName() == "Put")
             {
-                result.append(childElement);
+                QDomElement snapshotElement = recordElement.firstChildElement();
+                QString oid = snapshotElement.attribute("OID");
+                if (snapshotElement.isNull() || oid.isEmpty())
+                {   //  OOPS!
+                    throw tt3::db::api::DatabaseCorruptException(_address);
+                }
+                QDomElement targetElement = aggregationElement(recordElement);
+                if (objectElements.contains(oid))
+                {   //  Replace properties & associations, keep aggregations
+                    QDomElement objectElement = objectElements[oid];
+                    QDomNamedNodeMap oldAttributes = objectElement.attributes();
+                    QStringList oldNames;
+                    for (int i = 0; i < oldAttributes.count(); i++)
+                    {
+                        oldNames.append(oldAttributes.item(i).nodeName());
+                    }
+                    for (const QString & name : std::as_const(oldNames))
+                    {
+                        objectElement.removeAttribute(name);
+                    }
+                    QDomNamedNodeMap newAttributes = snapshotElement.attributes();
+                    for (int i = 0; i < newAttributes.count(); i++)
+                    {
+                        QDomAttr attribute = newAttributes.item(i).toAttr();
+                        objectElement.setAttribute(attribute.name(), attribute.value());
+                    }
+                    if (objectElement.parentNode() != targetElement)
+                    {   //  Re-parented
+                        targetElement.appendChild(objectElement);
+                    }
+                }
+                else
+                {   //  A new object
+                    QDomElement objectElement =
+                        document.importNode(snapshotElement, true).toElement();
+                    targetElement.appendChild(objectElement);
+                    objectElements.insert(oid, objectElement);
+                }
+            }
+            else if (recordElement.tagName() == "Delete")
+            {
+                QString oid = recordElement.attribute("OID");
+                if (objectElements.contains(oid))
+                {   //  Aggregated objects go away along with it
+                    QDomElement objectElement = objectElements.take(oid);
+                    objectElement.parentNode().removeChild(objectElement);
+                }
+                if (recordElement.hasAttribute("ModificationStamp"))
+                {   //  Journals written before change tracking have none
+                    QDomElement tombstoneElement = document.createElement("Tombstone");
+                    tombstoneElement.setAttribute("FormerOID", oid);
+                    tombstoneElement.setAttribute("ModificationStamp", recordElement.attribute("ModificationStamp"));
+                    tombstonesElement().appendChild(tombstoneElement);
+                }
+            }
+            else
+            {   //  OOPS!
+                throw tt3::db::api::DatabaseCorruptException(_address);
             }
         }
+        replayed = true;
     }
-    return result;
+    return replayed;
 }
 
-auto Database::_childElement(
+void Database::_indexObjectElements(
         const QDomElement & parentElement,
-        const QString & tagName
-    ) -> QDomElement
+        QHash<QString, QDomElement> & objectElements
+    )
 {
-    QList<QDomElement> children = _childElements(parentElement, tagName);
-    if (children.size() != 1)
-    {   //  OOPS!
-        throw tt3::db::api::DatabaseCorruptException(_address);
+    for (QDomElement childElement = parentElement.firstChildElement();
+         !childElement.isNull();
+         childElement = childElement.nextSiblingElement())
+    {
+        if (childElement.hasAttribute("OID"))
+        {
+            objectElements.insert(childElement.attribute("OID"), childElement);
+        }
+        _indexObjectElements(childElement, objectElements);
     }
-    return children[0];
 }
 
 //////////
 //  Validation
 void Database::_validate()
 {
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+    Q_ASSERT(!_validatingIncrementally);
+
+    if (_unvalidatedOids.isEmpty())
+    {   //  Nothing has changed since the last validation
+        return;
+    }
+    if (_bulkLoading)
+    {   //  Deferred until the bulk-load session ends
+        return;
+    }
+
+    //  Validate the objects touched since the last validation;
+    //  objects they aggregate are validated only if touched too.
+    //  Objects linked to a touched one are covered, as
+    //  links are always validated from both ends.
+    Objects validatedObjects;
+    _validatingIncrementally = true;
+    try
+    {
+        for (const auto & oid : std::as_const(_unvalidatedOids))
+        {
+            if (Object * object = _liveObjects.value(oid, nullptr))
+            {
+                if (object->_oid != oid || _graveyard.contains(oid))
+                {   //  OOPS!
+                    throw tt3::db::api::DatabaseCorruptException(_address);
+                }
+                if (!validatedObjects.contains(object))
+                {
+                    object->_validate(validatedObjects);
+                }
+            }
+            else if (Object * object = _graveyard.value(oid, nullptr))
+            {
+                if (object->_oid != oid || object->_isLive)
+                {   //  OOPS!
+                    throw tt3::db::api::DatabaseCorruptException(_address);
+                }
+            }
+            //  ...else the object was destroyed and recycled,
+            //  or its OID has since changed
+        }
+    }
+    catch (...)
+    {   //  OOPS! Cleanup & re-throw
+        _validatingIncrementally = false;
+        throw;
+    }
+    _validatingIncrementally = false;
+
+    //  Secondary indexes must match primary caches; these
+    //  do not cover the high-volume Works and Events, so
+    //  checking them is cheap
+    _validateIndexes();
+
+    //  Done
+    _unvalidatedOids.clear();
+}
+
+void Database::_validateAll()
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+    Q_ASSERT(!_validatingIncrementally);
+
     Objects validatedObjects;
 
     for (auto [oid, object] : _liveObjects.asKeyValueRange())
@@ -1857,6 +2595,65 @@ void Database::_validate()
     {   //  OOPS!
         throw tt3::db::api::DatabaseCorruptException(_address);
     }
+
+    //  Secondary indexes must match primary caches
+    _validateIndexes();
+
+    //  Everything has now been validated
+    _unvalidatedOids.clear();
+}
+
+void Database::_validateIndexes()
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+
+    Accounts accounts;
+    for (User * user : std::as_const(_users))
+    {
+        accounts.unite(user->_accounts);
+    }
+    _validateIndex<Account>(
+        _accountsByLogin,
+        accounts,
+        [](auto a) { return a->_login; });
+    _validateIndex<ActivityType>(
+        _activityTypesByDisplayName,
+        _activityTypes,
+        [](auto a) { return a->_displayName; });
+    _validateIndex<PublicActivity>(
+        _publicActivitiesByDisplayName,
+        _publicActivities,
+        [](auto a) { return a->_displayName; });
+    _validateIndex<PublicTask>(
+        _rootPublicTasksByDisplayName,
+        _rootPublicTasks,
+        [](auto a) { return a->_displayName; });
+    _validateIndex<Project>(
+        _rootProjectsByDisplayName,
+        _rootProjects,
+        [](auto a) { return a->_displayName; });
+    _validateIndex<WorkStream>(
+        _workStreamsByDisplayName,
+        _workStreams,
+        [](auto a) { return a->_displayName; });
+    _validateIndex<Beneficiary>(
+        _beneficiariesByDisplayName,
+        _beneficiaries,
+        [](auto a) { return a->_displayName; });
+}
+
+void Database::_validateAggregated(
+        Object * object,
+        Objects & validatedObjects
+    )
+{
+    Q_ASSERT(object != nullptr);
+
+    if (!_validatingIncrementally)
+    {   //  ...else the aggregated object is only validated
+        //  if it has been touched since the last validation
+        object->_validate(validatedObjects);
+    }
 }
 
 //////////
@@ -104,6 +104,7 @@ namespace tt3::db::xml
         virtual bool    isReadOnly() const override;
         virtual void    close() override;
         virtual void    refresh() override;
+        virtual void    validate() override;
 
         //////////
         //  tt3::db::api::IDatabase (associations)
@@ -218,6 +219,35 @@ namespace tt3::db::xml
                              unsigned long timeoutMs = ULONG_MAX
                             ) -> tt3::db::api::IDatabaseLock * override;
 
+        //////////
+        //  tt3::db::api::IDatabase (bulk loading)
+    public:
+        virtual void    beginBulkLoad() override;
+        virtual void    endBulkLoad() override;
+        virtual bool    isBulkLoading() const override;
+        virtual void    setBulkLoadOid(
+                                const tt3::db::api::Oid & oid
+                            ) override;
+
+        //////////
+        //  tt3::db::api::IDatabase (change tracking)
+    public:
+        virtual quint64 modificationStamp(
+                            ) const override;
+        virtual auto    modifiedOidsSince(
+                                quint64 modificationStamp
+                            ) const -> tt3::db::api::Oids override;
+        virtual auto    destroyedOidsSince(
+                                quint64 modificationStamp
+                            ) const -> tt3::db::api::Oids override;
+        virtual QUuid   instanceId(
+                            ) const override;
+        virtual void    recordFullBackup(
+                                quint64 modificationStamp
+                            ) override;
+        virtual quint64 oldestBaseModificationStamp(
+                            ) const override;
+
         //////////
         //  tt3::db::api::IDatabase (change notification handling)
     public:
@@ -232,15 +262,18 @@ namespace tt3::db::xml
     private:
         DatabaseAddress *const          _address;   //  counts as a "reference"
         tt3::db::api::IValidator *const _validator;
-        mutable tt3::util::Mutex        _guard; //  for all access synchronization
+        mutable tt3::util::ReadWriteMutex   _guard; //  for all access synchronization
         bool            _needsSaving;
         bool            _isOpen;
         bool            _isReadOnly;    //  not "const" - will be faked as "false" during close()
 
-        static const int    _SaveIntervalMs = 60 * 1000;
+        //  The XML file is re-written only occasionally; changes
+        //  made in between are appended to the journal
+        static const int    _SaveIntervalMs = 30 * 60 * 1000;
+        static const qint64 _MaxJournalSize = 16 * 1024 * 1024;
         QDateTime       _nextSaveAt;    //  UTC
         qint64          _lastSaveDurationMs;
-        QTimer          _saveTimer;
+        QTimer          _saveTimer;     //  also flushes the journal
 
         //  Primary object caches - these contain all live
         //  objects, either directly (like Users) or indirectly
@@ -254,8 +287,19 @@ namespace tt3::db::xml
         Beneficiaries       _beneficiaries;     //  count as "references"
 
         //  Secondary caches - these do NOT count as "references"
-        QMap<tt3::db::api::Oid, Object*> _liveObjects;  //  All "live" objects
-        QMap<tt3::db::api::Oid, Object*> _graveyard;    //  All "dead" objects
+        QHash<tt3::db::api::Oid, Object*> _liveObjects; //  All "live" objects
+        QHash<tt3::db::api::Oid, Object*> _graveyard;   //  All "dead" objects
+
+        //  Secondary indexes - these do NOT count as "references"
+        //  either. Objects keep these up to date themselves (see
+        //  Object::_addToIndexes() and Object::_removeFromIndexes()).
+        QHash<QString, Account*>        _accountsByLogin;
+        QHash<QString, ActivityType*>   _activityTypesByDisplayName;
+        QHash<QString, PublicActivity*> _publicActivitiesByDisplayName; //  BUT NOT TASKS!
+        QHash<QString, PublicTask*>     _rootPublicTasksByDisplayName;
+        QHash<QString, Project*>        _rootProjectsByDisplayName;
+        QHash<QString, WorkStream*>     _workStreamsByDisplayName;
+        QHash<QString, Beneficiary*>    _beneficiariesByDisplayName;
 
         //  Database file locking mechanism
         class TT3_DB_XML_PUBLIC _LockRefresher final
@@ -296,13 +340,49 @@ namespace tt3::db::xml
 
         tt3::db::api::ChangeNotifier    _changeNotifier;
 
+        //  Objects created, modified or destroyed since the last
+        //  validation, plus objects linked to destroyed ones
+        tt3::db::api::Oids  _unvalidatedOids;
+        bool                _validatingIncrementally = false;
+
         //  Databas locking
         QSet<DatabaseLock*> _activeDatabaseLocks;
 
+        //  Write-ahead journal - a sequence of batches, each
+        //  containing snapshots of objects changed since the
+        //  previous batch, appended to "<XML file>.journal".
+        //  The journal file is open only while the Database
+        //  is writable.
+        QFile               _journalFile;
+        tt3::db::api::Oids  _journalDirtyOids;  //  since last batch
+        QList<QPair<tt3::db::api::Oid, tt3::db::api::Oid>>
+                            _journalRenames;    //  old -> new, since last batch
+
+        //  Bulk loading. While a bulk-load session is underway,
+        //  change notifications are dropped, while validation,
+        //  journalling and saving are deferred until it ends.
+        bool                _bulkLoading = false;
+        tt3::db::api::Oid   _bulkLoadOid;   //  for the next object created; Invalid == generate
+
+        //  Change tracking. Every change to an object gives it
+        //  the next modification stamp; the OIDs of destroyed
+        //  (or re-OIDed) objects are kept as "tombstones" along
+        //  with the stamp of their destruction. Both are saved
+        //  with the database, so backups can pick up changes
+        //  made since an earlier backup. Tombstones older than
+        //  the full backup before the latest one are pruned.
+        quint64             _modificationStamp = 0; //  the latest one issued
+        QHash<tt3::db::api::Oid, quint64>   _tombstones;    //  OID -> modification stamp
+        quint64             _latestFullBackupModificationStamp = 0;
+        quint64             _oldestBaseModificationStamp = 0;   //  tombstones up to this one are pruned
+        QUuid               _instanceId;    //  saved with the database; never changes
+
         //  Helpers
         void                _ensureOpen() const;    //  throws tt3::db::api::DatabaseException
         void                _ensureOpenAndWritable() const; //  throws tt3::db::api::DatabaseException
         void                _markModified();
+        void                _recordChange(const tt3::db::api::Oid & oid);
+        void                _postChangeNotification(tt3::db::api::ChangeNotification * notification);
         void                _markClosed();
         void                _clearOrphanedDatabaseLocks();
         tt3::db::api::Oid   _generateOid();
@@ -313,11 +393,13 @@ namespace tt3::db::xml
         Project *           _findRootProject(const QString & displayName) const;
         WorkStream *        _findWorkStream(const QString & displayName) const;
         Beneficiary *       _findBeneficiary(const QString & displayName) const;
-        void                _savePeriodically();
+        void                _savePeriodically();    //  throws tt3::util::Exception
         void                _collectPublicTasksClosure(PublicTasks & closure, const PublicTasks & addend) const;
         void                _collectProjectsClosure(Projects & closure, const Projects & addend) const;
 
         //  Serialization
+        bool            _shallowSerialization = false;  //  true == omit aggregated objects
+
         void            _save();    //  throws tt3::util::Exception
         template <class T>
         QList<T>        _sortedByOid(const QSet<T> & objects)
@@ -329,104 +411,95 @@ namespace tt3::db::xml
                     result.begin(),
                     result.end(),
                     [](T a, T b)
-                    {
-                        return tt3::util::toString(a->_oid) < tt3::util::toString(b->_oid);
+                    {   //  Same order as that of OID strings
+                        return a->_oid < b->_oid;
                     });
             }
             return result;
         }
-        template <class R, class T>
-        QList<R>        _map(const QList<T> & objects,
-                             std::function<R(T)> mapper)
-        {
-            QList<R> result;
-            for (T obj : objects)
-            {
-                result.append(mapper(obj));
-            }
-            return result;
-        }
         template <class T>
         void            _serializeAssociation(
-                                QDomElement & objectElement,
+                                QXmlStreamWriter & writer,
                                 const QString & associationName,
                                 const T * association
                             )
         {
             if (association != nullptr)
             {
-                objectElement.setAttribute(associationName, tt3::util::toString(association->_oid));
+                writer.writeAttribute(associationName, tt3::util::toString(association->_oid));
             }
         }
         template <class T>
         void            _serializeAssociation(
-                                QDomElement & objectElement,
+                                QXmlStreamWriter & writer,
                                 const QString & associationName,
                                 const QList<T*> association
                             )
         {
             if (!association.isEmpty())
-            {
-                objectElement.setAttribute(
-                    associationName,
-                    _map<QString,T*>(
-                        association,
-                        [](auto a) { return tt3::util::toString(a->_oid); })
-                        .join(","));
+            {   //  Format all OIDs straight into a single buffer
+                constexpr qsizetype oidLength = tt3::db::api::Oid::StringLength;
+                QString oids(association.size() * (oidLength + 1) - 1, Qt::Uninitialized);
+                QChar * buffer = oids.data();
+                for (qsizetype i = 0; i < association.size(); i++)
+                {
+                    if (i > 0)
+                    {
+                        *buffer++ = ',';
+                    }
+                    association[i]->_oid.formatInto(buffer);
+                    buffer += oidLength;
+                }
+                writer.writeAttribute(associationName, oids);
             }
         }
         template <class T>
         void            _serializeAssociation(
-                                QDomElement & objectElement,
+                                QXmlStreamWriter & writer,
                                 const QString & associationName,
                                 const QSet<T*> association
                             )
         {
-            _serializeAssociation(objectElement, associationName, _sortedByOid(association));
+            _serializeAssociation(writer, associationName, _sortedByOid(association));
         }
         template <class T>
         void            _serializeObject(
-                                QDomElement & collectionElement,
+                                QXmlStreamWriter & writer,
                                 const T * object
                             )
         {
-            QDomElement objectElement =
-                collectionElement.ownerDocument()
-                                 .createElement(object->type()->mnemonic().toString());
-            collectionElement.appendChild(objectElement);
-            //  Serialize features
-            object->_serializeProperties(objectElement);
-            object->_serializeAggregations(objectElement);
-            object->_serializeAssociations(objectElement);
+            writer.writeStartElement(object->type()->mnemonic().toString());
+            //  Serialize features - attributes first
+            object->_serializeProperties(writer);
+            object->_serializeAssociations(writer);
+            object->_serializeAggregations(writer);
+            writer.writeEndElement();
         }
         template <class T>
         void            _serializeAggregation(
-                                QDomElement & parentElement,
+                                QXmlStreamWriter & writer,
                                 const QString & aggregationName,
                                 const QSet<T*> & aggregation
                             )
         {
-            QDomElement aggregationElement =
-                parentElement.ownerDocument().createElement(aggregationName);
-            parentElement.appendChild(aggregationElement);
-            for (T * object : _sortedByOid(aggregation))
-            {   //  Sorting by OID to reduce changes
-                _serializeObject(aggregationElement, object);
+            writer.writeStartElement(aggregationName);
+            if (!_shallowSerialization)
+            {   //  Aggregated objects are journalled separately
+                for (T * object : _sortedByOid(aggregation))
+                {   //  Sorting by OID to reduce changes
+                    _serializeObject(writer, object);
+                }
             }
+            writer.writeEndElement();
         }
 
         //  Deserialization
-        QMap<Object*, QDomElement>  _deserializationMap;    //  object -> DOM element from which it came
+        QHash<Object*, QXmlStreamAttributes> _deserializationMap;   //  object -> its association attributes
 
-        void            _load();    //  throws tt3::util::Exception
-        auto            _childElements(
-                                const QDomElement & parentElement,
-                                const QString & tagName
-                            ) -> QList<QDomElement>;
-        auto            _childElement(  //  throws tt3::db::api::DatabaseException
-                                const QDomElement & parentElement,
-                                const QString & tagName
-                            ) -> QDomElement;
+        bool            _load();    //  throws tt3::util::Exception; true == must be saved
+        void            _deserialize(   //  throws tt3::util::Exception
+                                QXmlStreamReader & reader
+                            );
         template <class T>
         T               _getObject(const tt3::db::api::Oid oid)
         {
@@ -441,39 +514,56 @@ namespace tt3::db::xml
         }
         template <class T>
         void            _deserializeAssociation(
-                                const QDomElement & objectElement,
+                                const QXmlStreamAttributes & attributes,
                                 const QString & associationName,
                                 T *& association
                             )
         {
             Q_ASSERT(association == nullptr);
-            if (objectElement.hasAttribute(associationName))
+            if (attributes.hasAttribute(associationName))
             {
                 association =
                     _getObject<T*>(
-                        tt3::util::fromString<tt3::db::api::Oid>(
-                            objectElement.attribute(associationName)));
+                        tt3::db::api::Oid::parse(
+                            attributes.value(associationName)));
                 association->addReference();
             }
         }
         template <class T>
         void            _deserializeAssociation(
-                                const QDomElement & objectElement,
+                                const QXmlStreamAttributes & attributes,
                                 const QString & associationName,
                                 QList<T*> & association
                             )
         {
             Q_ASSERT(association.isEmpty());
-            if (objectElement.hasAttribute(associationName))
+            if (attributes.hasAttribute(associationName))
             {
-                association =
-                    _map<T*,QString>(
-                        objectElement.attribute(associationName).split(','),
-                        [&](auto s)
-                        {
-                            return _getObject<T*>(
-                                tt3::util::fromString(s, tt3::db::api::Oid::Invalid));
-                        });
+                //  Slice the OIDs straight out of the attribute value
+                constexpr qsizetype oidLength = tt3::db::api::Oid::StringLength;
+                QStringView oids = attributes.value(associationName);
+                QList<T*> temp;
+                temp.reserve((oids.size() + 1) / (oidLength + 1));
+                for (qsizetype scan = 0; ; scan += oidLength + 1)
+                {
+                    if (scan + oidLength > oids.size())
+                    {   //  OOPS! Truncated
+                        throw tt3::db::api::DatabaseCorruptException(_address);
+                    }
+                    temp.append(
+                        _getObject<T*>(
+                            tt3::db::api::Oid::parse(
+                                oids.mid(scan, oidLength))));
+                    if (scan + oidLength == oids.size())
+                    {   //  That was the last one
+                        break;
+                    }
+                    if (oids[scan + oidLength] != ',')
+                    {   //  OOPS! Not a separator
+                        throw tt3::db::api::DatabaseCorruptException(_address);
+                    }
+                }
+                association = temp;
                 for (T * a : association)
                 {
                     a->addReference();
@@ -482,14 +572,14 @@ namespace tt3::db::xml
         }
         template <class T>
         void            _deserializeAssociation(
-                                const QDomElement & objectElement,
+                                const QXmlStreamAttributes & attributes,
                                 const QString & associationName,
                                 QSet<T*> & association
                             )
         {
             Q_ASSERT(association.isEmpty());
             QList<T*> temp;
-            _deserializeAssociation(objectElement, associationName, temp);
+            _deserializeAssociation(attributes, associationName, temp);
             association = QSet<T*>(temp.cbegin(), temp.cend());
             if (association.size() != temp.size())
             {
@@ -498,13 +588,14 @@ namespace tt3::db::xml
         }
         template <class T>
         void            _deserializeObject(
-                                const QDomElement & objectElement,
+                                QXmlStreamReader & reader,
                                 T *& object,
                                 std::function<T*(const tt3::db::api::Oid & oid)> objectFactory
                             )
-        {
+        {   //  The "reader" is positioned at the object's start element
+            QXmlStreamAttributes attributes = reader.attributes();
             tt3::db::api::Oid oid =
-                tt3::util::fromString<tt3::db::api::Oid>(objectElement.attribute("OID", ""));
+                tt3::db::api::Oid::parse(attributes.value("OID"));
             if (!oid.isValid() || _liveObjects.contains(oid))
             {   //  OOPS!
                 throw tt3::db::api::DatabaseCorruptException(_address);
@@ -515,33 +606,103 @@ namespace tt3::db::xml
             {   //  OOPS!
                 throw tt3::db::api::DatabaseCorruptException(_address);
             }
-            object->_deserializeProperties(objectElement);
-            object->_deserializeAggregations(objectElement);
+            object->_deserializeProperties(attributes);
+            object->_addToIndexes();
+            object->_deserializeAggregations(reader);
+            //  Skip whatever else is there, up to and
+            //  including the object's end element
+            while (reader.readNextStartElement())
+            {
+                reader.skipCurrentElement();
+            }
+            if (reader.hasError())
+            {   //  OOPS!
+                throw tt3::db::api::DatabaseCorruptException(_address);
+            }
         }
         template <class T>
         void            _deserializeAggregation(
-                                const QDomElement & parentElement,
+                                QXmlStreamReader & reader,
                                 const QString & aggregationName,
                                 QSet<T*> & aggregation,
                                 std::function<T*(const tt3::db::api::Oid & oid)> objectFactory
             )
-        {
+        {   //  Aggregations are expected in the order
+            //  in which _save() writes them
             Q_ASSERT(aggregation.isEmpty());
-            QDomElement aggregationElement = _childElement(parentElement, aggregationName); //  may throw
+            if (!reader.readNextStartElement() ||
+                reader.name() != aggregationName)
+            {   //  OOPS!
+                throw tt3::db::api::DatabaseCorruptException(_address);
+            }
             tt3::db::api::IObjectType * objectType = ObjectTypeTraits<T>::objectType();
-            for (const QDomElement & objectElement : _childElements(aggregationElement, objectType->mnemonic().toString()))
+            QString objectTagName = objectType->mnemonic().toString();
+            while (reader.readNextStartElement())
             {
+                if (reader.name() != objectTagName)
+                {   //  Not ours - ignore
+                    reader.skipCurrentElement();
+                    continue;
+                }
                 T * object = nullptr;
                 _deserializeObject<T>(
-                    objectElement,
+                    reader,
                     object,
                     objectFactory);
                aggregation.insert(object);
             }
+            if (reader.hasError())
+            {   //  OOPS!
+                throw tt3::db::api::DatabaseCorruptException(_address);
+            }
         }
 
-        //  Validation
-        void            _validate();    //  throwstt3::db::api::DatabaseException
+        //  Journalling
+        void            _resetJournal();    //  throws tt3::util::Exception
+        void            _flushJournal();    //  throws tt3::util::Exception
+        void            _writeJournal(const QByteArray & bytes);  //  throws tt3::util::Exception
+        bool            _openCurrentJournal(    //  throws tt3::util::Exception
+                                QFile & journalFile
+                            );  //  true == journal applies to the XML file, header skipped
+        bool            _replayJournal( //  throws tt3::util::Exception
+                                QFile & journalFile,
+                                QDomDocument & document
+                            );
+        void            _indexObjectElements(
+                                const QDomElement & parentElement,
+                                QHash<QString, QDomElement> & objectElements
+                            );
+
+        //  Validation. The incremental validation only covers
+        //  objects touched since the last validation (plus the
+        //  secondary indexes); the full validation covers all
+        //  objects and is used after loading.
+        void            _validate();    //  throws tt3::db::api::DatabaseException
+        void            _validateAll(); //  throws tt3::db::api::DatabaseException
+        void            _validateIndexes(); //  throws tt3::db::api::DatabaseException
+        void            _validateAggregated(    //  throws tt3::db::api::DatabaseException
+                                Object * object,
+                                Objects & validatedObjects
+                            );
+        template <class T>
+        void            _validateIndex(
+                                const QHash<QString, T*> & index,
+                                const QSet<T*> & indexedObjects,
+                                std::function<QString(T*)> key
+                            )
+        {
+            if (index.size() != indexedObjects.size())
+            {   //  OOPS! Primary caches and secondary indexes do not match
+                throw tt3::db::api::DatabaseCorruptException(_address);
+            }
+            for (auto [k, object] : index.asKeyValueRange())
+            {
+                if (!indexedObjects.contains(object) || key(object) != k)
+                {   //  OOPS!
+                    throw tt3::db::api::DatabaseCorruptException(_address);
+                }
+            }
+        }
     };
 }
 
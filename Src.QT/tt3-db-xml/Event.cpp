@@ -42,7 +42,7 @@ Event::~Event()
 auto Event::occurredAt(
     ) const -> QDateTime
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -52,7 +52,7 @@ auto Event::occurredAt(
 auto Event::summary(
     ) const -> QString
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -64,7 +64,7 @@ auto Event::summary(
 auto Event::account(
     ) const -> tt3::db::api::IAccount *
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -74,7 +74,7 @@ auto Event::account(
 auto Event::activities(
     ) const -> tt3::db::api::Activities
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -91,6 +91,7 @@ void Event::_makeDead()
     //  Break associations
     Q_ASSERT(_account != nullptr && _account->_isLive);
     Q_ASSERT(_account->_events.contains(this));
+    _account->_unindexEvent(this);
     _account->_events.remove(this);
     this->removeReference();
     _account->removeReference();
@@ -112,60 +113,72 @@ void Event::_makeDead()
 
 //////////
 //  Serialization
+auto Event::_serializationParent(
+    ) const -> Object *
+{
+    return _account;
+}
+
+QString Event::_serializationAggregationName() const
+{
+    return "Events";
+}
+
 void Event::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeProperties(objectElement);
+    Object::_serializeProperties(writer);
 
-    objectElement.setAttribute("OccurredAt", tt3::util::toString(_occurredAt));
-    objectElement.setAttribute("Summary", _summary);
+    writer.writeAttribute("OccurredAt", tt3::util::toString(_occurredAt));
+    writer.writeAttribute("Summary", _summary);
 }
 
 void Event::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAggregations(objectElement);
+    Object::_serializeAggregations(writer);
 }
 
 void Event::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAssociations(objectElement);
+    Object::_serializeAssociations(writer);
 
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "Activities",
         _activities);
 }
 
 void Event::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeProperties(objectElement);
+    Object::_deserializeProperties(attributes);
 
-    _occurredAt = tt3::util::fromString(objectElement.attribute("OccurredAt"), _occurredAt);
-    _summary = objectElement.attribute("Summary");
+    _occurredAt = tt3::util::fromString(attributes.value("OccurredAt").toString(), _occurredAt);
+    _summary = attributes.value("Summary").toString();
+    _account->_indexEvent(this);
 }
 
 void Event::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Object::_deserializeAggregations(objectElement);
+    Object::_deserializeAggregations(reader);
 }
 
 void Event::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeAssociations(objectElement);
+    Object::_deserializeAssociations(attributes);
 
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "Activities",
         _activities);
 }
@@ -206,4 +219,17 @@ void Event::_validate(
     }
 }
 
-//  End of tt3-db-xml/Account.cpp
+void Event::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    Object::_collectLinkedObjects(linkedObjects);
+
+    linkedObjects.insert(_account);
+    for (Activity * activity : std::as_const(_activities))
+    {
+        linkedObjects.insert(activity);
+    }
+}
+
+//  End of tt3-db-xml/Event.cpp
@@ -67,24 +67,28 @@ namespace tt3::db::xml
         //////////
         //  Serialization
     private:
+        virtual auto    _serializationParent(
+                            ) const -> Object * override;
+        virtual QString _serializationAggregationName(
+                            ) const override;
         virtual void    _serializeProperties(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
         virtual void    _serializeAggregations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
         virtual void    _serializeAssociations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
 
         virtual void    _deserializeProperties(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             ) override; //  throws tt3::util::ParseException
         virtual void    _deserializeAggregations(
-                                const QDomElement & objectElement
+                                QXmlStreamReader & reader
                             ) override; //  throws tt3::util::ParseException
         virtual void    _deserializeAssociations(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             ) override;  //  throws tt3::util::ParseException
 
         //////////
@@ -93,6 +97,9 @@ namespace tt3::db::xml
         virtual void    _validate(
                                 Objects & validatedObjects
                             ) override; //  throws(tt3::db::api::DatabaseException
+        virtual void    _collectLinkedObjects(
+                                Objects & linkedObjects
+                            ) const override;
     };
 }
 
@@ -65,7 +65,8 @@ void Object::setOid(
     {   //  There IS actually a change
         //  Disallow OID duplication
         if (_database->_liveObjects.contains(oid) ||
-            _database->_graveyard.contains(oid))    //  can't reuse OIDs!
+            _database->_graveyard.contains(oid) ||
+            _database->_tombstones.contains(oid))   //  can't reuse OIDs!
         {   //  OOPS!
             throw tt3::db::api::AlreadyExistsException(
                 "Object",
@@ -78,11 +79,22 @@ void Object::setOid(
         _oid = oid;
         _database->_liveObjects[oid] = this;
         _database->_markModified();
+        if (_database->_journalFile.isOpen() && !_database->_bulkLoading)
+        {   //  Aggregated objects move along with us
+            _database->_journalRenames.append(qMakePair(oldOid, _oid));
+        }
+        //  Objects linked to this one now refer to the new OID
+        Objects linkedObjects;
+        _collectLinkedObjects(linkedObjects);
+        for (Object * linkedObject : std::as_const(linkedObjects))
+        {
+            _database->_recordChange(linkedObject->_oid);
+        }
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), oldOid));
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -94,10 +106,18 @@ void Object::setOid(
 
 bool Object::isLive() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     return _isLive;
 }
 
+quint64 Object::modificationStamp() const
+{
+    tt3::util::ReadLock _(_database->_guard);
+    _ensureLive();  //  may throw
+
+    return _modificationStamp;
+}
+
 //////////
 //  tt3::db::api::IObject (life cycle)
 void Object::destroy()
@@ -108,6 +128,16 @@ void Object::destroy()
     _database->_validate(); //  may throw
 #endif
 
+    //  Objects linked to this one will lose their links,
+    //  so they need re-validation, journalling, etc.
+    Objects linkedObjects;
+    _collectLinkedObjects(linkedObjects);
+    for (Object * linkedObject : std::as_const(linkedObjects))
+    {
+        _database->_recordChange(linkedObject->_oid);
+    }
+
+    _removeFromIndexes();
     _makeDead();
 
 #ifdef Q_DEBUG
@@ -119,13 +149,13 @@ void Object::destroy()
 //  tt3::db::api::IObject (reference counting)
 Object::State Object::state() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     return _state;
 }
 
 int Object::referenceCount() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     return _referenceCount;
 }
 
@@ -236,7 +266,7 @@ void Object::_makeDead()
     _database->_graveyard.insert(_oid, this);
     _database->_markModified();
     //  Schedule change notifications
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectDestroyedNotification(
             _database, type(), _oid));
     //  Can we recycle now ?
@@ -247,51 +277,82 @@ void Object::_makeDead()
     }
 }
 
+void Object::_addToIndexes()
+{   //  Nothing at this level
+}
+
+void Object::_removeFromIndexes()
+{   //  Nothing at this level
+}
+
 //////////
 //  Serialization
 void Object::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    objectElement.setAttribute("OID", tt3::util::toString(_oid));
+    writer.writeAttribute("OID", tt3::util::toString(_oid));
+    if (_modificationStamp != 0)
+    {
+        writer.writeAttribute("ModificationStamp", tt3::util::toString(_modificationStamp));
+    }
 }
 
 void Object::_serializeAggregations(
-        QDomElement & /*parentElement*/
+        QXmlStreamWriter & /*writer*/
     ) const
 {   //  Nothing at this level
 }
 
 void Object::_serializeAssociations(
-        QDomElement & /*objectElement*/
+        QXmlStreamWriter & /*writer*/
     ) const
 {   //  Nothing at this level
 }
 
 void Object::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
     tt3::db::api::Oid oid =
-        tt3::util::fromString<tt3::db::api::Oid>(
-            objectElement.attribute("OID", ""));
+        tt3::db::api::Oid::parse(attributes.value("OID"));
     if (oid != _oid)
     {   //  OOPS! Deserialization implemented wrong!
         throw tt3::db::api::DatabaseCorruptException(_database->_address);
     }
+    if (attributes.hasAttribute("ModificationStamp"))
+    {   //  Files written before change tracking have none
+        _modificationStamp =
+            tt3::util::fromString(attributes.value("ModificationStamp").toString(), _modificationStamp);
+        _database->_modificationStamp =
+            qMax(_database->_modificationStamp, _modificationStamp);
+    }
     //  Add entry to "deserialization map" - we'll need
-    //  it when deserializing associations
-    _database->_deserializationMap.insert(this, objectElement);
+    //  it when deserializing associations. Associations
+    //  are always (lists of) OIDs, so there's no point in
+    //  keeping property attributes until then.
+    QXmlStreamAttributes associationAttributes;
+    for (const QXmlStreamAttribute & attribute : attributes)
+    {
+        if (attribute.name() != u"OID" &&
+            attribute.value().startsWith(u'{'))
+        {
+            associationAttributes.append(
+                attribute.name().toString(),
+                attribute.value().toString());
+        }
+    }
+    _database->_deserializationMap.insert(this, associationAttributes);
 }
 
 void Object::_deserializeAggregations(
-        const QDomElement & /*parentElement*/
+        QXmlStreamReader & /*reader*/
     )
 {   //  Nothing at this level
 }
 
 void Object::_deserializeAssociations(
-        const QDomElement & /*objectElement*/
+        const QXmlStreamAttributes & /*attributes*/
     )
 {   //  Nothing at this level
 }
@@ -322,4 +383,10 @@ void Object::_validate(
     //  Validate associations
 }
 
+void Object::_collectLinkedObjects(
+        Objects & /*linkedObjects*/
+    ) const
+{   //  Nothing at this level
+}
+
 //  End of tt3-db-xml/Object.cpp
@@ -57,6 +57,7 @@ namespace tt3::db::xml
                                     const tt3::db::api::Oid & oid
                                 ) override;
         virtual bool        isLive() const override;
+        virtual quint64     modificationStamp() const override;
 
         //////////
         //  tt3::db::api::IObject (life cycle)
@@ -79,33 +80,52 @@ namespace tt3::db::xml
         State           _state = State::New;
         int             _referenceCount = 0;
         bool            _isLive = true;
+        quint64         _modificationStamp = 0; //  see Database::_recordChange()
 
         //  Helpers
         void            _ensureLive() const;    //  throws tt3::db::api::DatabaseException
         void            _ensureLiveAndWritable() const;    //  throws tt3::db::api::DatabaseException
         virtual void    _makeDead();
+        //  Secondary Database indexes (by login, by display
+        //  name, etc.) are kept up to date through these
+        virtual void    _addToIndexes();
+        virtual void    _removeFromIndexes();
 
         //////////
         //  Serialization
     private:
+        //  The object whose aggregation this object belongs
+        //  to (nullptr == the database itself) and the name
+        //  of that aggregation.
+        virtual auto    _serializationParent(
+                            ) const -> Object * = 0;
+        virtual QString _serializationAggregationName(
+                            ) const = 0;
+
+        //  Properties and associations become attributes of
+        //  the object's XML element, so they must be written
+        //  before aggregations (which are child elements).
         virtual void    _serializeProperties(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const;
         virtual void    _serializeAggregations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const;
         virtual void    _serializeAssociations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const;
 
+        //  Aggregations are read from the "reader" positioned
+        //  just after the object's start element, in the same
+        //  order in which they were serialized.
         virtual void    _deserializeProperties(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             );  //  throws tt3::util::ParseException
         virtual void    _deserializeAggregations(
-                                const QDomElement & objectElement
+                                QXmlStreamReader & reader
                             );  //  throws tt3::util::ParseException
         virtual void    _deserializeAssociations(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             );  //  throws tt3::util::ParseException
 
         //////////
@@ -114,6 +134,13 @@ namespace tt3::db::xml
         virtual void    _validate(
                                 Objects & validatedObjects
                             );  //  throws tt3::db::api::DatabaseException
+        //  Adds all objects this object is linked to (in either
+        //  direction) to "linkedObjects". These must be validated
+        //  again when this object is destroyed, as a dead object
+        //  no longer knows what it used to be linked to.
+        virtual void    _collectLinkedObjects(
+                                Objects & linkedObjects
+                            ) const;
     };
 }
 
@@ -33,7 +33,7 @@ Principal::~Principal()
 bool Principal::enabled(
     ) const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -55,7 +55,7 @@ void Principal::setEnabled(
         _enabled = enabled;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -68,7 +68,7 @@ void Principal::setEnabled(
 auto Principal::emailAddresses(
     ) const -> QStringList
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -98,7 +98,7 @@ void Principal::setEmailAddresses(
         _emailAddresses = emailAddresses;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -121,60 +121,60 @@ void Principal::_makeDead()
 //////////
 //  Serialization
 void Principal::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeProperties(objectElement);
+    Object::_serializeProperties(writer);
 
-    objectElement.setAttribute("Enabled", tt3::util::toString(_enabled));
+    writer.writeAttribute("Enabled", tt3::util::toString(_enabled));
     if (!_emailAddresses.isEmpty())
     {   //  A valid e-mail address has no ',' in it
-        objectElement.setAttribute("EmailAddresses", _emailAddresses.join(','));
+        writer.writeAttribute("EmailAddresses", _emailAddresses.join(','));
     }
 }
 
 void Principal::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAggregations(objectElement);
+    Object::_serializeAggregations(writer);
 }
 
 void Principal::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAssociations(objectElement);
+    Object::_serializeAssociations(writer);
 }
 
 void Principal::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeProperties(objectElement);
+    Object::_deserializeProperties(attributes);
 
     _enabled =
         tt3::util::fromString(
-            objectElement.attribute("Enabled"),
+            attributes.value("Enabled").toString(),
             _enabled);
-    if (objectElement.hasAttribute("EmailAddresses"))
+    if (attributes.hasAttribute("EmailAddresses"))
     {   //  A valid e-mail address has no ',' in it
-        _emailAddresses = objectElement.attribute("EmailAddresses").split(',');
+        _emailAddresses = attributes.value("EmailAddresses").toString().split(',');
     }
 }
 
 void Principal::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Object::_deserializeAggregations(objectElement);
+    Object::_deserializeAggregations(reader);
 }
 
 void Principal::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeAssociations(objectElement);
+    Object::_deserializeAssociations(attributes);
 }
 
 //////////
@@ -41,7 +41,7 @@ PrivateActivity::~PrivateActivity()
 auto PrivateActivity::owner(
     ) const -> tt3::db::api::IUser *
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -79,46 +79,57 @@ void PrivateActivity::_makeDead()
 
 //////////
 //  Serialization
+auto PrivateActivity::_serializationParent(
+    ) const -> Object *
+{
+    return _owner;
+}
+
+QString PrivateActivity::_serializationAggregationName() const
+{
+    return "PrivateActivities";
+}
+
 void PrivateActivity::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Activity::_serializeProperties(objectElement);
+    Activity::_serializeProperties(writer);
 }
 
 void PrivateActivity::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Activity::_serializeAggregations(objectElement);
+    Activity::_serializeAggregations(writer);
 }
 
 void PrivateActivity::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Activity::_serializeAssociations(objectElement);
+    Activity::_serializeAssociations(writer);
 }
 
 void PrivateActivity::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Activity::_deserializeProperties(objectElement);
+    Activity::_deserializeProperties(attributes);
 }
 
 void PrivateActivity::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Activity::_deserializeAggregations(objectElement);
+    Activity::_deserializeAggregations(reader);
 }
 
 void PrivateActivity::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Activity::_deserializeAssociations(objectElement);
+    Activity::_deserializeAssociations(attributes);
 }
 
 //////////
@@ -142,4 +153,13 @@ void PrivateActivity::_validate(
     }
 }
 
+void PrivateActivity::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    Activity::_collectLinkedObjects(linkedObjects);
+
+    linkedObjects.insert(_owner);
+}
+
 //  End of tt3-db-xml/PrivateActivity.cpp
@@ -67,7 +67,7 @@ PrivateTask::~PrivateTask()
 auto PrivateTask::parent(
     ) const -> IPrivateTask *
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -113,7 +113,7 @@ void PrivateTask::setParent(
             _parent->_children.remove(this);
             this->removeReference();
             _parent->removeReference();
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, _parent->type(), _parent->_oid));
         }
@@ -129,7 +129,7 @@ void PrivateTask::setParent(
             _parent->_children.insert(this);
             this->addReference();
             _parent->addReference();
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, _parent->type(), _parent->_oid));
         }
@@ -141,10 +141,10 @@ void PrivateTask::setParent(
         }
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, _owner->type(), _owner->_oid));
         //  ...and we're done
@@ -157,7 +157,7 @@ void PrivateTask::setParent(
 auto PrivateTask::children(
     ) const -> tt3::db::api::PrivateTasks
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -266,21 +266,21 @@ auto PrivateTask::createChild(
     }
     _database->_markModified();
     //  ...schedule change notifications...
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectModifiedNotification(
             _database, type(), _oid));
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             _database, child->type(), child->_oid));
     if (xmlActivityType != nullptr)
     {
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlActivityType->type(), xmlActivityType->_oid));
     }
     if (xmlWorkload != nullptr)
     {
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlWorkload->type(), xmlWorkload->_oid));
     }
@@ -369,52 +369,67 @@ void PrivateTask::_collectParentClosure(PrivateTasks & closure)
 
 //////////
 //  Serialization
+auto PrivateTask::_serializationParent(
+    ) const -> Object *
+{
+    if (_parent != nullptr)
+    {
+        return _parent;
+    }
+    return _owner;
+}
+
+QString PrivateTask::_serializationAggregationName() const
+{
+    return (_parent != nullptr) ? "Children" : "PrivateTasks";
+}
+
 void PrivateTask::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    PrivateActivity::_serializeProperties(objectElement);
-    Task::_serializeProperties(objectElement);
+    PrivateActivity::_serializeProperties(writer);
+    Task::_serializeProperties(writer);
 }
 
 void PrivateTask::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    PrivateActivity::_serializeAggregations(objectElement);
-    Task::_serializeAggregations(objectElement);
+    PrivateActivity::_serializeAggregations(writer);
+    Task::_serializeAggregations(writer);
 
     _database->_serializeAggregation(
-        objectElement,
+        writer,
         "Children",
         _children);
 }
 
 void PrivateTask::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    PrivateActivity::_serializeAssociations(objectElement);
-    Task::_serializeAssociations(objectElement);
+    PrivateActivity::_serializeAssociations(writer);
+    Task::_serializeAssociations(writer);
 }
 
 void PrivateTask::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    PrivateActivity::_deserializeProperties(objectElement);
-    Task::_deserializeProperties(objectElement);
+    PrivateActivity::_deserializeProperties(attributes);
+    Task::_deserializeProperties(attributes);
 }
 
 void PrivateTask::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    PrivateActivity::_deserializeAggregations(objectElement);
-    Task::_deserializeAggregations(objectElement);
+    PrivateActivity::_deserializeAggregations(reader);
+    Task::_deserializeAggregations(reader);
 
     _database->_deserializeAggregation<PrivateTask>(
-        objectElement,
+        reader,
         "Children",
         _children,
         [&](auto oid)
@@ -424,11 +439,11 @@ void PrivateTask::_deserializeAggregations(
 }
 
 void PrivateTask::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    PrivateActivity::_deserializeAssociations(objectElement);
-    Task::_deserializeAssociations(objectElement);
+    PrivateActivity::_deserializeAssociations(attributes);
+    Task::_deserializeAssociations(attributes);
 }
 
 //////////
@@ -474,10 +489,26 @@ void PrivateTask::_validate(
         {   //  OOPS!
             throw tt3::db::api::DatabaseCorruptException(_database->_address);
         }
-        child->_validate(validatedObjects);
+        _database->_validateAggregated(child, validatedObjects);
     }
 
     //  Validate associations
 }
 
+void PrivateTask::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    PrivateActivity::_collectLinkedObjects(linkedObjects);
+
+    if (_parent != nullptr)
+    {
+        linkedObjects.insert(_parent);
+    }
+    for (PrivateTask * child : std::as_const(_children))
+    {
+        linkedObjects.insert(child);
+    }
+}
+
 //  End of tt3-db-xml/User.cpp
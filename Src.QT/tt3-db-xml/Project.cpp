@@ -53,7 +53,7 @@ Project::~Project()
 bool Project::completed(
     ) const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -75,7 +75,7 @@ void Project::setCompleted(
         _completed = completed;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -90,7 +90,7 @@ void Project::setCompleted(
 auto Project::parent(
     ) const -> IProject *
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -130,12 +130,13 @@ void Project::setParent(
             }
         }
         //  ...and make the change...
+        _removeFromIndexes();
         if (_parent != nullptr)
         {
             _parent->_children.remove(this);
             this->removeReference();
             _parent->removeReference();
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, _parent->type(), _parent->_oid));
         }
@@ -151,7 +152,7 @@ void Project::setParent(
             _parent->_children.insert(this);
             this->addReference();
             _parent->addReference();
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, _parent->type(), _parent->_oid));
         }
@@ -161,9 +162,10 @@ void Project::setParent(
             _database->_rootProjects.insert(this);
             this->removeReference();
         }
+        _addToIndexes();
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -176,7 +178,7 @@ void Project::setParent(
 auto Project::children(
     ) const -> tt3::db::api::Projects
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -249,6 +251,7 @@ auto Project::createChild(
     project->_displayName = displayName;
     project->_description = description;
     project->_completed = completed;
+    project->_addToIndexes();
     for (Beneficiary * xmlBeneficiary : xmlBeneficiaries)
     {   //  Link with Beneficiary
         project->_beneficiaries.insert(xmlBeneficiary);
@@ -258,15 +261,15 @@ auto Project::createChild(
     }
     _database->_markModified();
     //  ...schedule change notifications...
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectModifiedNotification(
             _database, type(), _oid));
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             _database, project->type(), project->_oid));
     for (Beneficiary * xmlBeneficiary : xmlBeneficiaries)
     {
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlBeneficiary->type(), xmlBeneficiary->_oid));
     }
@@ -325,6 +328,27 @@ void Project::_makeDead()
     Workload::_makeDead();
 }
 
+void Project::_addToIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    if (_parent == nullptr)
+    {   //  Only root Projects are indexed
+        _database->_rootProjectsByDisplayName.insert(_displayName, this);
+    }
+}
+
+void Project::_removeFromIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    if (_parent == nullptr &&
+        _database->_rootProjectsByDisplayName.value(_displayName) == this)
+    {
+        _database->_rootProjectsByDisplayName.remove(_displayName);
+    }
+}
+
 Project * Project::_findChild(
         const QString & displayName
     ) const
@@ -354,52 +378,63 @@ void Project::_collectParentClosure(Projects & closure)
 
 //////////
 //  Serialization
+auto Project::_serializationParent(
+    ) const -> Object *
+{
+    return _parent; //  nullptr == a root Project
+}
+
+QString Project::_serializationAggregationName() const
+{
+    return (_parent != nullptr) ? "Children" : "Projects";
+}
+
 void Project::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Workload::_serializeProperties(objectElement);
-    objectElement.setAttribute("Completed", tt3::util::toString(_completed));
+    Workload::_serializeProperties(writer);
+    writer.writeAttribute("Completed", tt3::util::toString(_completed));
 }
 
 void Project::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Workload::_serializeAggregations(objectElement);
+    Workload::_serializeAggregations(writer);
 
     _database->_serializeAggregation(
-        objectElement,
+        writer,
         "Children",
         _children);
 }
 
 void Project::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Workload::_serializeAssociations(objectElement);
+    Workload::_serializeAssociations(writer);
 }
 
 void Project::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Workload::_deserializeProperties(objectElement);
+    Workload::_deserializeProperties(attributes);
     _completed =
         tt3::util::fromString(
-            objectElement.attribute("Completed"),
+            attributes.value("Completed").toString(),
             _completed);
 }
 
 void Project::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Workload::_deserializeAggregations(objectElement);
+    Workload::_deserializeAggregations(reader);
 
     _database->_deserializeAggregation<Project>(
-        objectElement,
+        reader,
         "Children",
         _children,
         [&](auto oid)
@@ -409,10 +444,10 @@ void Project::_deserializeAggregations(
 }
 
 void Project::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Workload::_deserializeAssociations(objectElement);
+    Workload::_deserializeAssociations(attributes);
 }
 
 //////////
@@ -457,10 +492,26 @@ void Project::_validate(
         {   //  OOPS!
             throw tt3::db::api::DatabaseCorruptException(_database->_address);
         }
-        child->_validate(validatedObjects);
+        _database->_validateAggregated(child, validatedObjects);
     }
 
     //  Validate associations
 }
 
+void Project::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    Workload::_collectLinkedObjects(linkedObjects);
+
+    if (_parent != nullptr)
+    {
+        linkedObjects.insert(_parent);
+    }
+    for (Project * child : std::as_const(_children))
+    {
+        linkedObjects.insert(child);
+    }
+}
+
 //  End of tt3-db-xml/Project.cpp
@@ -78,30 +78,36 @@ namespace tt3::db::xml
         //  Helpers
         virtual bool    _siblingExists(const QString & displayName) const override;
         virtual void    _makeDead() override;
+        virtual void    _addToIndexes() override;
+        virtual void    _removeFromIndexes() override;
         Project *       _findChild(const QString & displayName) const;
         void            _collectParentClosure(Projects & closure);
 
         //////////
         //  Serialization
     private:
+        virtual auto    _serializationParent(
+                            ) const -> Object * override;
+        virtual QString _serializationAggregationName(
+                            ) const override;
         virtual void    _serializeProperties(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
         virtual void    _serializeAggregations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
         virtual void    _serializeAssociations(
-                                QDomElement & objectElement
+                                QXmlStreamWriter & writer
                             ) const override;
 
         virtual void    _deserializeProperties(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             ) override; //  throws tt3::util::ParseException)
         virtual void    _deserializeAggregations(
-                                const QDomElement & objectElement
+                                QXmlStreamReader & reader
                             ) override; //  throws tt3::util::ParseException)
         virtual void    _deserializeAssociations(
-                                const QDomElement & objectElement
+                                const QXmlStreamAttributes & attributes
                             ) override;  //  throws tt3::util::ParseException
 
         //////////
@@ -110,6 +116,9 @@ namespace tt3::db::xml
         virtual void    _validate(  //  throws tt3::db::api::DatabaseException
                                 Objects & validatedObjects
                             ) override;
+        virtual void    _collectLinkedObjects(
+                                Objects & linkedObjects
+                            ) const override;
     };
 }
 
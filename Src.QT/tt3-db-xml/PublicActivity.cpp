@@ -60,48 +60,76 @@ void PublicActivity::_makeDead()
     Activity::_makeDead();
 }
 
+void PublicActivity::_addToIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    _database->_publicActivitiesByDisplayName.insert(_displayName, this);
+}
+
+void PublicActivity::_removeFromIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    if (_database->_publicActivitiesByDisplayName.value(_displayName) == this)
+    {
+        _database->_publicActivitiesByDisplayName.remove(_displayName);
+    }
+}
+
 //////////
 //  Serialization
+auto PublicActivity::_serializationParent(
+    ) const -> Object *
+{
+    return nullptr;  //  a root object
+}
+
+QString PublicActivity::_serializationAggregationName() const
+{
+    return "PublicActivities";
+}
+
 void PublicActivity::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Activity::_serializeProperties(objectElement);
+    Activity::_serializeProperties(writer);
 }
 
 void PublicActivity::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Activity::_serializeAggregations(objectElement);
+    Activity::_serializeAggregations(writer);
 }
 
 void PublicActivity::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Activity::_serializeAssociations(objectElement);
+    Activity::_serializeAssociations(writer);
 }
 
 void PublicActivity::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Activity::_deserializeProperties(objectElement);
+    Activity::_deserializeProperties(attributes);
 }
 
 void PublicActivity::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Activity::_deserializeAggregations(objectElement);
+    Activity::_deserializeAggregations(reader);
 }
 
 void PublicActivity::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Activity::_deserializeAssociations(objectElement);
+    Activity::_deserializeAssociations(attributes);
 }
 
 //////////
@@ -67,7 +67,7 @@ PublicTask::~PublicTask()
 auto PublicTask::parent(
     ) const -> IPublicTask *
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -107,12 +107,13 @@ void PublicTask::setParent(
             }
         }
         //  ...and make the change...
+        _removeFromIndexes();
         if (_parent != nullptr)
         {
             _parent->_children.remove(this);
             this->removeReference();
             _parent->removeReference();
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, _parent->type(), _parent->_oid));
         }
@@ -128,7 +129,7 @@ void PublicTask::setParent(
             _parent->_children.insert(this);
             this->addReference();
             _parent->addReference();
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, _parent->type(), _parent->_oid));
         }
@@ -138,9 +139,10 @@ void PublicTask::setParent(
             _database->_rootPublicTasks.insert(this);
             this->removeReference();
         }
+        _addToIndexes();
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -153,7 +155,7 @@ void PublicTask::setParent(
 auto PublicTask::children(
     ) const -> tt3::db::api::PublicTasks
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -246,6 +248,7 @@ auto PublicTask::createChild(
     child->_fullScreenReminder = fullScreenReminder;
     child->_completed = completed;
     child->_requireCommentOnCompletion = requireCommentOnCompletion;
+    child->_addToIndexes();
     if (xmlActivityType != nullptr)
     {   //  Link with ActivityType
         child->_activityType = xmlActivityType;
@@ -262,21 +265,21 @@ auto PublicTask::createChild(
     }
     _database->_markModified();
     //  ...schedule change notifications...
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectModifiedNotification(
             _database, type(), _oid));
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             _database, child->type(), child->_oid));
     if (xmlActivityType != nullptr)
     {
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlActivityType->type(), xmlActivityType->_oid));
     }
     if (xmlWorkload != nullptr)
     {
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlWorkload->type(), xmlWorkload->_oid));
     }
@@ -335,6 +338,28 @@ void PublicTask::_makeDead()
     Activity::_makeDead();
 }
 
+void PublicTask::_addToIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    if (_parent == nullptr)
+    {   //  Only root PublicTasks are indexed, and never
+        //  as PublicActivities
+        _database->_rootPublicTasksByDisplayName.insert(_displayName, this);
+    }
+}
+
+void PublicTask::_removeFromIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    if (_parent == nullptr &&
+        _database->_rootPublicTasksByDisplayName.value(_displayName) == this)
+    {
+        _database->_rootPublicTasksByDisplayName.remove(_displayName);
+    }
+}
+
 PublicTask * PublicTask::_findChild(
         const QString & displayName
     ) const
@@ -364,52 +389,63 @@ void PublicTask::_collectParentClosure(PublicTasks & closure)
 
 //////////
 //  Serialization
+auto PublicTask::_serializationParent(
+    ) const -> Object *
+{
+    return _parent; //  nullptr == a root PublicTask
+}
+
+QString PublicTask::_serializationAggregationName() const
+{
+    return (_parent != nullptr) ? "Children" : "PublicTasks";
+}
+
 void PublicTask::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    PublicActivity::_serializeProperties(objectElement);
-    Task::_serializeProperties(objectElement);
+    PublicActivity::_serializeProperties(writer);
+    Task::_serializeProperties(writer);
 }
 
 void PublicTask::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    PublicActivity::_serializeAggregations(objectElement);
-    Task::_serializeAggregations(objectElement);
+    PublicActivity::_serializeAggregations(writer);
+    Task::_serializeAggregations(writer);
 
     _database->_serializeAggregation(
-        objectElement,
+        writer,
         "Children",
         _children);
 }
 
 void PublicTask::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    PublicActivity::_serializeAssociations(objectElement);
-    Task::_serializeAssociations(objectElement);
+    PublicActivity::_serializeAssociations(writer);
+    Task::_serializeAssociations(writer);
 }
 
 void PublicTask::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    PublicActivity::_deserializeProperties(objectElement);
-    Task::_deserializeProperties(objectElement);
+    PublicActivity::_deserializeProperties(attributes);
+    Task::_deserializeProperties(attributes);
 }
 
 void PublicTask::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    PublicActivity::_deserializeAggregations(objectElement);
-    Task::_deserializeAggregations(objectElement);
+    PublicActivity::_deserializeAggregations(reader);
+    Task::_deserializeAggregations(reader);
 
     _database->_deserializeAggregation<PublicTask>(
-        objectElement,
+        reader,
         "Children",
         _children,
         [&](auto oid)
@@ -419,11 +455,11 @@ void PublicTask::_deserializeAggregations(
 }
 
 void PublicTask::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    PublicActivity::_deserializeAssociations(objectElement);
-    Task::_deserializeAssociations(objectElement);
+    PublicActivity::_deserializeAssociations(attributes);
+    Task::_deserializeAssociations(attributes);
 }
 
 //////////
@@ -469,10 +505,26 @@ void PublicTask::_validate(
         {   //  OOPS!
             throw tt3::db::api::DatabaseCorruptException(_database->_address);
         }
-        child->_validate(validatedObjects);
+        _database->_validateAggregated(child, validatedObjects);
     }
 
     //  Validate associations
 }
 
+void PublicTask::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    Activity::_collectLinkedObjects(linkedObjects);
+
+    if (_parent != nullptr)
+    {
+        linkedObjects.insert(_parent);
+    }
+    for (PublicTask * child : std::as_const(_children))
+    {
+        linkedObjects.insert(child);
+    }
+}
+
 //  End of tt3-db-xml/PublicTask.cpp
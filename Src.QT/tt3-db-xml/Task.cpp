@@ -35,7 +35,7 @@ Task::~Task()
 bool Task::completed(
     ) const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -57,7 +57,7 @@ void Task::setCompleted(
         _completed = completed;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -70,7 +70,7 @@ void Task::setCompleted(
 bool Task::requireCommentOnCompletion(
     ) const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -92,7 +92,7 @@ void Task::setRequireCommentOnCompletion(
         _requireCommentOnCompletion = requireCommentOnCompletion;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -105,18 +105,18 @@ void Task::setRequireCommentOnCompletion(
 //////////
 //  Serialization
 void Task::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
     //  Activity properties of a concrete Task
     //  will be serialized via Activity route
 
-    objectElement.setAttribute("RequireCommentOnCompletion", tt3::util::toString(_requireCommentOnCompletion));
-    objectElement.setAttribute("Completed", tt3::util::toString(_completed));
+    writer.writeAttribute("RequireCommentOnCompletion", tt3::util::toString(_requireCommentOnCompletion));
+    writer.writeAttribute("Completed", tt3::util::toString(_completed));
 }
 
 void Task::_serializeAggregations(
-        QDomElement & /*objectElement*/
+        QXmlStreamWriter & /*writer*/
     ) const
 {
     //  Activity aggregations of a concrete Task
@@ -124,7 +124,7 @@ void Task::_serializeAggregations(
 }
 
 void Task::_serializeAssociations(
-        QDomElement & /*objectElement*/
+        QXmlStreamWriter & /*writer*/
     ) const
 {
     //  Activity associations of a concrete Task
@@ -132,7 +132,7 @@ void Task::_serializeAssociations(
 }
 
 void Task::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
     //  Activity properties of a concrete Task
@@ -140,16 +140,16 @@ void Task::_deserializeProperties(
 
     _requireCommentOnCompletion =
         tt3::util::fromString(
-            objectElement.attribute("RequireCommentOnCompletion"),
+            attributes.value("RequireCommentOnCompletion").toString(),
             _requireCommentOnCompletion);
     _completed =
         tt3::util::fromString(
-            objectElement.attribute("Completed"),
+            attributes.value("Completed").toString(),
             _completed);
 }
 
 void Task::_deserializeAggregations(
-        const QDomElement & /*objectElement*/
+        QXmlStreamReader & /*reader*/
     )
 {
     //  Activity aggregations of a concrete Task
@@ -157,7 +157,7 @@ void Task::_deserializeAggregations(
 }
 
 void Task::_deserializeAssociations(
-        const QDomElement & /*objectElement*/
+        const QXmlStreamAttributes & /*attributes*/
     )
 {
     //  Activity associations of a concrete Task
@@ -38,7 +38,7 @@ User::~User()
 //  tt3::db::api::IUser (properties)
 QString User::realName() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -68,7 +68,7 @@ void User::setRealName(
         _realName = realName;
         _database->_markModified();
         //  ...schedule change notifications....
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -81,7 +81,7 @@ void User::setRealName(
 auto User::inactivityTimeout(
     ) const -> tt3::db::api::InactivityTimeout
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -112,7 +112,7 @@ void User::setInactivityTimeout(
         _inactivityTimeout = inactivityTimeout;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -125,7 +125,7 @@ void User::setInactivityTimeout(
 auto User::uiLocale(
     ) const -> tt3::db::api::UiLocale
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -156,7 +156,7 @@ void User::setUiLocale(
         _uiLocale = uiLocale;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -171,7 +171,7 @@ void User::setUiLocale(
 auto User::accounts(
     ) const -> tt3::db::api::Accounts
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -181,7 +181,7 @@ auto User::accounts(
 auto User::privateActivities(
     ) const -> tt3::db::api::PrivateActivities
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -191,7 +191,7 @@ auto User::privateActivities(
 auto User::privateActivitiesAndTasks(
     ) const -> tt3::db::api::PrivateActivities
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -207,7 +207,7 @@ auto User::privateActivitiesAndTasks(
 auto User::privateTasks(
     ) const -> tt3::db::api::PrivateTasks
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -219,7 +219,7 @@ auto User::privateTasks(
 auto User::rootPrivateTasks(
     ) const -> tt3::db::api::PrivateTasks
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -229,7 +229,7 @@ auto User::rootPrivateTasks(
 auto User::permittedWorkloads(
     ) const -> tt3::db::api::Workloads
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -293,12 +293,12 @@ void User::setPermittedWorkloads(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         for (Workload * xmlWorkload : addedWorkloads + removedWorkloads)
         {
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, xmlWorkload->type(), xmlWorkload->_oid));
         }
@@ -345,10 +345,10 @@ void User::addPermittedWorkload(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlWorkload->type(), xmlWorkload->_oid));
         //  ...and we're done
@@ -394,10 +394,10 @@ void User::removePermittedWorkload(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlWorkload->type(), xmlWorkload->_oid));
         //  ...and we're done
@@ -467,12 +467,13 @@ auto User::createAccount(
     account->_login = login;
     account->_passwordHash = passwordHash;
     account->_capabilities = capabilities;
+    account->_addToIndexes();
     _database->_markModified();
     //  ...schedule change notifications...
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectModifiedNotification(
             _database, type(), _oid));
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             _database, account->type(), account->_oid));
     //  ...and we're done
@@ -579,21 +580,21 @@ auto User::createPrivateActivity(
     }
     _database->_markModified();
     //  ...schedule change notifications...
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectModifiedNotification(
             _database, this->type(), this->_oid));
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             _database, privateActivity->type(), privateActivity->_oid));
     if (xmlActivityType != nullptr)
     {
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlActivityType->type(), xmlActivityType->_oid));
     }
     if (xmlWorkload != nullptr)
     {
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlWorkload->type(), xmlWorkload->_oid));
     }
@@ -705,21 +706,21 @@ auto User::createPrivateTask(
     }
     _database->_markModified();
     //  ...schedule change notifications...
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectModifiedNotification(
             _database, this->type(), this->_oid));
-    _database->_changeNotifier.post(
+    _database->_postChangeNotification(
         new tt3::db::api::ObjectCreatedNotification(
             _database, privateTask->type(), privateTask->_oid));
     if (xmlActivityType != nullptr)
     {
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlActivityType->type(), xmlActivityType->_oid));
     }
     if (xmlWorkload != nullptr)
     {
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlWorkload->type(), xmlWorkload->_oid));
     }
@@ -806,84 +807,95 @@ void User::_collectPrivateTasksClosure(PrivateTasks & closure, const PrivateTask
 
 //////////
 //  Serialization
+auto User::_serializationParent(
+    ) const -> Object *
+{
+    return nullptr;  //  a root object
+}
+
+QString User::_serializationAggregationName() const
+{
+    return "Users";
+}
+
 void User::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Principal::_serializeProperties(objectElement);
+    Principal::_serializeProperties(writer);
 
-    objectElement.setAttribute("RealName", _realName);
+    writer.writeAttribute("RealName", _realName);
     if (_inactivityTimeout.has_value())
     {
-        objectElement.setAttribute("InactivityTimeout", tt3::util::toString(_inactivityTimeout.value()));
+        writer.writeAttribute("InactivityTimeout", tt3::util::toString(_inactivityTimeout.value()));
     }
     if (_uiLocale.has_value())
     {
-        objectElement.setAttribute("UiLocale", tt3::util::toString(_uiLocale.value()));
+        writer.writeAttribute("UiLocale", tt3::util::toString(_uiLocale.value()));
     }
 }
 
 void User::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Principal::_serializeAggregations(objectElement);
+    Principal::_serializeAggregations(writer);
 
     _database->_serializeAggregation(
-        objectElement,
+        writer,
         "Accounts",
         _accounts);
     _database->_serializeAggregation(
-        objectElement,
+        writer,
         "PrivateActivities",
         _privateActivities);
     _database->_serializeAggregation(
-        objectElement,
+        writer,
         "PrivateTasks",
         _rootPrivateTasks);
 }
 
 void User::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Principal::_serializeProperties(objectElement);
+    Principal::_serializeAssociations(writer);
 
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "PermittedWorkloads",
         _permittedWorkloads);
 }
 
 void User::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Principal::_deserializeProperties(objectElement);
+    Principal::_deserializeProperties(attributes);
 
-    _realName = objectElement.attribute("RealName");
-    if (objectElement.hasAttribute("InactivityTimeout"))
+    _realName = attributes.value("RealName").toString();
+    if (attributes.hasAttribute("InactivityTimeout"))
     {
         _inactivityTimeout =
             tt3::util::fromString<tt3::util::TimeSpan>(
-                objectElement.attribute("InactivityTimeout"));
+                attributes.value("InactivityTimeout").toString());
     }
-    if (objectElement.hasAttribute("UiLocale"))
+    if (attributes.hasAttribute("UiLocale"))
     {
         _uiLocale =
             tt3::util::fromString<QLocale>(
-                objectElement.attribute("UiLocale"));
+                attributes.value("UiLocale").toString());
     }
 }
 
 void User::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Principal::_deserializeAggregations(objectElement);
+    Principal::_deserializeAggregations(reader);
 
     _database->_deserializeAggregation<Account>(
-        objectElement,
+        reader,
         "Accounts",
         _accounts,
         [&](auto oid)
@@ -891,7 +903,7 @@ void User::_deserializeAggregations(
             return new Account(this, oid);
         });
     _database->_deserializeAggregation<PrivateActivity>(
-        objectElement,
+        reader,
         "PrivateActivities",
         _privateActivities,
         [&](auto oid)
@@ -899,7 +911,7 @@ void User::_deserializeAggregations(
             return new PrivateActivity(this, oid);
         });
     _database->_deserializeAggregation<PrivateTask>(
-        objectElement,
+        reader,
         "PrivateTasks",
         _rootPrivateTasks,
         [&](auto oid)
@@ -909,13 +921,13 @@ void User::_deserializeAggregations(
 }
 
 void User::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Principal::_deserializeProperties(objectElement);
+    Principal::_deserializeAssociations(attributes);
 
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "PermittedWorkloads",
         _permittedWorkloads);
 }
@@ -957,7 +969,7 @@ void User::_validate(
         {   //  OOPS!
             throw tt3::db::api::DatabaseCorruptException(_database->_address);
         }
-        account->_validate(validatedObjects);
+        _database->_validateAggregated(account, validatedObjects);
     }
     for (PrivateActivity * privateActivity : std::as_const(_privateActivities))
     {
@@ -967,7 +979,7 @@ void User::_validate(
         {   //  OOPS!
             throw tt3::db::api::DatabaseCorruptException(_database->_address);
         }
-        privateActivity->_validate(validatedObjects);
+        _database->_validateAggregated(privateActivity, validatedObjects);
     }
     for (PrivateTask * privateTask : std::as_const(_rootPrivateTasks))
     {
@@ -977,7 +989,7 @@ void User::_validate(
         {   //  OOPS!
             throw tt3::db::api::DatabaseCorruptException(_database->_address);
         }
-        privateTask->_validate(validatedObjects);
+        _database->_validateAggregated(privateTask, validatedObjects);
     }
 
     //  Validate associations
@@ -992,4 +1004,28 @@ void User::_validate(
     }
 }
 
+void User::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    Principal::_collectLinkedObjects(linkedObjects);
+
+    for (Account * account : std::as_const(_accounts))
+    {
+        linkedObjects.insert(account);
+    }
+    for (PrivateActivity * privateActivity : std::as_const(_privateActivities))
+    {
+        linkedObjects.insert(privateActivity);
+    }
+    for (PrivateTask * privateTask : std::as_const(_rootPrivateTasks))
+    {
+        linkedObjects.insert(privateTask);
+    }
+    for (Workload * workload : std::as_const(_permittedWorkloads))
+    {
+        linkedObjects.insert(workload);
+    }
+}
+
 //  End of tt3-db-xml/User.cpp
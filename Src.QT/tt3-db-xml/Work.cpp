@@ -43,7 +43,7 @@ Work::~Work()
 auto Work::startedAt(
     ) const -> QDateTime
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -53,7 +53,7 @@ auto Work::startedAt(
 auto Work::finishedAt(
     ) const -> QDateTime
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -65,7 +65,7 @@ auto Work::finishedAt(
 auto Work::account(
     ) const -> tt3::db::api::IAccount *
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -75,7 +75,7 @@ auto Work::account(
 auto Work::activity(
     ) const -> tt3::db::api::IActivity *
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -93,6 +93,7 @@ void Work::_makeDead()
     //  Break associations
     Q_ASSERT(_account != nullptr && _account->_isLive);
     Q_ASSERT(_account->_works.contains(this));
+    _account->_unindexWork(this);
     _account->_works.remove(this);
     this->removeReference();
     _account->removeReference();
@@ -111,60 +112,72 @@ void Work::_makeDead()
 
 //////////
 //  Serialization
+auto Work::_serializationParent(
+    ) const -> Object *
+{
+    return _account;
+}
+
+QString Work::_serializationAggregationName() const
+{
+    return "Works";
+}
+
 void Work::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeProperties(objectElement);
+    Object::_serializeProperties(writer);
 
-    objectElement.setAttribute("StartedAt", tt3::util::toString(_startedAt));
-    objectElement.setAttribute("FinishedAt", tt3::util::toString(_finishedAt));
+    writer.writeAttribute("StartedAt", tt3::util::toString(_startedAt));
+    writer.writeAttribute("FinishedAt", tt3::util::toString(_finishedAt));
 }
 
 void Work::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAggregations(objectElement);
+    Object::_serializeAggregations(writer);
 }
 
 void Work::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAssociations(objectElement);
+    Object::_serializeAssociations(writer);
 
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "Activity",
         _activity);
 }
 
 void Work::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeProperties(objectElement);
+    Object::_deserializeProperties(attributes);
 
-    _startedAt = tt3::util::fromString(objectElement.attribute("StartedAt"), _startedAt);
-    _finishedAt = tt3::util::fromString(objectElement.attribute("FinishedAt"), _finishedAt);
+    _startedAt = tt3::util::fromString(attributes.value("StartedAt").toString(), _startedAt);
+    _finishedAt = tt3::util::fromString(attributes.value("FinishedAt").toString(), _finishedAt);
+    _account->_indexWork(this);
 }
 
 void Work::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Object::_deserializeAggregations(objectElement);
+    Object::_deserializeAggregations(reader);
 }
 
 void Work::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeAssociations(objectElement);
+    Object::_deserializeAssociations(attributes);
 
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "Activity",
         _activity);
 }
@@ -198,4 +211,14 @@ void Work::_validate(
     }
 }
 
-//  End of tt3-db-xml/Account.cpp
+void Work::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    Object::_collectLinkedObjects(linkedObjects);
+
+    linkedObjects.insert(_account);
+    linkedObjects.insert(_activity);
+}
+
+//  End of tt3-db-xml/Work.cpp
@@ -61,48 +61,76 @@ void WorkStream::_makeDead()
     Workload::_makeDead();
 }
 
+void WorkStream::_addToIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    _database->_workStreamsByDisplayName.insert(_displayName, this);
+}
+
+void WorkStream::_removeFromIndexes()
+{
+    Q_ASSERT(_database->_guard.isLockedByCurrentThread());
+
+    if (_database->_workStreamsByDisplayName.value(_displayName) == this)
+    {
+        _database->_workStreamsByDisplayName.remove(_displayName);
+    }
+}
+
 //////////
 //  Serialization
+auto WorkStream::_serializationParent(
+    ) const -> Object *
+{
+    return nullptr;  //  a root object
+}
+
+QString WorkStream::_serializationAggregationName() const
+{
+    return "WorkStreams";
+}
+
 void WorkStream::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Workload::_serializeProperties(objectElement);
+    Workload::_serializeProperties(writer);
 }
 
 void WorkStream::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Workload::_serializeAggregations(objectElement);
+    Workload::_serializeAggregations(writer);
 }
 
 void WorkStream::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Workload::_serializeAssociations(objectElement);
+    Workload::_serializeAssociations(writer);
 }
 
 void WorkStream::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Workload::_deserializeProperties(objectElement);
+    Workload::_deserializeProperties(attributes);
 }
 
 void WorkStream::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Workload::_deserializeAggregations(objectElement);
+    Workload::_deserializeAggregations(reader);
 }
 
 void WorkStream::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Workload::_deserializeAssociations(objectElement);
+    Workload::_deserializeAssociations(attributes);
 }
 
 //////////
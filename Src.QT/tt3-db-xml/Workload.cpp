@@ -37,7 +37,7 @@ Workload::~Workload()
 //  tt3::db::api::IWorkload (properties)
 QString Workload::displayName() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -71,10 +71,12 @@ void Workload::setDisplayName(
                 "displayName",
                 displayName);
         }
+        _removeFromIndexes();
         _displayName = displayName;
+        _addToIndexes();
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -86,7 +88,7 @@ void Workload::setDisplayName(
 
 QString Workload::description() const
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -116,7 +118,7 @@ void Workload::setDescription(
         _description = description;
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         //  ...and we're done
@@ -131,7 +133,7 @@ void Workload::setDescription(
 auto Workload::contributingActivities(
     ) const -> tt3::db::api::Activities
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -141,7 +143,7 @@ auto Workload::contributingActivities(
 auto Workload::beneficiaries(
     ) const -> tt3::db::api::Beneficiaries
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -205,12 +207,12 @@ void Workload::setBeneficiaries(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         for (Beneficiary * xmlBeneficiary : addedBeneficiaries + removedBeneficiaries)
         {
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, xmlBeneficiary->type(), xmlBeneficiary->_oid));
         }
@@ -257,10 +259,10 @@ void Workload::addBeneficiary(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlBeneficiary->type(), xmlBeneficiary->_oid));
         //  ...and we're done
@@ -306,10 +308,10 @@ void Workload::removeBeneficiary(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlBeneficiary->type(), xmlBeneficiary->_oid));
         //  ...and we're done
@@ -322,7 +324,7 @@ void Workload::removeBeneficiary(
 auto Workload::assignedUsers(
     ) const -> tt3::db::api::Users
 {
-    tt3::util::Lock _(_database->_guard);
+    tt3::util::ReadLock _(_database->_guard);
     _ensureLive();  //  may throw
     //  We assume database is consistent since last change
 
@@ -386,12 +388,12 @@ void Workload::setAssignedUsers(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
         for (User * xmlUser : addedUsers + removedUsers)
         {
-            _database->_changeNotifier.post(
+            _database->_postChangeNotification(
                 new tt3::db::api::ObjectModifiedNotification(
                     _database, xmlUser->type(), xmlUser->_oid));
         }
@@ -438,10 +440,10 @@ void Workload::addAssignedUser(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlUser->type(), xmlUser->_oid));
         //  ...and we're done
@@ -487,10 +489,10 @@ void Workload::removeAssignedUser(
         //  ...ensure the changes are saved...
         _database->_markModified();
         //  ...schedule change notifications...
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, type(), _oid));
-        _database->_changeNotifier.post(
+        _database->_postChangeNotification(
             new tt3::db::api::ObjectModifiedNotification(
                 _database, xmlUser->type(), xmlUser->_oid));
         //  ...and we're done
@@ -543,75 +545,75 @@ void Workload::_makeDead()
 //////////
 //  Serialization
 void Workload::_serializeProperties(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeProperties(objectElement);
+    Object::_serializeProperties(writer);
 
-    objectElement.setAttribute("DisplayName", _displayName);
-    objectElement.setAttribute("Description", _description);
+    writer.writeAttribute("DisplayName", _displayName);
+    writer.writeAttribute("Description", _description);
 }
 
 void Workload::_serializeAggregations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAggregations(objectElement);
+    Object::_serializeAggregations(writer);
 }
 
 void Workload::_serializeAssociations(
-        QDomElement & objectElement
+        QXmlStreamWriter & writer
     ) const
 {
-    Object::_serializeAssociations(objectElement);
+    Object::_serializeAssociations(writer);
 
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "Beneficiaries",
         _beneficiaries);
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "AssignedUsers",
         _assignedUsers);
     _database->_serializeAssociation(
-        objectElement,
+        writer,
         "ContributingActivities",
         _contributingActivities);
 }
 
 void Workload::_deserializeProperties(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeProperties(objectElement);
+    Object::_deserializeProperties(attributes);
 
-    _displayName = objectElement.attribute("DisplayName");
-    _description = objectElement.attribute("Description");
+    _displayName = attributes.value("DisplayName").toString();
+    _description = attributes.value("Description").toString();
 }
 
 void Workload::_deserializeAggregations(
-        const QDomElement & objectElement
+        QXmlStreamReader & reader
     )
 {
-    Object::_deserializeAggregations(objectElement);
+    Object::_deserializeAggregations(reader);
 }
 
 void Workload::_deserializeAssociations(
-        const QDomElement & objectElement
+        const QXmlStreamAttributes & attributes
     )
 {
-    Object::_deserializeAssociations(objectElement);
+    Object::_deserializeAssociations(attributes);
 
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "Beneficiaries",
         _beneficiaries);
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "AssignedUsers",
         _assignedUsers);
     _database->_deserializeAssociation(
-        objectElement,
+        attributes,
         "ContributingActivities",
         _contributingActivities);
 }
@@ -669,4 +671,24 @@ void Workload::_validate(
     }
 }
 
+void Workload::_collectLinkedObjects(
+        Objects & linkedObjects
+    ) const
+{
+    Object::_collectLinkedObjects(linkedObjects);
+
+    for (Beneficiary * beneficiary : std::as_const(_beneficiaries))
+    {
+        linkedObjects.insert(beneficiary);
+    }
+    for (User * user : std::as_const(_assignedUsers))
+    {
+        linkedObjects.insert(user);
+    }
+    for (Activity * activity : std::as_const(_contributingActivities))
+    {
+        linkedObjects.insert(activity);
+    }
+}
+
 //  End of tt3-db-xml/Workload.cpp
@@ -35,6 +35,7 @@
 #include "tt3-gui/CurrentCredentials.hpp"
 #include "tt3-gui/CurrentWorkspace.hpp"
 #include "tt3-gui/CurrentActivity.hpp"
+#include "tt3-gui/RefreshScheduler.hpp"
 #include "tt3-gui/UiHelpers.hpp"
 #include "tt3-gui/QuickReport.hpp"
 
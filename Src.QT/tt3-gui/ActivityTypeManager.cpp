@@ -23,6 +23,7 @@ namespace tt3::gui
     extern CurrentTheme theCurrentTheme;
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -60,6 +61,7 @@ ActivityTypeManager::ActivityTypeManager(
             this,
             &ActivityTypeManager::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 
     //  Start listening for change notifications
     //  on the currently "viewed" Workspace
@@ -105,6 +107,13 @@ void ActivityTypeManager::setCredentials(const tt3::ws::Credentials & credential
 }
 
 void ActivityTypeManager::refresh()
+{
+    _refresh(nullptr);
+}
+
+void ActivityTypeManager::_refresh(
+        const QSet<tt3::ws::Oid> * modifiedOids
+    )
 {
     static const QIcon viewActivityTypeIcon(":/tt3-gui/Resources/Images/Actions/ViewActivityTypeLarge.png");
     static const QIcon modifyActivityTypeIcon(":/tt3-gui/Resources/Images/Actions/ModifyActivityTypeLarge.png");
@@ -130,6 +139,8 @@ void ActivityTypeManager::refresh()
             return;
         }
 
+        bool refreshItemsOnly = canRefreshItemsOnly(_ui->activityTypesTreeWidget, modifiedOids);
+
         //  Otherwise some controls are always enabled...
         _ui->filterLabel->setEnabled(true);
         _ui->filterLineEdit->setEnabled(true);
@@ -137,12 +148,16 @@ void ActivityTypeManager::refresh()
 
         //  ...while others are enabled based on current
         //  selection and permissions granted by Credentials
-        _WorkspaceModel workspaceModel = _createWorkspaceModel();
-        if (!_ui->filterLineEdit->text().trimmed().isEmpty())
-        {
-            _filterItems(workspaceModel);
+        if (!refreshItemsOnly ||
+            !_refreshModifiedItems(*modifiedOids))
+        {   //  Must rebuild the whole tree
+            _WorkspaceModel workspaceModel = _createWorkspaceModel();
+            if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+            {
+                _filterItems(workspaceModel);
+            }
+            _refreshWorkspaceTree(workspaceModel);
         }
-        _refreshWorkspaceTree(workspaceModel);
 
         tt3::ws::ActivityType currentActivityType = _currentActivityType();
         bool readOnly = _workspace->isReadOnly();
@@ -205,7 +220,10 @@ void ActivityTypeManager::refresh()
 
 void ActivityTypeManager::requestRefresh()
 {
-    emit refreshRequested();
+    if (_pendingRefresh.requestFullRefresh())
+    {
+        emit refreshRequested();
+    }
 }
 
 //////////
@@ -219,13 +237,9 @@ ActivityTypeManager::_WorkspaceModel ActivityTypeManager::_createWorkspaceModel(
         {
             workspaceModel->activityTypeModels.append(_createActivityTypeModel(activityType));
         }
-        std::sort(
-            workspaceModel->activityTypeModels.begin(),
-            workspaceModel->activityTypeModels.end(),
-            [&](const auto & a, const auto & b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            workspaceModel->activityTypeModels,
+            [](const auto & m) { return m->activityType; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -327,6 +341,36 @@ void ActivityTypeManager::_refreshActivityTypeItem(
     Q_ASSERT(activityTypeItem->childCount() == 0);
 }
 
+bool ActivityTypeManager::_refreshModifiedItems(
+        const QSet<tt3::ws::Oid> & modifiedOids
+    )
+{
+    if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+    {   //  A modified ActivityType may start or stop matching the filter
+        return modifiedOids.isEmpty();
+    }
+    for (const auto & oid : modifiedOids)
+    {
+        QTreeWidgetItem * activityTypeItem =
+            findTreeWidgetItem<tt3::ws::ActivityType>(
+                _ui->activityTypesTreeWidget,
+                oid);
+        if (activityTypeItem == nullptr)
+        {   //  OOPS! Not in the tree - can't patch it
+            return false;
+        }
+        _refreshActivityTypeItem(
+            activityTypeItem,
+            _createActivityTypeModel(
+                activityTypeItem->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::ActivityType>()));
+        if (!isInNaturalOrder(activityTypeItem))
+        {   //  Display name change requires re-ordering
+            return false;
+        }
+    }
+    return true;
+}
+
 //////////
 //  Implementation helpers
 tt3::ws::ActivityType ActivityTypeManager::_currentActivityType()
@@ -427,6 +471,18 @@ void ActivityTypeManager::_applyCurrentLocale()
     refresh();
 }
 
+void ActivityTypeManager::_objectCreatedOrDestroyed(
+        tt3::ws::ObjectType * objectType
+    )
+{
+    if (_pendingRefresh.requestRefreshOnObjectCreatedOrDestroyed(
+            objectType,
+            tt3::ws::ObjectTypes::ActivityType::instance()))
+    {
+        emit refreshRequested();
+    }
+}
+
 //////////
 //  Signal handlers
 void ActivityTypeManager::_currentThemeChanged(ITheme *, ITheme *)
@@ -555,24 +611,36 @@ void ActivityTypeManager::_workspaceClosed(tt3::ws::WorkspaceClosedNotification
     requestRefresh();
 }
 
-void ActivityTypeManager::_objectCreated(tt3::ws::ObjectCreatedNotification /*notification*/)
+void ActivityTypeManager::_objectCreated(tt3::ws::ObjectCreatedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void ActivityTypeManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification /*notification*/)
+void ActivityTypeManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void ActivityTypeManager::_objectModified(tt3::ws::ObjectModifiedNotification /*notification*/)
+void ActivityTypeManager::_objectModified(tt3::ws::ObjectModifiedNotification notification)
 {
-    requestRefresh();
+    if (_pendingRefresh.requestRefreshOnObjectModified(
+            notification,
+            tt3::ws::ObjectTypes::ActivityType::instance()))
+    {
+        emit refreshRequested();
+    }
 }
 
 void ActivityTypeManager::_refreshRequested()
 {
-    refresh();
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
+    PendingRefresh pendingRefresh = _pendingRefresh.take();
+    _refresh(pendingRefresh.isFullRefresh() ?
+                nullptr :
+                &pendingRefresh.modifiedOids());
 }
 
 //  End of tt3-gui/ActivityTypeManager.cpp
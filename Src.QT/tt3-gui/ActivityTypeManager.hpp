@@ -109,6 +109,7 @@ namespace tt3::gui
         tt3::ws::Workspace      _workspace;
         tt3::ws::Credentials    _credentials;
         bool                    _refreshUnderway = false;
+        PendingRefresh          _pendingRefresh;
 
         //  View model
         struct _WorkspaceModelImpl;
@@ -150,8 +151,14 @@ namespace tt3::gui
                             QTreeWidgetItem * activityTypeItem,
                             _ActivityTypeModel activityTypeModel
                         );
+        bool        _refreshModifiedItems(
+                            const QSet<tt3::ws::Oid> & modifiedOids
+                        );  //  false == must rebuild the whole tree
 
         //  Helpers
+        void        _refresh(
+                            const QSet<tt3::ws::Oid> * modifiedOids
+                        );  //  nullptr == refresh all
         auto        _currentActivityType(
                         ) -> tt3::ws::ActivityType;
         void        _setCurrentActivityType(
@@ -160,6 +167,9 @@ namespace tt3::gui
         void        _startListeningToWorkspaceChanges();
         void        _stopListeningToWorkspaceChanges();
         void        _clearAndDisableAllControls();
+        void        _objectCreatedOrDestroyed(
+                            tt3::ws::ObjectType * objectType
+                        );
         void        _applyCurrentLocale();
 
         //////////
@@ -23,6 +23,7 @@ namespace tt3::gui
     extern CurrentTheme theCurrentTheme;
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -60,6 +61,7 @@ BeneficiaryManager::BeneficiaryManager(
             this,
             &BeneficiaryManager::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 
     //  Start listening for change notifications
     //  on the currently "viewed" Workspace
@@ -105,6 +107,13 @@ void BeneficiaryManager::setCredentials(const tt3::ws::Credentials & credentials
 }
 
 void BeneficiaryManager::refresh()
+{
+    _refresh(nullptr);
+}
+
+void BeneficiaryManager::_refresh(
+        const QSet<tt3::ws::Oid> * modifiedOids
+    )
 {
     static const QIcon viewBeneficiaryIcon(":/tt3-gui/Resources/Images/Actions/ViewBeneficiaryLarge.png");
     static const QIcon modifyBeneficiaryIcon(":/tt3-gui/Resources/Images/Actions/ModifyBeneficiaryLarge.png");
@@ -130,6 +139,8 @@ void BeneficiaryManager::refresh()
             return;
         }
 
+        bool refreshItemsOnly = canRefreshItemsOnly(_ui->beneficiariesTreeWidget, modifiedOids);
+
         //  Otherwise some controls are always enabled...
         _ui->filterLabel->setEnabled(true);
         _ui->filterLineEdit->setEnabled(true);
@@ -137,14 +148,18 @@ void BeneficiaryManager::refresh()
 
         //  ...while others are enabled based on current
         //  selection and permissions granted by Credentials
-        _WorkspaceModel workspaceModel =
-            _createWorkspaceModel(_workspace, _credentials, _decorations);
-        QString filter = _ui->filterLineEdit->text().trimmed();
-        if (!filter.isEmpty())
-        {
-            _filterItems(workspaceModel, filter, _decorations);
+        if (!refreshItemsOnly ||
+            !_refreshModifiedItems(*modifiedOids))
+        {   //  Must rebuild the whole tree
+            _WorkspaceModel workspaceModel =
+                _createWorkspaceModel(_workspace, _credentials, _decorations);
+            QString filter = _ui->filterLineEdit->text().trimmed();
+            if (!filter.isEmpty())
+            {
+                _filterItems(workspaceModel, filter, _decorations);
+            }
+            _refreshWorkspaceTree(_ui->beneficiariesTreeWidget, workspaceModel);
         }
-        _refreshWorkspaceTree(_ui->beneficiariesTreeWidget, workspaceModel);
 
         tt3::ws::Beneficiary currentBeneficiary = _currentBeneficiary();
         bool readOnly = _workspace->isReadOnly();
@@ -207,7 +222,10 @@ void BeneficiaryManager::refresh()
 
 void BeneficiaryManager::requestRefresh()
 {
-    emit refreshRequested();
+    if (_pendingRefresh.requestFullRefresh())
+    {
+        emit refreshRequested();
+    }
 }
 
 //////////
@@ -226,13 +244,9 @@ auto BeneficiaryManager::_createWorkspaceModel(
             workspaceModel->beneficiaryModels.append(
                 _createBeneficiaryModel(beneficiary, credentials, decorations));
         }
-        std::sort(
-            workspaceModel->beneficiaryModels.begin(),
-            workspaceModel->beneficiaryModels.end(),
-            [&](const auto & a, const auto & b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            workspaceModel->beneficiaryModels,
+            [](const auto & m) { return m->beneficiary; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -341,6 +355,38 @@ void BeneficiaryManager::_refreshBeneficiaryItem(
     Q_ASSERT(beneficiaryItem->childCount() == 0);
 }
 
+bool BeneficiaryManager::_refreshModifiedItems(
+        const QSet<tt3::ws::Oid> & modifiedOids
+    )
+{
+    if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+    {   //  A modified Beneficiary may start or stop matching the filter
+        return modifiedOids.isEmpty();
+    }
+    for (const auto & oid : modifiedOids)
+    {
+        QTreeWidgetItem * beneficiaryItem =
+            findTreeWidgetItem<tt3::ws::Beneficiary>(
+                _ui->beneficiariesTreeWidget,
+                oid);
+        if (beneficiaryItem == nullptr)
+        {   //  OOPS! Not in the tree - can't patch it
+            return false;
+        }
+        _refreshBeneficiaryItem(
+            beneficiaryItem,
+            _createBeneficiaryModel(
+                beneficiaryItem->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::Beneficiary>(),
+                _credentials,
+                _decorations));
+        if (!isInNaturalOrder(beneficiaryItem))
+        {   //  Display name change requires re-ordering
+            return false;
+        }
+    }
+    return true;
+}
+
 //////////
 //  Implementation helpers
 tt3::ws::Beneficiary BeneficiaryManager::_currentBeneficiary()
@@ -441,6 +487,18 @@ void BeneficiaryManager::_applyCurrentLocale()
     refresh();
 }
 
+void BeneficiaryManager::_objectCreatedOrDestroyed(
+        tt3::ws::ObjectType * objectType
+    )
+{
+    if (_pendingRefresh.requestRefreshOnObjectCreatedOrDestroyed(
+            objectType,
+            tt3::ws::ObjectTypes::Beneficiary::instance()))
+    {
+        emit refreshRequested();
+    }
+}
+
 //////////
 //  Signal handlers
 void BeneficiaryManager::_currentThemeChanged(ITheme *, ITheme *)
@@ -569,24 +627,36 @@ void BeneficiaryManager::_workspaceClosed(tt3::ws::WorkspaceClosedNotification /
     requestRefresh();
 }
 
-void BeneficiaryManager::_objectCreated(tt3::ws::ObjectCreatedNotification /*notification*/)
+void BeneficiaryManager::_objectCreated(tt3::ws::ObjectCreatedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void BeneficiaryManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification /*notification*/)
+void BeneficiaryManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void BeneficiaryManager::_objectModified(tt3::ws::ObjectModifiedNotification /*notification*/)
+void BeneficiaryManager::_objectModified(tt3::ws::ObjectModifiedNotification notification)
 {
-    requestRefresh();
+    if (_pendingRefresh.requestRefreshOnObjectModified(
+            notification,
+            tt3::ws::ObjectTypes::Beneficiary::instance()))
+    {
+        emit refreshRequested();
+    }
 }
 
 void BeneficiaryManager::_refreshRequested()
 {
-    refresh();
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
+    PendingRefresh pendingRefresh = _pendingRefresh.take();
+    _refresh(pendingRefresh.isFullRefresh() ?
+                nullptr :
+                &pendingRefresh.modifiedOids());
 }
 
 //  End of tt3-gui/BeneficiaryManager.cpp
@@ -113,6 +113,7 @@ namespace tt3::gui
         tt3::ws::Workspace      _workspace;
         tt3::ws::Credentials    _credentials;
         bool                    _refreshUnderway = false;
+        PendingRefresh          _pendingRefresh;
 
         //  View model
         //  Model services are "static" because they are oiggybacked
@@ -166,8 +167,14 @@ namespace tt3::gui
                             QTreeWidgetItem * beneficiaryItem,
                             _BeneficiaryModel beneficiaryModel
                         );
+        bool        _refreshModifiedItems(
+                            const QSet<tt3::ws::Oid> & modifiedOids
+                        );  //  false == must rebuild the whole tree
 
         //  Helpers
+        void        _refresh(
+                            const QSet<tt3::ws::Oid> * modifiedOids
+                        );  //  nullptr == refresh all
         auto        _currentBeneficiary(
                         ) -> tt3::ws::Beneficiary;
         void        _setCurrentBeneficiary(
@@ -176,6 +183,9 @@ namespace tt3::gui
         void        _startListeningToWorkspaceChanges();
         void        _stopListeningToWorkspaceChanges();
         void        _clearAndDisableAllControls();
+        void        _objectCreatedOrDestroyed(
+                            tt3::ws::ObjectType * objectType
+                        );
         void        _applyCurrentLocale();
 
         //////////
@@ -24,6 +24,7 @@ namespace tt3::gui
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
     extern CurrentActivity theCurrentActivity;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -37,8 +38,7 @@ MyDayManager::MyDayManager(
         //  View model
         _myDayModel(new _MyDayModelImpl()),
         //  Controls
-        _ui(new Ui::MyDayManager),
-        _refreshTimer(this)
+        _ui(new Ui::MyDayManager)
 {
     _ui->setupUi(this);
     _pushButtonDecorations = PushButtonDecorations(_ui->quickPicksPushButton);
@@ -79,6 +79,7 @@ MyDayManager::MyDayManager(
             this,
             &MyDayManager::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 
     //  Current activity change means, at least, a refresh
     connect(&theCurrentActivity,
@@ -91,12 +92,11 @@ MyDayManager::MyDayManager(
     //  on the currently "viewed" Workspace
     _startListeningToWorkspaceChanges();
 
-    //  Must listen to refresh timer
-    connect(&_refreshTimer,
-            &QTimer::timeout,
+    //  The current activity's elapsed time changes every second
+    connect(&theRefreshScheduler,
+            &RefreshScheduler::tick,
             this,
-            &MyDayManager::_refreshTimerTimeout);
-    _refreshTimer.start(1000);
+            &MyDayManager::_clockTicked);
     
     //  Done
     _constructed = true;
@@ -104,7 +104,6 @@ MyDayManager::MyDayManager(
 
 MyDayManager::~MyDayManager()
 {
-    _refreshTimer.stop();
     _stopListeningToWorkspaceChanges();
     delete _ui;
 }
@@ -123,8 +122,6 @@ void MyDayManager::setWorkspace(tt3::ws::Workspace workspace)
         _stopListeningToWorkspaceChanges();
         _workspace = workspace;
         _startListeningToWorkspaceChanges();
-        _recreateDynamicControls();
-        _myDayModel = _createMyDayModel();
         requestRefresh();
     }
 }
@@ -139,124 +136,21 @@ void MyDayManager::setCredentials(const tt3::ws::Credentials & credentials)
     if (credentials != _credentials)
     {
         _credentials = credentials;
-        _recreateDynamicControls();
-        _myDayModel = _createMyDayModel();
         requestRefresh();
     }
 }
 
 void MyDayManager::refresh()
 {
-    tt3::util::ResourceReader rr(Component::Resources::instance(), RSID(MyDayManager));
-
-    //  We don't want a refresh() to trigger a recursive refresh()!
-    if (auto _ = RefreshGuard(_refreshUnderway)) //  Don't recurse!
-    {
-        try
-        {
-            if (_workspace == nullptr || !_credentials.isValid() ||
-                !_workspace->isOpen() ||
-                !_workspace->canAccess(_credentials)) //  may throw
-            {   //  Nothing to show
-                _clearAndDisableAllControls();
-                return;
-            }
-        }
-        catch (const tt3::util::Exception & ex)
-        {   //  OOPS! No point in proceesing.
-            qCritical() << ex;
-            _clearAndDisableAllControls();
-            return;
-        }
-
-        //  Otherwise some controls are always enabled...
-        _ui->quickPicksPushButton->setEnabled(
-            !_workspace->isReadOnly());
-        _ui->filterLabel->setEnabled(true);
-        _ui->filterComboBox->setEnabled(true);
-        _ui->logListWidget->setEnabled(true);
-        try
-        {
-            _ui->logEventPushButton->setEnabled(
-                !_workspace->isReadOnly() &&
-                _workspace->grantsAny(  //  may throw
-                    _credentials,
-                    tt3::ws::Capability::Administrator |
-                    tt3::ws::Capability::LogEvents));
-        }
-        catch (const tt3::util::Exception & ex)
-        {   //  OOPS! Log & disable
-            qCritical() << ex;
-            _ui->logEventPushButton->setEnabled(false);
-        }
-
-        _refreslLogList();
-
-        //  Adjust quick pick button states & appearance
-        for (int i = 0; i < _quickPicksList.size(); i++)
-        {
-            try
-            {
-                QString suffix;
-                if (tt3::ws::Task task =
-                    std::dynamic_pointer_cast<tt3::ws::TaskImpl>(_quickPicksList[i]))
-                {
-                    if (task->completed(_credentials))
-                    {
-                        suffix = "\n" + rr.string(RID(TaskCompletedSuffix));
-                    }
-                }
-                if (theCurrentActivity == _quickPicksList[i])
-                {   //  Must adjust the button's text & UI style
-                    qint64 secs = qMax(0, theCurrentActivity.lastChangedAt().secsTo(QDateTime::currentDateTimeUtc()));
-                    char s[32];
-                    sprintf(s, " [%d:%02d:%02d]",
-                            int(secs / (60 * 60)),
-                            int((secs / 60) % 60),
-                            int(secs % 60));
-                    _quickPicksButtons[i]->setText(
-                        _quickPicksList[i]->displayName(_credentials) + s + suffix); //  may throw
-                    bool canStop =
-                        !_workspace->isReadOnly() &&
-                        _quickPicksList[i]->canStop(_credentials); //  may throw
-                    _pushButtonDecorations.applyTo(
-                        _quickPicksButtons[i],
-                        canStop ?
-                            PushButtonDecorations::ButtonRole::LiveStatusButton :
-                            PushButtonDecorations::ButtonRole::DisabledButton);
-                    _quickPicksButtons[i]->setEnabled(canStop);
-                }
-                else
-                {   //  Must adjust the button's text & UI style
-                    _quickPicksButtons[i]->setText(
-                        _quickPicksList[i]->displayName(_credentials) + suffix); //  may throw
-                    bool canStart =
-                        !_workspace->isReadOnly() &&
-                        _quickPicksList[i]->canStart(_credentials); //  may throw
-                    _pushButtonDecorations.applyTo(
-                        _quickPicksButtons[i],
-                        canStart ?
-                            PushButtonDecorations::ButtonRole::NormalButton :
-                            PushButtonDecorations::ButtonRole::DisabledButton);
-                    _quickPicksButtons[i]->setEnabled(canStart);
-                }
-            }
-            catch (const tt3::util::Exception & ex)
-            {
-                qCritical() << ex;
-                _quickPicksButtons[i]->setText(ex.errorMessage());
-                _pushButtonDecorations.applyTo(
-                    _quickPicksButtons[i],
-                    PushButtonDecorations::ButtonRole::ErrorButton);
-                _quickPicksButtons[i]->setEnabled(false);
-            }
-        }
-    }
+    _refresh(nullptr);
 }
 
 void MyDayManager::requestRefresh()
 {
-    emit refreshRequested();
+    if (_pendingRefresh.requestFullRefresh())
+    {
+        emit refreshRequested();
+    }
 }
 
 //////////
@@ -266,91 +160,83 @@ MyDayManager::_MyDayModel MyDayManager::_createMyDayModel()
     _MyDayModel myDayModel = std::make_shared<_MyDayModelImpl>();
     if (_workspace != nullptr)
     {
-        QDate localToday = QDateTime::currentDateTime().date();
-        QDateTime localFrom(localToday.addDays(-_logDepth() + 1), QTime(0, 0));
-        QDateTime localTo(localToday, QTime(23, 59, 59, 999));
-        QDateTime from = localFrom.toUTC(), to = localTo.toUTC();
+        myDayModel->localToday = QDateTime::currentDateTime().date();
+        QDateTime localFrom(myDayModel->localToday.addDays(-_logDepth() + 1), QTime(0, 0));
+        QDateTime localTo(myDayModel->localToday, QTime(23, 59, 59, 999));
+        myDayModel->from = localFrom.toUTC();
+        myDayModel->to = localTo.toUTC();
         try
         {
             tt3::ws::Account account = _workspace->login(_credentials); //  may throw
-            for (const auto & work : account->works(_credentials, from, to)) //  may throw
+            //  Bulk queries check access rights once, not per item
+            for (const auto & workRecord : account->workRecords(_credentials, myDayModel->from, myDayModel->to))   //  may throw
             {
-                try
-                {
-                    myDayModel->itemModels.append(_createWorkModel(work));  //  may throw
-                }
-                catch (const tt3::util::Exception & ex)
-                {   //  OOPS! Log, but ignore
-                    qCritical() << ex;
-                }
+                myDayModel->sourceItemModels.append(_createWorkModel(myDayModel, workRecord));
             }
-            for (const auto & event : account->events(_credentials, from, to)) //  may throw
+            for (const auto & eventRecord : account->eventRecords(_credentials, myDayModel->from, myDayModel->to)) //  may throw
             {
-                try
-                {
-                    myDayModel->itemModels.append(_createEventModel(event));    //  may throw
-                }
-                catch (const tt3::util::Exception & ex)
-                {   //  OOPS! Log, but ignore
-                    qCritical() << ex;
-                }
+                myDayModel->sourceItemModels.append(_createEventModel(myDayModel, eventRecord));
             }
-            //  If there is a "current" activity add its item
-            if (theCurrentActivity != nullptr)
-            {
-                try
+            //  Both lists come sorted, but must be merged
+            std::stable_sort(
+                myDayModel->sourceItemModels.begin(),
+                myDayModel->sourceItemModels.end(),
+                [](auto a, auto b)
                 {
-                    myDayModel->itemModels.append(_createCurrentActivityModel());   //  may throw
-                }
-                catch (const tt3::util::Exception & ex)
-                {   //  OOPS! Log, but ignore
-                    qCritical() << ex;
-                }
-            }
+                    return a->startedAt() < b->startedAt();
+                });
+            //  If there is a "current" activity add its item
+            _replaceCurrentActivityModel(myDayModel);
         }
         catch (const tt3::util::Exception & ex)
         {
             qCritical() << ex;
-            myDayModel->itemModels.clear();
+            myDayModel->clear();
             //  Add a single "error" _ItemModel
-            myDayModel->itemModels.append(
+            myDayModel->sourceItemModels.append(
                 std::make_shared<_ErrorModelImpl>(ex.errorMessage()));
+            myDayModel->isErroneous = true;
         }
     }
-    _breakLongWorks(myDayModel);
-    _addDateIndicators(myDayModel);
-    _sortChronologically(myDayModel);
-    _breakWorksOnEvents(myDayModel);
+    _deriveItemModels(myDayModel);
     return myDayModel;
 }
 
-MyDayManager::_WorkModel MyDayManager::_createWorkModel(tt3::ws::Work work)
+MyDayManager::_WorkModel MyDayManager::_createWorkModel(
+        _MyDayModel myDayModel,
+        const tt3::ws::WorkRecord & workRecord
+    )
 {
-    tt3::ws::Activity activity = work->activity(_credentials);  //  may throw
-    QString displayName = activity->displayName(_credentials);  //  may throw
-    QString description = activity->description(_credentials).trimmed();    //  may throw
+    const tt3::ws::ActivityRecord & activityRecord = workRecord.activity;
+    _rememberActivityText(myDayModel, activityRecord);
+    QString displayName = activityRecord.displayName;
+    QString description = activityRecord.description.trimmed();
     QString tooltip =
         description.isEmpty() ?
             displayName :
             displayName + "\n\n" + description;
     _WorkModel workModel =
         std::make_shared<_WorkModelImpl>(
-            work,
-            work->startedAt(_credentials).toLocalTime(),                //  may throw
-            work->finishedAt(_credentials).toLocalTime(),               //  may throw
+            workRecord.work,
+            workRecord.startedAt.toLocalTime(),
+            workRecord.finishedAt.toLocalTime(),
             displayName,
-            activity->type()->smallIcon(),
+            activityRecord.activity->type()->smallIcon(),
             tooltip);
     return workModel;
 }
 
-MyDayManager::_EventModel MyDayManager::_createEventModel(tt3::ws::Event event)
+MyDayManager::_EventModel MyDayManager::_createEventModel(
+        _MyDayModel myDayModel,
+        const tt3::ws::EventRecord & eventRecord
+    )
 {
-    QString summary = event->summary(_credentials); //  may throw
+    QString summary = eventRecord.summary;
     QString tooltip = summary;
-    for (const auto & activity : event->activities(_credentials))
+    for (const auto & activityRecord : eventRecord.activities)
     {
-        QString description = activity->description(_credentials).trimmed();    //  may throw
+        _rememberActivityText(myDayModel, activityRecord);
+        QString description = activityRecord.description.trimmed();
         if (!description.isEmpty())
         {
             tooltip += "\n\n";
@@ -359,19 +245,22 @@ MyDayManager::_EventModel MyDayManager::_createEventModel(tt3::ws::Event event)
     }
     _EventModel eventModel =
         std::make_shared<_EventModelImpl>(
-            event,
-            event->occurredAt(_credentials).toLocalTime(),  //  may throw
+            eventRecord.event,
+            eventRecord.occurredAt.toLocalTime(),
             summary,
-            event->type()->smallIcon(),
+            eventRecord.event->type()->smallIcon(),
             tooltip);
     return eventModel;
 }
 
 auto MyDayManager::_createCurrentActivityModel(
+        _MyDayModel myDayModel
     ) -> _CurrentActivityModel
 {
     QString displayName = theCurrentActivity->displayName(_credentials);  //  may throw
     QString description = theCurrentActivity->description(_credentials).trimmed();    //  may throw
+    myDayModel->activityTexts[theCurrentActivity->oid()] =
+        displayName + '\n' + description;
     QString tooltip =
         description.isEmpty() ?
             displayName :
@@ -384,6 +273,189 @@ auto MyDayManager::_createCurrentActivityModel(
                 tooltip);
 }
 
+void MyDayManager::_rememberActivityText(
+        _MyDayModel myDayModel,
+        const tt3::ws::ActivityRecord & activityRecord
+    )
+{
+    myDayModel->activityTexts[activityRecord.activity->oid()] =
+        activityRecord.displayName + '\n' + activityRecord.description.trimmed();
+}
+
+bool MyDayManager::_refreshModifiedItems(
+        const QSet<tt3::ws::Oid> & modifiedOids
+    )
+{
+    if (_myDayModel->isErroneous ||
+        _myDayModel->localToday != QDateTime::currentDateTime().date())
+    {   //  Retry from scratch; midnight moves the whole log window
+        return false;
+    }
+    if (modifiedOids.isEmpty())
+    {   //  Nothing to patch
+        return true;
+    }
+    try
+    {
+        tt3::ws::Account account = _workspace->login(_credentials); //  may throw
+        bool changed = false;
+        for (const auto & oid : modifiedOids)
+        {
+            tt3::ws::Object object =
+                _workspace->findObjectByOid<tt3::ws::Object>(_credentials, oid);  //  may throw
+            if (_myDayModel->activityTexts.contains(oid))
+            {   //  An Activity shown in the log - its items are
+                //  split & merged all over the place, so unless its
+                //  texts are unchanged, it's easier to start afresh
+                auto activity = std::dynamic_pointer_cast<tt3::ws::ActivityImpl>(object);
+                if (activity == nullptr ||
+                    activity->displayName(_credentials) + '\n' + activity->description(_credentials).trimmed() !=   //  may throw
+                        _myDayModel->activityTexts[oid])
+                {
+                    return false;
+                }
+                continue;
+            }
+            //  Drop the stale items representing the object...
+            changed |=
+                _myDayModel->sourceItemModels.removeIf(
+                    [&](auto itemModel)
+                    {
+                        return itemModel->oid() == oid;
+                    }) > 0;
+            //  ...and re-create them if the object is still ours & relevant
+            if (auto work = std::dynamic_pointer_cast<tt3::ws::WorkImpl>(object))
+            {
+                changed |= _addWorkModels(_myDayModel, account, work);  //  may throw
+            }
+            else if (auto event = std::dynamic_pointer_cast<tt3::ws::EventImpl>(object))
+            {
+                changed |= _addEventModels(_myDayModel, account, event);    //  may throw
+            }
+        }
+        if (changed)
+        {
+            _deriveItemModels(_myDayModel);
+        }
+        return true;
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Log & retry from scratch
+        qCritical() << ex;
+        return false;
+    }
+}
+
+bool MyDayManager::_addWorkModels(
+        _MyDayModel myDayModel,
+        tt3::ws::Account account,
+        tt3::ws::Work work
+    )
+{
+    if (work->account(_credentials)->oid() != account->oid())   //  may throw
+    {   //  Someone else's Work
+        return false;
+    }
+    QDateTime startedAt = work->startedAt(_credentials);    //  may throw
+    QDateTime finishedAt = work->finishedAt(_credentials);  //  may throw
+    if (finishedAt < myDayModel->from || startedAt > myDayModel->to)
+    {   //  Outside the log window
+        return false;
+    }
+    //  The bulk query over just this Work's time range
+    //  gives us a consistent snapshot of it
+    bool added = false;
+    for (const auto & workRecord :
+         account->workRecords(  //  may throw
+            _credentials,
+            qMax(startedAt, myDayModel->from),
+            qMin(finishedAt, myDayModel->to)))
+    {
+        if (workRecord.work->oid() == work->oid())
+        {
+            _insertSourceItemModel(myDayModel, _createWorkModel(myDayModel, workRecord));
+            added = true;
+        }
+    }
+    return added;
+}
+
+bool MyDayManager::_addEventModels(
+        _MyDayModel myDayModel,
+        tt3::ws::Account account,
+        tt3::ws::Event event
+    )
+{
+    if (event->account(_credentials)->oid() != account->oid())  //  may throw
+    {   //  Someone else's Event
+        return false;
+    }
+    QDateTime occurredAt = event->occurredAt(_credentials); //  may throw
+    if (occurredAt < myDayModel->from || occurredAt > myDayModel->to)
+    {   //  Outside the log window
+        return false;
+    }
+    bool added = false;
+    for (const auto & eventRecord :
+         account->eventRecords(_credentials, occurredAt, occurredAt))   //  may throw
+    {
+        if (eventRecord.event->oid() == event->oid())
+        {
+            _insertSourceItemModel(myDayModel, _createEventModel(myDayModel, eventRecord));
+            added = true;
+        }
+    }
+    return added;
+}
+
+void MyDayManager::_replaceCurrentActivityModel(
+        _MyDayModel myDayModel
+    )
+{
+    myDayModel->sourceItemModels.removeIf(
+        [](auto itemModel)
+        {
+            return std::dynamic_pointer_cast<_CurrentActivityModelImpl>(itemModel) != nullptr;
+        });
+    if (theCurrentActivity != nullptr)
+    {
+        try
+        {
+            _insertSourceItemModel(myDayModel, _createCurrentActivityModel(myDayModel)); //  may throw
+        }
+        catch (const tt3::util::Exception & ex)
+        {   //  OOPS! Log, but ignore
+            qCritical() << ex;
+        }
+    }
+}
+
+void MyDayManager::_insertSourceItemModel(
+        _MyDayModel myDayModel,
+        _ItemModel itemModel
+    )
+{   //  Keep the source item models oldest first
+    auto position =
+        std::upper_bound(
+            myDayModel->sourceItemModels.begin(),
+            myDayModel->sourceItemModels.end(),
+            itemModel,
+            [](auto a, auto b)
+            {
+                return a->startedAt() < b->startedAt();
+            });
+    myDayModel->sourceItemModels.insert(position, itemModel);
+}
+
+void MyDayManager::_deriveItemModels(_MyDayModel myDayModel)
+{   //  Cheap compared to querying the workspace
+    myDayModel->itemModels = myDayModel->sourceItemModels;
+    _breakLongWorks(myDayModel);
+    _addDateIndicators(myDayModel);
+    _sortChronologically(myDayModel);
+    _breakWorksOnEvents(myDayModel);
+}
+
 void MyDayManager::_breakLongWorks(_MyDayModel myDayModel)
 {
     for (int i = 0; i < myDayModel->itemModels.size(); i++)
@@ -535,6 +607,165 @@ void MyDayManager::_breakWorksOnEvents(_MyDayModel myDayModel)
 
 //////////
 //  Implementation helpers
+void MyDayManager::_refresh(
+        const QSet<tt3::ws::Oid> * modifiedOids
+    )
+{
+    tt3::util::ResourceReader rr(Component::Resources::instance(), RSID(MyDayManager));
+
+    //  We don't want a refresh() to trigger a recursive refresh()!
+    if (auto _ = RefreshGuard(_refreshUnderway)) //  Don't recurse!
+    {
+        try
+        {
+            if (_workspace == nullptr || !_credentials.isValid() ||
+                !_workspace->isOpen() ||
+                !_workspace->canAccess(_credentials)) //  may throw
+            {   //  Nothing to show
+                _clearAndDisableAllControls();
+                return;
+            }
+        }
+        catch (const tt3::util::Exception & ex)
+        {   //  OOPS! No point in proceesing.
+            qCritical() << ex;
+            _clearAndDisableAllControls();
+            return;
+        }
+
+        //  A disabled log list is an empty log list
+        bool logPopulated = _ui->logListWidget->isEnabled();
+
+        if (modifiedOids == nullptr || !logPopulated ||
+            !_refreshModifiedItems(*modifiedOids))
+        {   //  Must re-create the whole model
+            _quickPicksOutdated = false;
+            _recreateDynamicControls();
+            _myDayModel = _createMyDayModel();
+        }
+        else if (_quickPicksOutdated)
+        {
+            _quickPicksOutdated = false;
+            _recreateDynamicControls();
+        }
+
+        //  Otherwise some controls are always enabled...
+        _ui->quickPicksPushButton->setEnabled(
+            !_workspace->isReadOnly());
+        _ui->filterLabel->setEnabled(true);
+        _ui->filterComboBox->setEnabled(true);
+        _ui->logListWidget->setEnabled(true);
+        try
+        {
+            _ui->logEventPushButton->setEnabled(
+                !_workspace->isReadOnly() &&
+                _workspace->grantsAny(  //  may throw
+                    _credentials,
+                    tt3::ws::Capability::Administrator |
+                    tt3::ws::Capability::LogEvents));
+        }
+        catch (const tt3::util::Exception & ex)
+        {   //  OOPS! Log & disable
+            qCritical() << ex;
+            _ui->logEventPushButton->setEnabled(false);
+        }
+
+        _refreslLogList();
+
+        //  Adjust quick pick button states & appearance
+        _currentQuickPickIndex = -1;
+        for (int i = 0; i < _quickPicksList.size(); i++)
+        {
+            try
+            {
+                QString suffix;
+                if (tt3::ws::Task task =
+                    std::dynamic_pointer_cast<tt3::ws::TaskImpl>(_quickPicksList[i]))
+                {
+                    if (task->completed(_credentials))
+                    {
+                        suffix = "\n" + rr.string(RID(TaskCompletedSuffix));
+                    }
+                }
+                if (theCurrentActivity == _quickPicksList[i])
+                {   //  Must adjust the button's text & UI style;
+                    //  the refresh timer keeps the elapsed time current
+                    _currentQuickPickIndex = i;
+                    _currentQuickPickText = _quickPicksList[i]->displayName(_credentials);  //  may throw
+                    _currentQuickPickSuffix = suffix;
+                    _quickPicksButtons[i]->setText(
+                        _currentQuickPickText + _elapsedTimeSuffix() + suffix);
+                    bool canStop =
+                        !_workspace->isReadOnly() &&
+                        _quickPicksList[i]->canStop(_credentials); //  may throw
+                    _pushButtonDecorations.applyTo(
+                        _quickPicksButtons[i],
+                        canStop ?
+                            PushButtonDecorations::ButtonRole::LiveStatusButton :
+                            PushButtonDecorations::ButtonRole::DisabledButton);
+                    _quickPicksButtons[i]->setEnabled(canStop);
+                }
+                else
+                {   //  Must adjust the button's text & UI style
+                    _quickPicksButtons[i]->setText(
+                        _quickPicksList[i]->displayName(_credentials) + suffix); //  may throw
+                    bool canStart =
+                        !_workspace->isReadOnly() &&
+                        _quickPicksList[i]->canStart(_credentials); //  may throw
+                    _pushButtonDecorations.applyTo(
+                        _quickPicksButtons[i],
+                        canStart ?
+                            PushButtonDecorations::ButtonRole::NormalButton :
+                            PushButtonDecorations::ButtonRole::DisabledButton);
+                    _quickPicksButtons[i]->setEnabled(canStart);
+                }
+            }
+            catch (const tt3::util::Exception & ex)
+            {
+                qCritical() << ex;
+                if (_currentQuickPickIndex == i)
+                {   //  Don't let the refresh timer overwrite the error
+                    _currentQuickPickIndex = -1;
+                }
+                _quickPicksButtons[i]->setText(ex.errorMessage());
+                _pushButtonDecorations.applyTo(
+                    _quickPicksButtons[i],
+                    PushButtonDecorations::ButtonRole::ErrorButton);
+                _quickPicksButtons[i]->setEnabled(false);
+            }
+        }
+    }
+}
+
+void MyDayManager::_refreshElapsedTime()
+{   //  Only the texts that show the elapsed time of the
+    //  current activity change from one second to the next
+    if (_currentActivityRow >= 0 &&
+        _currentActivityRow < _myDayModel->itemModels.size() &&
+        _currentActivityRow < _ui->logListWidget->count())
+    {
+        _ui->logListWidget->item(_currentActivityRow)->setText(
+            _myDayModel->itemModels[_currentActivityRow]->toString());
+    }
+    if (_currentQuickPickIndex >= 0 &&
+        _currentQuickPickIndex < _quickPicksButtons.size())
+    {
+        _quickPicksButtons[_currentQuickPickIndex]->setText(
+            _currentQuickPickText + _elapsedTimeSuffix() + _currentQuickPickSuffix);
+    }
+}
+
+QString MyDayManager::_elapsedTimeSuffix()
+{
+    qint64 secs = qMax(0, theCurrentActivity.lastChangedAt().secsTo(QDateTime::currentDateTimeUtc()));
+    char s[32];
+    sprintf(s, " [%d:%02d:%02d]",
+            int(secs / (60 * 60)),
+            int((secs / 60) % 60),
+            int(secs % 60));
+    return s;
+}
+
 void MyDayManager::_startListeningToWorkspaceChanges()
 {
     if (_workspace != nullptr)
@@ -594,6 +825,8 @@ void MyDayManager::_clearAndDisableAllControls()
     _ui->logListWidget->setEnabled(false);
     _ui->logEventPushButton->setEnabled(false);
     _myDayModel->clear();
+    _currentActivityRow = -1;
+    _currentQuickPickIndex = -1;
 }
 
 void MyDayManager::_applyCurrentLocale()
@@ -636,11 +869,6 @@ void MyDayManager::_recreateQuickPickButtons()
     static const QIcon errorIcon(":/tt3-gui/Resources/Images/Misc/ErrorSmall.png");
     tt3::util::ResourceReader rr(Component::Resources::instance(), RSID(MyDayManager));
 
-    for (int i = 0; i < _quickPicksButtons.size(); i++)
-    {
-        delete _quickPicksButtons[i];
-    }
-    _quickPicksButtons.clear();
     //  Don't show "quick pick" buttons for completed tasks
     for (qsizetype i = _quickPicksList.size() - 1; i >= 0; i--)
     {
@@ -661,6 +889,20 @@ void MyDayManager::_recreateQuickPickButtons()
             }
         }
     }
+    //  The same buttons will do if the same activities are shown;
+    //  their texts & states are adjusted by refresh()
+    if (_quickPicksList == _quickPicksButtonsList &&
+        _quickPicksButtons.size() == _quickPicksList.size())
+    {
+        return;
+    }
+    for (int i = 0; i < _quickPicksButtons.size(); i++)
+    {
+        delete _quickPicksButtons[i];
+    }
+    _quickPicksButtons.clear();
+    _quickPicksButtonsList = _quickPicksList;
+    _currentQuickPickIndex = -1;
     //  No quick picks buttons is a special case
     if (_quickPicksList.isEmpty())
     {
@@ -742,8 +984,13 @@ void MyDayManager::_refreslLogList()
     {   //  Too many items in the log list
         delete _ui->logListWidget->takeItem(_ui->logListWidget->count() - 1);
     }
+    _currentActivityRow = -1;
     for (int i = 0; i < _myDayModel->itemModels.size(); i++)
     {
+        if (std::dynamic_pointer_cast<_CurrentActivityModelImpl>(_myDayModel->itemModels[i]))
+        {   //  The refresh timer keeps its elapsed time current
+            _currentActivityRow = i;
+        }
         _ui->logListWidget->item(i)->setText(_myDayModel->itemModels[i]->toString());
         _ui->logListWidget->item(i)->setIcon(_myDayModel->itemModels[i]->icon());
         _ui->logListWidget->item(i)->setFont(
@@ -772,13 +1019,55 @@ void MyDayManager::_setLogDepth(int logDepth)
 }
 
 
+void MyDayManager::_objectChanged(
+        tt3::ws::ObjectType * objectType,
+        const tt3::ws::Oid & oid,
+        bool createdOrDestroyed
+    )
+{   //  Works, Events, the Activities they refer to
+    //  (which can also be quick picks) and the access
+    //  rights granted by credentials are all we show.
+    //  Whatever changes, refresh once per burst of changes
+    bool refreshNeeded = false;
+    if (objectType == tt3::ws::ObjectTypes::Work::instance() ||
+        objectType == tt3::ws::ObjectTypes::Event::instance())
+    {
+        refreshNeeded = _pendingRefresh.requestItemRefresh(oid);
+    }
+    else if (objectType == tt3::ws::ObjectTypes::PublicActivity::instance() ||
+             objectType == tt3::ws::ObjectTypes::PublicTask::instance() ||
+             objectType == tt3::ws::ObjectTypes::PrivateActivity::instance() ||
+             objectType == tt3::ws::ObjectTypes::PrivateTask::instance())
+    {
+        _quickPicksOutdated = true;
+        refreshNeeded = _pendingRefresh.requestItemRefresh(oid);
+    }
+    else if (objectType == tt3::ws::ObjectTypes::User::instance() ||
+             objectType == tt3::ws::ObjectTypes::Account::instance())
+    {   //  Every new Work modifies its Account, which only
+        //  affects quick picks & access rights...
+        _quickPicksOutdated = true;
+        refreshNeeded =
+            createdOrDestroyed ?    //  ...but login may now fail or succeed
+                _pendingRefresh.requestFullRefresh() :
+                _pendingRefresh.requestControlsRefresh();
+    }
+    if (refreshNeeded)
+    {
+        emit refreshRequested();
+    }
+}
+
 //////////
 //  Signal handlers
 void MyDayManager::_currentThemeChanged(ITheme *, ITheme *)
 {
     _pushButtonDecorations = PushButtonDecorations(_ui->quickPicksPushButton);
     _listWidgetDecorations = ListWidgetDecorations(_ui->logListWidget);
-    requestRefresh();
+    if (_pendingRefresh.requestControlsRefresh())
+    {
+        emit refreshRequested();
+    }
 }
 
 void MyDayManager::_currentLocaleChanged(QLocale, QLocale)
@@ -789,35 +1078,34 @@ void MyDayManager::_currentLocaleChanged(QLocale, QLocale)
 
 void MyDayManager::_workspaceClosed(tt3::ws::WorkspaceClosedNotification /*notification*/)
 {
-    _recreateDynamicControls();
-    _myDayModel = _createMyDayModel();
     requestRefresh();
 }
 
-void MyDayManager::_objectCreated(tt3::ws::ObjectCreatedNotification /*notification*/)
+void MyDayManager::_objectCreated(tt3::ws::ObjectCreatedNotification notification)
 {
-    _recreateDynamicControls();
-    _myDayModel = _createMyDayModel();
-    requestRefresh();
+    _objectChanged(notification.objectType(), notification.oid(), true);
 }
 
-void MyDayManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification /*notification*/)
+void MyDayManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification notification)
 {
-    _recreateDynamicControls();
-    _myDayModel = _createMyDayModel();
-    requestRefresh();
+    _objectChanged(notification.objectType(), notification.oid(), true);
 }
 
-void MyDayManager::_objectModified(tt3::ws::ObjectModifiedNotification /*notification*/)
+void MyDayManager::_objectModified(tt3::ws::ObjectModifiedNotification notification)
 {
-    _recreateDynamicControls();
-    _myDayModel = _createMyDayModel();
-    requestRefresh();
+    _objectChanged(notification.objectType(), notification.oid(), false);
 }
 
 void MyDayManager::_refreshRequested()
 {
-    refresh();
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
+    PendingRefresh pendingRefresh = _pendingRefresh.take();
+    _refresh(pendingRefresh.isFullRefresh() ?
+                nullptr :
+                &pendingRefresh.modifiedOids());
 }
 
 void MyDayManager::_quickPicksPushButtonClicked()
@@ -870,7 +1158,6 @@ void MyDayManager::_quickPickPushButtonClicked()
         if (_quickPicksButtons[i] == senderButton)
         {
             theCurrentActivity.replaceWith(_quickPicksList[i]);
-            requestRefresh();
             break;
         }
     }
@@ -881,7 +1168,6 @@ void MyDayManager::_filterComboBoxCurrentIndexChanged(int)
     if (_constructed)
     {
         Component::Settings::instance()->myDayLogDepth = _logDepth();
-        _myDayModel = _createMyDayModel();
         requestRefresh();
     }
 }
@@ -889,22 +1175,42 @@ void MyDayManager::_filterComboBoxCurrentIndexChanged(int)
 void MyDayManager::_viewOptionSettingValueChanged()
 {
     _setLogDepth(Component::Settings::instance()->myDayLogDepth);
-    _myDayModel = _createMyDayModel();
     requestRefresh();
 }
 
-void MyDayManager::_refreshTimerTimeout()
+void MyDayManager::_clockTicked()
 {
-    if (theCurrentActivity != nullptr)
-    {
+    if (!isVisible())
+    {   //  Nothing to show the elapsed time in
+        return;
+    }
+    if (_myDayModel->localToday.isValid() &&
+        _myDayModel->localToday != QDateTime::currentDateTime().date())
+    {   //  Past midnight the log covers different days
         requestRefresh();
     }
+    else if (theCurrentActivity != nullptr)
+    {
+        _refreshElapsedTime();
+    }
 }
 
 void MyDayManager::_currentActivityChanged(tt3::ws::Activity, tt3::ws::Activity)
-{
-    _myDayModel = _createMyDayModel();
-    requestRefresh();
+{   //  The Work logged for the previous current activity (if
+    //  any) will arrive through change notifications
+    if (!_myDayModel->isErroneous && _myDayModel->localToday.isValid())
+    {
+        _replaceCurrentActivityModel(_myDayModel);
+        _deriveItemModels(_myDayModel);
+        if (_pendingRefresh.requestControlsRefresh())
+        {
+            emit refreshRequested();
+        }
+    }
+    else
+    {
+        requestRefresh();
+    }
 }
 
 void MyDayManager::_logListWidgetCustomContextMenuRequested(QPoint p)
@@ -1200,17 +1506,12 @@ void MyDayManager::_destroyObjectContextActionTriggered()
         try
         {
             DestroyWorkDialog dlg(this, work, _credentials);
-            if (dlg.doModal() == DestroyWorkDialog::Result::Ok)
-            {
-                _myDayModel = _createMyDayModel();
-                requestRefresh();
-            }
+            dlg.doModal();  //  change notifications will update the log
         }
         catch (const tt3::util::Exception & ex)
         {
             qCritical() << ex;
             ErrorDialog::show(this, ex);
-            _myDayModel = _createMyDayModel();
             requestRefresh();
         }
     }
@@ -1220,17 +1521,12 @@ void MyDayManager::_destroyObjectContextActionTriggered()
         try
         {
             DestroyEventDialog dlg(this, event, _credentials);
-            if (dlg.doModal() == DestroyEventDialog::Result::Ok)
-            {
-                _myDayModel = _createMyDayModel();
-                requestRefresh();
-            }
+            dlg.doModal();  //  change notifications will update the log
         }
         catch (const tt3::util::Exception & ex)
         {
             qCritical() << ex;
             ErrorDialog::show(this, ex);
-            _myDayModel = _createMyDayModel();
             requestRefresh();
         }
     }
@@ -112,6 +112,7 @@ namespace tt3::gui
         tt3::ws::Credentials    _credentials;
         bool                    _constructed = false;
         bool                    _refreshUnderway = false;
+        PendingRefresh          _pendingRefresh;
 
         //  View model
         struct _MyDayModelImpl;
@@ -134,11 +135,22 @@ namespace tt3::gui
 
         struct TT3_GUI_PUBLIC _MyDayModelImpl
         {
+            //  Properties
+            QDate               localToday; //  when the model was created
+            QDateTime           from;       //  UTC, inclusive
+            QDateTime           to;         //  UTC, inclusive
+            bool                isErroneous = false;
+            //  Display name + description of every Activity shown,
+            //  as of when the items referring to it were created
+            QHash<tt3::ws::Oid, QString>    activityTexts;
             //  Associations
+            _ItemModels         sourceItemModels;   //  oldest first; Works, Events, current activity
             _ItemModels         itemModels; //  youngest first, oldest last
             //  Operations
             void                clear()
             {
+                activityTexts.clear();
+                sourceItemModels.clear();
                 itemModels.clear();
             }
         };
@@ -154,6 +166,7 @@ namespace tt3::gui
             virtual QString     tooltip() const = 0;
             virtual bool        isEmphasized() const { return false; }
             virtual QString     toString() const = 0;
+            virtual tt3::ws::Oid    oid() const { return tt3::ws::Oid::Invalid; }  //  of the object represented
         };
 
         struct TT3_GUI_PUBLIC _WorkModelImpl : public _ItemModelImpl
@@ -187,6 +200,7 @@ namespace tt3::gui
                        "] " +
                        _displayName;
             }
+            virtual tt3::ws::Oid    oid() const override { return _work->oid(); }
             tt3::ws::Work       work() const { return _work; }
 
         private:
@@ -225,6 +239,7 @@ namespace tt3::gui
                        "] " +
                        _summary;
             }
+            virtual tt3::ws::Oid    oid() const override { return _event->oid(); }
             tt3::ws::Event      event() const { return _event; }
 
         private:
@@ -323,19 +338,60 @@ namespace tt3::gui
         };
 
         _MyDayModel     _myDayModel;    //  currently displayed
+        bool            _quickPicksOutdated = false;    //  re-query on next refresh
 
         _MyDayModel     _createMyDayModel();
-        _WorkModel      _createWorkModel(tt3::ws::Work work);
-        _EventModel     _createEventModel(tt3::ws::Event event);
+        _WorkModel      _createWorkModel(
+                                _MyDayModel myDayModel,
+                                const tt3::ws::WorkRecord & workRecord
+                            );
+        _EventModel     _createEventModel(
+                                _MyDayModel myDayModel,
+                                const tt3::ws::EventRecord & eventRecord
+                            );
         auto            _createCurrentActivityModel(
+                                _MyDayModel myDayModel
                             ) -> _CurrentActivityModel;
+        void            _rememberActivityText(
+                                _MyDayModel myDayModel,
+                                const tt3::ws::ActivityRecord & activityRecord
+                            );
+
+        //  Incremental model updates; false == must re-create the model
+        bool            _refreshModifiedItems(
+                                const QSet<tt3::ws::Oid> & modifiedOids
+                            );
+        bool            _addWorkModels(
+                                _MyDayModel myDayModel,
+                                tt3::ws::Account account,
+                                tt3::ws::Work work
+                            );
+        bool            _addEventModels(
+                                _MyDayModel myDayModel,
+                                tt3::ws::Account account,
+                                tt3::ws::Event event
+                            );
+        void            _replaceCurrentActivityModel(
+                                _MyDayModel myDayModel
+                            );
+        void            _insertSourceItemModel(
+                                _MyDayModel myDayModel,
+                                _ItemModel itemModel
+                            );
 
+        //  The displayed item models are derived from the source ones
+        void            _deriveItemModels(_MyDayModel myDayModel);
         void            _breakLongWorks(_MyDayModel myDayModel);
         void            _addDateIndicators(_MyDayModel myDayModel);
         void            _sortChronologically(_MyDayModel myDayModel);
         void            _breakWorksOnEvents(_MyDayModel myDayModel);
 
         //  Helpers
+        void            _refresh(
+                                const QSet<tt3::ws::Oid> * modifiedOids  //  nullptr == all
+                            );
+        void            _refreshElapsedTime();
+        static QString  _elapsedTimeSuffix();
         void            _startListeningToWorkspaceChanges();
         void            _stopListeningToWorkspaceChanges();
         void            _clearAndDisableAllControls();
@@ -345,16 +401,27 @@ namespace tt3::gui
         void            _refreslLogList();
         int             _logDepth();
         void            _setLogDepth(int logDepth);
+        void            _objectChanged(
+                                tt3::ws::ObjectType * objectType,
+                                const tt3::ws::Oid & oid,
+                                bool createdOrDestroyed
+                            );
 
         //////////
         //  Controls
     private:
         Ui::MyDayManager *const _ui;
-        QTimer          _refreshTimer;
         //  Dynamic controls
         QList<tt3::ws::Activity>    _quickPicksList;
+        QList<tt3::ws::Activity>    _quickPicksButtonsList; //  as when buttons were created
         QList<QPushButton*> _quickPicksButtons; //  parallel to _quickPicksButtons
 
+        //  What the refresh timer updates between refreshes
+        int             _currentActivityRow = -1;   //  in the log list; -1 == none
+        int             _currentQuickPickIndex = -1;//  -1 == none
+        QString         _currentQuickPickText;      //  sans the elapsed time
+        QString         _currentQuickPickSuffix;
+
         //  Drawing resources
         PushButtonDecorations   _pushButtonDecorations;
         ListWidgetDecorations   _listWidgetDecorations;
@@ -378,7 +445,7 @@ namespace tt3::gui
         void            _quickPickPushButtonClicked();
         void            _filterComboBoxCurrentIndexChanged(int);
         void            _viewOptionSettingValueChanged();
-        void            _refreshTimerTimeout();
+        void            _clockTicked();
         void            _currentActivityChanged(tt3::ws::Activity, tt3::ws::Activity);
         void            _logListWidgetCustomContextMenuRequested(QPoint);
         void            _quickPickButtonCustomContextMenuRequested(QPoint);
@@ -24,6 +24,7 @@ namespace tt3::gui
     extern CurrentActivity theCurrentActivity;
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -35,8 +36,7 @@ PrivateActivityManager::PrivateActivityManager(
         _workspace(theCurrentWorkspace),
         _credentials(theCurrentCredentials),
         //  Controls
-        _ui(new Ui::PrivateActivityManager),
-        _refreshTimer(this)
+        _ui(new Ui::PrivateActivityManager)
 {
     _ui->setupUi(this);
     _decorations = TreeWidgetDecorations(_ui->privateActivitiesTreeWidget);
@@ -69,22 +69,20 @@ PrivateActivityManager::PrivateActivityManager(
             this,
             &PrivateActivityManager::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 
     //  Start listening for change notifications
     //  on the currently "viewed" Workspace
     _startListeningToWorkspaceChanges();
 
-    //  Start refreshing on timer
-    connect(&_refreshTimer,
-            &QTimer::timeout,
+    connect(&theRefreshScheduler,
+            &RefreshScheduler::tick,
             this,
-            &PrivateActivityManager::_refreshTimerTimeout);
-    _refreshTimer.start(1000);
+            &PrivateActivityManager::_clockTicked);
 }
 
 PrivateActivityManager::~PrivateActivityManager()
 {
-    _refreshTimer.stop();
     _stopListeningToWorkspaceChanges();
     delete _ui;
 }
@@ -122,6 +120,13 @@ void PrivateActivityManager::setCredentials(const tt3::ws::Credentials & credent
 }
 
 void PrivateActivityManager::refresh()
+{
+    _refresh(nullptr);
+}
+
+void PrivateActivityManager::_refresh(
+        const QSet<tt3::ws::Oid> * modifiedOids
+    )
 {
     static const QIcon viewPrivateActivityIcon(":/tt3-gui/Resources/Images/Actions/ViewPrivateActivityLarge.png");
     static const QIcon modifyPrivateActivityIcon(":/tt3-gui/Resources/Images/Actions/ModifyPrivateActivityLarge.png");
@@ -147,6 +152,8 @@ void PrivateActivityManager::refresh()
             return;
         }
 
+        bool refreshItemsOnly = canRefreshItemsOnly(_ui->privateActivitiesTreeWidget, modifiedOids);
+
         //  Otherwise some controls are always enabled...
         _ui->filterLabel->setEnabled(true);
         _ui->filterLineEdit->setEnabled(true);
@@ -154,19 +161,24 @@ void PrivateActivityManager::refresh()
 
         //  ...while others are enabled based on current
         //  selection and permissions granted by Credentials
-        _WorkspaceModel workspaceModel =
-            _createWorkspaceModel(_workspace, _credentials, _decorations);
-        QString filter = _ui->filterLineEdit->text().trimmed();
-        if (!filter.isEmpty())
-        {
-            _filterItems(workspaceModel, filter, _decorations);
-        }
-        _refreshWorkspaceTree(
-            _ui->privateActivitiesTreeWidget,
-            workspaceModel);
-        if (!_ui->filterLineEdit->text().trimmed().isEmpty())
-        {   //  Filtered - show all
-            _ui->privateActivitiesTreeWidget->expandAll();
+        if (!refreshItemsOnly ||
+            !_refreshModifiedItems(*modifiedOids))
+        {   //  Must rebuild the whole tree
+            _accountChangeFilter.remember(_workspace, _credentials);
+            _WorkspaceModel workspaceModel =
+                _createWorkspaceModel(_workspace, _credentials, _decorations);
+            QString filter = _ui->filterLineEdit->text().trimmed();
+            if (!filter.isEmpty())
+            {
+                _filterItems(workspaceModel, filter, _decorations);
+            }
+            _refreshWorkspaceTree(
+                _ui->privateActivitiesTreeWidget,
+                workspaceModel);
+            if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+            {   //  Filtered - show all
+                _ui->privateActivitiesTreeWidget->expandAll();
+            }
         }
 
         tt3::ws::PrivateActivity selectedPrivateActivity = _selectedPrivateActivity();
@@ -258,7 +270,10 @@ void PrivateActivityManager::refresh()
 
 void PrivateActivityManager::requestRefresh()
 {
-    emit refreshRequested();
+    if (_pendingRefresh.requestFullRefresh())
+    {
+        emit refreshRequested();
+    }
 }
 
 //////////
@@ -288,13 +303,9 @@ auto PrivateActivityManager::_createWorkspaceModel(
                     credentials,
                     decorations));
         }
-        std::sort(
-            workspaceModel->userModels.begin(),
-            workspaceModel->userModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            workspaceModel->userModels,
+            [](const auto & m) { return m->user; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -334,13 +345,9 @@ auto PrivateActivityManager::_createUserModel(
             userModel->privateActivityModels.append(
                 _createPrivateActivityModel(privateActivity, credentials, decorations));
         }
-        std::sort(
-            userModel->privateActivityModels.begin(),
-            userModel->privateActivityModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            userModel->privateActivityModels,
+            [](const auto & m) { return m->privateActivity; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -529,6 +536,38 @@ void PrivateActivityManager::_refreshPrivateActivityItem(
     Q_ASSERT(privateActivityItem->childCount() == 0);
 }
 
+bool PrivateActivityManager::_refreshModifiedItems(
+        const QSet<tt3::ws::Oid> & modifiedOids
+    )
+{
+    if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+    {   //  A modified PrivateActivity may start or stop matching the filter
+        return modifiedOids.isEmpty();
+    }
+    for (const auto & oid : modifiedOids)
+    {
+        QTreeWidgetItem * privateActivityItem =
+            findTreeWidgetItem<tt3::ws::PrivateActivity>(
+                _ui->privateActivitiesTreeWidget,
+                oid);
+        if (privateActivityItem == nullptr)
+        {   //  OOPS! Not in the tree - can't patch it
+            return false;
+        }
+        _refreshPrivateActivityItem(
+            privateActivityItem,
+            _createPrivateActivityModel(
+                privateActivityItem->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::PrivateActivity>(),
+                _credentials,
+                _decorations));
+        if (!isInNaturalOrder(privateActivityItem))
+        {   //  Display name change requires re-ordering
+            return false;
+        }
+    }
+    return true;
+}
+
 //////////
 //  Implementation helpers
 tt3::ws::User PrivateActivityManager::_selectedUser()
@@ -663,6 +702,23 @@ void PrivateActivityManager::_applyCurrentLocale()
     refresh();
 }
 
+void PrivateActivityManager::_objectCreatedOrDestroyed(
+        tt3::ws::ObjectType * objectType
+    )
+{
+    if (objectType == tt3::ws::ObjectTypes::PrivateActivity::instance() ||
+        objectType == tt3::ws::ObjectTypes::User::instance())
+    {   //  The tree structure changes
+        requestRefresh();
+    }
+    else if (objectType == tt3::ws::ObjectTypes::Account::instance())
+    {   //  Our credentials may have gained or lost the
+        //  Administrator capability, which decides whose
+        //  private activities are shown
+        requestRefresh();
+    }
+}
+
 //////////
 //  Signal handlers
 void PrivateActivityManager::_currentThemeChanged(ITheme *, ITheme *)
@@ -678,9 +734,21 @@ void PrivateActivityManager::_currentLocaleChanged(QLocale, QLocale)
     refresh();
 }
 
-void PrivateActivityManager::_currentActivityChanged(tt3::ws::Activity, tt3::ws::Activity)
-{
-    requestRefresh();
+void PrivateActivityManager::_currentActivityChanged(tt3::ws::Activity before, tt3::ws::Activity after)
+{   //  Buttons may change, but of all items only those
+    //  representing the old and the new current activity do
+    bool mustSchedule = _pendingRefresh.requestControlsRefresh();
+    for (const auto & activity : {before, after})
+    {
+        if (std::dynamic_pointer_cast<tt3::ws::PrivateActivityImpl>(activity))
+        {
+            _pendingRefresh.requestItemRefresh(activity->oid());
+        }
+    }
+    if (mustSchedule)
+    {
+        emit refreshRequested();
+    }
 }
 
 void PrivateActivityManager::_privateActivitiesTreeWidgetCurrentItemChanged(QTreeWidgetItem*,QTreeWidgetItem*)
@@ -860,34 +928,57 @@ void PrivateActivityManager::_workspaceClosed(tt3::ws::WorkspaceClosedNotificati
     requestRefresh();
 }
 
-void PrivateActivityManager::_objectCreated(tt3::ws::ObjectCreatedNotification /*notification*/)
+void PrivateActivityManager::_objectCreated(tt3::ws::ObjectCreatedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void PrivateActivityManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification /*notification*/)
+void PrivateActivityManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void PrivateActivityManager::_objectModified(tt3::ws::ObjectModifiedNotification /*notification*/)
+void PrivateActivityManager::_objectModified(tt3::ws::ObjectModifiedNotification notification)
 {
-    requestRefresh();
+    if (notification.objectType() == tt3::ws::ObjectTypes::PrivateActivity::instance())
+    {   //  Only the corresponding item needs a refresh
+        if (_pendingRefresh.requestItemRefresh(notification.oid()))
+        {
+            emit refreshRequested();
+        }
+    }
+    else if (notification.objectType() == tt3::ws::ObjectTypes::User::instance())
+    {   //  The set of Users shown depends on their (and
+        //  our credentials') capabilities
+        requestRefresh();
+    }
+    else if (notification.objectType() == tt3::ws::ObjectTypes::Account::instance())
+    {   //  ...and so it does on their Accounts' - but Accounts
+        //  are also modified by every Work or Event recorded
+        if (_accountChangeFilter.matters(_workspace, _credentials, notification.oid()))
+        {
+            requestRefresh();
+        }
+    }
 }
 
 void PrivateActivityManager::_refreshRequested()
 {
-    refresh();
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
+    PendingRefresh pendingRefresh = _pendingRefresh.take();
+    _refresh(pendingRefresh.isFullRefresh() ?
+                nullptr :
+                &pendingRefresh.modifiedOids());
 }
 
-void PrivateActivityManager::_refreshTimerTimeout()
+void PrivateActivityManager::_clockTicked()
 {
-    if (tt3::ws::Activity activity = theCurrentActivity)
+    if (_pendingRefresh.requestElapsedTimeRefresh<tt3::ws::PrivateActivityImpl>(this))
     {
-        if (std::dynamic_pointer_cast<tt3::ws::PrivateActivityImpl>(activity))
-        {
-            refresh();
-        }
+        emit refreshRequested();
     }
 }
 
@@ -118,6 +118,8 @@ namespace tt3::gui
         tt3::ws::Workspace      _workspace;
         tt3::ws::Credentials    _credentials;
         bool                    _refreshUnderway = false;
+        PendingRefresh          _pendingRefresh;
+        AccountChangeFilter     _accountChangeFilter;
 
         //  View model
         //  Model services are "static" because they are oiggybacked
@@ -204,8 +206,14 @@ namespace tt3::gui
                                 QTreeWidgetItem * privateActivityItem,
                                 _PrivateActivityModel privateActivityModel
                             );
+        bool            _refreshModifiedItems(
+                                const QSet<tt3::ws::Oid> & modifiedOids
+                            );  //  false == must rebuild the whole tree
 
         //  Helpers
+        void            _refresh(
+                                const QSet<tt3::ws::Oid> * modifiedOids
+                            );  //  nullptr == refresh all
         tt3::ws::User   _selectedUser();
         void            _setSelectedUser(
                                 tt3::ws::User user
@@ -218,6 +226,9 @@ namespace tt3::gui
         void            _startListeningToWorkspaceChanges();
         void            _stopListeningToWorkspaceChanges();
         void            _clearAndDisableAllControls();
+        void            _objectCreatedOrDestroyed(
+                                tt3::ws::ObjectType * objectType
+                            );
         void            _applyCurrentLocale();
 
 
@@ -226,7 +237,6 @@ namespace tt3::gui
     private:
         Ui::PrivateActivityManager *const   _ui;
         std::unique_ptr<QMenu>  _privateActivitiesTreeContextMenu;
-        QTimer                  _refreshTimer;
 
         //  Drawing resources
         TreeWidgetDecorations   _decorations;
@@ -250,7 +260,7 @@ namespace tt3::gui
         void            _objectDestroyed(tt3::ws::ObjectDestroyedNotification notification);
         void            _objectModified(tt3::ws::ObjectModifiedNotification notification);
         void            _refreshRequested();
-        void            _refreshTimerTimeout();
+        void            _clockTicked();
     };
 }
 
@@ -24,6 +24,7 @@ namespace tt3::gui
     extern CurrentActivity theCurrentActivity;
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -35,8 +36,7 @@ PrivateTaskManager::PrivateTaskManager(
         _workspace(theCurrentWorkspace),
         _credentials(theCurrentCredentials),
         //  Controls
-        _ui(new Ui::PrivateTaskManager),
-        _refreshTimer(this)
+        _ui(new Ui::PrivateTaskManager)
 {
     _ui->setupUi(this);
     _decorations = TreeWidgetDecorations(_ui->privateTasksTreeWidget);
@@ -76,22 +76,20 @@ PrivateTaskManager::PrivateTaskManager(
             this,
             &PrivateTaskManager::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 
     //  Start listening for change notifications
     //  on the currently "viewed" Workspace
     _startListeningToWorkspaceChanges();
 
-    //  Start refreshing on timer
-    connect(&_refreshTimer,
-            &QTimer::timeout,
+    connect(&theRefreshScheduler,
+            &RefreshScheduler::tick,
             this,
-            &PrivateTaskManager::_refreshTimerTimeout);
-    _refreshTimer.start(1000);
+            &PrivateTaskManager::_clockTicked);
 }
 
 PrivateTaskManager::~PrivateTaskManager()
 {
-    _refreshTimer.stop();
     _stopListeningToWorkspaceChanges();
     delete _ui;
 }
@@ -129,6 +127,13 @@ void PrivateTaskManager::setCredentials(const tt3::ws::Credentials & credentials
 }
 
 void PrivateTaskManager::refresh()
+{
+    _refresh(nullptr);
+}
+
+void PrivateTaskManager::_refresh(
+        const QSet<tt3::ws::Oid> * modifiedOids
+    )
 {
     static const QIcon viewPrivateTaskIcon(":/tt3-gui/Resources/Images/Actions/ViewPrivateTaskLarge.png");
     static const QIcon modifyPrivateTaskIcon(":/tt3-gui/Resources/Images/Actions/ModifyPrivateTaskLarge.png");
@@ -154,6 +159,8 @@ void PrivateTaskManager::refresh()
             return;
         }
 
+        bool refreshItemsOnly = canRefreshItemsOnly(_ui->privateTasksTreeWidget, modifiedOids);
+
         //  Otherwise some controls are always enabled...
         _ui->filterLabel->setEnabled(true);
         _ui->filterLineEdit->setEnabled(true);
@@ -162,21 +169,26 @@ void PrivateTaskManager::refresh()
 
         //  ...while others are enabled based on current
         //  selection and permissions granted by Credentials
-        _WorkspaceModel workspaceModel =
-            _createWorkspaceModel(_workspace, _credentials, _decorations);
-        if (!Component::Settings::instance()->showCompletedPrivateTasks)
-        {
-            _removeCompletedItems(workspaceModel, _credentials);
-        }
-        QString filter = _ui->filterLineEdit->text().trimmed();
-        if (!filter.isEmpty())
-        {
-            _filterItems(workspaceModel, filter, _decorations);
-        }
-        _refreshWorkspaceTree(_ui->privateTasksTreeWidget, workspaceModel);
-        if (!_ui->filterLineEdit->text().trimmed().isEmpty())
-        {   //  Filtered - show all
-            _ui->privateTasksTreeWidget->expandAll();
+        if (!refreshItemsOnly ||
+            !_refreshModifiedItems(*modifiedOids))
+        {   //  Must rebuild the whole tree
+            _accountChangeFilter.remember(_workspace, _credentials);
+            _WorkspaceModel workspaceModel =
+                _createWorkspaceModel(_workspace, _credentials, _decorations);
+            if (!Component::Settings::instance()->showCompletedPrivateTasks)
+            {
+                _removeCompletedItems(workspaceModel, _credentials);
+            }
+            QString filter = _ui->filterLineEdit->text().trimmed();
+            if (!filter.isEmpty())
+            {
+                _filterItems(workspaceModel, filter, _decorations);
+            }
+            _refreshWorkspaceTree(_ui->privateTasksTreeWidget, workspaceModel);
+            if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+            {   //  Filtered - show all
+                _ui->privateTasksTreeWidget->expandAll();
+            }
         }
 
         tt3::ws::PrivateTask selectedPrivateTask = _selectedPrivateTask();
@@ -285,7 +297,10 @@ void PrivateTaskManager::refresh()
 
 void PrivateTaskManager::requestRefresh()
 {
-    emit refreshRequested();
+    if (_pendingRefresh.requestFullRefresh())
+    {
+        emit refreshRequested();
+    }
 }
 
 //////////
@@ -314,13 +329,9 @@ auto PrivateTaskManager::_createWorkspaceModel(
                     workspace->login(credentials)->user(credentials),
                         credentials, decorations));
         }
-        std::sort(
-            workspaceModel->userModels.begin(),
-            workspaceModel->userModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            workspaceModel->userModels,
+            [](const auto & m) { return m->user; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -360,13 +371,9 @@ auto PrivateTaskManager::_createUserModel(
             userModel->privateTaskModels.append(
                 _createPrivateTaskModel(privateTask, credentials, decorations));
         }
-        std::sort(
-            userModel->privateTaskModels.begin(),
-            userModel->privateTaskModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            userModel->privateTaskModels,
+            [](const auto & m) { return m->privateTask; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -424,13 +431,9 @@ auto PrivateTaskManager::_createPrivateTaskModel(
             privateTaskModel->childModels.append(
                 _createPrivateTaskModel(child, credentials, decorations));
         }
-        std::sort(
-            privateTaskModel->childModels.begin(),
-            privateTaskModel->childModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            privateTaskModel->childModels,
+            [](const auto & m) { return m->privateTask; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -698,6 +701,64 @@ void PrivateTaskManager::_refreshPrivateTaskItem(
     }
 }
 
+bool PrivateTaskManager::_refreshModifiedItems(
+        const QSet<tt3::ws::Oid> & modifiedOids
+    )
+{
+    if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+    {   //  A modified PrivateTask may start or stop matching the filter
+        return modifiedOids.isEmpty();
+    }
+    for (const auto & oid : modifiedOids)
+    {
+        QTreeWidgetItem * privateTaskItem =
+            findTreeWidgetItem<tt3::ws::PrivateTask>(
+                _ui->privateTasksTreeWidget,
+                oid);
+        if (privateTaskItem == nullptr)
+        {   //  Not in the tree (e.g. a hidden completed PrivateTask)
+            //  - can't patch it
+            return false;
+        }
+        tt3::ws::PrivateTask privateTask =
+            privateTaskItem->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::PrivateTask>();
+        _PrivateTaskModel privateTaskModel =
+            _createPrivateTaskModel(privateTask, _credentials, _decorations);
+        try
+        {   //  The PrivateTask may have been moved to another parent...
+            tt3::ws::PrivateTask parentPrivateTask =
+                (privateTaskItem->parent() != nullptr) ?
+                    privateTaskItem->parent()->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::PrivateTask>() :
+                    nullptr;
+            if (privateTask->parent(_credentials) != parentPrivateTask)    //  may throw
+            {
+                return false;
+            }
+            //  ...or completed, in which case it may need to be hidden
+            if (!Component::Settings::instance()->showCompletedPrivateTasks)
+            {
+                _removeCompletedItems(privateTaskModel, _credentials);
+                if (privateTask->completed(_credentials) &&  //  may throw
+                    privateTaskModel->childModels.isEmpty())
+                {
+                    return false;
+                }
+            }
+        }
+        catch (const tt3::util::Exception & ex)
+        {   //  OOPS! Log & rebuild the whole tree
+            qCritical() << ex;
+            return false;
+        }
+        _refreshPrivateTaskItem(privateTaskItem, privateTaskModel);
+        if (!isInNaturalOrder(privateTaskItem))
+        {   //  Display name change requires re-ordering
+            return false;
+        }
+    }
+    return true;
+}
+
 //////////
 //  Implementation helpers
 tt3::ws::User PrivateTaskManager::_selectedUser()
@@ -864,6 +925,23 @@ void PrivateTaskManager::_applyCurrentLocale()
     refresh();
 }
 
+void PrivateTaskManager::_objectCreatedOrDestroyed(
+        tt3::ws::ObjectType * objectType
+    )
+{
+    if (objectType == tt3::ws::ObjectTypes::PrivateTask::instance() ||
+        objectType == tt3::ws::ObjectTypes::User::instance())
+    {   //  The tree structure changes
+        requestRefresh();
+    }
+    else if (objectType == tt3::ws::ObjectTypes::Account::instance())
+    {   //  Our credentials may have gained or lost the
+        //  Administrator capability, which decides whose
+        //  private tasks are shown
+        requestRefresh();
+    }
+}
+
 //////////
 //  Signal handlers
 void PrivateTaskManager::_currentThemeChanged(ITheme *, ITheme *)
@@ -879,9 +957,21 @@ void PrivateTaskManager::_currentLocaleChanged(QLocale, QLocale)
     refresh();
 }
 
-void PrivateTaskManager::_currentActivityChanged(tt3::ws::Activity, tt3::ws::Activity)
-{
-    requestRefresh();
+void PrivateTaskManager::_currentActivityChanged(tt3::ws::Activity before, tt3::ws::Activity after)
+{   //  Buttons may change, but of all items only those
+    //  representing the old and the new current activity do
+    bool mustSchedule = _pendingRefresh.requestControlsRefresh();
+    for (const auto & activity : {before, after})
+    {
+        if (std::dynamic_pointer_cast<tt3::ws::PrivateTaskImpl>(activity))
+        {
+            _pendingRefresh.requestItemRefresh(activity->oid());
+        }
+    }
+    if (mustSchedule)
+    {
+        emit refreshRequested();
+    }
 }
 
 void PrivateTaskManager::_privateTasksTreeWidgetCurrentItemChanged(QTreeWidgetItem*,QTreeWidgetItem*)
@@ -1151,34 +1241,57 @@ void PrivateTaskManager::_workspaceClosed(tt3::ws::WorkspaceClosedNotification /
     requestRefresh();
 }
 
-void PrivateTaskManager::_objectCreated(tt3::ws::ObjectCreatedNotification /*notification*/)
+void PrivateTaskManager::_objectCreated(tt3::ws::ObjectCreatedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void PrivateTaskManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification /*notification*/)
+void PrivateTaskManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void PrivateTaskManager::_objectModified(tt3::ws::ObjectModifiedNotification /*notification*/)
+void PrivateTaskManager::_objectModified(tt3::ws::ObjectModifiedNotification notification)
 {
-    requestRefresh();
+    if (notification.objectType() == tt3::ws::ObjectTypes::PrivateTask::instance())
+    {   //  Only the corresponding item needs a refresh
+        if (_pendingRefresh.requestItemRefresh(notification.oid()))
+        {
+            emit refreshRequested();
+        }
+    }
+    else if (notification.objectType() == tt3::ws::ObjectTypes::User::instance())
+    {   //  The set of Users shown depends on their (and
+        //  our credentials') capabilities
+        requestRefresh();
+    }
+    else if (notification.objectType() == tt3::ws::ObjectTypes::Account::instance())
+    {   //  ...and so it does on their Accounts' - but Accounts
+        //  are also modified by every Work or Event recorded
+        if (_accountChangeFilter.matters(_workspace, _credentials, notification.oid()))
+        {
+            requestRefresh();
+        }
+    }
 }
 
 void PrivateTaskManager::_refreshRequested()
 {
-    refresh();
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
+    PendingRefresh pendingRefresh = _pendingRefresh.take();
+    _refresh(pendingRefresh.isFullRefresh() ?
+                nullptr :
+                &pendingRefresh.modifiedOids());
 }
 
-void PrivateTaskManager::_refreshTimerTimeout()
+void PrivateTaskManager::_clockTicked()
 {
-    if (tt3::ws::Activity activity = theCurrentActivity)
+    if (_pendingRefresh.requestElapsedTimeRefresh<tt3::ws::PrivateTaskImpl>(this))
     {
-        if (std::dynamic_pointer_cast<tt3::ws::PrivateTaskImpl>(activity))
-        {
-            refresh();
-        }
+        emit refreshRequested();
     }
 }
 
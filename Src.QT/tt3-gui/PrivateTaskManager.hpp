@@ -120,6 +120,8 @@ namespace tt3::gui
         tt3::ws::Workspace      _workspace;
         tt3::ws::Credentials    _credentials;
         bool                    _refreshUnderway = false;
+        PendingRefresh          _pendingRefresh;
+        AccountChangeFilter     _accountChangeFilter;
 
         //  View model
         //  Model services are "static" because they are oiggybacked
@@ -225,8 +227,14 @@ namespace tt3::gui
                                 QTreeWidgetItem * privateTaskItem,
                                 _PrivateTaskModel privateTaskModel
                             );
+        bool            _refreshModifiedItems(
+                                const QSet<tt3::ws::Oid> & modifiedOids
+                            );  //  false == must rebuild the whole tree
 
         //  Helpers
+        void            _refresh(
+                                const QSet<tt3::ws::Oid> * modifiedOids
+                            );  //  nullptr == refresh all
         auto            _selectedUser(
                             ) -> tt3::ws::User;
         void            _setSelectedUser(
@@ -244,6 +252,9 @@ namespace tt3::gui
         void            _startListeningToWorkspaceChanges();
         void            _stopListeningToWorkspaceChanges();
         void            _clearAndDisableAllControls();
+        void            _objectCreatedOrDestroyed(
+                                tt3::ws::ObjectType * objectType
+                            );
         void            _applyCurrentLocale();
 
         //////////
@@ -251,7 +262,6 @@ namespace tt3::gui
     private:
         Ui::PrivateTaskManager *const   _ui;
         std::unique_ptr<QMenu>  _privateTasksTreeContextMenu;
-        QTimer                  _refreshTimer;
 
         //  Drawing resources
         TreeWidgetDecorations   _decorations;
@@ -278,7 +288,7 @@ namespace tt3::gui
         void            _objectDestroyed(tt3::ws::ObjectDestroyedNotification notification);
         void            _objectModified(tt3::ws::ObjectModifiedNotification notification);
         void            _refreshRequested();
-        void            _refreshTimerTimeout();
+        void            _clockTicked();
     };
 }
 
@@ -24,6 +24,7 @@ namespace tt3::gui
     extern CurrentActivity theCurrentActivity;
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -75,6 +76,7 @@ ProjectManager::ProjectManager(
             this,
             &ProjectManager::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 
     //  Start listening for change notifications
     //  on the currently "viewed" Workspace
@@ -120,6 +122,13 @@ void ProjectManager::setCredentials(const tt3::ws::Credentials & credentials)
 }
 
 void ProjectManager::refresh()
+{
+    _refresh(nullptr);
+}
+
+void ProjectManager::_refresh(
+        const QSet<tt3::ws::Oid> * modifiedOids
+    )
 {
     static const QIcon viewProjectIcon(":/tt3-gui/Resources/Images/Actions/ViewProjectLarge.png");
     static const QIcon modifyProjectIcon(":/tt3-gui/Resources/Images/Actions/ModifyProjectLarge.png");
@@ -145,6 +154,8 @@ void ProjectManager::refresh()
             return;
         }
 
+        bool refreshItemsOnly = canRefreshItemsOnly(_ui->projectsTreeWidget, modifiedOids);
+
         //  Otherwise some controls are always enabled...
         _ui->filterLabel->setEnabled(true);
         _ui->filterLineEdit->setEnabled(true);
@@ -153,21 +164,25 @@ void ProjectManager::refresh()
 
         //  ...while others are enabled based on current
         //  selection and permissions granted by Credentials
-        _WorkspaceModel workspaceModel =
-            _createWorkspaceModel(_workspace, _credentials, _decorations);
-        if (!Component::Settings::instance()->showCompletedProjects)
-        {
-            _removeCompletedItems(workspaceModel, _credentials);
-        }
-        QString filter = _ui->filterLineEdit->text().trimmed();
-        if (!filter.isEmpty())
-        {
-            _filterItems(workspaceModel, filter, _decorations);
-        }
-        _refreshWorkspaceTree(_ui->projectsTreeWidget, workspaceModel);
-        if (!_ui->filterLineEdit->text().trimmed().isEmpty())
-        {   //  Filtered - show all
-            _ui->projectsTreeWidget->expandAll();
+        if (!refreshItemsOnly ||
+            !_refreshModifiedItems(*modifiedOids))
+        {   //  Must rebuild the whole tree
+            _WorkspaceModel workspaceModel =
+                _createWorkspaceModel(_workspace, _credentials, _decorations);
+            if (!Component::Settings::instance()->showCompletedProjects)
+            {
+                _removeCompletedItems(workspaceModel, _credentials);
+            }
+            QString filter = _ui->filterLineEdit->text().trimmed();
+            if (!filter.isEmpty())
+            {
+                _filterItems(workspaceModel, filter, _decorations);
+            }
+            _refreshWorkspaceTree(_ui->projectsTreeWidget, workspaceModel);
+            if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+            {   //  Filtered - show all
+                _ui->projectsTreeWidget->expandAll();
+            }
         }
 
         tt3::ws::Project selectedProject = _selectedProject();
@@ -248,7 +263,10 @@ void ProjectManager::refresh()
 
 void ProjectManager::requestRefresh()
 {
-    emit refreshRequested();
+    if (_pendingRefresh.requestFullRefresh())
+    {
+        emit refreshRequested();
+    }
 }
 
 //////////
@@ -267,13 +285,9 @@ auto ProjectManager::_createWorkspaceModel(
             workspaceModel->projectModels.append(
                 _createProjectModel(project, credentials, decorations));
         }
-        std::sort(
-            workspaceModel->projectModels.begin(),
-            workspaceModel->projectModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            workspaceModel->projectModels,
+            [](const auto & m) { return m->project; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -314,13 +328,9 @@ auto ProjectManager::_createProjectModel(
             projectModel->childModels.append(
                 _createProjectModel(child, credentials, decorations));
         }
-        std::sort(
-            projectModel->childModels.begin(),
-            projectModel->childModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            projectModel->childModels,
+            [](const auto & m) { return m->project; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -512,6 +522,64 @@ void ProjectManager::_refreshProjectItem(
     }
 }
 
+bool ProjectManager::_refreshModifiedItems(
+        const QSet<tt3::ws::Oid> & modifiedOids
+    )
+{
+    if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+    {   //  A modified Project may start or stop matching the filter
+        return modifiedOids.isEmpty();
+    }
+    for (const auto & oid : modifiedOids)
+    {
+        QTreeWidgetItem * projectItem =
+            findTreeWidgetItem<tt3::ws::Project>(
+                _ui->projectsTreeWidget,
+                oid);
+        if (projectItem == nullptr)
+        {   //  Not in the tree (e.g. a hidden completed Project)
+            //  - can't patch it
+            return false;
+        }
+        tt3::ws::Project project =
+            projectItem->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::Project>();
+        _ProjectModel projectModel =
+            _createProjectModel(project, _credentials, _decorations);
+        try
+        {   //  The Project may have been moved to another parent...
+            tt3::ws::Project parentProject =
+                (projectItem->parent() != nullptr) ?
+                    projectItem->parent()->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::Project>() :
+                    nullptr;
+            if (project->parent(_credentials) != parentProject)    //  may throw
+            {
+                return false;
+            }
+            //  ...or completed, in which case it may need to be hidden
+            if (!Component::Settings::instance()->showCompletedProjects)
+            {
+                _removeCompletedItems(projectModel, _credentials);
+                if (project->completed(_credentials) &&  //  may throw
+                    projectModel->childModels.isEmpty())
+                {
+                    return false;
+                }
+            }
+        }
+        catch (const tt3::util::Exception & ex)
+        {   //  OOPS! Log & rebuild the whole tree
+            qCritical() << ex;
+            return false;
+        }
+        _refreshProjectItem(projectItem, projectModel);
+        if (!isInNaturalOrder(projectItem))
+        {   //  Display name change requires re-ordering
+            return false;
+        }
+    }
+    return true;
+}
+
 //////////
 //  Implementation helpers
 auto ProjectManager::_selectedProject(
@@ -647,6 +715,18 @@ void ProjectManager::_applyCurrentLocale()
     refresh();
 }
 
+void ProjectManager::_objectCreatedOrDestroyed(
+        tt3::ws::ObjectType * objectType
+    )
+{
+    if (_pendingRefresh.requestRefreshOnObjectCreatedOrDestroyed(
+            objectType,
+            tt3::ws::ObjectTypes::Project::instance()))
+    {
+        emit refreshRequested();
+    }
+}
+
 //////////
 //  Signal handlers
 void ProjectManager::_currentThemeChanged(ITheme *, ITheme *)
@@ -824,24 +904,36 @@ void ProjectManager::_workspaceClosed(tt3::ws::WorkspaceClosedNotification /*not
     requestRefresh();
 }
 
-void ProjectManager::_objectCreated(tt3::ws::ObjectCreatedNotification /*notification*/)
+void ProjectManager::_objectCreated(tt3::ws::ObjectCreatedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void ProjectManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification /*notification*/)
+void ProjectManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void ProjectManager::_objectModified(tt3::ws::ObjectModifiedNotification /*notification*/)
+void ProjectManager::_objectModified(tt3::ws::ObjectModifiedNotification notification)
 {
-    requestRefresh();
+    if (_pendingRefresh.requestRefreshOnObjectModified(
+            notification,
+            tt3::ws::ObjectTypes::Project::instance()))
+    {
+        emit refreshRequested();
+    }
 }
 
 void ProjectManager::_refreshRequested()
 {
-    refresh();
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
+    PendingRefresh pendingRefresh = _pendingRefresh.take();
+    _refresh(pendingRefresh.isFullRefresh() ?
+                nullptr :
+                &pendingRefresh.modifiedOids());
 }
 
 //  End of tt3-gui/ProjectManager.cpp
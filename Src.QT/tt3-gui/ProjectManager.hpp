@@ -121,6 +121,7 @@ namespace tt3::gui
         tt3::ws::Workspace      _workspace;
         tt3::ws::Credentials    _credentials;
         bool                    _refreshUnderway = false;
+        PendingRefresh          _pendingRefresh;
 
         //  View model
         //  Model services are "static" because they are oiggybacked
@@ -190,8 +191,14 @@ namespace tt3::gui
                                 QTreeWidgetItem * projectItem,
                                 _ProjectModel projectModel
                             );
+        bool            _refreshModifiedItems(
+                                const QSet<tt3::ws::Oid> & modifiedOids
+                            );  //  false == must rebuild the whole tree
 
         //  Helpers
+        void            _refresh(
+                                const QSet<tt3::ws::Oid> * modifiedOids
+                            );  //  nullptr == refresh all
         auto            _selectedProject(
                             ) -> tt3::ws::Project;
         bool            _setSelectedProject(
@@ -204,6 +211,9 @@ namespace tt3::gui
         void            _startListeningToWorkspaceChanges();
         void            _stopListeningToWorkspaceChanges();
         void            _clearAndDisableAllControls();
+        void            _objectCreatedOrDestroyed(
+                                tt3::ws::ObjectType * objectType
+                            );
         void            _applyCurrentLocale();
 
         //////////
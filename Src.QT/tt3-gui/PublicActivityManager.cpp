@@ -24,6 +24,7 @@ namespace tt3::gui
     extern CurrentActivity theCurrentActivity;
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -35,8 +36,7 @@ PublicActivityManager::PublicActivityManager(
         _workspace(theCurrentWorkspace),
         _credentials(theCurrentCredentials),
         //  Controls
-        _ui(new Ui::PublicActivityManager),
-        _refreshTimer(this)
+        _ui(new Ui::PublicActivityManager)
 {
     _ui->setupUi(this);
     _decorations = TreeWidgetDecorations(_ui->publicActivitiesTreeWidget);
@@ -69,22 +69,20 @@ PublicActivityManager::PublicActivityManager(
             this,
             &PublicActivityManager::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 
     //  Start listening for change notifications
     //  on the currently "viewed" Workspace
     _startListeningToWorkspaceChanges();
 
-    //  Start refreshing on timer
-    connect(&_refreshTimer,
-            &QTimer::timeout,
+    connect(&theRefreshScheduler,
+            &RefreshScheduler::tick,
             this,
-            &PublicActivityManager::_refreshTimerTimeout);
-    _refreshTimer.start(1000);
+            &PublicActivityManager::_clockTicked);
 }
 
 PublicActivityManager::~PublicActivityManager()
 {
-    _refreshTimer.stop();
     _stopListeningToWorkspaceChanges();
     delete _ui;
 }
@@ -122,6 +120,13 @@ void PublicActivityManager::setCredentials(const tt3::ws::Credentials & credenti
 }
 
 void PublicActivityManager::refresh()
+{
+    _refresh(nullptr);
+}
+
+void PublicActivityManager::_refresh(
+        const QSet<tt3::ws::Oid> * modifiedOids
+    )
 {
     static const QIcon viewPublicActivityIcon(":/tt3-gui/Resources/Images/Actions/ViewPublicActivityLarge.png");
     static const QIcon modifyPublicActivityIcon(":/tt3-gui/Resources/Images/Actions/ModifyPublicActivityLarge.png");
@@ -147,6 +152,8 @@ void PublicActivityManager::refresh()
             return;
         }
 
+        bool refreshItemsOnly = canRefreshItemsOnly(_ui->publicActivitiesTreeWidget, modifiedOids);
+
         //  Otherwise some controls are always enabled...
         _ui->filterLabel->setEnabled(true);
         _ui->filterLineEdit->setEnabled(true);
@@ -154,16 +161,20 @@ void PublicActivityManager::refresh()
 
         //  ...while others are enabled based on current
         //  selection and permissions granted by Credentials
-        _WorkspaceModel workspaceModel =
-            _createWorkspaceModel(_workspace, _credentials, _decorations);
-        QString filter = _ui->filterLineEdit->text().trimmed();
-        if (!filter.isEmpty())
-        {
-            _filterItems(workspaceModel, filter, _decorations);
+        if (!refreshItemsOnly ||
+            !_refreshModifiedItems(*modifiedOids))
+        {   //  Must rebuild the whole tree
+            _WorkspaceModel workspaceModel =
+                _createWorkspaceModel(_workspace, _credentials, _decorations);
+            QString filter = _ui->filterLineEdit->text().trimmed();
+            if (!filter.isEmpty())
+            {
+                _filterItems(workspaceModel, filter, _decorations);
+            }
+            _refreshWorkspaceTree(
+                _ui->publicActivitiesTreeWidget,
+                workspaceModel);
         }
-        _refreshWorkspaceTree(
-            _ui->publicActivitiesTreeWidget,
-            workspaceModel);
 
         tt3::ws::PublicActivity selectedPublicActivity = _selectedPublicActivity();
         bool readOnly = _workspace->isReadOnly();
@@ -253,7 +264,10 @@ void PublicActivityManager::refresh()
 
 void PublicActivityManager::requestRefresh()
 {
-    emit refreshRequested();
+    if (_pendingRefresh.requestFullRefresh())
+    {
+        emit refreshRequested();
+    }
 }
 
 //////////
@@ -272,13 +286,9 @@ auto PublicActivityManager::_createWorkspaceModel(
             workspaceModel->publicActivityModels.append(
                 _createPublicActivityModel(publicActivity, credentials, decorations));
         }
-        std::sort(
-            workspaceModel->publicActivityModels.begin(),
-            workspaceModel->publicActivityModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            workspaceModel->publicActivityModels,
+            [](const auto & m) { return m->publicActivity; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -399,6 +409,38 @@ void PublicActivityManager::_refreshPublicActivityItem(
     Q_ASSERT(publicActivityItem->childCount() == 0);
 }
 
+bool PublicActivityManager::_refreshModifiedItems(
+        const QSet<tt3::ws::Oid> & modifiedOids
+    )
+{
+    if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+    {   //  A modified PublicActivity may start or stop matching the filter
+        return modifiedOids.isEmpty();
+    }
+    for (const auto & oid : modifiedOids)
+    {
+        QTreeWidgetItem * publicActivityItem =
+            findTreeWidgetItem<tt3::ws::PublicActivity>(
+                _ui->publicActivitiesTreeWidget,
+                oid);
+        if (publicActivityItem == nullptr)
+        {   //  OOPS! Not in the tree - can't patch it
+            return false;
+        }
+        _refreshPublicActivityItem(
+            publicActivityItem,
+            _createPublicActivityModel(
+                publicActivityItem->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::PublicActivity>(),
+                _credentials,
+                _decorations));
+        if (!isInNaturalOrder(publicActivityItem))
+        {   //  Display name change requires re-ordering
+            return false;
+        }
+    }
+    return true;
+}
+
 //////////
 //  Implementation helpers
 auto PublicActivityManager::_selectedPublicActivity(
@@ -508,6 +550,18 @@ void PublicActivityManager::_applyCurrentLocale()
     refresh();
 }
 
+void PublicActivityManager::_objectCreatedOrDestroyed(
+        tt3::ws::ObjectType * objectType
+    )
+{
+    if (_pendingRefresh.requestRefreshOnObjectCreatedOrDestroyed(
+            objectType,
+            tt3::ws::ObjectTypes::PublicActivity::instance()))
+    {
+        emit refreshRequested();
+    }
+}
+
 //////////
 //  Signal handlers
 void PublicActivityManager::_currentThemeChanged(ITheme *, ITheme *)
@@ -523,9 +577,21 @@ void PublicActivityManager::_currentLocaleChanged(QLocale, QLocale)
     refresh();
 }
 
-void PublicActivityManager::_currentActivityChanged(tt3::ws::Activity, tt3::ws::Activity)
-{
-    requestRefresh();
+void PublicActivityManager::_currentActivityChanged(tt3::ws::Activity before, tt3::ws::Activity after)
+{   //  Buttons may change, but of all items only those
+    //  representing the old and the new current activity do
+    bool mustSchedule = _pendingRefresh.requestControlsRefresh();
+    for (const auto & activity : {before, after})
+    {
+        if (std::dynamic_pointer_cast<tt3::ws::PublicActivityImpl>(activity))
+        {
+            _pendingRefresh.requestItemRefresh(activity->oid());
+        }
+    }
+    if (mustSchedule)
+    {
+        emit refreshRequested();
+    }
 }
 
 void PublicActivityManager::_publicActivitiesTreeWidgetCurrentItemChanged(QTreeWidgetItem*,QTreeWidgetItem*)
@@ -702,34 +768,43 @@ void PublicActivityManager::_workspaceClosed(tt3::ws::WorkspaceClosedNotificatio
     requestRefresh();
 }
 
-void PublicActivityManager::_objectCreated(tt3::ws::ObjectCreatedNotification /*notification*/)
+void PublicActivityManager::_objectCreated(tt3::ws::ObjectCreatedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void PublicActivityManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification /*notification*/)
+void PublicActivityManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void PublicActivityManager::_objectModified(tt3::ws::ObjectModifiedNotification /*notification*/)
+void PublicActivityManager::_objectModified(tt3::ws::ObjectModifiedNotification notification)
 {
-    requestRefresh();
+    if (_pendingRefresh.requestRefreshOnObjectModified(
+            notification,
+            tt3::ws::ObjectTypes::PublicActivity::instance()))
+    {
+        emit refreshRequested();
+    }
 }
 
 void PublicActivityManager::_refreshRequested()
 {
-    refresh();
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
+    PendingRefresh pendingRefresh = _pendingRefresh.take();
+    _refresh(pendingRefresh.isFullRefresh() ?
+                nullptr :
+                &pendingRefresh.modifiedOids());
 }
 
-void PublicActivityManager::_refreshTimerTimeout()
+void PublicActivityManager::_clockTicked()
 {
-    if (tt3::ws::Activity activity = theCurrentActivity)
+    if (_pendingRefresh.requestElapsedTimeRefresh<tt3::ws::PublicActivityImpl>(this))
     {
-        if (std::dynamic_pointer_cast<tt3::ws::PublicActivityImpl>(activity))
-        {
-            refresh();
-        }
+        emit refreshRequested();
     }
 }
 
@@ -118,6 +118,7 @@ namespace tt3::gui
         tt3::ws::Workspace      _workspace;
         tt3::ws::Credentials    _credentials;
         bool                    _refreshUnderway = false;
+        PendingRefresh          _pendingRefresh;
 
         //  View model
         //  Model services are "static" because they are oiggybacked
@@ -172,8 +173,14 @@ namespace tt3::gui
                                 QTreeWidgetItem * publicActivityItem,
                                 _PublicActivityModel publicActivityModel
                             );
+        bool            _refreshModifiedItems(
+                                const QSet<tt3::ws::Oid> & modifiedOids
+                            );  //  false == must rebuild the whole tree
 
         //  Helpers
+        void            _refresh(
+                                const QSet<tt3::ws::Oid> * modifiedOids
+                            );  //  nullptr == refresh all
         auto            _selectedPublicActivity(
                             ) -> tt3::ws::PublicActivity;
         void            _setSelectedPublicActivity(
@@ -182,6 +189,9 @@ namespace tt3::gui
         void            _startListeningToWorkspaceChanges();
         void            _stopListeningToWorkspaceChanges();
         void            _clearAndDisableAllControls();
+        void            _objectCreatedOrDestroyed(
+                                tt3::ws::ObjectType * objectType
+                            );
         void            _applyCurrentLocale();
 
         //////////
@@ -189,7 +199,6 @@ namespace tt3::gui
     private:
         Ui::PublicActivityManager *const    _ui;
         std::unique_ptr<QMenu>  _publicActivitiesTreeContextMenu;
-        QTimer                  _refreshTimer;
 
         //  Drawing resources
         TreeWidgetDecorations   _decorations;
@@ -213,7 +222,7 @@ namespace tt3::gui
         void            _objectDestroyed(tt3::ws::ObjectDestroyedNotification notification);
         void            _objectModified(tt3::ws::ObjectModifiedNotification notification);
         void            _refreshRequested();
-        void            _refreshTimerTimeout();
+        void            _clockTicked();
     };
 }
 
@@ -24,6 +24,7 @@ namespace tt3::gui
     extern CurrentActivity theCurrentActivity;
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -35,8 +36,7 @@ PublicTaskManager::PublicTaskManager(
         _workspace(theCurrentWorkspace),
         _credentials(theCurrentCredentials),
         //  Controls
-        _ui(new Ui::PublicTaskManager),
-        _refreshTimer(this)
+        _ui(new Ui::PublicTaskManager)
 {
     _ui->setupUi(this);
     _decorations = TreeWidgetDecorations(_ui->publicTasksTreeWidget);
@@ -76,22 +76,20 @@ PublicTaskManager::PublicTaskManager(
             this,
             &PublicTaskManager::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 
     //  Start listening for change notifications
     //  on the currently "viewed" Workspace
     _startListeningToWorkspaceChanges();
 
-    //  Start refreshing on timer
-    connect(&_refreshTimer,
-            &QTimer::timeout,
+    connect(&theRefreshScheduler,
+            &RefreshScheduler::tick,
             this,
-            &PublicTaskManager::_refreshTimerTimeout);
-    _refreshTimer.start(1000);
+            &PublicTaskManager::_clockTicked);
 }
 
 PublicTaskManager::~PublicTaskManager()
 {
-    _refreshTimer.stop();
     _stopListeningToWorkspaceChanges();
     delete _ui;
 }
@@ -129,6 +127,13 @@ void PublicTaskManager::setCredentials(const tt3::ws::Credentials & credentials)
 }
 
 void PublicTaskManager::refresh()
+{
+    _refresh(nullptr);
+}
+
+void PublicTaskManager::_refresh(
+        const QSet<tt3::ws::Oid> * modifiedOids
+    )
 {
     static const QIcon viewPublicTaskIcon(":/tt3-gui/Resources/Images/Actions/ViewPublicTaskLarge.png");
     static const QIcon modifyPublicTaskIcon(":/tt3-gui/Resources/Images/Actions/ModifyPublicTaskLarge.png");
@@ -154,6 +159,8 @@ void PublicTaskManager::refresh()
             return;
         }
 
+        bool refreshItemsOnly = canRefreshItemsOnly(_ui->publicTasksTreeWidget, modifiedOids);
+
         //  Otherwise some controls are always enabled...
         _ui->filterLabel->setEnabled(true);
         _ui->filterLineEdit->setEnabled(true);
@@ -162,21 +169,25 @@ void PublicTaskManager::refresh()
 
         //  ...while others are enabled based on current
         //  selection and permissions granted by Credentials
-        _WorkspaceModel workspaceModel =
-            _createWorkspaceModel(_workspace, _credentials, _decorations);
-        if (!Component::Settings::instance()->showCompletedPublicTasks)
-        {
-            _removeCompletedItems(workspaceModel, _credentials);
-        }
-        QString filter = _ui->filterLineEdit->text().trimmed();
-        if (!filter.isEmpty())
-        {
-            _filterItems(workspaceModel, filter, _decorations);
-        }
-        _refreshWorkspaceTree(_ui->publicTasksTreeWidget, workspaceModel);
-        if (!_ui->filterLineEdit->text().trimmed().isEmpty())
-        {   //  Filtered - show all
-            _ui->publicTasksTreeWidget->expandAll();
+        if (!refreshItemsOnly ||
+            !_refreshModifiedItems(*modifiedOids))
+        {   //  Must rebuild the whole tree
+            _WorkspaceModel workspaceModel =
+                _createWorkspaceModel(_workspace, _credentials, _decorations);
+            if (!Component::Settings::instance()->showCompletedPublicTasks)
+            {
+                _removeCompletedItems(workspaceModel, _credentials);
+            }
+            QString filter = _ui->filterLineEdit->text().trimmed();
+            if (!filter.isEmpty())
+            {
+                _filterItems(workspaceModel, filter, _decorations);
+            }
+            _refreshWorkspaceTree(_ui->publicTasksTreeWidget, workspaceModel);
+            if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+            {   //  Filtered - show all
+                _ui->publicTasksTreeWidget->expandAll();
+            }
         }
 
         tt3::ws::PublicTask selectedPublicTask = _selectedPublicTask();
@@ -284,7 +295,10 @@ void PublicTaskManager::refresh()
 
 void PublicTaskManager::requestRefresh()
 {
-    emit refreshRequested();
+    if (_pendingRefresh.requestFullRefresh())
+    {
+        emit refreshRequested();
+    }
 }
 
 //////////
@@ -303,13 +317,9 @@ auto PublicTaskManager::_createWorkspaceModel(
             workspaceModel->publicTaskModels.append(
                 _createPublicTaskModel(publicTask, credentials, decorations));
         }
-        std::sort(
-            workspaceModel->publicTaskModels.begin(),
-            workspaceModel->publicTaskModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            workspaceModel->publicTaskModels,
+            [](const auto & m) { return m->publicTask; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -362,13 +372,9 @@ auto PublicTaskManager::_createPublicTaskModel(
             publicTaskModel->childModels.append(
                 _createPublicTaskModel(child, credentials, decorations));
         }
-        std::sort(
-            publicTaskModel->childModels.begin(),
-            publicTaskModel->childModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            publicTaskModel->childModels,
+            [](const auto & m) { return m->publicTask; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -560,6 +566,64 @@ void PublicTaskManager::_refreshPublicTaskItem(
     }
 }
 
+bool PublicTaskManager::_refreshModifiedItems(
+        const QSet<tt3::ws::Oid> & modifiedOids
+    )
+{
+    if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+    {   //  A modified PublicTask may start or stop matching the filter
+        return modifiedOids.isEmpty();
+    }
+    for (const auto & oid : modifiedOids)
+    {
+        QTreeWidgetItem * publicTaskItem =
+            findTreeWidgetItem<tt3::ws::PublicTask>(
+                _ui->publicTasksTreeWidget,
+                oid);
+        if (publicTaskItem == nullptr)
+        {   //  Not in the tree (e.g. a hidden completed PublicTask)
+            //  - can't patch it
+            return false;
+        }
+        tt3::ws::PublicTask publicTask =
+            publicTaskItem->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::PublicTask>();
+        _PublicTaskModel publicTaskModel =
+            _createPublicTaskModel(publicTask, _credentials, _decorations);
+        try
+        {   //  The PublicTask may have been moved to another parent...
+            tt3::ws::PublicTask parentPublicTask =
+                (publicTaskItem->parent() != nullptr) ?
+                    publicTaskItem->parent()->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::PublicTask>() :
+                    nullptr;
+            if (publicTask->parent(_credentials) != parentPublicTask)    //  may throw
+            {
+                return false;
+            }
+            //  ...or completed, in which case it may need to be hidden
+            if (!Component::Settings::instance()->showCompletedPublicTasks)
+            {
+                _removeCompletedItems(publicTaskModel, _credentials);
+                if (publicTask->completed(_credentials) &&  //  may throw
+                    publicTaskModel->childModels.isEmpty())
+                {
+                    return false;
+                }
+            }
+        }
+        catch (const tt3::util::Exception & ex)
+        {   //  OOPS! Log & rebuild the whole tree
+            qCritical() << ex;
+            return false;
+        }
+        _refreshPublicTaskItem(publicTaskItem, publicTaskModel);
+        if (!isInNaturalOrder(publicTaskItem))
+        {   //  Display name change requires re-ordering
+            return false;
+        }
+    }
+    return true;
+}
+
 //////////
 //  Implementation helpers
 auto PublicTaskManager::_selectedPublicTask(
@@ -701,6 +765,18 @@ void PublicTaskManager::_applyCurrentLocale()
     refresh();
 }
 
+void PublicTaskManager::_objectCreatedOrDestroyed(
+        tt3::ws::ObjectType * objectType
+    )
+{
+    if (_pendingRefresh.requestRefreshOnObjectCreatedOrDestroyed(
+            objectType,
+            tt3::ws::ObjectTypes::PublicTask::instance()))
+    {
+        emit refreshRequested();
+    }
+}
+
 //////////
 //  Signal handlers
 void PublicTaskManager::_currentThemeChanged(ITheme *, ITheme *)
@@ -716,9 +792,21 @@ void PublicTaskManager::_currentLocaleChanged(QLocale, QLocale)
     refresh();
 }
 
-void PublicTaskManager::_currentActivityChanged(tt3::ws::Activity, tt3::ws::Activity)
-{
-    requestRefresh();
+void PublicTaskManager::_currentActivityChanged(tt3::ws::Activity before, tt3::ws::Activity after)
+{   //  Buttons may change, but of all items only those
+    //  representing the old and the new current activity do
+    bool mustSchedule = _pendingRefresh.requestControlsRefresh();
+    for (const auto & activity : {before, after})
+    {
+        if (std::dynamic_pointer_cast<tt3::ws::PublicTaskImpl>(activity))
+        {
+            _pendingRefresh.requestItemRefresh(activity->oid());
+        }
+    }
+    if (mustSchedule)
+    {
+        emit refreshRequested();
+    }
 }
 
 void PublicTaskManager::_publicTasksTreeWidgetCurrentItemChanged(QTreeWidgetItem*,QTreeWidgetItem*)
@@ -977,34 +1065,43 @@ void PublicTaskManager::_workspaceClosed(tt3::ws::WorkspaceClosedNotification /*
     requestRefresh();
 }
 
-void PublicTaskManager::_objectCreated(tt3::ws::ObjectCreatedNotification /*notification*/)
+void PublicTaskManager::_objectCreated(tt3::ws::ObjectCreatedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void PublicTaskManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification /*notification*/)
+void PublicTaskManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void PublicTaskManager::_objectModified(tt3::ws::ObjectModifiedNotification /*notification*/)
+void PublicTaskManager::_objectModified(tt3::ws::ObjectModifiedNotification notification)
 {
-    requestRefresh();
+    if (_pendingRefresh.requestRefreshOnObjectModified(
+            notification,
+            tt3::ws::ObjectTypes::PublicTask::instance()))
+    {
+        emit refreshRequested();
+    }
 }
 
 void PublicTaskManager::_refreshRequested()
 {
-    refresh();
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
+    PendingRefresh pendingRefresh = _pendingRefresh.take();
+    _refresh(pendingRefresh.isFullRefresh() ?
+                nullptr :
+                &pendingRefresh.modifiedOids());
 }
 
-void PublicTaskManager::_refreshTimerTimeout()
+void PublicTaskManager::_clockTicked()
 {
-    if (tt3::ws::Activity activity = theCurrentActivity)
+    if (_pendingRefresh.requestElapsedTimeRefresh<tt3::ws::PublicTaskImpl>(this))
     {
-        if (std::dynamic_pointer_cast<tt3::ws::PublicTaskImpl>(activity))
-        {
-            refresh();
-        }
+        emit refreshRequested();
     }
 }
 
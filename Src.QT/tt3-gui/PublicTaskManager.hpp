@@ -119,6 +119,7 @@ namespace tt3::gui
         tt3::ws::Workspace      _workspace;
         tt3::ws::Credentials    _credentials;
         bool                    _refreshUnderway = false;
+        PendingRefresh          _pendingRefresh;
 
         //  View model
         //  Model services are "static" because they are oiggybacked
@@ -188,8 +189,14 @@ namespace tt3::gui
                                 QTreeWidgetItem * publicTaskItem,
                                 _PublicTaskModel publicTaskModel
                             );
+        bool            _refreshModifiedItems(
+                                const QSet<tt3::ws::Oid> & modifiedOids
+                            );  //  false == must rebuild the whole tree
 
         //  Helpers
+        void            _refresh(
+                                const QSet<tt3::ws::Oid> * modifiedOids
+                            );  //  nullptr == refresh all
         auto            _selectedPublicTask(
                             ) -> tt3::ws::PublicTask;
         bool            _setSelectedPublicTask(
@@ -202,6 +209,9 @@ namespace tt3::gui
         void            _startListeningToWorkspaceChanges();
         void            _stopListeningToWorkspaceChanges();
         void            _clearAndDisableAllControls();
+        void            _objectCreatedOrDestroyed(
+                                tt3::ws::ObjectType * objectType
+                            );
         void            _applyCurrentLocale();
 
         //////////
@@ -209,7 +219,6 @@ namespace tt3::gui
     private:
         Ui::PublicTaskManager *const    _ui;
         std::unique_ptr<QMenu>  _publicTasksTreeContextMenu;
-        QTimer                  _refreshTimer;
 
         //  Drawing resources
         TreeWidgetDecorations   _decorations;
@@ -236,7 +245,7 @@ namespace tt3::gui
         void            _objectDestroyed(tt3::ws::ObjectDestroyedNotification notification);
         void            _objectModified(tt3::ws::ObjectModifiedNotification notification);
         void            _refreshRequested();
-        void            _refreshTimerTimeout();
+        void            _clockTicked();
     };
 }
 
@@ -22,6 +22,7 @@ namespace tt3::gui
 {
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -65,6 +66,7 @@ QuickReportBrowser::QuickReportBrowser(
             this,
             &QuickReportBrowser::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 
     //  Start refresing on timer
     connect(
@@ -313,12 +315,16 @@ void QuickReportBrowser::_refreshPushButtonClicked()
 }
 
 void QuickReportBrowser::_refreshTimerTimeout()
-{
-    refresh();
+{   //  Don't re-generate the report while nobody looks at it
+    requestRefresh();
 }
 
 void QuickReportBrowser::_refreshRequested()
 {
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
     refresh();
 }
 
@@ -22,6 +22,7 @@ namespace tt3::gui
 {
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -38,6 +39,7 @@ QuickReportView::QuickReportView(
             this,
             &QuickReportView::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 }
 
 QuickReportView::~QuickReportView()
@@ -85,6 +87,10 @@ void QuickReportView::requestRefresh()
 //  Signal handlers
 void QuickReportView::_refreshRequested()
 {
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
     refresh();
 }
 
@@ -0,0 +1,107 @@
+//
+//  tt3-gui/RefreshScheduler.cpp - tt3::gui::RefreshScheduler class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-gui/API.hpp"
+using namespace tt3::gui;
+
+//////////
+//  Construction/destruction
+RefreshScheduler::RefreshScheduler()
+{
+}
+
+RefreshScheduler::~RefreshScheduler()
+{
+}
+
+//////////
+//  QObject
+bool RefreshScheduler::eventFilter(QObject * watched, QEvent * event)
+{
+    if (event->type() == QEvent::Show &&
+        _deferredWidgets.remove(watched))
+    {   //  The widget has missed at least one refresh while
+        //  hidden - let it catch up, on the next event loop turn
+        Q_ASSERT(_refreshRequestEmitters.contains(watched));
+        _refreshRequestEmitters[watched]();
+    }
+    return false;
+}
+
+void RefreshScheduler::connectNotify(const QMetaMethod & signal)
+{
+    if (signal == QMetaMethod::fromSignal(&RefreshScheduler::tick) &&
+        _clockTimer == nullptr)
+    {   //  The global static instance is constructed before
+        //  the application - start ticking only when needed
+        _clockTimer = new QTimer(this);
+        connect(_clockTimer,
+                &QTimer::timeout,
+                this,
+                &RefreshScheduler::tick);
+        _clockTimer->start(1000);
+    }
+}
+
+//////////
+//  Operations
+bool RefreshScheduler::deferRefresh(QWidget * widget)
+{
+    Q_ASSERT(widget != nullptr);
+
+    if (widget->isVisible() ||
+        !_refreshRequestEmitters.contains(widget))
+    {   //  Unregistered widgets would never be woken up
+        return false;
+    }
+    _deferredWidgets.insert(widget);
+    return true;
+}
+
+//////////
+//  Implementation helpers
+void RefreshScheduler::_registerWidget(
+        QWidget * widget,
+        const std::function<void()> & refreshRequestEmitter
+    )
+{
+    Q_ASSERT(widget != nullptr);
+    Q_ASSERT(!_refreshRequestEmitters.contains(widget));
+
+    _refreshRequestEmitters[widget] = refreshRequestEmitter;
+    widget->installEventFilter(this);
+    connect(widget,
+            &QObject::destroyed,
+            this,
+            &RefreshScheduler::_widgetDestroyed);
+}
+
+//////////
+//  Signal handlers
+void RefreshScheduler::_widgetDestroyed(QObject * widget)
+{
+    _refreshRequestEmitters.remove(widget);
+    _deferredWidgets.remove(widget);
+}
+
+//////////
+//  Global statics
+namespace tt3::gui
+{
+    Q_DECL_EXPORT RefreshScheduler theRefreshScheduler;
+}
+
+//  End of tt3-gui/RefreshScheduler.cpp
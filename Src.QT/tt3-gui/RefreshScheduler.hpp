@@ -0,0 +1,152 @@
+//
+//  tt3-gui/RefreshScheduler.hpp - tt3-gui UI refresh scheduler
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#pragma once
+#include "tt3-gui/API.hpp"
+
+namespace tt3::gui
+{
+    /// \class RefreshScheduler tt3-gui/API.hpp
+    /// \brief Schedules the refreshes of UI widgets.
+    /// \details
+    ///     Only one global static instance of this class exists,
+    ///     and other instances should NOT be constructed.
+    ///     A widget registered with the scheduler marks itself
+    ///     "dirty" when notified of a change, but actually
+    ///     refreshes only while visible; a refresh requested
+    ///     while the widget is hidden is deferred until it is
+    ///     shown. Separately, the scheduler emits a single
+    ///     "clock" tick once a second, which widgets showing the
+    ///     time elapsed since the "current" activity has started
+    ///     use to update just that.
+    class TT3_GUI_PUBLIC RefreshScheduler final
+        :   public QObject
+    {
+        Q_OBJECT
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(RefreshScheduler)
+
+        //////////
+        //  Construction/destruction
+    public:
+        /// \brief
+        ///     The class constructor.
+        RefreshScheduler();
+
+        /// \brief
+        ///     The class destructor.
+        virtual ~RefreshScheduler();
+
+        //////////
+        //  QObject
+    public:
+        /// \brief
+        ///     Filters events of registered widgets.
+        /// \param watched
+        ///     The registered widget.
+        /// \param event
+        ///     The event to filter.
+        /// \return
+        ///     Always false - the event is never consumed.
+        virtual bool    eventFilter(QObject * watched, QEvent * event) override;
+
+    protected:
+        /// \brief
+        ///     Called when something connects to a signal of this object.
+        /// \param signal
+        ///     The signal connected to.
+        virtual void    connectNotify(const QMetaMethod & signal) override;
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Registers a widget with the scheduler.
+        /// \details
+        ///     The widget must have a "refreshRequested()" signal,
+        ///     which the scheduler re-emits when the widget becomes
+        ///     visible after its refresh was deferred. A widget is
+        ///     unregistered automatically when destroyed.
+        /// \param widget
+        ///     The widget to register.
+        template <class W>
+        void        registerWidget(W * widget)
+        {
+            Q_ASSERT(widget != nullptr);
+            _registerWidget(
+                widget,
+                [=]()
+                {
+                    emit widget->refreshRequested();
+                });
+        }
+
+        /// \brief
+        ///     Decides whether a registered widget's refresh
+        ///     should be deferred.
+        /// \details
+        ///     Called by a widget just before it refreshes on
+        ///     request. If the widget is hidden, records that it
+        ///     must be refreshed once shown.
+        /// \param widget
+        ///     The widget about to refresh.
+        /// \return
+        ///     True if the refresh must be skipped for now, false
+        ///     if the widget should refresh right away.
+        bool        deferRefresh(QWidget * widget);
+
+        //////////
+        //  Signals
+        //  Clients are encourated to use "queued" connections.
+    signals:
+        /// \brief
+        ///     Emitted once a second.
+        /// \details
+        ///     Clients should only update what shows the time
+        ///     elapsed since something, not refresh fully.
+        void        tick();
+
+        //////////
+        //  Implementation
+    private:
+        QTimer *    _clockTimer = nullptr;  //  created on first use
+        QHash<QObject*, std::function<void()>>  _refreshRequestEmitters;
+        QSet<QObject*>  _deferredWidgets;
+
+        //  Helpers
+        void        _registerWidget(
+                            QWidget * widget,
+                            const std::function<void()> & refreshRequestEmitter
+                        );
+
+        //////////
+        //  Signal handlers
+    private slots:
+        void        _widgetDestroyed(QObject * widget);
+    };
+
+#if defined(TT3_GUI_LIBRARY)
+    //  Building tt3-gui
+#else
+    //  Building tt3-gui client
+    #ifdef Q_OS_WINDOWS
+        Q_DECL_IMPORT RefreshScheduler theRefreshScheduler;
+    #else
+        extern RefreshScheduler theRefreshScheduler;
+    #endif
+#endif
+}
+
+//  End of tt3-gui/RefreshScheduler.hpp
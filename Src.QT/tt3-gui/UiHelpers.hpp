@@ -68,6 +68,452 @@ namespace tt3::gui
         bool &      _refreshUnderway;
         const bool  _savedRefreshUnderway;
     };
+
+    /// \class PendingRefresh tt3-gui/API.hpp
+    /// \brief Accumulates changes a UI widget must reflect on its next refresh.
+    /// \details
+    ///     A single user action (e.g. stopping an activity) can result
+    ///     in a burst of workspace change notifications. Rather than
+    ///     refreshing on each one, a widget records them here and
+    ///     refreshes once, on the next turn of its event loop - and,
+    ///     unless a full refresh was requested, only re-creates the
+    ///     items representing the modified objects.
+    class TT3_GUI_PUBLIC PendingRefresh final
+    {
+        //  Default copy constructor and assignment are OK
+
+        //////////
+        //  Construction/destruction
+    public:
+        /// \brief
+        ///     Constructs an "empty" pending refresh.
+        PendingRefresh() = default;
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Records that the entire widget must be refreshed.
+        /// \return
+        ///     True if the caller must now schedule a refresh,
+        ///     false if a refresh is already scheduled.
+        bool        requestFullRefresh()
+        {
+            _fullRefresh = true;
+            _modifiedOids.clear();
+            return _schedule();
+        }
+
+        /// \brief
+        ///     Records that an item representing the specified
+        ///     object must be refreshed.
+        /// \param oid
+        ///     The OID of the modified object.
+        /// \return
+        ///     True if the caller must now schedule a refresh,
+        ///     false if a refresh is already scheduled.
+        bool        requestItemRefresh(const tt3::ws::Oid & oid)
+        {
+            if (!_fullRefresh)
+            {
+                _modifiedOids.insert(oid);
+            }
+            return _schedule();
+        }
+
+        /// \brief
+        ///     Records that the widget's controls (but none of
+        ///     its items) must be refreshed, e.g. because the
+        ///     access rights granted by credentials may have changed.
+        /// \return
+        ///     True if the caller must now schedule a refresh,
+        ///     false if a refresh is already scheduled.
+        bool        requestControlsRefresh()
+        {
+            return _schedule();
+        }
+
+        /// \brief
+        ///     Records what a widget showing workspace objects of
+        ///     one type must refresh when an object is created or
+        ///     destroyed.
+        /// \details
+        ///     Objects of the type shown change the tree structure.
+        ///     Of all other objects, only Users and Accounts matter -
+        ///     they may change the access rights granted by the
+        ///     widget's credentials, and so its controls. Changes
+        ///     to other objects are not displayed by such widgets.
+        /// \param objectType
+        ///     The type of the created or destroyed object.
+        /// \param shownObjectType
+        ///     The type of objects the widget shows.
+        /// \return
+        ///     True if the caller must now schedule a refresh,
+        ///     false if a refresh is already scheduled or unneeded.
+        bool        requestRefreshOnObjectCreatedOrDestroyed(
+                            tt3::ws::ObjectType * objectType,
+                            tt3::ws::ObjectType * shownObjectType
+                        )
+        {
+            if (objectType == shownObjectType)
+            {
+                return requestFullRefresh();
+            }
+            if (_affectsAccessRights(objectType))
+            {
+                return requestControlsRefresh();
+            }
+            return false;
+        }
+
+        /// \brief
+        ///     Records what a widget showing workspace objects of
+        ///     one type must refresh when an object is modified.
+        /// \details
+        ///     A modified object of the type shown only needs its own
+        ///     item refreshed; otherwise the same rules apply as in
+        ///     requestRefreshOnObjectCreatedOrDestroyed().
+        /// \param notification
+        ///     The notification about the modified object.
+        /// \param shownObjectType
+        ///     The type of objects the widget shows.
+        /// \return
+        ///     True if the caller must now schedule a refresh,
+        ///     false if a refresh is already scheduled or unneeded.
+        bool        requestRefreshOnObjectModified(
+                            const tt3::ws::ObjectModifiedNotification & notification,
+                            tt3::ws::ObjectType * shownObjectType
+                        )
+        {
+            if (notification.objectType() == shownObjectType)
+            {
+                return requestItemRefresh(notification.oid());
+            }
+            if (_affectsAccessRights(notification.objectType()))
+            {
+                return requestControlsRefresh();
+            }
+            return false;
+        }
+
+        /// \brief
+        ///     Records that the item showing the current activity's
+        ///     elapsed time must be refreshed; to be called on every
+        ///     RefreshScheduler::tick(), as that time changes every
+        ///     second.
+        /// \details
+        ///     Nothing needs a refresh if the widget is hidden, or
+        ///     if the current activity is not of the type it shows.
+        /// \param widget
+        ///     The widget showing the activities.
+        /// \return
+        ///     True if the caller must now schedule a refresh,
+        ///     false if a refresh is already scheduled or unneeded.
+        template <class ActivityImpl>
+        bool        requestElapsedTimeRefresh(const QWidget * widget)
+        {
+            Q_ASSERT(widget != nullptr);
+
+            if (!widget->isVisible())
+            {   //  Nothing to show the elapsed time in
+                return false;
+            }
+            tt3::ws::Activity activity = theCurrentActivity;
+            if (std::dynamic_pointer_cast<ActivityImpl>(activity))
+            {   //  Only the "current" item shows the elapsed time
+                return requestItemRefresh(activity->oid());
+            }
+            return false;
+        }
+
+        /// \brief
+        ///     Returns the changes accumulated so far and resets
+        ///     this pending refresh to "empty".
+        /// \return
+        ///     The changes accumulated so far.
+        PendingRefresh  take()
+        {
+            PendingRefresh result = *this;
+            *this = PendingRefresh();
+            return result;
+        }
+
+        //////////
+        //  Properties
+    public:
+        /// \brief
+        ///     Checks whether the entire widget must be refreshed.
+        /// \return
+        ///     True if the entire widget must be refreshed, false
+        ///     if refreshing the modifiedOids() items is enough.
+        bool        isFullRefresh() const { return _fullRefresh; }
+
+        /// \brief
+        ///     Returns the OIDs of objects whose items must be refreshed.
+        /// \return
+        ///     The OIDs of objects whose items must be refreshed.
+        auto        modifiedOids(
+                        ) const -> const QSet<tt3::ws::Oid> &
+        {
+            return _modifiedOids;
+        }
+
+        //////////
+        //  Implementation
+    private:
+        bool        _scheduled = false;
+        bool        _fullRefresh = false;
+        QSet<tt3::ws::Oid>  _modifiedOids;
+
+        //  Helpers
+        bool        _schedule()
+        {
+            bool result = !_scheduled;
+            _scheduled = true;
+            return result;
+        }
+
+        static bool _affectsAccessRights(tt3::ws::ObjectType * objectType)
+        {
+            return objectType == tt3::ws::ObjectTypes::User::instance() ||
+                   objectType == tt3::ws::ObjectTypes::Account::instance();
+        }
+    };
+
+    /// \class AccountChangeFilter tt3-gui/API.hpp
+    /// \brief Tells the Account modifications that matter to
+    ///     a tree of Users from those that don't.
+    /// \details
+    ///     Every Work or Event recorded for an Account modifies it,
+    ///     so Accounts are modified all the time; yet a tree of
+    ///     Users (and of their objects) only depends on the
+    ///     Accounts' capabilities and on the Users they belong to.
+    ///     The filter remembers these as of the last full refresh.
+    class TT3_GUI_PUBLIC AccountChangeFilter final
+    {
+        //  Default copy constructor and assignment are OK
+
+        //////////
+        //  Construction/destruction
+    public:
+        /// \brief
+        ///     Constructs a filter that remembers no Accounts.
+        AccountChangeFilter() = default;
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Remembers the capabilities and the Users of all
+        ///     Accounts; to be called on every full refresh.
+        /// \param workspace
+        ///     The workspace shown; nullptr == none.
+        /// \param credentials
+        ///     The credentials to use for data access.
+        void        remember(
+                            tt3::ws::Workspace workspace,
+                            const tt3::ws::Credentials & credentials
+                        )
+        {
+            _accountStates.clear();
+            if (workspace == nullptr)
+            {   //  Nothing to remember
+                return;
+            }
+            try
+            {
+                for (const tt3::ws::Account & account : workspace->accounts(credentials))   //  may throw
+                {
+                    _accountStates[account->oid()] = _stateOf(account, credentials);  //  may throw
+                }
+            }
+            catch (const tt3::util::Exception & ex)
+            {   //  OOPS! Log; all modifications will matter
+                qCritical() << ex;
+                _accountStates.clear();
+            }
+        }
+
+        /// \brief
+        ///     Checks whether a modification of an Account
+        ///     matters to the tree of Users.
+        /// \param workspace
+        ///     The workspace shown; nullptr == none.
+        /// \param credentials
+        ///     The credentials to use for data access.
+        /// \param accountOid
+        ///     The OID of the modified Account.
+        /// \return
+        ///     True if the Account's capabilities or User have
+        ///     changed since the last full refresh (or can't be
+        ///     told), false if the tree can stay as it is.
+        bool        matters(
+                            tt3::ws::Workspace workspace,
+                            const tt3::ws::Credentials & credentials,
+                            const tt3::ws::Oid & accountOid
+                        ) const
+        {
+            auto it = _accountStates.constFind(accountOid);
+            if (workspace == nullptr || it == _accountStates.cend())
+            {   //  Unknown as of the last full refresh
+                return true;
+            }
+            try
+            {
+                tt3::ws::Account account =
+                    workspace->findObjectByOid<tt3::ws::Account>(credentials, accountOid);  //  may throw
+                return account == nullptr ||
+                       _stateOf(account, credentials) != it.value();  //  may throw
+            }
+            catch (const tt3::util::Exception & ex)
+            {   //  OOPS! Log & assume the worst
+                qCritical() << ex;
+                return true;
+            }
+        }
+
+        //////////
+        //  Implementation
+    private:
+        using _AccountState = QPair<tt3::ws::Capabilities, tt3::ws::Oid>;    //  capabilities, User OID
+        QMap<tt3::ws::Oid, _AccountState>   _accountStates;
+
+        //  Helpers
+        static auto _stateOf(
+                            tt3::ws::Account account,
+                            const tt3::ws::Credentials & credentials
+                        ) -> _AccountState
+        {
+            return _AccountState(
+                account->capabilities(credentials), //  may throw
+                account->user(credentials)->oid()); //  may throw
+        }
+    };
+
+    /// \brief
+    ///     Checks whether a refresh of a workspace object tree
+    ///     can be limited to the items of the modified objects.
+    /// \details
+    ///     Only a populated tree has items to refresh, and a
+    ///     disabled tree is an empty tree - so this must be
+    ///     checked before the tree is (re-)enabled.
+    /// \param treeWidget
+    ///     The tree widget to refresh.
+    /// \param modifiedOids
+    ///     The OIDs of the modified objects; nullptr == the
+    ///     entire tree must be refreshed.
+    /// \return
+    ///     True if refreshing the items of the modified objects
+    ///     may be enough, false if the tree must be rebuilt.
+    inline bool canRefreshItemsOnly(
+                        const QTreeWidget * treeWidget,
+                        const QSet<tt3::ws::Oid> * modifiedOids
+                    )
+    {
+        Q_ASSERT(treeWidget != nullptr);
+
+        return modifiedOids != nullptr && treeWidget->isEnabled();
+    }
+
+    /// \brief
+    ///     Finds the tree widget item that represents the
+    ///     specified workspace object.
+    /// \param treeWidget
+    ///     The tree widget to search.
+    /// \param oid
+    ///     The OID of the workspace object to look for.
+    /// \return
+    ///     The item whose Qt::ItemDataRole::UserRole data is
+    ///     a T with the specified OID; nullptr if not found.
+    template <class T>
+    QTreeWidgetItem *   findTreeWidgetItem(
+                                QTreeWidget * treeWidget,
+                                const tt3::ws::Oid & oid
+                            )
+    {
+        Q_ASSERT(treeWidget != nullptr);
+
+        for (QTreeWidgetItemIterator it(treeWidget); *it != nullptr; ++it)
+        {
+            T object = (*it)->data(0, Qt::ItemDataRole::UserRole).value<T>();
+            if (object != nullptr && object->oid() == oid)
+            {   //  This one!
+                return *it;
+            }
+        }
+        return nullptr;
+    }
+
+    /// \brief
+    ///     Sorts the models of workspace object tree items by
+    ///     text, in natural string order.
+    /// \details
+    ///     Models with equal texts are ordered by the OIDs of
+    ///     the objects they represent, so that their order does
+    ///     not change from one refresh to the next.
+    /// \param models
+    ///     The models to sort; each must have a "text".
+    /// \param objectOf
+    ///     The function returning the workspace object a
+    ///     model represents.
+    template <class M, class F>
+    void        sortItemModels(
+                        QList<M> & models,
+                        F objectOf
+                    )
+    {
+        std::sort(
+            models.begin(),
+            models.end(),
+            [&](const M & a, const M & b)
+            {
+                if (tt3::util::NaturalStringOrder::less(a->text, b->text))
+                {
+                    return true;
+                }
+                if (tt3::util::NaturalStringOrder::less(b->text, a->text))
+                {
+                    return false;
+                }
+                return objectOf(a)->oid() < objectOf(b)->oid();
+            });
+    }
+
+    /// \brief
+    ///     Checks whether a tree widget item is still properly
+    ///     placed among its siblings after its text has changed.
+    /// \details
+    ///     All workspace object trees keep their sibling items
+    ///     ordered by text in natural string order.
+    /// \param item
+    ///     The tree widget item to check.
+    /// \return
+    ///     True if the item is properly placed among its siblings,
+    ///     false if the tree needs re-ordering.
+    inline bool isInNaturalOrder(QTreeWidgetItem * item)
+    {
+        Q_ASSERT(item != nullptr);
+
+        QTreeWidgetItem * parentItem = item->parent();
+        QTreeWidget * treeWidget = item->treeWidget();
+        Q_ASSERT(parentItem != nullptr || treeWidget != nullptr);
+        int index = (parentItem != nullptr) ?
+                        parentItem->indexOfChild(item) :
+                        treeWidget->indexOfTopLevelItem(item);
+        int count = (parentItem != nullptr) ?
+                        parentItem->childCount() :
+                        treeWidget->topLevelItemCount();
+        auto sibling = [&](int i)
+        {
+            return (parentItem != nullptr) ?
+                        parentItem->child(i) :
+                        treeWidget->topLevelItem(i);
+        };
+        return (index == 0 ||
+                !tt3::util::NaturalStringOrder::less(item->text(0), sibling(index - 1)->text(0))) &&
+               (index + 1 == count ||
+                !tt3::util::NaturalStringOrder::less(sibling(index + 1)->text(0), item->text(0)));
+    }
 }
 
 //  End of tt3-gui/UiHelpers.hpp
@@ -23,6 +23,7 @@ namespace tt3::gui
     extern CurrentTheme theCurrentTheme;
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -66,6 +67,7 @@ UserManager::UserManager(QWidget * parent)
             this,
             &UserManager::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 
     //  Start listening for change notifications
     //  on the currently "viewed" Workspace
@@ -111,6 +113,13 @@ void UserManager::setCredentials(const tt3::ws::Credentials & credentials)
 }
 
 void UserManager::refresh()
+{
+    _refresh(nullptr);
+}
+
+void UserManager::_refresh(
+        const QSet<tt3::ws::Oid> * modifiedOids
+    )
 {
     static const QIcon viewUserIcon(":/tt3-gui/Resources/Images/Actions/ViewUserLarge.png");
     static const QIcon modifyUserIcon(":/tt3-gui/Resources/Images/Actions/ModifyUserLarge.png");
@@ -138,6 +147,8 @@ void UserManager::refresh()
             return;
         }
 
+        bool refreshItemsOnly = canRefreshItemsOnly(_ui->usersTreeWidget, modifiedOids);
+
         //  Otherwise some controls are always enabled...
         _ui->filterLabel->setEnabled(true);
         _ui->filterLineEdit->setEnabled(true);
@@ -146,19 +157,23 @@ void UserManager::refresh()
 
         //  ...while others are enabled based on current
         //  selection and permissions granted by Credentials
-        _WorkspaceModel workspaceModel = _createWorkspaceModel();
-        if (!Component::Settings::instance()->showDisabledUsersAndAccounts)
-        {
-            _removeDisabledItems(workspaceModel);
-        }
-        if (!_ui->filterLineEdit->text().trimmed().isEmpty())
-        {
-            _filterItems(workspaceModel);
-        }
-        _refreshWorkspaceTree(workspaceModel);
-        if (!_ui->filterLineEdit->text().trimmed().isEmpty())
-        {   //  Filtered - show all
-            _ui->usersTreeWidget->expandAll();
+        if (!refreshItemsOnly ||
+            !_refreshModifiedItems(*modifiedOids))
+        {   //  Must rebuild the whole tree
+            _WorkspaceModel workspaceModel = _createWorkspaceModel();
+            if (!Component::Settings::instance()->showDisabledUsersAndAccounts)
+            {
+                _removeDisabledItems(workspaceModel);
+            }
+            if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+            {
+                _filterItems(workspaceModel);
+            }
+            _refreshWorkspaceTree(workspaceModel);
+            if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+            {   //  Filtered - show all
+                _ui->usersTreeWidget->expandAll();
+            }
         }
 
         tt3::ws::User currentUser = _currentUser();
@@ -279,7 +294,10 @@ void UserManager::refresh()
 
 void UserManager::requestRefresh()
 {
-    emit refreshRequested();
+    if (_pendingRefresh.requestFullRefresh())
+    {
+        emit refreshRequested();
+    }
 }
 
 //////////
@@ -293,13 +311,9 @@ UserManager::_WorkspaceModel UserManager::_createWorkspaceModel()
         {
             workspaceModel->userModels.append(_createUserModel(user));
         }
-        std::sort(
-            workspaceModel->userModels.begin(),
-            workspaceModel->userModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            workspaceModel->userModels,
+            [](const auto & m) { return m->user; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -344,13 +358,9 @@ UserManager::_UserModel UserManager::_createUserModel(tt3::ws::User user)
         {
             userModel->accountModels.append(_createAccountModel(account));
         }
-        std::sort(
-            userModel->accountModels.begin(),
-            userModel->accountModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            userModel->accountModels,
+            [](const auto & m) { return m->account; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -567,6 +577,78 @@ void UserManager::_refreshAccountItem(
     Q_ASSERT(accountItem->childCount() == 0);
 }
 
+bool UserManager::_refreshModifiedItems(
+        const QSet<tt3::ws::Oid> & modifiedOids
+    )
+{
+    if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+    {   //  A modified User or Account may start or stop matching the filter
+        return modifiedOids.isEmpty();
+    }
+    bool showDisabled = Component::Settings::instance()->showDisabledUsersAndAccounts;
+    for (const auto & oid : modifiedOids)
+    {
+        if (QTreeWidgetItem * userItem =
+                findTreeWidgetItem<tt3::ws::User>(_ui->usersTreeWidget, oid))
+        {
+            tt3::ws::User user =
+                userItem->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::User>();
+            _UserModel userModel = _createUserModel(user);
+            if (!showDisabled)
+            {
+                _removeDisabledItems(userModel);
+                try
+                {
+                    if (!user->enabled(_credentials) &&  //  may throw
+                        userModel->accountModels.isEmpty())
+                    {   //  Must hide the User item
+                        return false;
+                    }
+                }
+                catch (const tt3::util::Exception & ex)
+                {   //  OOPS! Log & rebuild the whole tree
+                    qCritical() << ex;
+                    return false;
+                }
+            }
+            _refreshUserItem(userItem, userModel);
+            if (!isInNaturalOrder(userItem))
+            {   //  Real name change requires re-ordering
+                return false;
+            }
+        }
+        else if (QTreeWidgetItem * accountItem =
+                    findTreeWidgetItem<tt3::ws::Account>(_ui->usersTreeWidget, oid))
+        {
+            tt3::ws::Account account =
+                accountItem->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::Account>();
+            try
+            {
+                if (!showDisabled && !account->enabled(_credentials))   //  may throw
+                {   //  Must hide the Account item
+                    return false;
+                }
+            }
+            catch (const tt3::util::Exception & ex)
+            {   //  OOPS! Log & rebuild the whole tree
+                qCritical() << ex;
+                return false;
+            }
+            _refreshAccountItem(accountItem, _createAccountModel(account));
+            if (!isInNaturalOrder(accountItem))
+            {   //  Login change requires re-ordering
+                return false;
+            }
+        }
+        else
+        {   //  Not in the tree (e.g. a hidden disabled
+            //  User or Account) - can't patch it
+            return false;
+        }
+    }
+    return true;
+}
+
 //////////
 //  Implementation helpers
 tt3::ws::User UserManager::_currentUser()
@@ -936,24 +1018,46 @@ void UserManager::_workspaceClosed(tt3::ws::WorkspaceClosedNotification /*notifi
    requestRefresh();
 }
 
-void UserManager::_objectCreated(tt3::ws::ObjectCreatedNotification /*notification*/)
+void UserManager::_objectCreated(tt3::ws::ObjectCreatedNotification notification)
 {
-   requestRefresh();
+    if (notification.objectType() == tt3::ws::ObjectTypes::User::instance() ||
+        notification.objectType() == tt3::ws::ObjectTypes::Account::instance())
+    {   //  The tree structure changes
+        requestRefresh();
+    }
 }
 
-void UserManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification /*notification*/)
+void UserManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification notification)
 {
-   requestRefresh();
+    if (notification.objectType() == tt3::ws::ObjectTypes::User::instance() ||
+        notification.objectType() == tt3::ws::ObjectTypes::Account::instance())
+    {   //  The tree structure changes
+        requestRefresh();
+    }
 }
 
-void UserManager::_objectModified(tt3::ws::ObjectModifiedNotification /*notification*/)
+void UserManager::_objectModified(tt3::ws::ObjectModifiedNotification notification)
 {
-   requestRefresh();
+    if (notification.objectType() == tt3::ws::ObjectTypes::User::instance() ||
+        notification.objectType() == tt3::ws::ObjectTypes::Account::instance())
+    {   //  Only the corresponding item needs a refresh
+        if (_pendingRefresh.requestItemRefresh(notification.oid()))
+        {
+            emit refreshRequested();
+        }
+    }
 }
 
 void UserManager::_refreshRequested()
 {
-    refresh();
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
+    PendingRefresh pendingRefresh = _pendingRefresh.take();
+    _refresh(pendingRefresh.isFullRefresh() ?
+                nullptr :
+                &pendingRefresh.modifiedOids());
 }
 
 //  End of tt3-gui/UserManager.cpp
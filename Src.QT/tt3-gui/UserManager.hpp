@@ -116,6 +116,7 @@ namespace tt3::gui
         tt3::ws::Workspace      _workspace;
         tt3::ws::Credentials    _credentials;
         bool                    _refreshUnderway = false;
+        PendingRefresh          _pendingRefresh;
 
         //  View model
         struct _WorkspaceModelImpl;
@@ -177,8 +178,14 @@ namespace tt3::gui
                                     QTreeWidgetItem * accountItem,
                                     _AccountModel accountModel
                                );
+        bool                _refreshModifiedItems(
+                                    const QSet<tt3::ws::Oid> & modifiedOids
+                                );  //  false == must rebuild the whole tree
 
         //  Helpers
+        void                _refresh(
+                                    const QSet<tt3::ws::Oid> * modifiedOids
+                                );  //  nullptr == refresh all
         tt3::ws::User       _currentUser();
         void                _setCurrentUser(tt3::ws::User user);
         tt3::ws::Account    _currentAccount();
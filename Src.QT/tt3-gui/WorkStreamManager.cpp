@@ -23,6 +23,7 @@ namespace tt3::gui
     extern CurrentTheme theCurrentTheme;
     extern CurrentCredentials theCurrentCredentials;
     extern CurrentWorkspace theCurrentWorkspace;
+    extern RefreshScheduler theRefreshScheduler;
 }
 
 //////////
@@ -60,6 +61,7 @@ WorkStreamManager::WorkStreamManager(
             this,
             &WorkStreamManager::_refreshRequested,
             Qt::ConnectionType::QueuedConnection);
+    theRefreshScheduler.registerWidget(this);
 
     //  Start listening for change notifications
     //  on the currently "viewed" Workspace
@@ -105,6 +107,13 @@ void WorkStreamManager::setCredentials(const tt3::ws::Credentials & credentials)
 }
 
 void WorkStreamManager::refresh()
+{
+    _refresh(nullptr);
+}
+
+void WorkStreamManager::_refresh(
+        const QSet<tt3::ws::Oid> * modifiedOids
+    )
 {
     static const QIcon viewWorkStreamIcon(":/tt3-gui/Resources/Images/Actions/ViewWorkStreamLarge.png");
     static const QIcon modifyWorkStreamIcon(":/tt3-gui/Resources/Images/Actions/ModifyWorkStreamLarge.png");
@@ -130,6 +139,8 @@ void WorkStreamManager::refresh()
             return;
         }
 
+        bool refreshItemsOnly = canRefreshItemsOnly(_ui->workStreamsTreeWidget, modifiedOids);
+
         //  Otherwise some controls are always enabled...
         _ui->filterLabel->setEnabled(true);
         _ui->filterLineEdit->setEnabled(true);
@@ -137,16 +148,20 @@ void WorkStreamManager::refresh()
 
         //  ...while others are enabled based on current
         //  selection and permissions granted by Credentials
-        _WorkspaceModel workspaceModel =
-            _createWorkspaceModel(_workspace, _credentials, _decorations);
-        QString filter = _ui->filterLineEdit->text().trimmed();
-        if (!filter.isEmpty())
-        {
-            _filterItems(workspaceModel, filter, _decorations);
+        if (!refreshItemsOnly ||
+            !_refreshModifiedItems(*modifiedOids))
+        {   //  Must rebuild the whole tree
+            _WorkspaceModel workspaceModel =
+                _createWorkspaceModel(_workspace, _credentials, _decorations);
+            QString filter = _ui->filterLineEdit->text().trimmed();
+            if (!filter.isEmpty())
+            {
+                _filterItems(workspaceModel, filter, _decorations);
+            }
+            _refreshWorkspaceTree(
+                _ui->workStreamsTreeWidget,
+                workspaceModel);
         }
-        _refreshWorkspaceTree(
-            _ui->workStreamsTreeWidget,
-            workspaceModel);
 
         tt3::ws::WorkStream selectedWorkStream = _selectedWorkStream();
         bool readOnly = _workspace->isReadOnly();
@@ -209,7 +224,10 @@ void WorkStreamManager::refresh()
 
 void WorkStreamManager::requestRefresh()
 {
-    emit refreshRequested();
+    if (_pendingRefresh.requestFullRefresh())
+    {
+        emit refreshRequested();
+    }
 }
 
 //////////
@@ -228,13 +246,9 @@ auto WorkStreamManager::_createWorkspaceModel(
             workspaceModel->workStreamModels.append(
                 _createWorkStreamModel(workStream, credentials, decorations));
         }
-        std::sort(
-            workspaceModel->workStreamModels.begin(),
-            workspaceModel->workStreamModels.end(),
-            [&](auto a, auto b)
-            {
-                return tt3::util::NaturalStringOrder::less(a->text, b->text);
-            });
+        sortItemModels(
+            workspaceModel->workStreamModels,
+            [](const auto & m) { return m->workStream; });
     }
     catch (const tt3::util::Exception & ex)
     {
@@ -343,6 +357,38 @@ void WorkStreamManager::_refreshWorkStreamItem(
     Q_ASSERT(workStreamItem->childCount() == 0);
 }
 
+bool WorkStreamManager::_refreshModifiedItems(
+        const QSet<tt3::ws::Oid> & modifiedOids
+    )
+{
+    if (!_ui->filterLineEdit->text().trimmed().isEmpty())
+    {   //  A modified WorkStream may start or stop matching the filter
+        return modifiedOids.isEmpty();
+    }
+    for (const auto & oid : modifiedOids)
+    {
+        QTreeWidgetItem * workStreamItem =
+            findTreeWidgetItem<tt3::ws::WorkStream>(
+                _ui->workStreamsTreeWidget,
+                oid);
+        if (workStreamItem == nullptr)
+        {   //  OOPS! Not in the tree - can't patch it
+            return false;
+        }
+        _refreshWorkStreamItem(
+            workStreamItem,
+            _createWorkStreamModel(
+                workStreamItem->data(0, Qt::ItemDataRole::UserRole).value<tt3::ws::WorkStream>(),
+                _credentials,
+                _decorations));
+        if (!isInNaturalOrder(workStreamItem))
+        {   //  Display name change requires re-ordering
+            return false;
+        }
+    }
+    return true;
+}
+
 //////////
 //  Implementation helpers
 tt3::ws::WorkStream WorkStreamManager::_selectedWorkStream()
@@ -445,6 +491,18 @@ void WorkStreamManager::_applyCurrentLocale()
     refresh();
 }
 
+void WorkStreamManager::_objectCreatedOrDestroyed(
+        tt3::ws::ObjectType * objectType
+    )
+{
+    if (_pendingRefresh.requestRefreshOnObjectCreatedOrDestroyed(
+            objectType,
+            tt3::ws::ObjectTypes::WorkStream::instance()))
+    {
+        emit refreshRequested();
+    }
+}
+
 //////////
 //  Signal handlers
 void WorkStreamManager::_currentThemeChanged(ITheme *, ITheme *)
@@ -573,24 +631,36 @@ void WorkStreamManager::_workspaceClosed(tt3::ws::WorkspaceClosedNotification /*
     requestRefresh();
 }
 
-void WorkStreamManager::_objectCreated(tt3::ws::ObjectCreatedNotification /*notification*/)
+void WorkStreamManager::_objectCreated(tt3::ws::ObjectCreatedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void WorkStreamManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification /*notification*/)
+void WorkStreamManager::_objectDestroyed(tt3::ws::ObjectDestroyedNotification notification)
 {
-    requestRefresh();
+    _objectCreatedOrDestroyed(notification.objectType());
 }
 
-void WorkStreamManager::_objectModified(tt3::ws::ObjectModifiedNotification /*notification*/)
+void WorkStreamManager::_objectModified(tt3::ws::ObjectModifiedNotification notification)
 {
-    requestRefresh();
+    if (_pendingRefresh.requestRefreshOnObjectModified(
+            notification,
+            tt3::ws::ObjectTypes::WorkStream::instance()))
+    {
+        emit refreshRequested();
+    }
 }
 
 void WorkStreamManager::_refreshRequested()
 {
-    refresh();
+    if (theRefreshScheduler.deferRefresh(this))
+    {   //  Hidden - will catch up once shown
+        return;
+    }
+    PendingRefresh pendingRefresh = _pendingRefresh.take();
+    _refresh(pendingRefresh.isFullRefresh() ?
+                nullptr :
+                &pendingRefresh.modifiedOids());
 }
 
 //  End of tt3-gui/WorkStreamManager.cpp
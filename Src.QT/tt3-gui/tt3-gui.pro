@@ -108,6 +108,7 @@ SOURCES += \
     QuickReportManager.cpp \
     QuickReportView.cpp \
     QuickReportsDialog.cpp \
+    RefreshScheduler.cpp \
     RestartRequiredDialog.cpp \
     SelectBeneficiariesDialog.cpp \
     SelectPrivateTaskParentDialog.cpp \
@@ -221,6 +222,7 @@ HEADERS += \
     QuickReportBrowser.hpp \
     QuickReportView.hpp \
     QuickReportsDialog.hpp \
+    RefreshScheduler.hpp \
     RestartRequiredDialog.hpp \
     SelectBeneficiariesDialog.hpp \
     SelectPrivateTaskParentDialog.hpp \
@@ -61,6 +61,14 @@ Component::ISubsystem * Component::subsystem() const
     return tt3::util::StandardSubsystems::Utility::instance();
 }
 
+Component::Mnemonics Component::dependencies() const
+{
+    return Mnemonics
+        {
+            M(tt3-util)
+        };
+}
+
 Component::Resources * Component::resources() const
 {
     return Resources::instance();
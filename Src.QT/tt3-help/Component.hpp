@@ -53,6 +53,7 @@ namespace tt3::help
         virtual QVersionNumber  version() const override;
         virtual QString         buildNumber() const override;
         virtual ISubsystem *    subsystem() const override;
+        virtual Mnemonics       dependencies() const override;
         virtual Resources *     resources() const override;
         virtual Settings *      settings() override;
         virtual const Settings *settings() const override;
@@ -61,6 +61,18 @@ Component::ISubsystem * Component::subsystem() const
     return tt3::util::StandardSubsystems::Reporting::instance();
 }
 
+Component::Mnemonics Component::dependencies() const
+{
+    return Mnemonics
+        {
+            M(tt3-report),
+            M(tt3-gui),
+            M(tt3-ws),
+            M(tt3-db-api),
+            M(tt3-util)
+        };
+}
+
 Component::Resources * Component::resources() const
 {
     return Resources::instance();
@@ -108,7 +120,8 @@ Component::Settings::Settings()
         includeMonthlyData(this, M(IncludeMonthlyData), true),
         includeYearlyData(this, M(IncludeYearlyData), true),
         houesPerDay(this, M(HouesPerDay), 8.0f),
-        weekStart(this, M(WeekStart), Qt::DayOfWeek::Monday)
+        weekStart(this, M(WeekStart), Qt::DayOfWeek::Monday),
+        parallelDataCollection(this, M(ParallelDataCollection), false)
 {
 }
 
@@ -62,6 +62,11 @@ namespace tt3::report::worksummary
             tt3::util::Setting<bool> includeYearlyData;
             tt3::util::Setting<float> houesPerDay;
             tt3::util::Setting<Qt::DayOfWeek> weekStart;
+
+            /// \brief
+            ///     True to collect report data for different
+            ///     Accounts concurrently on a pool of threads.
+            tt3::util::Setting<bool> parallelDataCollection;
         };
 
         //////////
@@ -74,6 +79,7 @@ namespace tt3::report::worksummary
         virtual QVersionNumber  version() const override;
         virtual QString         buildNumber() const override;
         virtual ISubsystem *    subsystem() const override;
+        virtual Mnemonics       dependencies() const override;
         virtual Resources *     resources() const override;
         virtual Settings *      settings() override;
         virtual const Settings *settings() const override;
@@ -47,4 +47,68 @@ ReportConfiguration::ReportConfiguration(
 {
 }
 
+//////////
+//  Operations
+void ReportConfiguration::calculateDates(
+        DateRange dateRange,
+        Qt::DayOfWeek weekStart,
+        QDate & startDate,
+        QDate & endDate
+    )
+{
+    QDate today = QDateTime::currentDateTime().date();
+    QDate thisWeekStart = today;
+    while (thisWeekStart.dayOfWeek() != weekStart)
+    {
+        thisWeekStart = thisWeekStart.addDays(-1);
+    }
+    QDate thisMonthStart(today.year(), today.month(), 1);
+
+    switch (dateRange)
+    {
+        case DateRange::Today:
+            startDate = endDate = today;
+            break;
+        case DateRange::Yesterday:
+            startDate = endDate = today.addDays(-1);
+            break;
+        case DateRange::LastWeek:
+            startDate = thisWeekStart.addDays(-7);
+            endDate = thisWeekStart.addDays(-1);
+            break;
+        case DateRange::CurrentWeek:
+            startDate = thisWeekStart;
+            endDate = today;
+            break;
+        case DateRange::CurrentMonth:
+            startDate = thisMonthStart;
+            endDate = today;
+            break;
+        case DateRange::CurrentYear:
+            startDate = QDate(today.year(), 1, 1);
+            endDate = today;
+            break;
+        case DateRange::WeekToDate:
+            startDate = today.addDays(-6);
+            endDate = today;
+            break;
+        case DateRange::MonthToDate:
+            startDate = today.addMonths(-1).addDays(1);
+            endDate = today;
+            break;
+        case DateRange::YearToDate:
+            startDate = today.addYears(-1).addDays(1);
+            endDate = today;
+            break;
+        case DateRange::Custom:
+            endDate = std::max(startDate, endDate); //  ...for sanity
+            break;
+        default:
+            Q_ASSERT(false);
+            //  Be defensive in release mode
+            startDate = endDate = today;
+            break;
+    }
+}
+
 //  End of tt3-report-worksummary/ReportConfiguration.cpp
@@ -70,6 +70,25 @@ namespace tt3::report::worksummary
         //////////
         //  Operations
     public:
+        /// \brief
+        ///     Calculates the report start/end dates for a date range.
+        /// \param dateRange
+        ///     The date range to calculate the dates for.
+        /// \param weekStart
+        ///     The first day of the week.
+        /// \param startDate
+        ///     On entry, the custom start date; on return, the
+        ///     local date to start from, inclusive.
+        /// \param endDate
+        ///     On entry, the custom end date; on return, the
+        ///     local date to end at, inclusive.
+        static void     calculateDates(
+                                DateRange dateRange,
+                                Qt::DayOfWeek weekStart,
+                                QDate & startDate,
+                                QDate & endDate
+                            );
+
         tt3::ws::Users  users() const { return _users; }
         QDate           startDate() const { return _startDate; }
         QDate           endDate() const { return _endDate; }
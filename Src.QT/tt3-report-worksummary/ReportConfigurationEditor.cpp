@@ -195,61 +195,13 @@ auto ReportConfigurationEditor::createReportConfiguration(
     {   //  In case of errors, use defaults
         return new ReportConfiguration();
     }
-    QDate today = QDateTime::currentDateTime().date();
-    QDate thisWeekStart = today;
-    while (thisWeekStart.dayOfWeek() != _selectedWeekStart())
-    {
-        thisWeekStart = thisWeekStart.addDays(-1);
-    }
-    QDate thisMonthStart(today.year(), today.month(), 1);
-
-    QDate startDate, endDate;
-    switch (_selectedDateRange())
-    {
-        case DateRange::Today:
-            startDate = endDate = today;
-            break;
-        case DateRange::Yesterday:
-            startDate = endDate = today.addDays(-1);
-            break;
-        case DateRange::LastWeek:
-            startDate = thisWeekStart.addDays(-7);
-            endDate = thisWeekStart.addDays(-1);
-            break;
-        case DateRange::CurrentWeek:
-            startDate = thisWeekStart;
-            endDate = today;
-            break;
-        case DateRange::CurrentMonth:
-            startDate = thisMonthStart;
-            endDate = today;
-            break;
-        case DateRange::CurrentYear:
-            startDate = QDate(today.year(), 1, 1);
-            endDate = today;
-            break;
-        case DateRange::WeekToDate:
-            startDate = today.addDays(-6);
-            endDate = today;
-            break;
-        case DateRange::MonthToDate:
-            startDate = today.addMonths(-1).addDays(1);
-            endDate = today;
-            break;
-        case DateRange::YearToDate:
-            startDate = today.addYears(-1).addDays(1);
-            endDate = today;
-            break;
-        case DateRange::Custom:
-            startDate = _ui->fromDateEdit->date();
-            endDate = std::max(startDate, _ui->toDateEdit->date()); //  ...for sanity
-            break;
-        default:
-            Q_ASSERT(false);
-            //  Be defensive in release mode
-            startDate = endDate = today;
-            break;
-    }
+    QDate startDate = _ui->fromDateEdit->date(),
+          endDate = _ui->toDateEdit->date();
+    ReportConfiguration::calculateDates(
+        _selectedDateRange(),
+        _selectedWeekStart(),
+        startDate,
+        endDate);
     return new ReportConfiguration(
         _users,
         startDate,
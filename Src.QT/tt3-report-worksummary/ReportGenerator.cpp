@@ -51,23 +51,22 @@ auto ReportGenerator::generateReport() -> Report *
     //  Prepare to [re]generate the report
     _prepareAccounts();
     _prepareDateRanges();
-    _columns.clear();   //  will be filled as report is generated
-    _totalSteps = 1; //  report totals
+    _totalSteps = 1 + _accounts.size(); //  report totals + collect Works of each Account
     if (_configuration.includeDailyData())
     {
-        _totalSteps += _dailyRanges.size();
+        _totalSteps++;
     }
     if (_configuration.includeWeeklyData())
     {
-        _totalSteps += _weeklyRanges.size();
+        _totalSteps++;
     }
     if (_configuration.includeMonthlyData())
     {
-        _totalSteps += _monthlyRanges.size();
+        _totalSteps++;
     }
     if (_configuration.includeYearlyData())
     {
-        _totalSteps += _yearlyRanges.size();
+        _totalSteps++;
     }
     _completedSteps = 0;
 
@@ -80,38 +79,39 @@ auto ReportGenerator::generateReport() -> Report *
     _analyze(report.get());
 
     //  Go!
+    _collectData();
     _generatePreface();
     if (_configuration.includeDailyData())
     {
-        _collectData(_dailyRanges);
         _generateReportTable(
             rr.string(RID(DailyBreakdownChapter)),
             report.get(),
-            _dailyRanges);
+            _dailyRanges,
+            _aggregation.dailyEfforts);
     }
     if (_configuration.includeWeeklyData())
     {
-        _collectData(_weeklyRanges);
         _generateReportTable(
             rr.string(RID(WeeklyBreakdownChapter)),
             report.get(),
-            _weeklyRanges);
+            _weeklyRanges,
+            _aggregation.weeklyEfforts);
     }
     if (_configuration.includeMonthlyData())
     {
-        _collectData(_monthlyRanges);
         _generateReportTable(
             rr.string(RID(MonthlyBreakdownChapter)),
             report.get(),
-            _monthlyRanges);
+            _monthlyRanges,
+            _aggregation.monthlyEfforts);
     }
     if (_configuration.includeYearlyData())
     {
-        _collectData(_yearlyRanges);
         _generateReportTable(
             rr.string(RID(YearlyBreakdownChapter)),
             report.get(),
-            _yearlyRanges);
+            _yearlyRanges,
+            _aggregation.yearlyEfforts);
     }
 
     //  All done - pass Report ownership out
@@ -373,21 +373,26 @@ void ReportGenerator::_prepareDateRanges()
     _totalRange = _DateRange(_configuration.startDate(), _configuration.endDate());
 }
 
-void ReportGenerator::_collectData(
-        const _DateRanges & dateRanges
-    )
+void ReportGenerator::_collectData()
 {
-    _columns.clear();
-    _efforts.clear();
-    for (const auto & account : std::as_const(_accounts))
-    {
-        for (const auto & dateRange : dateRanges)
-        {   //  Process all works in this date range...
-            for (const auto & work :
-                 account->works(_credentials, dateRange.startUtc(), dateRange.endUtc()))
-            {
-                _recordWork(dateRange, work);
-            }
+    tt3::util::ResourceReader rr(Component::Resources::instance(), RSID(ReportGenerator));
+
+    //  Resolve this up front - worker threads never touch resources
+    _otherColumnName = rr.string(RID(OtherColumn));
+
+    _aggregation = _Aggregation();
+    _prepareAggregation(_aggregation);
+    if (Component::Settings::instance()->parallelDataCollection &&
+        _accounts.size() > 1)
+    {
+        _collectDataInParallel();   //  may throw
+    }
+    else
+    {   //  All breakdowns cover the same total range, so each
+        //  Account's Works need to be fetched just once
+        for (const auto & account : std::as_const(_accounts))
+        {   //  Process all works of this account...
+            _collectAccountData(_aggregation, account);
             //  ...and mark 1 step completed
             _completedSteps++;
             if (_progressListener != nullptr)
@@ -397,145 +402,319 @@ void ReportGenerator::_collectData(
         }
     }
 
-    //  Columns must be sorted by name
+    //  Columns must be sorted by name - and columns with equal
+    //  names by OID, as the order in which they were discovered
+    //  depends on the order in which the Accounts were processed
+    _columns = _aggregation.columns;
     std::sort(
         _columns.begin(),
         _columns.end(),
         [](auto a, auto b)
         {
-            return tt3::util::NaturalStringOrder::less(a->name, b->name);
+            if (tt3::util::NaturalStringOrder::less(a->name, b->name))
+            {
+                return true;
+            }
+            if (tt3::util::NaturalStringOrder::less(b->name, a->name))
+            {
+                return false;
+            }
+            return a->oid < b->oid;
         });
     //  ...except we want the "no activity type" column LAST!
-    for (int i = 0; i < _columns.size(); i++)
+    if (auto col = _aggregation.activityTypeColumns.value(nullptr))
     {
-        if (auto col =
-            std::dynamic_pointer_cast<_ActivityTypeColumnImpl>(_columns[i]))
+        _columns.removeOne(col);
+        _columns.append(col);
+    }
+}
+
+void ReportGenerator::_collectDataInParallel()
+{
+    //  Accounts are split into contiguous shards, each
+    //  aggregated on its own thread; shards are then
+    //  merged in their original order, so the outcome
+    //  does not depend on thread scheduling
+    qsizetype numShards =
+        std::min<qsizetype>(
+            std::max(QThread::idealThreadCount(), 1),
+            _accounts.size());
+    QList<tt3::ws::Account> accounts(_accounts.cbegin(), _accounts.cend());
+    QList<_Aggregation> shards(numShards);
+    QList<std::exception_ptr> errors(numShards);
+    std::atomic<qsizetype> completedAccounts = 0;
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(int(numShards));
+    for (qsizetype shard = 0; shard < numShards; shard++)
+    {
+        qsizetype from = accounts.size() * shard / numShards;
+        qsizetype to = accounts.size() * (shard + 1) / numShards;
+        threadPool.start(
+            [&, shard, from, to]()
+            {
+                try
+                {
+                    _prepareAggregation(shards[shard]);
+                    for (qsizetype i = from; i < to; i++)
+                    {
+                        _collectAccountData(shards[shard], accounts[i]);
+                        completedAccounts++;
+                    }
+                }
+                catch (...)
+                {   //  Re-thrown on the calling thread
+                    errors[shard] = std::current_exception();
+                }
+            });
+    }
+
+    //  Progress is only ever reported from the calling thread
+    qsizetype initiallyCompletedSteps = _completedSteps;
+    for (bool done = false; !done; )
+    {
+        done = threadPool.waitForDone(100);
+        _completedSteps = initiallyCompletedSteps + completedAccounts;
+        if (_progressListener != nullptr)
         {
-            if (col->activityType == nullptr)
-            {   //  This one!
-                _columns.remove(i);
-                _columns.append(col);
-                break;
-            }
+            _progressListener(float(_completedSteps) / float(_totalSteps));
+        }
+    }
+
+    for (qsizetype shard = 0; shard < numShards; shard++)
+    {
+        if (errors[shard] != nullptr)
+        {   //  OOPS! Report the first failure
+            std::rethrow_exception(errors[shard]);
         }
     }
+    for (const auto & shard : std::as_const(shards))
+    {
+        _mergeAggregation(_aggregation, shard);
+    }
+}
+
+void ReportGenerator::_prepareAggregation(
+        _Aggregation & aggregation
+    )
+{   //  Only the enabled breakdowns get rows; the rest stay
+    //  empty and are skipped by _recordEffort()
+    if (_configuration.includeDailyData())
+    {
+        aggregation.dailyEfforts.resize(_dailyRanges.size());
+    }
+    if (_configuration.includeWeeklyData())
+    {
+        aggregation.weeklyEfforts.resize(_weeklyRanges.size());
+    }
+    if (_configuration.includeMonthlyData())
+    {
+        aggregation.monthlyEfforts.resize(_monthlyRanges.size());
+    }
+    if (_configuration.includeYearlyData())
+    {
+        aggregation.yearlyEfforts.resize(_yearlyRanges.size());
+    }
+}
+
+void ReportGenerator::_collectAccountData(
+        _Aggregation & aggregation,
+        tt3::ws::Account account
+    )
+{   //  Bulk query checks access rights once, not per Work
+    for (const auto & workRecord :
+         account->workRecords(_credentials, _totalRange.startUtc(), _totalRange.endUtc()))
+    {
+        _recordWork(aggregation, workRecord);
+    }
 }
 
 void ReportGenerator::_recordWork(
-        const _DateRange & dateRange,
-        tt3::ws::Work work
+        _Aggregation & aggregation,
+        const tt3::ws::WorkRecord & workRecord
     )
 {
     QDateTime from =
         std::max(
-            dateRange.start(),
-            work->startedAt(_credentials).toLocalTime());
+            _totalRange.start(),
+            workRecord.startedAt.toLocalTime());
     QDateTime to =
         std::min(
-            dateRange.end(),
-            work->finishedAt(_credentials).toLocalTime());
-    Q_ASSERT(from <= to);
+            _totalRange.end(),
+            workRecord.finishedAt.toLocalTime());
+    if (from > to)
+    {   //  Be defensive - nothing to record
+        return;
+    }
     _Column column;
     switch (_configuration.grouping())
     {
         case Grouping::ByActivityType:
-            column = _getColumn(work->activity(_credentials)->activityType(_credentials));
+            column = _getColumn(aggregation, workRecord.activity.activityType);
             break;
         case Grouping::ByActivity:
-            column = _getColumn(work->activity(_credentials));
+            column = _getColumn(aggregation, workRecord.activity.activity);
             break;
         default:
             Q_ASSERT(false);
             //  Be defensive in release mode
-            column = _getColumn(work->activity(_credentials)->activityType(_credentials));
+            column = _getColumn(aggregation, workRecord.activity.activityType);
             break;
     }
-    //  Prepare & record duration
-    qint64 durationMs = from.msecsTo(to);
-    _recordEffort(dateRange, column, durationMs);
+    //  Attribute the Work to all enabled breakdowns at once
+    _recordEffort(_dailyRanges, aggregation.dailyEfforts, column, from, to);
+    _recordEffort(_weeklyRanges, aggregation.weeklyEfforts, column, from, to);
+    _recordEffort(_monthlyRanges, aggregation.monthlyEfforts, column, from, to);
+    _recordEffort(_yearlyRanges, aggregation.yearlyEfforts, column, from, to);
 }
 
 auto ReportGenerator::_getColumn(
+        _Aggregation & aggregation,
         tt3::ws::ActivityType activityType
     ) -> _Column
-{
-    tt3::util::ResourceReader rr(Component::Resources::instance(), RSID(ReportGenerator));
-
-    //  Will one of the existing columns do ?
-    for (const auto & column : std::as_const(_columns))
-    {
-        if (auto col =
-            std::dynamic_pointer_cast<_ActivityTypeColumnImpl>(column))
-        {
-            if (col->activityType == activityType)
-            {   //  Yes!
-                return col;
-            }
-        }
+{   //  Will one of the existing columns do ?
+    if (auto column = aggregation.activityTypeColumns.value(activityType))
+    {   //  Yes!
+        return column;
     }
     //  Need a new column
     auto column =
         std::make_shared<_ActivityTypeColumnImpl>(
             (activityType != nullptr) ?
                 activityType->displayName(_credentials) :
-                rr.string(RID(OtherColumn)),
+                _otherColumnName,
+            aggregation.columns.size(),
             activityType);
-    _columns.append(column);
+    aggregation.columns.append(column);
+    aggregation.activityTypeColumns.insert(activityType, column);
     return column;
 }
 
 auto ReportGenerator::_getColumn(
+        _Aggregation & aggregation,
         tt3::ws::Activity activity
     ) -> _Column
 {   //  Will one of the existing columns do ?
-    for (const auto & column : std::as_const(_columns))
-    {
-        if (auto col =
-            std::dynamic_pointer_cast<_ActivityColumnImpl>(column))
-        {
-            if (col->activity == activity)
-            {   //  Yes!
-                return col;
-            }
-        }
+    if (auto column = aggregation.activityColumns.value(activity))
+    {   //  Yes!
+        return column;
     }
     //  Need a new column
     auto column =
         std::make_shared<_ActivityColumnImpl>(
             activity->displayName(_credentials),
+            aggregation.columns.size(),
             activity);
-    _columns.append(column);
+    aggregation.columns.append(column);
+    aggregation.activityColumns.insert(activity, column);
     return column;
 }
 
-void ReportGenerator::_recordEffort(
-        const _DateRange & dateRange,
-        _Column column,
-        qint64 durationMs
+void ReportGenerator::_mergeAggregation(
+        _Aggregation & into,
+        const _Aggregation & from
     )
 {
-    _EffortKey key(dateRange, column);
-    if (_efforts.contains(key))
-    {
-        _efforts[key] += durationMs;
+    for (const auto & fromColumn : from.columns)
+    {   //  Find (or create) the matching column...
+        _Column intoColumn;
+        if (auto activityTypeColumn =
+            std::dynamic_pointer_cast<_ActivityTypeColumnImpl>(fromColumn))
+        {
+            intoColumn = _getColumn(into, activityTypeColumn->activityType);
+        }
+        else if (auto activityColumn =
+                 std::dynamic_pointer_cast<_ActivityColumnImpl>(fromColumn))
+        {
+            intoColumn = _getColumn(into, activityColumn->activity);
+        }
+        else
+        {   //  OOPS! Can't happen
+            Q_ASSERT(false);
+            continue;
+        }
+        //  ...and add up the efforts
+        _mergeEfforts(into.dailyEfforts, intoColumn, from.dailyEfforts, fromColumn);
+        _mergeEfforts(into.weeklyEfforts, intoColumn, from.weeklyEfforts, fromColumn);
+        _mergeEfforts(into.monthlyEfforts, intoColumn, from.monthlyEfforts, fromColumn);
+        _mergeEfforts(into.yearlyEfforts, intoColumn, from.yearlyEfforts, fromColumn);
     }
-    else
+}
+
+void ReportGenerator::_mergeEfforts(
+        _Efforts & into,
+        _Column intoColumn,
+        const _Efforts & from,
+        _Column fromColumn
+    )
+{
+    Q_ASSERT(into.size() == from.size());
+
+    for (qsizetype i = 0; i < from.size(); i++)
     {
-        _efforts[key] = durationMs;
+        qint64 effortMs = _getEffort(from, i, fromColumn);
+        if (effortMs != 0)
+        {
+            _EffortRow & row = into[i];
+            if (row.size() <= intoColumn->index)
+            {
+                row.resize(intoColumn->index + 1, 0);
+            }
+            row[intoColumn->index] += effortMs;
+        }
+    }
+}
+
+void ReportGenerator::_recordEffort(
+        const _DateRanges & dateRanges,
+        _Efforts & efforts,
+        _Column column,
+        const QDateTime & from,
+        const QDateTime & to
+    )
+{
+    if (efforts.isEmpty())
+    {   //  This breakdown is not reported
+        return;
+    }
+    Q_ASSERT(efforts.size() == dateRanges.size());
+
+    //  Date ranges are in ascending order and never
+    //  intersect - find the first one the Work touches...
+    QDate fromDate = from.date();
+    auto it =
+        std::partition_point(
+            dateRanges.cbegin(),
+            dateRanges.cend(),
+            [&](const auto & dateRange)
+            {
+                return dateRange.endDate < fromDate;
+            });
+    //  ...and split the Work between it and its successors
+    for (qsizetype i = it - dateRanges.cbegin();
+         i < dateRanges.size() && dateRanges[i].start() <= to;
+         i++)
+    {
+        qint64 durationMs =
+            std::max(from, dateRanges[i].start())
+                .msecsTo(std::min(to, dateRanges[i].end()));
+        _EffortRow & row = efforts[i];
+        if (row.size() <= column->index)
+        {
+            row.resize(column->index + 1, 0);
+        }
+        row[column->index] += durationMs;
     }
 }
 
 qint64 ReportGenerator::_getEffort(
-        const _DateRange & dateRange,
+        const _Efforts & efforts,
+        qsizetype dateRangeIndex,
         _Column column
     )
 {
-    _EffortKey key(dateRange, column);
-    if (_efforts.contains(key))
-    {
-        return _efforts[key];
-    }
-    return 0;
+    const _EffortRow & row = efforts[dateRangeIndex];
+    return (column->index < row.size()) ? row[column->index] : 0;
 }
 
 void ReportGenerator::_generatePreface()
@@ -552,9 +731,12 @@ void ReportGenerator::_generatePreface()
         ->createParagraph(
             reportTemplate->paragraphStyle(IParagraphStyle::DefaultStyleName))
         ->createText(rr.string(RID(CreatorMessage)));
+    //  The creator is whoever has started the report session;
+    //  the UI's "current" credentials are not for a report
+    //  worker thread to read
     auto currentUser =
-        _workspace->login(gui::theCurrentCredentials)
-                  ->user(gui::theCurrentCredentials);
+        _workspace->reportOwner(_credentials)   //  may throw
+                  ->user(_credentials);         //  may throw
     _bodySection
         ->createList(
             reportTemplate->listStyle(IListStyle::DefaultStyleName))
@@ -622,7 +804,8 @@ void ReportGenerator::_generatePreface()
 void ReportGenerator::_generateReportTable(
         const QString & heading,
         Report * report,
-        const _DateRanges & dateRanges
+        const _DateRanges & dateRanges,
+        const _Efforts & efforts
     )
 {
     tt3::util::ResourceReader rr(Component::Resources::instance(), RSID(ReportGenerator));
@@ -675,7 +858,7 @@ void ReportGenerator::_generateReportTable(
         bool skipRow = true;
         for (int j = 0; j < _columns.size(); j++)
         {
-            if (_getEffort(dateRange, _columns[j]) > 0)
+            if (_getEffort(efforts, i, _columns[j]) > 0)
             {
                 skipRow = false;
             }
@@ -709,7 +892,7 @@ void ReportGenerator::_generateReportTable(
         qint64 rowEffortMs = 0;
         for (int j = 0; j < _columns.size(); j++)
         {
-            auto effortMs = _getEffort(dateRange, _columns[j]);
+            auto effortMs = _getEffort(efforts, i, _columns[j]);
             rowEffortMs += effortMs;
             totalEffortMs += effortMs;
             table
@@ -745,9 +928,9 @@ void ReportGenerator::_generateReportTable(
     for (int i = 0; i < _columns.size(); i++)
     {
         qint64 columnEfforsMs = 0;
-        for (auto dateRange : dateRanges)
+        for (qsizetype j = 0; j < dateRanges.size(); j++)
         {
-            columnEfforsMs += _getEffort(dateRange, _columns[i]);
+            columnEfforsMs += _getEffort(efforts, j, _columns[i]);
         }
         table
             ->createCell(
@@ -766,6 +949,13 @@ void ReportGenerator::_generateReportTable(
                 ITableCellStyle::HeadingStyleName))
         ->createParagraph()
         ->createText(_formatEffort(totalEffortMs));
+
+    //  Mark 1 step completed
+    _completedSteps++;
+    if (_progressListener != nullptr)
+    {
+        _progressListener(float(_completedSteps) / float(_totalSteps));
+    }
 }
 
 QString ReportGenerator::_formatEffort(qint64 effortMs)
@@ -120,11 +120,13 @@ namespace tt3::report::worksummary
         //  Column definitions
         struct _ColumnImpl
         {
-            _ColumnImpl(const QString & nm)
-                :   name(nm) {}
+            _ColumnImpl(const QString & nm, qsizetype ndx, const tt3::ws::Oid & o)
+                :   name(nm), index(ndx), oid(o) {}
             virtual ~_ColumnImpl() = default;
 
             QString         name;   //  as visible in the report
+            qsizetype       index;  //  of this column's slot in effort rows
+            tt3::ws::Oid    oid;    //  of the object represented; orders equal names
         };
         using _Column = std::shared_ptr<_ColumnImpl>;
         using _Columns = QList<_Column>;
@@ -133,8 +135,10 @@ namespace tt3::report::worksummary
         {
             _ActivityTypeColumnImpl(
                     const QString & nm,
+                    qsizetype ndx,
                     tt3::ws::ActivityType at
-                ) : _ColumnImpl(nm), activityType(at) {}
+                ) : _ColumnImpl(nm, ndx, (at != nullptr) ? at->oid() : tt3::ws::Oid::Invalid),
+                    activityType(at) {}
 
             tt3::ws::ActivityType   activityType;
         };
@@ -143,36 +147,38 @@ namespace tt3::report::worksummary
         {
             _ActivityColumnImpl(
                     const QString & nm,
+                    qsizetype ndx,
                     tt3::ws::Activity a
-                ) : _ColumnImpl(nm), activity(a) {}
+                ) : _ColumnImpl(nm, ndx, (a != nullptr) ? a->oid() : tt3::ws::Oid::Invalid),
+                    activity(a) {}
 
             tt3::ws::Activity   activity;   //  nullptr == not assigned
         };
 
-        _Columns    _columns;   //  in display order, "Totls" column not included
-
-        //  Efforts recorded for a period
-        struct _EffortKey
-        {
-            _EffortKey(const _DateRange & dr,
-                       _Column col)
-                :   dateRange(dr), column(col) {}
-
-            _DateRange  dateRange;
-            _Column     column;
-
-        };
-        struct _Less
+        //  Efforts recorded for a series of date ranges, as
+        //  efforts[dateRangeIndex][column->index]. Rows grow
+        //  lazily as new columns are discovered, so a missing
+        //  trailing slot means "no effort".
+        using _EffortRow = QList<qint64>;   //  values == msecs
+        using _Efforts = QList<_EffortRow>;
+
+        //  Columns and efforts collected from some or all of
+        //  the _accounts; column indexes are local to the
+        //  aggregation that has created the column
+        struct _Aggregation
         {
-            bool operator()(const _EffortKey & a, const _EffortKey & b) const
-            {   //  We need arbitrary strong sort to use it as a QMap key.
-                //  Note, that date ranges in a single series never intersect
-                return a.dateRange.startDate < b.dateRange.startDate ||
-                       (a.dateRange.startDate == b.dateRange.startDate &&
-                        a.column.get() < b.column.get());
-            }
+            _Columns    columns;    //  in order of discovery
+            QHash<tt3::ws::ActivityType, _Column>   activityTypeColumns;
+            QHash<tt3::ws::Activity, _Column>   activityColumns;
+            _Efforts    dailyEfforts;
+            _Efforts    weeklyEfforts;
+            _Efforts    monthlyEfforts;
+            _Efforts    yearlyEfforts;
         };
-        std::map<_EffortKey, qint64, _Less> _efforts;   //  values == msecs
+
+        _Aggregation    _aggregation;   //  of all _accounts
+        _Columns    _columns;   //  in display order, "Totls" column not included
+        QString     _otherColumnName;
 
         //////////
         //  Helpers
@@ -191,33 +197,55 @@ namespace tt3::report::worksummary
         void        _analyze(ReportTableCell * cell);
         void        _prepareAccounts();
         void        _prepareDateRanges();
-        void        _collectData(
-                            const _DateRanges & dateRanges
+        void        _collectData();
+        void        _collectDataInParallel();
+        void        _prepareAggregation(
+                            _Aggregation & aggregation
+                        );
+        void        _collectAccountData(
+                            _Aggregation & aggregation,
+                            tt3::ws::Account account
                         );
         void        _recordWork(
-                            const _DateRange & dateRange,
-                            tt3::ws::Work work
+                            _Aggregation & aggregation,
+                            const tt3::ws::WorkRecord & workRecord
                         );
         _Column     _getColumn(
+                            _Aggregation & aggregation,
                             tt3::ws::ActivityType activityType
                         );
         _Column     _getColumn(
+                            _Aggregation & aggregation,
                             tt3::ws::Activity activity
                         );
+        void        _mergeAggregation(
+                            _Aggregation & into,
+                            const _Aggregation & from
+                        );
+        void        _mergeEfforts(
+                            _Efforts & into,
+                            _Column intoColumn,
+                            const _Efforts & from,
+                            _Column fromColumn
+                        );
         void        _recordEffort(
-                            const _DateRange & dateRange,
+                            const _DateRanges & dateRanges,
+                            _Efforts & efforts,
                             _Column column,
-                            qint64 durationMs
+                            const QDateTime & from,
+                            const QDateTime & to
                         );
         qint64      _getEffort(
-                            const _DateRange & dateRange,
+                            const _Efforts & efforts,
+                            qsizetype dateRangeIndex,
                             _Column column
                         );
         void        _generatePreface();
         void        _generateReportTable(
                             const QString & heading,
                             Report * report,
-                            const _DateRanges & dateRanges
+                            const _DateRanges & dateRanges,
+                            const _Efforts & efforts
                         );
         QString     _formatEffort(qint64 effortMs);
     };
@@ -17,6 +17,31 @@
 #include "tt3-report-worksummary/API.hpp"
 using namespace tt3::report::worksummary;
 
+namespace
+{
+    //  Parses the entire value of the named parameter, if present
+    template <class T>
+    T parseParameter(
+            const QMap<QString, QString> & parameters,
+            const QString & name,
+            const T & defaultValue
+        )
+    {
+        if (!parameters.contains(name))
+        {   //  Not specified
+            return defaultValue;
+        }
+        QString s = parameters[name].trimmed();
+        qsizetype scan = 0;
+        T result = tt3::util::fromString<T>(s, scan);  //  may throw
+        if (scan != s.length())
+        {   //  OOPS! Trailing garbage
+            throw tt3::util::ParseException(s, scan);
+        }
+        return result;
+    }
+}
+
 //////////
 //  Registration
 TT3_IMPLEMENT_SINGLETON(ReportType)
@@ -63,6 +88,82 @@ auto ReportType::createConfigurationEditor(
     return new ReportConfigurationEditor(parent, workspace, credentials);
 }
 
+auto ReportType::createReportConfiguration(
+        tt3::ws::Workspace workspace,
+        const tt3::ws::ReportCredentials & credentials,
+        const QMap<QString, QString> & parameters
+    ) -> IReportConfiguration *
+{
+    static const QSet<QString> knownParameters
+    {
+        "Users", "DateRange", "StartDate", "EndDate", "Grouping",
+        "IncludeDailyData", "IncludeWeeklyData",
+        "IncludeMonthlyData", "IncludeYearlyData",
+        "HoursPerDay", "WeekStart"
+    };
+    for (const QString & name : parameters.keys())
+    {
+        if (!knownParameters.contains(name))
+        {   //  OOPS!
+            throw InvalidReportConfigurationException();
+        }
+    }
+
+    //  Use the settings' DEFAULT values, so the report
+    //  does not depend on whoever used the UI last
+    Component::Settings * settings = Component::Settings::instance();
+
+    //  Users are specified by login; the default is the
+    //  user on whose behalf the report is generated
+    tt3::ws::Users users;
+    QString ownerLogin =
+        workspace->reportOwner(credentials)->login(credentials);    //  may throw
+    QStringList logins =
+        parameters.value("Users", ownerLogin)
+                  .split(',', Qt::SkipEmptyParts);
+    for (const QString & login : std::as_const(logins))
+    {
+        tt3::ws::Account account =
+            workspace->findAccount(credentials, login.trimmed()); //  may throw
+        if (account == nullptr)
+        {   //  OOPS!
+            throw tt3::ws::DoesNotExistException(
+                tt3::ws::ObjectTypes::Account::instance(),
+                "login",
+                login.trimmed());
+        }
+        users.insert(account->user(credentials));   //  may throw
+    }
+
+    DateRange dateRange =
+        parseParameter(parameters, "DateRange", settings->reportDateRange.defaultValue());
+    Qt::DayOfWeek weekStart =
+        parseParameter(parameters, "WeekStart", settings->weekStart.defaultValue());
+    QDate startDate =
+        parseParameter(parameters, "StartDate", QDate::currentDate());
+    QDate endDate =
+        parseParameter(parameters, "EndDate", startDate);
+    ReportConfiguration::calculateDates(dateRange, weekStart, startDate, endDate);
+
+    float hoursPerDay =
+        parseParameter(parameters, "HoursPerDay", settings->houesPerDay.defaultValue());
+    if (!(hoursPerDay > 0 && hoursPerDay <= 24))
+    {   //  OOPS!
+        throw InvalidReportConfigurationException();
+    }
+    return new ReportConfiguration(
+        users,
+        startDate,
+        endDate,
+        parseParameter(parameters, "Grouping", settings->reportGrouping.defaultValue()),
+        parseParameter(parameters, "IncludeDailyData", settings->includeDailyData.defaultValue()),
+        parseParameter(parameters, "IncludeWeeklyData", settings->includeWeeklyData.defaultValue()),
+        parseParameter(parameters, "IncludeMonthlyData", settings->includeMonthlyData.defaultValue()),
+        parseParameter(parameters, "IncludeYearlyData", settings->includeYearlyData.defaultValue()),
+        hoursPerDay,
+        weekStart);
+}
+
 auto ReportType::generateReport(
         tt3::ws::Workspace & workspace,
         const tt3::ws::ReportCredentials & credentials,
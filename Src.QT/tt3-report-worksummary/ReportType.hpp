@@ -37,6 +37,11 @@ namespace tt3::report::worksummary
                                 tt3::ws::Workspace workspace,
                                 const tt3::ws::ReportCredentials & credentials
                             ) -> ReportConfigurationEditor * override;
+        virtual auto    createReportConfiguration(
+                                tt3::ws::Workspace workspace,
+                                const tt3::ws::ReportCredentials & credentials,
+                                const QMap<QString, QString> & parameters
+                            ) -> IReportConfiguration * override;
         virtual auto    generateReport(
                                 tt3::ws::Workspace & workspace,
                                 const tt3::ws::ReportCredentials & credentials,
@@ -43,6 +43,8 @@
 #include "tt3-report/ReportConfiguration.hpp"
 #include "tt3-report/ReportConfigurationEditor.hpp"
 #include "tt3-report/ReportType.hpp"
+#include "tt3-report/ReportJob.hpp"
+#include "tt3-report/ReportBatch.hpp"
 
 #include "tt3-report/ReportTemplateManagerTool.hpp"
 #include "tt3-report/ManageReportTemplatesDialog.hpp"
@@ -73,6 +73,8 @@ namespace tt3::report
     class HtmlReportFormat;
     
     class IReportType;
+    class ReportJob;
+    class ReportBatch;
     
     //  Collections
     using ReportTemplates = QSet<IReportTemplate*>;
@@ -349,47 +349,33 @@ void CreateReportDialog::accept()
         }
     }
 
-    //  Go!
+    //  Go! The report is generated and saved on the job's
+    //  worker thread, while the progress dialog keeps the UI alive
+    ReportJob reportJob(
+        _workspace,
+        _credentials,
+        _reportType,
+        reportConfiguration.release(),
+        _reportTemplate,
+        _reportFormat,
+        _reportDestination);
+    ReportProgressDialog progressDialog(this, &reportJob);
+    progressDialog.doModal();
     try
     {
-        ReportProgressDialog dlg(this, _reportType, _reportDestination);
-        dlg.show();
-        std::unique_ptr<Report> report
-        {
-            _reportType->generateReport(    //  may throw
-                _workspace,
-                _credentials,
-                reportConfiguration.get(),
-                _reportTemplate,
-                [&](float ratioCompleted)
-                {
-                    dlg.reportGenerationProgress(ratioCompleted);
-                    if (dlg.cancelRequested())
-                    {
-                        throw _CancelRequest();
-                    }
-                })
-        };
-        dlg.reportGenerationProgress(1.0f);
-        if (report != nullptr)
-        {   //  Be defensive in release mode
-            _reportFormat->saveReport(
-                report.get(),
-                _reportDestination,
-                [&](float ratioCompleted)
-                {
-                    dlg.reportSaveProgress(ratioCompleted);
-                    if (dlg.cancelRequested())
-                    {
-                        throw _CancelRequest();
-                    }
-                });
-            dlg.reportSaveProgress(1.0f);
+        if (reportJob.outcome() == ReportJob::Outcome::Failed)
+        {   //  Re-throw on this thread
+            reportJob.error()->raise();
         }
-        //  All done
-        dlg.hide();
     }
-    catch (const _CancelRequest &)
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS!
+        qCritical() << ex;
+        tt3::gui::ErrorDialog::show(this, ex);
+        done(int(Result::Cancel));
+        return;
+    }
+    if (reportJob.outcome() == ReportJob::Outcome::Cancelled)
     {   //  Report generation was cancelled half-way
         tt3::gui::MessageDialog::show(
             this,
@@ -399,15 +385,6 @@ void CreateReportDialog::accept()
             Component::Resources::instance()->string(
                 RSID(ReportCancelledDialog),
                 RID(Message)));
-        //  Don't leave half-written file behind
-        QFile(_reportDestination).remove(); //  ignore errors
-        done(int(Result::Cancel));
-        return;
-    }
-    catch (const tt3::util::Exception & ex)
-    {   //  OOPS!
-        qCritical() << ex;
-        tt3::gui::ErrorDialog::show(this, ex);
         done(int(Result::Cancel));
         return;
     }
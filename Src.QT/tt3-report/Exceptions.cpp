@@ -125,6 +125,26 @@ QString InvalidReportConfigurationException::errorMessage() const
         RID(InvalidReportConfigurationException));
 }
 
+//////////
+//  InvalidReportBatchException
+InvalidReportBatchException::InvalidReportBatchException(
+        const QString & fileName,
+        int lineNumber
+    ) : _fileName(fileName),
+        _lineNumber(lineNumber)
+{
+}
+
+QString InvalidReportBatchException::errorMessage() const
+{
+    static Component::Resources *const resources = Component::Resources::instance();   //  idempotent
+    return resources->string(
+        RSID(Errors),
+        RID(InvalidReportBatchException),
+        _fileName,
+        _lineNumber);
+}
+
 //////////
 //  CustomReportException
 CustomReportException::CustomReportException(
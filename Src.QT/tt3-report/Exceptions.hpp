@@ -301,6 +301,64 @@ namespace tt3::report
         virtual QString errorMessage() const override;
     };
 
+    /// \class InvalidReportBatchException tt3-db-api/API.hpp
+    /// \brief Thrown when a report batch file is malformed.
+    class TT3_REPORT_PUBLIC InvalidReportBatchException
+        :   public ReportException
+    {
+        //////////
+        //  Types
+    public:
+        /// \brief A type alias to improve code readability.
+        using Self = InvalidReportBatchException;
+
+        //////////
+        //  Construction/destruction/assignment
+    public:
+        /// \brief
+        ///     Constructs the exception.
+        /// \param fileName
+        ///     The name of the malformed report batch file.
+        /// \param lineNumber
+        ///     The 1-based number of the offending line.
+        InvalidReportBatchException(
+                const QString & fileName,
+                int lineNumber
+            );
+
+        //////////
+        //  QException
+    public:
+        virtual Self *  clone() const override { return new Self(*this); }
+        virtual void    raise() const override { throw *this; }
+
+        //////////
+        //  tt3::util::Exception
+    public:
+        virtual QString errorMessage() const override;
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Returns the name of the malformed report batch file.
+        /// \return
+        ///     The name of the malformed report batch file.
+        QString         fileName() const { return _fileName; }
+
+        /// \brief
+        ///     Returns the 1-based number of the offending line.
+        /// \return
+        ///     The 1-based number of the offending line.
+        int             lineNumber() const { return _lineNumber; }
+
+        //////////
+        //  Implementation
+    private:
+        QString         _fileName;
+        int             _lineNumber;
+    };
+
     /// \class CustomReportException tt3-db-api/API.hpp
     /// \brief Thrown when must carry a custom error message (from OS, etc.)
     class TT3_REPORT_PUBLIC CustomReportException
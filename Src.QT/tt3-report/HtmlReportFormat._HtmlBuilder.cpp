@@ -22,19 +22,21 @@ using HRG = HtmlReportFormat;
 //  Construction/destruction
 HRG::_HtmlBuilder::_HtmlBuilder()
 {
-    reset();
+    reset(nullptr);
 }
 
 HRG::_HtmlBuilder::~_HtmlBuilder()
 {
-    reset();    //  to chean up
+    reset(nullptr); //  to chean up
 }
 
 //////////
 //  Operations
-void HRG::_HtmlBuilder::reset()
+void HRG::_HtmlBuilder::reset(
+        QTextStream * out
+    )
 {
-    _htmlAccumulator.clear();
+    _out = out;
     _spanAccumulator.clear();
     _openTags.clear();
 }
@@ -53,9 +55,7 @@ void HRG::_HtmlBuilder::openTag(
     else
     {   //  Commit "span data" & open a new div tag
         _commitSpanData();
-        _htmlAccumulator += _indent(_openTags.size());
-        _htmlAccumulator += tag;
-        _htmlAccumulator += "\n";
+        _write(_indent(_openTags.size()), tag);
     }
 
     _openTags.push(tagName);
@@ -82,9 +82,7 @@ void HRG::_HtmlBuilder::openTag(
     else
     {   //  Commit "span data" & open a new div tag
         _commitSpanData();
-        _htmlAccumulator += _indent(_openTags.size());
-        _htmlAccumulator += tag;
-        _htmlAccumulator += "\n";
+        _write(_indent(_openTags.size()), tag);
     }
 
     _openTags.push(tagName);
@@ -116,9 +114,7 @@ void HRG::_HtmlBuilder::openTag(
     else
     {   //  Commit "span data" & open a new div tag
         _commitSpanData();
-        _htmlAccumulator += _indent(_openTags.size());
-        _htmlAccumulator += tag;
-        _htmlAccumulator += "\n";
+        _write(_indent(_openTags.size()), tag);
     }
 
     _openTags.push(tagName);
@@ -155,9 +151,7 @@ void HRG::_HtmlBuilder::openTag(
     else
     {   //  Commit "span data" & open a new div tag
         _commitSpanData();
-        _htmlAccumulator += _indent(_openTags.size());
-        _htmlAccumulator += tag;
-        _htmlAccumulator += "\n";
+        _write(_indent(_openTags.size()), tag);
     }
 
     _openTags.push(tagName);
@@ -199,9 +193,7 @@ void HRG::_HtmlBuilder::openTag(
     else
     {   //  Commit "span data" & open a new div tag
         _commitSpanData();
-        _htmlAccumulator += _indent(_openTags.size());
-        _htmlAccumulator += tag;
-        _htmlAccumulator += "\n";
+        _write(_indent(_openTags.size()), tag);
     }
 
     _openTags.push(tagName);
@@ -224,9 +216,7 @@ void HRG::_HtmlBuilder::closeTag(
     else
     {   //  Commit "span data" & open a new div tag
         _commitSpanData();
-        _htmlAccumulator += _indent(_openTags.size());
-        _htmlAccumulator += tag;
-        _htmlAccumulator += "\n";
+        _write(_indent(_openTags.size()), tag);
     }
 }
 
@@ -244,9 +234,7 @@ void HRG::_HtmlBuilder::writeTag(
     else
     {   //  Commit "span data" & open a new div tag
         _commitSpanData();
-        _htmlAccumulator += _indent(_openTags.size());
-        _htmlAccumulator += tag;
-        _htmlAccumulator += "\n";
+        _write(_indent(_openTags.size()), tag);
     }
 }
 
@@ -271,9 +259,7 @@ void HRG::_HtmlBuilder::writeTag(
     else
     {   //  Commit "span data" & open a new div tag
         _commitSpanData();
-        _htmlAccumulator += _indent(_openTags.size());
-        _htmlAccumulator += tag;
-        _htmlAccumulator += "\n";
+        _write(_indent(_openTags.size()), tag);
     }
 }
 
@@ -281,6 +267,10 @@ void HRG::_HtmlBuilder::writeText(
         const QString & text
     )
 {
+    if (_out == nullptr)
+    {   //  Dry run - don't bother escaping
+        return;
+    }
     QString escapedText = _escapeText(text);
     if (!escapedText.isEmpty())
     {
@@ -292,10 +282,14 @@ void HRG::_HtmlBuilder::writeText(
     }
 }
 
-QString HRG::_HtmlBuilder::html()
+void HRG::_HtmlBuilder::writeRawData(
+        const QString & data
+    )
 {
+    //  Indented the same as the text content of the
+    //  innermost open tag, but written as is
     _commitSpanData();
-    return _htmlAccumulator;
+    _write(_indent(_openTags.size()), data);
 }
 
 //////////
@@ -312,9 +306,18 @@ void HRG::_HtmlBuilder::_commitSpanData()
     _spanAccumulator.clear();
     if (!spanData.isEmpty())
     {   //  Indent + data TODO break "spanData" into multiple lines if too long
-        _htmlAccumulator += _indent(_openTags.size() + 1);
-        _htmlAccumulator += spanData;
-        _htmlAccumulator += "\n";
+        _write(_indent(_openTags.size() + 1), spanData);
+    }
+}
+
+void HRG::_HtmlBuilder::_write(
+        const QString & indent,
+        const QString & line
+    )
+{
+    if (_out != nullptr)
+    {   //  The QTextStream does its own buffering
+        *_out << indent << line << '\n';
     }
 }
 
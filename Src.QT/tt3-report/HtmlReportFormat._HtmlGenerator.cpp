@@ -31,39 +31,63 @@ HRG::_HtmlGenerator::~_HtmlGenerator()
 
 //////////
 //  Operations
-QString HRG::_HtmlGenerator::generateHtml(
-        const Report * report
+void HRG::_HtmlGenerator::generateHtml(
+        const Report * report,
+        QTextStream & out
     )
 {
     Q_ASSERT(report != nullptr);
 
     //  The number of "save" steps will be:
-    //  *   1 for every "Paragraph" in the "report"
-    _totalSteps = _countParagraps(report);
+    //  *   1 for every "Paragraph" in the "report"...
+    //  *   ...for each of the 2 passes
+    _totalSteps = _countParagraps(report) * 2;
     _completedSteps = 0;
     if (_progressListener != nullptr)
     {
         _progressListener(0.0);
     }
 
-    //  We'll be embedding the CSS into the HTML - we need a "token" that will be
-    //  inserted into the proper place of HTML document that we'll later replace
-    //  with the CSS (because the complete CSS is only available after HTML document
-    //  generation is completed)
-    QString cssToken =
-        QUuid::createUuid().toString() +
-        "-" +
-        QUuid::createUuid().toString() +
-        "-" +
-        QUuid::createUuid().toString();
-
-    _htmlBuilder.reset();
     _cssBuilder.reset();
 
     _nextUnusedId = 1;
     _mapElementsToIds.clear();
     _assignIdsToElements(report);
 
+    //  The CSS is embedded into the <head> of the HTML
+    //  document, but the complete CSS is only known once all
+    //  elements of the report have been visited. So the 1st
+    //  pass is a dry run that only populates the CSS builder;
+    //  the 2nd pass then finds all CSS classes already there
+    //  and streams the HTML straight to "out"
+    _htmlBuilder.reset(nullptr);
+    _generateHtml(report);
+    _htmlBuilder.reset(&out);
+    _generateHtml(report);
+    _htmlBuilder.reset(nullptr);
+
+    //  Done
+    if (_progressListener != nullptr)
+    {
+        _progressListener(1.0);
+    }
+}
+
+//////////
+//  Implementation helpers
+void HRG::_HtmlGenerator::_completeStep()
+{
+    _completedSteps++;
+    if (_progressListener != nullptr)
+    {
+        _progressListener(float(_completedSteps + 1) / float(_totalSteps + 1));
+    }
+}
+
+void HRG::_HtmlGenerator::_generateHtml(
+        const Report * report
+    )
+{
     _htmlBuilder.openTag("html");
 
     _htmlBuilder.openTag("head");
@@ -72,7 +96,7 @@ QString HRG::_HtmlGenerator::generateHtml(
     _htmlBuilder.writeText(report->name());
     _htmlBuilder.closeTag("title");
     _htmlBuilder.openTag("style");
-    _htmlBuilder.writeText(cssToken);
+    _htmlBuilder.writeRawData(_cssBuilder.css());
     _htmlBuilder.closeTag("style");
     _htmlBuilder.closeTag("head");
 
@@ -87,26 +111,6 @@ QString HRG::_HtmlGenerator::generateHtml(
     _htmlBuilder.closeTag("body");
 
     _htmlBuilder.closeTag("html");
-
-    //  Done
-    QString html = _htmlBuilder.html();
-    html = html.replace(cssToken, _cssBuilder.css());
-    if (_progressListener != nullptr)
-    {
-        _progressListener(1.0);
-    }
-    return html;
-}
-
-//////////
-//  Implementation helpers
-void HRG::_HtmlGenerator::_completeStep()
-{
-    _completedSteps++;
-    if (_progressListener != nullptr)
-    {
-        _progressListener(float(_completedSteps + 1) / float(_totalSteps + 1));
-    }
 }
 
 int HRG::_HtmlGenerator::_countParagraps(
@@ -67,14 +67,21 @@ void HtmlReportFormat::saveReport(
 {
     Q_ASSERT(report != nullptr);
 
-    _HtmlGenerator htmlGenerator(progressListener);
-    QString html = htmlGenerator.generateHtml(report);
-
     QFile file(fileName);
     if (file.open(QIODevice::WriteOnly | QIODevice::Text))
-    {
+    {   //  HTML is streamed to the file as it is generated
+        _HtmlGenerator htmlGenerator(progressListener);
         QTextStream out(&file);
-        out << html;
+        try
+        {
+            htmlGenerator.generateHtml(report, out);
+        }
+        catch (...)
+        {   //  Don't leave a partial HTML file behind
+            file.close();
+            file.remove();
+            throw;
+        }
         out.flush();
         file.close();
     }
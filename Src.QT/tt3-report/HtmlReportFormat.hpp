@@ -56,7 +56,9 @@ namespace tt3::report
             //////////
             //  Operations
         public:
-            void        reset();
+            //  Subsequent HTML goes to "out"; nullptr == a dry
+            //  run where no HTML is produced at all
+            void        reset(QTextStream * out);
             void        openTag(const QString & tagName);
             void        openTag(const QString & tagName,
                                 const QString & attributeName1,
@@ -88,12 +90,12 @@ namespace tt3::report
                                 const QString & attributeName1,
                                 const QString & attributeValue1);
             void        writeText(const QString & text);
-            QString     html();
+            void        writeRawData(const QString & data);
 
             //////////
             //  Implementation
         private:
-            QString     _htmlAccumulator;
+            QTextStream *   _out = nullptr; //  nullptr == dry run
             QString     _spanAccumulator;
 
             QStack<QString> _openTags;
@@ -101,6 +103,7 @@ namespace tt3::report
             //  Helpers
             bool        _isSpanTag(const QString & tagName);
             void        _commitSpanData();
+            void        _write(const QString & indent, const QString & line);
             QString     _indent(qsizetype level);
             bool        _isTagNameStart(QChar c);
             bool        _isTagNameChar(QChar c);
@@ -449,7 +452,7 @@ namespace tt3::report
             //////////
             //  Operations
         public:
-            QString     generateHtml(const Report * report);
+            void        generateHtml(const Report * report, QTextStream & out);
 
             //////////
             //  Implementation
@@ -465,6 +468,7 @@ namespace tt3::report
 
             //  Helpers
             void            _completeStep();
+            void            _generateHtml(const Report * report);
             static int      _countParagraps(const Report * report);
             static int      _countParagraps(const ReportFlowElement * flowElement);
             static int      _countParagraps(const ReportBlockElement * blockElement);
@@ -0,0 +1,193 @@
+//
+//  tt3-report/ReportBatch.cpp - tt3::report::ReportBatch class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-report/API.hpp"
+using namespace tt3::report;
+
+//////////
+//  Construction/destruction
+ReportBatch::ReportBatch(const QString & fileName)
+    :   _fileName(fileName)
+{
+    QFile file(_fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {   //  OOPS!
+        throw CustomReportException(file.errorString());
+    }
+    QDomDocument document;
+    auto parseResult = document.setContent(&file);
+    if (!parseResult)
+    {   //  OOPS! Throw a proper exception!
+        throw InvalidReportBatchException(_fileName, int(parseResult.errorLine));
+    }
+
+    //  The root element specifies the workspace and access...
+    QDomElement rootElement = document.documentElement();
+    if (rootElement.tagName() != XmlTagName)
+    {   //  OOPS!
+        _invalid(rootElement);
+    }
+    tt3::ws::WorkspaceType workspaceType =
+        tt3::ws::WorkspaceTypeManager::find(
+            tt3::util::Mnemonic(rootElement.attribute("WorkspaceType")));
+    if (workspaceType == nullptr)
+    {   //  OOPS!
+        _invalid(rootElement);
+    }
+    _workspaceAddress =
+        workspaceType->parseWorkspaceAddress(
+            rootElement.attribute("WorkspaceAddress")); //  may throw
+    _credentials =
+        tt3::ws::Credentials(
+            rootElement.attribute("Login"),
+            rootElement.attribute("Password"));
+
+    //  ...and its children - the reports
+    QDir batchDirectory = QFileInfo(_fileName).absoluteDir();
+    for (QDomElement reportElement = rootElement.firstChildElement();
+         !reportElement.isNull();
+         reportElement = reportElement.nextSiblingElement())
+    {
+        _Entry entry;
+        entry.lineNumber = reportElement.lineNumber();
+        entry.reportType =
+            ReportTypeManager::find(
+                tt3::util::Mnemonic(reportElement.attribute("Type")));
+        entry.reportFormat =
+            ReportFormatManager::find(
+                tt3::util::Mnemonic(reportElement.attribute("Format")));
+        entry.reportTemplate =
+            reportElement.hasAttribute("Template") ?
+                ReportTemplateManager::find(
+                    tt3::util::Mnemonic(reportElement.attribute("Template"))) :
+                BasicReportTemplate::instance();
+        if (reportElement.tagName() != "Report" ||
+            entry.reportType == nullptr ||
+            entry.reportFormat == nullptr ||
+            entry.reportTemplate == nullptr ||
+            reportElement.attribute("Destination").isEmpty())
+        {   //  OOPS!
+            _invalid(reportElement);
+        }
+        entry.reportDestination =
+            batchDirectory.absoluteFilePath(reportElement.attribute("Destination"));
+        for (QDomElement parameterElement = reportElement.firstChildElement();
+             !parameterElement.isNull();
+             parameterElement = parameterElement.nextSiblingElement())
+        {
+            QString name = parameterElement.attribute("Name");
+            if (parameterElement.tagName() != "Parameter" ||
+                name.isEmpty() ||
+                !parameterElement.hasAttribute("Value") ||
+                entry.parameters.contains(name))
+            {   //  OOPS!
+                _invalid(parameterElement);
+            }
+            entry.parameters[name] = parameterElement.attribute("Value");
+        }
+        _entries.append(entry);
+    }
+}
+
+ReportBatch::~ReportBatch()
+{
+}
+
+//////////
+//  Operations
+qsizetype ReportBatch::run()
+{
+    tt3::ws::Workspace workspace =
+        _workspaceAddress->workspaceType()->openWorkspace(
+            _workspaceAddress,
+            tt3::ws::OpenMode::ReadOnly);   //  may throw
+    qsizetype failedReports = 0;
+    for (const _Entry & entry : std::as_const(_entries))
+    {
+        if (!_runEntry(workspace, entry))
+        {
+            failedReports++;
+        }
+    }
+    try
+    {
+        workspace->close();
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Log, but the reports are already there
+        qCritical() << ex;
+    }
+    return failedReports;
+}
+
+//////////
+//  Implementation helpers
+bool ReportBatch::_runEntry(
+        tt3::ws::Workspace workspace,
+        const _Entry & entry
+    )
+{
+    try
+    {
+        tt3::ws::ReportCredentials reportCredentials =
+            workspace->beginReport( //  may throw
+                _credentials,
+                workspace->objectCount(_credentials) * 85 + //  1,000,000 objects -> 1 day lease...
+                60 * 60 * 1000);    //  ...+ 1 hour
+        try
+        {
+            ReportJob reportJob(
+                workspace,
+                reportCredentials,
+                entry.reportType,
+                entry.reportType->createReportConfiguration(    //  may throw
+                    workspace,
+                    reportCredentials,
+                    entry.parameters),
+                entry.reportTemplate,
+                entry.reportFormat,
+                entry.reportDestination);
+            if (reportJob.run() == ReportJob::Outcome::Failed)
+            {   //  Re-throw here, to log & cleanup
+                reportJob.error()->raise();
+            }
+        }
+        catch (...)
+        {   //  OOPS! Cleanup & re-throw
+            workspace->releaseCredentials(reportCredentials);   //  may throw
+            throw;
+        }
+        //  Release outside the "try" - if this throws, there's
+        //  nothing left to release
+        workspace->releaseCredentials(reportCredentials);   //  may throw
+        qInfo() << "Report written:" << entry.reportDestination;
+        return true;
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Log & move on to the next report
+        qCritical() << "Report not written:" << entry.reportDestination
+                    << "(line" << entry.lineNumber << "of" << _fileName << ")";
+        qCritical() << ex;
+        return false;
+    }
+}
+
+void ReportBatch::_invalid(const QDomNode & node) const
+{
+    throw InvalidReportBatchException(_fileName, node.lineNumber());
+}
+
+//  End of tt3-report/ReportBatch.cpp
@@ -0,0 +1,131 @@
+//
+//  tt3-report/ReportBatch.hpp - tt3 report batches
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#pragma once
+#include "tt3-report/API.hpp"
+
+namespace tt3::report
+{
+    /// \class ReportBatch tt3-report/API.hpp
+    /// \brief A list of reports to generate without UI.
+    /// \details
+    ///     A report batch is loaded from an XML file like this:
+    ///     \code
+    ///     <ReportBatch WorkspaceType="..." WorkspaceAddress="..."
+    ///                  Login="..." Password="...">
+    ///         <Report Type="WorkSummary" Format="Html"
+    ///                 Template="..." Destination="...">
+    ///             <Parameter Name="Users" Value="..."/>
+    ///             ...
+    ///         </Report>
+    ///         ...
+    ///     </ReportBatch>
+    ///     \endcode
+    ///     The "Template" is optional (the basic report template
+    ///     is used by default); relative "Destination"s are relative
+    ///     to the directory where the batch file resides. Parameters
+    ///     are specific to the report type (see
+    ///     IReportType::createReportConfiguration()).
+    ///     Note that the "Password" is stored in the batch file
+    ///     as plain text, so anyone who can read the file can log
+    ///     into the workspace as its "Login". Keep batch files
+    ///     readable by their owner only, and prefer a dedicated
+    ///     account whose capabilities are limited to generating
+    ///     reports (i.e. to what the reports need to see).
+    ///     Reports are generated one after another on the current
+    ///     thread, on behalf of the batch's "Login", each with
+    ///     its own "report credentials", so that the workspace
+    ///     is only read-locked (see ReportJob) while a report
+    ///     is actually being generated.
+    class TT3_REPORT_PUBLIC ReportBatch final
+    {
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ReportBatch)
+
+        //////////
+        //  Constants
+    public:
+        /// \brief
+        ///     The XML tag name of the batch file root element.
+        static inline const QString XmlTagName = "ReportBatch";
+
+        //////////
+        //  Construction/destruction
+    public:
+        /// \brief
+        ///     Loads the report batch from a file.
+        /// \param fileName
+        ///     The name of the report batch file.
+        /// \exception ReportException
+        ///     If the report batch file cannot be loaded or
+        ///     is malformed.
+        /// \exception WorkspaceException
+        ///     If the workspace address in the report batch
+        ///     file is invalid.
+        explicit ReportBatch(const QString & fileName);
+
+        /// \brief
+        ///     The class destructor.
+        ~ReportBatch();
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Returns the number of reports in this batch.
+        /// \return
+        ///     The number of reports in this batch.
+        qsizetype       reportCount() const { return _entries.size(); }
+
+        /// \brief
+        ///     Generates all reports in this batch.
+        /// \details
+        ///     A failure to generate one report is logged and
+        ///     does not prevent other reports from being generated.
+        /// \return
+        ///     The number of reports that could not be generated.
+        /// \exception WorkspaceException
+        ///     If the workspace cannot be opened.
+        qsizetype       run();
+
+        //////////
+        //  Implementation
+    private:
+        struct _Entry
+        {
+            int                 lineNumber;
+            IReportType *       reportType;
+            IReportFormat *     reportFormat;
+            IReportTemplate *   reportTemplate;
+            QString             reportDestination;
+            QMap<QString, QString>  parameters;
+        };
+
+        const QString   _fileName;
+        tt3::ws::WorkspaceAddress   _workspaceAddress;
+        tt3::ws::Credentials    _credentials;
+        QList<_Entry>   _entries;
+
+        //  Helpers
+        bool            _runEntry(
+                                tt3::ws::Workspace workspace,
+                                const _Entry & entry
+                            );
+        [[noreturn]]
+        void            _invalid(const QDomNode & node) const;
+    };
+}
+
+//  End of tt3-report/ReportBatch.hpp
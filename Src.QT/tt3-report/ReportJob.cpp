@@ -0,0 +1,210 @@
+//
+//  tt3-report/ReportJob.cpp - tt3::report::ReportJob class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-report/API.hpp"
+using namespace tt3::report;
+
+namespace
+{
+    //  Turns a stream of progress reports into a trickle
+    //  of progress signals - at most one per whole percent
+    //  and per ReportJob::ProgressIntervalMs, except that
+    //  the completion of a stage is always reported
+    class ProgressThrottle final
+    {
+    public:
+        explicit ProgressThrottle(const std::function<void(float)> & emitter)
+            :   _emitter(emitter) {}
+
+        void        report(float ratioCompleted)
+        {
+            ratioCompleted = std::max(0.0f, std::min(1.0f, ratioCompleted));
+            int percentCompleted = int(ratioCompleted * 100);
+            if (percentCompleted == _lastPercentCompleted)
+            {   //  Nothing a progress bar can show
+                return;
+            }
+            if (percentCompleted < 100 &&
+                _lastEmitTimer.isValid() &&
+                _lastEmitTimer.elapsed() < ReportJob::ProgressIntervalMs)
+            {   //  Too soon
+                return;
+            }
+            _lastPercentCompleted = percentCompleted;
+            _lastEmitTimer.start();
+            _emitter(ratioCompleted);
+        }
+
+    private:
+        const std::function<void(float)>    _emitter;
+        int             _lastPercentCompleted = -1;
+        QElapsedTimer   _lastEmitTimer;
+    };
+}
+
+//////////
+//  Construction/destruction
+ReportJob::ReportJob(
+        tt3::ws::Workspace workspace,
+        const tt3::ws::ReportCredentials & credentials,
+        IReportType * reportType,
+        IReportConfiguration * configuration,
+        const IReportTemplate * reportTemplate,
+        IReportFormat * reportFormat,
+        const QString & reportDestination
+    ) : _workspace(workspace),
+        _credentials(credentials),
+        _reportType(reportType),
+        _configuration(configuration),
+        _reportTemplate(reportTemplate),
+        _reportFormat(reportFormat),
+        _reportDestination(reportDestination),
+        _workerThread(this)
+{
+    Q_ASSERT(_workspace != nullptr);
+    Q_ASSERT(_reportType != nullptr);
+    Q_ASSERT(_reportTemplate != nullptr);
+    Q_ASSERT(_reportFormat != nullptr);
+}
+
+ReportJob::~ReportJob()
+{
+    if (_workerThread.isRunning())
+    {   //  Don't leave the worker behind with a dangling "this"
+        cancel();
+        _workerThread.wait();
+    }
+}
+
+//////////
+//  Operations
+void ReportJob::start()
+{
+    Q_ASSERT(!_started);
+    if (!_started.exchange(true))
+    {   //  Be defensive in release mode
+        _workerThread.start();
+    }
+}
+
+auto ReportJob::run() -> Outcome
+{
+    Q_ASSERT(!_started);
+    if (!_started.exchange(true))
+    {   //  Be defensive in release mode
+        _execute();
+    }
+    return _outcome;
+}
+
+auto ReportJob::error() const -> const tt3::util::Throwable *
+{
+    return (_outcome == Outcome::Failed) ? _error.get() : nullptr;
+}
+
+//////////
+//  Implementation helpers
+void ReportJob::_execute()
+{
+    bool saveStarted = false;
+    try
+    {
+        ProgressThrottle generationProgressThrottle(
+            [&](float ratioCompleted)
+            {
+                emit generationProgress(ratioCompleted);
+            });
+        ProgressThrottle saveProgressThrottle(
+            [&](float ratioCompleted)
+            {
+                emit saveProgress(ratioCompleted);
+            });
+
+        std::unique_ptr<Report> report;
+        {   //  The workspace stays unmodified while the report
+            //  data is gathered, but not while the report is saved
+            tt3::ws::WorkspaceImpl::ReportLock reportLock(_workspace, _credentials);    //  may throw
+            report.reset(
+                _reportType->generateReport(    //  may throw
+                    _workspace,
+                    _credentials,
+                    _configuration.get(),
+                    _reportTemplate,
+                    [&](float ratioCompleted)
+                    {
+                        if (_cancelRequested)
+                        {
+                            throw _CancelRequest();
+                        }
+                        generationProgressThrottle.report(ratioCompleted);
+                    }));
+        }
+        generationProgressThrottle.report(1.0f);
+        if (report != nullptr)
+        {   //  Be defensive in release mode
+            saveStarted = true;
+            _reportFormat->saveReport(  //  may throw
+                report.get(),
+                _reportDestination,
+                [&](float ratioCompleted)
+                {
+                    if (_cancelRequested)
+                    {
+                        throw _CancelRequest();
+                    }
+                    saveProgressThrottle.report(ratioCompleted);
+                });
+            saveProgressThrottle.report(1.0f);
+        }
+        _outcome = Outcome::Succeeded;
+    }
+    catch (const _CancelRequest &)
+    {   //  Don't leave half-written file behind
+        if (saveStarted)
+        {
+            QFile(_reportDestination).remove(); //  ignore errors
+        }
+        _outcome = Outcome::Cancelled;
+    }
+    catch (const tt3::util::Throwable & ex)
+    {   //  OOPS! Keep for whoever is interested
+        _error.reset(ex.clone());
+        _outcome = Outcome::Failed;
+    }
+    catch (const std::exception & ex)
+    {   //  OOPS! Keep for whoever is interested
+        _error.reset(new CustomReportException(QString::fromLocal8Bit(ex.what())));
+        _outcome = Outcome::Failed;
+    }
+    catch (...)
+    {   //  OOPS! Don't let it escape the worker thread
+        static Component::Resources *const resources = Component::Resources::instance();   //  idempotent
+        _error.reset(
+            new CustomReportException(
+                resources->string(RSID(Errors), RID(UnknownReportError))));
+        _outcome = Outcome::Failed;
+    }
+    emit finished();
+}
+
+//////////
+//  ReportJob::_WorkerThread
+void ReportJob::_WorkerThread::run()
+{
+    _reportJob->_execute();
+}
+
+//  End of tt3-report/ReportJob.cpp
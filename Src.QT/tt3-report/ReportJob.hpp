@@ -0,0 +1,231 @@
+//
+//  tt3-report/ReportJob.hpp - tt3 report generation jobs
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#pragma once
+#include "tt3-report/API.hpp"
+
+namespace tt3::report
+{
+    /// \class ReportJob tt3-report/API.hpp
+    /// \brief A job that generates a report and saves it to a file.
+    /// \details
+    ///     A job can either be started on its own worker thread
+    ///     (which is what the UI does, so that it stays responsive
+    ///     while the report is generated) or run synchronously on
+    ///     the current thread (which is what the headless batch
+    ///     mode does). Either way, the workspace is accessed with
+    ///     "report credentials" and, while the report is generated,
+    ///     under a workspace ReportLock, so the report is a consistent
+    ///     view of the workspace. Modifications attempted meanwhile
+    ///     (e.g. from the UI) wait until the report is generated;
+    ///     they do not wait while the report is saved.
+    class TT3_REPORT_PUBLIC ReportJob final
+        :   public QObject
+    {
+        Q_OBJECT
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ReportJob)
+
+        //////////
+        //  Types
+    public:
+        /// \brief
+        ///     The outcome of a report job.
+        enum class Outcome
+        {
+            Pending,    ///< The job has not finished [yet].
+            Succeeded,  ///< The report has been generated and saved.
+            Cancelled,  ///< The job has been cancelled half-way.
+            Failed      ///< The job has failed; see error().
+        };
+
+        //////////
+        //  Constants
+    public:
+        /// \brief
+        ///     The minimum interval, in milliseconds, between
+        ///     two consecutive progress signals of the same stage.
+        static const int ProgressIntervalMs = 50;
+
+        //////////
+        //  Construction/destruction
+    public:
+        /// \brief
+        ///     Constructs the report job.
+        /// \param workspace
+        ///     The workspace to report from.
+        /// \param credentials
+        ///     The credentials to use for data access.
+        /// \param reportType
+        ///     The type of the report to generate.
+        /// \param configuration
+        ///     The report configuration; nullptr == default or
+        ///     none. The job takes ownership of it.
+        /// \param reportTemplate
+        ///     The template for the report.
+        /// \param reportFormat
+        ///     The format to save the report in.
+        /// \param reportDestination
+        ///     The path to the report file to write.
+        ReportJob(
+                tt3::ws::Workspace workspace,
+                const tt3::ws::ReportCredentials & credentials,
+                IReportType * reportType,
+                IReportConfiguration * configuration,
+                const IReportTemplate * reportTemplate,
+                IReportFormat * reportFormat,
+                const QString & reportDestination
+            );
+
+        /// \brief
+        ///     The class destructor.
+        /// \details
+        ///     If the job is still running on its worker
+        ///     thread, cancels it and waits for it to stop.
+        virtual ~ReportJob();
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Returns the type of the report being generated.
+        /// \return
+        ///     The type of the report being generated.
+        IReportType *   reportType() const { return _reportType; }
+
+        /// \brief
+        ///     Returns the path to the report file being written.
+        /// \return
+        ///     The path to the report file being written.
+        QString         reportDestination() const { return _reportDestination; }
+
+        /// \brief
+        ///     Starts the job on its worker thread.
+        /// \details
+        ///     Progress is reported by emitting signals below;
+        ///     clients should use "queued" connections.
+        ///     A job can only be started (or run) once.
+        void            start();
+
+        /// \brief
+        ///     Runs the job synchronously on the current thread.
+        /// \details
+        ///     Signals are still emitted as the job progresses.
+        ///     A job can only be run (or started) once.
+        /// \return
+        ///     The outcome of the job.
+        Outcome         run();
+
+        /// \brief
+        ///     Requests cancellation of the job.
+        /// \details
+        ///     Can be called from any thread. The job stops
+        ///     at the next progress report, removing the
+        ///     half-written report file, if any.
+        void            cancel() { _cancelRequested = true; }
+
+        /// \brief
+        ///     Checks if the cancellation of the job has been requested.
+        /// \return
+        ///     True if the cancellation of the job has been
+        ///     requested, else false.
+        bool            cancelRequested() const { return _cancelRequested; }
+
+        /// \brief
+        ///     Returns the outcome of the job.
+        /// \return
+        ///     The outcome of the job; Pending until it finishes.
+        Outcome         outcome() const { return _outcome; }
+
+        /// \brief
+        ///     Returns the error the job has failed with.
+        /// \return
+        ///     The error the job has failed with; nullptr
+        ///     unless the outcome() of the job is Failed.
+        auto            error() const -> const tt3::util::Throwable *;
+
+        //////////
+        //  Signals
+        //  Clients are encourated to use "queued" connections.
+    signals:
+        /// \brief
+        ///     Emitted to report the report generation progress.
+        /// \param ratioCompleted
+        ///     The ratio of the work completed, 0.0 == just started,
+        ///     1.0 == finished, 0.5 == half-way through.
+        void            generationProgress(float ratioCompleted);
+
+        /// \brief
+        ///     Emitted to report the report saving progress.
+        /// \param ratioCompleted
+        ///     The ratio of the work completed, 0.0 == just started,
+        ///     1.0 == finished, 0.5 == half-way through.
+        void            saveProgress(float ratioCompleted);
+
+        /// \brief
+        ///     Always emitted once the job has finished,
+        ///     regardless of its outcome.
+        void            finished();
+
+        //////////
+        //  Implementation
+    private:
+        tt3::ws::Workspace  _workspace;
+        const tt3::ws::ReportCredentials    _credentials;
+        IReportType *const  _reportType;
+        const std::unique_ptr<IReportConfiguration> _configuration;
+        const IReportTemplate *const    _reportTemplate;
+        IReportFormat *const    _reportFormat;
+        const QString   _reportDestination;
+
+        std::atomic<bool>       _started = false;
+        std::atomic<bool>       _cancelRequested = false;
+        std::atomic<Outcome>    _outcome = Outcome::Pending;
+        std::unique_ptr<tt3::util::Throwable>   _error;  //  set before _outcome
+
+        struct _CancelRequest {};
+
+        //  Helpers
+        void            _execute();
+
+        //  The worker thread is where work is done and
+        //  signals are emitted when the job is started
+        class TT3_REPORT_PUBLIC _WorkerThread
+            :   public QThread
+        {
+            TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(_WorkerThread)
+
+            //////////
+            //  Construction/destruction
+        public:
+            explicit _WorkerThread(ReportJob * reportJob)
+                :   _reportJob(reportJob) {}
+            virtual ~_WorkerThread() = default;
+
+            //////////
+            //  QThread
+        protected:
+            virtual void    run() override;
+
+            //////////
+            //  Implementation
+        private:
+            ReportJob *const    _reportJob;
+        };
+        _WorkerThread   _workerThread;
+    };
+}
+
+//  End of tt3-report/ReportJob.hpp
@@ -22,12 +22,12 @@ using namespace tt3::report;
 //  Construction/destruction
 ReportProgressDialog::ReportProgressDialog(
         QWidget * parent,
-        IReportType * reportType,
-        const QString & reportDestination
+        ReportJob * reportJob
     ) : QDialog(parent),
+        _reportJob(reportJob),
         _ui(new Ui::ReportProgressDialog)
 {
-    Q_ASSERT(reportType != nullptr);
+    Q_ASSERT(_reportJob != nullptr);
 
     tt3::util::ResourceReader rr(Component::Resources::instance(), RSID(ReportProgressDialog));
 
@@ -45,10 +45,10 @@ ReportProgressDialog::ReportProgressDialog(
     //  Set static control values
     _ui->generatingLabel->setText(
         rr.string(RID(GeneratingLabel),
-                  reportType->displayName()));
+                  _reportJob->reportType()->displayName()));
     _ui->writingToLabel->setText(
         rr.string(RID(WritingToLabel),
-                  reportDestination));
+                  _reportJob->reportDestination()));
 
     _ui->buttonBox->button(QDialogButtonBox::StandardButton::Cancel)->
         setText(rr.string(RID(CancelPushButton)));
@@ -61,6 +61,23 @@ ReportProgressDialog::ReportProgressDialog(
     _ui->writingToLabel->setEnabled(false);
     _ui->writingToProgressBar->setEnabled(false);
 
+    //  The job reports from its worker thread
+    connect(_reportJob,
+            &ReportJob::generationProgress,
+            this,
+            &ReportProgressDialog::_reportJobGenerationProgress,
+            Qt::ConnectionType::QueuedConnection);
+    connect(_reportJob,
+            &ReportJob::saveProgress,
+            this,
+            &ReportProgressDialog::_reportJobSaveProgress,
+            Qt::ConnectionType::QueuedConnection);
+    connect(_reportJob,
+            &ReportJob::finished,
+            this,
+            &ReportProgressDialog::_reportJobFinished,
+            Qt::ConnectionType::QueuedConnection);
+
     //  Done
     adjustSize();
 }
@@ -71,73 +88,44 @@ ReportProgressDialog::~ReportProgressDialog()
 }
 
 //////////
-//  QWidget
-void ReportProgressDialog::show()
-{
-    if (!isVisible())
-    {
-        QDialog::show();
-    }
-}
-
-void ReportProgressDialog::hide()
+//  Operations
+void ReportProgressDialog::doModal()
 {
-    if (isVisible())
-    {
-        QDialog::hide();
-    }
+    _reportJob->start();
+    exec();
 }
 
 //////////
-//  Operations
-void ReportProgressDialog::reportGenerationProgress(float ratioCompleted)
+//  Signal handlers
+void ReportProgressDialog::_reportJobGenerationProgress(float ratioCompleted)
 {
-    ratioCompleted = std::max(0.0f, std::min(1.0f, ratioCompleted));
-    //  Update the UI
     _ui->generatingProgressBar->setValue(int(ratioCompleted * 100));
-    //  Delay is calculate automatically,
-    //  100% == PreferredStageDurationMs
-    float deltaRatioCompleted = std::max(0.0f, ratioCompleted - _lastGenerationRatioCompleted);
-    int delayMs = int(deltaRatioCompleted * PreferredStageDurationMs);
-    _lastGenerationRatioCompleted = ratioCompleted;
-    QDateTime resumeAt = QDateTime::currentDateTimeUtc().addMSecs(delayMs);
-    do
-    {   //  We need at least 1 guaranteed repaint
-        QCoreApplication::processEvents();
-    }   while (QDateTime::currentDateTimeUtc() < resumeAt);
 }
 
-void ReportProgressDialog::reportSaveProgress(float ratioCompleted)
+void ReportProgressDialog::_reportJobSaveProgress(float ratioCompleted)
 {
-    ratioCompleted = std::max(0.0f, std::min(1.0f, ratioCompleted));
-    //  Update the UI
     if (!_ui->writingToLabel->isEnabled())
     {
+        _ui->generatingProgressBar->setValue(100);
         _ui->writingToLabel->setEnabled(true);
         _ui->writingToProgressBar->setEnabled(true);
     }
     _ui->writingToProgressBar->setValue(int(ratioCompleted * 100));
-    //  Delay is calculate automatically,
-    //  100% == PreferredStageDurationMs
-    float deltaRatioCompleted = std::max(0.0f, ratioCompleted - _lastSaveRatioCompleted);
-    int delayMs = int(deltaRatioCompleted * PreferredStageDurationMs);
-    _lastSaveRatioCompleted = ratioCompleted;
-    QDateTime resumeAt = QDateTime::currentDateTimeUtc().addMSecs(delayMs);
-    do
-    {   //  We need at least 1 guaranteed repaint
-        QCoreApplication::processEvents();
-    }   while (QDateTime::currentDateTimeUtc() < resumeAt);
 }
 
-//////////
-//  Signal handlers
+void ReportProgressDialog::_reportJobFinished()
+{
+    done(QDialog::Accepted);
+}
+
 void ReportProgressDialog::accept()
 {   //  Don't close on Enter
 }
 
 void ReportProgressDialog::reject()
-{   //  Record a cancellation request
-    _cancelRequested = true;
+{   //  Request a cancellation; the dialog closes when the job stops
+    _reportJob->cancel();
+    _ui->buttonBox->setEnabled(false);
 }
 
 //  End of tt3-report/ReportProgressDialog.cpp
@@ -29,14 +29,6 @@ namespace tt3::report
         Q_OBJECT
         TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ReportProgressDialog)
 
-        //////////
-        //  Constants
-    public:
-        /// \brief
-        ///     The preferred time, in milliseconds, taken
-        ///     by a single stage of report generation/
-        static const int PreferredStageDurationMs = 5000;
-
         //////////
         //  Construction/destruction
     public:
@@ -44,62 +36,34 @@ namespace tt3::report
         ///     Constructs the dialog.
         /// \param parent
         ///     The parent for the dialog, nullptr == none.
-        /// \param reportType
-        ///     The type of the report being generated.
-        /// \param reportDestination
-        ///     The path to the report file being written.
-        explicit ReportProgressDialog(
+        /// \param reportJob
+        ///     The report job to track the progress of;
+        ///     must not have been started yet.
+        ReportProgressDialog(
                 QWidget * parent,
-                IReportType * reportType,
-                const QString & reportDestination
+                ReportJob * reportJob
             );
 
         /// \brief
         ///     The class destructor.
         virtual ~ReportProgressDialog();
 
-        //////////
-        //  QWidget
-    public:
-        /// \brief
-        ///     Shows this dialog; has no effect if already shown.
-        void            show();
-
-        /// \brief
-        ///     Hides this dialog; has no effect if already hidden.
-        void            hide();
-
         //////////
         //  Operations
     public:
         /// \brief
-        ///     Updates the dialog to reflect report generation progress.
-        /// \param ratioCompleted
-        ///     The ratio of the work completed, 0.0 == just started,
-        ///     1.0 == finished, 0.5 == half-way through.
-        void            reportGenerationProgress(float ratioCompleted);
-
-        /// \brief
-        ///     Updates the dialog to reflect report saving progress.
-        /// \param ratioCompleted
-        ///     The ratio of the work completed, 0.0 == just started,
-        ///     1.0 == finished, 0.5 == half-way through.
-        void            reportSaveProgress(float ratioCompleted);
-
-        /// \brief
-        ///     Checks if the user has requested cancellation
-        ///     of the restore process.
-        /// \return
-        ///     True if the user has requested cancellation of
-        ///     the restore process, else false.
-        bool            cancelRequested() const { return _cancelRequested; }
+        ///     Starts the report job and runs the dialog modally
+        ///     until the job finishes.
+        /// \details
+        ///     The job runs on its worker thread, so the UI stays
+        ///     responsive; "Cancel" requests the job cancellation.
+        ///     Use the job's outcome() to find out how it went.
+        void            doModal();
 
         //////////
         //  Implementation
     private:
-        float           _lastGenerationRatioCompleted = 0.0f;
-        float           _lastSaveRatioCompleted = 0.0f;
-        bool            _cancelRequested = false;
+        ReportJob *const    _reportJob;
 
         //////////
         //  Controls
@@ -109,6 +73,9 @@ namespace tt3::report
         //////////
         //  Signal handlers
     private slots:
+        void            _reportJobGenerationProgress(float ratioCompleted);
+        void            _reportJobSaveProgress(float ratioCompleted);
+        void            _reportJobFinished();
         virtual void    accept() override;
         virtual void    reject() override;
     };
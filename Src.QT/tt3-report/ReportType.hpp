@@ -94,6 +94,32 @@ namespace tt3::report
                                 const tt3::ws::ReportCredentials & credentials
                             ) -> ReportConfigurationEditor * = 0;
 
+        /// \brief
+        ///     Creates a report configuration from its
+        ///     textual parameters.
+        /// \details
+        ///     This is how reports are configured when generated
+        ///     without the UI, e.g. in a headless batch mode.
+        ///     Parameters that are not specified take their
+        ///     default values; the meaning of parameters is
+        ///     specific to the report type.
+        /// \param workspace
+        ///     The workspace to report from.
+        /// \param credentials
+        ///     The credentials to use for data access.
+        /// \param parameters
+        ///     The report parameters, as name -> value.
+        /// \return
+        ///     The newly created report configuration or nullptr
+        ///     if reports of this type have no configuration.
+        /// \exception Exception
+        ///     If a parameter is unknown or has an invalid value.
+        virtual auto    createReportConfiguration(
+                                tt3::ws::Workspace workspace,
+                                const tt3::ws::ReportCredentials & credentials,
+                                const QMap<QString, QString> & parameters
+                            ) -> IReportConfiguration * = 0;
+
         /// \brief
         ///     Generates the report.
         /// \param workspace
@@ -55,6 +55,7 @@ SOURCES += \
     PageSetup.cpp \
     Report.cpp \
     ReportAnchor.cpp \
+    ReportBatch.cpp \
     ReportBlockElement.cpp \
     ReportConfigurationEditor.cpp \
     ReportCreatedDialog.cpp \
@@ -63,6 +64,7 @@ SOURCES += \
     ReportFlowElement.cpp \
     ReportFormatManager.cpp \
     ReportInternalLink.cpp \
+    ReportJob.cpp \
     ReportLink.cpp \
     ReportList.cpp \
     ReportListItem.cpp \
@@ -96,10 +98,12 @@ HEADERS += \
     Linkage.hpp \
     ManageReportTemplatesDialog.hpp \
     Report.hpp \
+    ReportBatch.hpp \
     ReportConfiguration.hpp \
     ReportConfigurationEditor.hpp \
     ReportCreatedDialog.hpp \
     ReportFormat.hpp \
+    ReportJob.hpp \
     ReportProgressDialog.hpp \
     ReportTemplate.hpp \
     ReportTemplateManagerTool.hpp \
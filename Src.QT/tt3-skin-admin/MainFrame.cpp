@@ -26,8 +26,7 @@ MainFrame::MainFrame()
     :   QMainWindow(nullptr),
         _ui(new Ui::MainFrame),
         _trackPositionTimer(this),
-        _savePositionTimer(this),
-        _refreshTimer(this)
+        _savePositionTimer(this)
 {
     _ui->setupUi(this);
     this->setMinimumSize(MinimumSize);
@@ -140,19 +139,17 @@ MainFrame::MainFrame()
     _ui->managersTabWidget->setCurrentIndex(Component::Settings::instance()->mainFrameCurrentTab);
     refresh();
 
-    //  Start refreshing on timer
-    connect(&_refreshTimer,
-            &QTimer::timeout,
+    //  The current activity's elapsed time changes every second
+    connect(&tt3::gui::theRefreshScheduler,
+            &tt3::gui::RefreshScheduler::tick,
             this,
-            &MainFrame::_refreshTimerTimeout);
-    _refreshTimer.start(1000);
+            &MainFrame::_clockTicked);
 }
 
 MainFrame::~MainFrame()
 {
     _trackPositionTimer.stop();
     _savePositionTimer.stop();
-    _refreshTimer.stop();
     delete _ui;
 }
 
@@ -244,18 +241,19 @@ void MainFrame::refresh()
     _refreshToolsMenuItemAvailability();
     _refreshReportsMenuItemAvailability();
 
-    //  Controls
-    _userManager->refresh();
-    _activityTypeManager->refresh();
-    _publicActivityManager->refresh();
-    _publicTaskManager->refresh();
-    _privateActivityManager->refresh();
-    _privateTaskManager->refresh();
-    _projectManager->refresh();
-    _workStreamManager->refresh();
-    _beneficiaryManager->refresh();
-    _myDayManager->refresh();
-    _quickReportBrowser->refresh();
+    //  Controls - only the visible one will actually
+    //  refresh, the rest will when their tabs are shown
+    _userManager->requestRefresh();
+    _activityTypeManager->requestRefresh();
+    _publicActivityManager->requestRefresh();
+    _publicTaskManager->requestRefresh();
+    _privateActivityManager->requestRefresh();
+    _privateTaskManager->requestRefresh();
+    _projectManager->requestRefresh();
+    _workStreamManager->requestRefresh();
+    _beneficiaryManager->requestRefresh();
+    _myDayManager->requestRefresh();
+    _quickReportBrowser->requestRefresh();
 
     _refreshCurrentActivityControls();
 }
@@ -1351,15 +1349,15 @@ void MainFrame::_currentLocaleChanged(QLocale, QLocale)
 void MainFrame::_managersTabWidgetCurrentChanged(int)
 {
     if (_trackPosition)
-    {   //  i.e. constructor has finished
-        refresh();
+    {   //  i.e. constructor has finished; the newly shown
+        //  manager catches up with changes on its own
         Component::Settings::instance()->mainFrameCurrentTab = _ui->managersTabWidget->currentIndex();
     }
 }
 
-void MainFrame::_refreshTimerTimeout()
+void MainFrame::_clockTicked()
 {
-    if (tt3::gui::theCurrentActivity != nullptr)
+    if (isVisible() && tt3::gui::theCurrentActivity != nullptr)
     {
         _refreshCurrentActivityControls();
     }
@@ -123,7 +123,6 @@ namespace tt3::skin::admin
         Ui::MainFrame *const    _ui;
         QTimer          _trackPositionTimer;
         QTimer          _savePositionTimer;
-        QTimer          _refreshTimer;
 
         //  Custom controls for the tabbed pane
         //  in the middle are created dynamically
@@ -198,7 +197,7 @@ namespace tt3::skin::admin
         void            _currentThemeChanged(tt3::gui::ITheme*, tt3::gui::ITheme*);
         void            _currentLocaleChanged(QLocale, QLocale);
         void            _managersTabWidgetCurrentChanged(int);
-        void            _refreshTimerTimeout();
+        void            _clockTicked();
     };
 }
 
@@ -24,8 +24,7 @@ MainFrame::MainFrame()
     :   QMainWindow(nullptr),
         _ui(new Ui::MainFrame),
         _trackPositionTimer(this),
-        _savePositionTimer(this),
-        _refreshTimer(this)
+        _savePositionTimer(this)
 {
     _ui->setupUi(this);
     Qt::WindowFlags flags = windowFlags();
@@ -83,20 +82,23 @@ MainFrame::MainFrame()
             &MainFrame::_currentLocaleChanged,
             Qt::ConnectionType::QueuedConnection);
 
+    //  Quick picks are shown as control areas
+    _startListeningToWorkspaceChanges(tt3::gui::theCurrentWorkspace);
+
     //  Done
     _recalculateControlAreas();
     refresh();
 
-    //  Start refreshing on timer
-    connect(&_refreshTimer,
-            &QTimer::timeout,
+    //  The current activity's elapsed time changes every second
+    connect(&tt3::gui::theRefreshScheduler,
+            &tt3::gui::RefreshScheduler::tick,
             this,
-            &MainFrame::_refreshTimerTimeout);
-    _refreshTimer.start(1000);
+            &MainFrame::_clockTicked);
 }
 
 MainFrame::~MainFrame()
 {
+    _stopListeningToWorkspaceChanges();
     delete _ui;
 }
 
@@ -353,33 +355,7 @@ void MainFrame::refresh()
     _recalculateControlAreas();
 
     //  Make tray ion refrect main frame's title
-    if (_trayIcon != nullptr)
-    {
-        QString tooltip = title;
-        if (gui::theCurrentActivity != nullptr)
-        {
-            try
-            {
-                tooltip +=
-                    "\n\n" +
-                    rr.string(RID(Title.CurrentActivity),
-                              gui::theCurrentActivity->displayName(credentials));   //  may throw
-                qint64 secs = qMax(0, tt3::gui::theCurrentActivity.lastChangedAt().secsTo(QDateTime::currentDateTimeUtc()));
-                char s[32];
-                sprintf(s, " [%d:%02d:%02d]",
-                        int(secs / (60 * 60)),
-                        int((secs / 60) % 60),
-                        int(secs % 60));
-                tooltip += s;
-            }
-            catch (const tt3::util::Exception & ex)
-            {   //  OOPS! Log & suppress
-                qCritical() << ex;
-                tooltip += "\n\n" + ex.errorMessage();
-            }
-        }
-        _trayIcon->setToolTip(tooltip);
-    }
+    _refreshTrayIconToolTip();
 
     //  Done
     update();
@@ -446,6 +422,8 @@ void MainFrame::_recalculateControlAreas()
 {
     const int _MinControlAreaHeight = 32;
 
+    _controlAreasOutdated = false;
+
     //  We need to distribute the quick picks list
     QList<tt3::ws::Activity> quickPicks;
     if (gui::theCurrentWorkspace != nullptr)
@@ -495,6 +473,103 @@ void MainFrame::_recalculateControlAreas()
     }
 }
 
+void MainFrame::_refreshTrayIconToolTip()
+{
+    tt3::util::ResourceReader rr(Component::Resources::instance(), RSID(MainFrame));
+
+    if (_trayIcon != nullptr)
+    {
+        QString tooltip = windowTitle();
+        if (gui::theCurrentActivity != nullptr)
+        {
+            try
+            {
+                tooltip +=
+                    "\n\n" +
+                    rr.string(RID(Title.CurrentActivity),
+                              gui::theCurrentActivity->displayName(gui::theCurrentCredentials));    //  may throw
+                qint64 secs = qMax(0, tt3::gui::theCurrentActivity.lastChangedAt().secsTo(QDateTime::currentDateTimeUtc()));
+                char s[32];
+                sprintf(s, " [%d:%02d:%02d]",
+                        int(secs / (60 * 60)),
+                        int((secs / 60) % 60),
+                        int(secs % 60));
+                tooltip += s;
+            }
+            catch (const tt3::util::Exception & ex)
+            {   //  OOPS! Log & suppress
+                qCritical() << ex;
+                tooltip += "\n\n" + ex.errorMessage();
+            }
+        }
+        _trayIcon->setToolTip(tooltip);
+    }
+}
+
+void MainFrame::_startListeningToWorkspaceChanges(tt3::ws::Workspace workspace)
+{
+    _stopListeningToWorkspaceChanges();
+    _listenedWorkspace = workspace;
+    if (_listenedWorkspace != nullptr)
+    {
+        connect(_listenedWorkspace.get(),
+                &tt3::ws::WorkspaceImpl::workspaceClosed,
+                this,
+                &MainFrame::_workspaceClosed,
+                Qt::ConnectionType::QueuedConnection);
+        connect(_listenedWorkspace.get(),
+                &tt3::ws::WorkspaceImpl::objectCreated,
+                this,
+                &MainFrame::_objectCreated,
+                Qt::ConnectionType::QueuedConnection);
+        connect(_listenedWorkspace.get(),
+                &tt3::ws::WorkspaceImpl::objectDestroyed,
+                this,
+                &MainFrame::_objectDestroyed,
+                Qt::ConnectionType::QueuedConnection);
+        connect(_listenedWorkspace.get(),
+                &tt3::ws::WorkspaceImpl::objectModified,
+                this,
+                &MainFrame::_objectModified,
+                Qt::ConnectionType::QueuedConnection);
+    }
+}
+
+void MainFrame::_stopListeningToWorkspaceChanges()
+{
+    if (_listenedWorkspace != nullptr)
+    {
+        disconnect(_listenedWorkspace.get(),
+                   &tt3::ws::WorkspaceImpl::workspaceClosed,
+                   this,
+                   &MainFrame::_workspaceClosed);
+        disconnect(_listenedWorkspace.get(),
+                   &tt3::ws::WorkspaceImpl::objectCreated,
+                   this,
+                   &MainFrame::_objectCreated);
+        disconnect(_listenedWorkspace.get(),
+                   &tt3::ws::WorkspaceImpl::objectDestroyed,
+                   this,
+                   &MainFrame::_objectDestroyed);
+        disconnect(_listenedWorkspace.get(),
+                   &tt3::ws::WorkspaceImpl::objectModified,
+                   this,
+                   &MainFrame::_objectModified);
+        _listenedWorkspace.reset();
+    }
+}
+
+bool MainFrame::_affectsControlAreas(tt3::ws::ObjectType * objectType)
+{   //  The quick picks list belongs to the Account;
+    //  the Activities in it are shown by name
+    return objectType == tt3::ws::ObjectTypes::PublicActivity::instance() ||
+           objectType == tt3::ws::ObjectTypes::PublicTask::instance() ||
+           objectType == tt3::ws::ObjectTypes::PrivateActivity::instance() ||
+           objectType == tt3::ws::ObjectTypes::PrivateTask::instance() ||
+           objectType == tt3::ws::ObjectTypes::User::instance() ||
+           objectType == tt3::ws::ObjectTypes::Account::instance();
+}
+
 void MainFrame::_draw(QPainter & p, const _ControlArea & controlArea)
 {
     tt3::util::ResourceReader rr(Component::Resources::instance(), RSID(MainFrame));
@@ -1493,8 +1568,33 @@ void MainFrame::_workspaceClosed(tt3::ws::WorkspaceClosedNotification)
     refresh();
 }
 
-void MainFrame::_currentWorkspaceChanged(tt3::ws::Workspace, tt3::ws::Workspace)
+void MainFrame::_objectCreated(tt3::ws::ObjectCreatedNotification notification)
 {
+    if (_affectsControlAreas(notification.objectType()))
+    {   //  Re-create once per burst of changes
+        _controlAreasOutdated = true;
+    }
+}
+
+void MainFrame::_objectDestroyed(tt3::ws::ObjectDestroyedNotification notification)
+{
+    if (_affectsControlAreas(notification.objectType()))
+    {   //  Re-create once per burst of changes
+        _controlAreasOutdated = true;
+    }
+}
+
+void MainFrame::_objectModified(tt3::ws::ObjectModifiedNotification notification)
+{
+    if (_affectsControlAreas(notification.objectType()))
+    {   //  Re-create once per burst of changes
+        _controlAreasOutdated = true;
+    }
+}
+
+void MainFrame::_currentWorkspaceChanged(tt3::ws::Workspace, tt3::ws::Workspace after)
+{
+    _startListeningToWorkspaceChanges(after);
     refresh();
 }
 
@@ -1519,9 +1619,18 @@ void MainFrame::_currentLocaleChanged(QLocale, QLocale)
     refresh();
 }
 
-void MainFrame::_refreshTimerTimeout()
+void MainFrame::_clockTicked()
 {
-    refresh();
+    if (_controlAreasOutdated)
+    {   //  Quick picks may have changed
+        refresh();
+    }
+    else if (tt3::gui::theCurrentActivity != nullptr)
+    {   //  Only the elapsed time has - no need to re-query
+        //  the quick picks list every second
+        _refreshTrayIconToolTip();
+        update();
+    }
 }
 
 void MainFrame::_onTrayIconActivated(QSystemTrayIcon::ActivationReason reason)
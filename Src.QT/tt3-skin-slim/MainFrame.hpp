@@ -160,6 +160,8 @@ namespace tt3::skin::slim
         using _ControlAreas = QList<_ControlArea>;
 
         _ControlAreas   _controlAreas;
+        bool            _controlAreasOutdated = false;  //  re-create on next clock tick
+        tt3::ws::Workspace  _listenedWorkspace;         //  nullptr == none
 
         //  Helpers
         void            _loadPosition();
@@ -167,6 +169,10 @@ namespace tt3::skin::slim
         QWidget *       _dialogParent();
 
         void            _recalculateControlAreas();
+        void            _refreshTrayIconToolTip();
+        void            _startListeningToWorkspaceChanges(tt3::ws::Workspace workspace);
+        void            _stopListeningToWorkspaceChanges();
+        static bool     _affectsControlAreas(tt3::ws::ObjectType * objectType);
         void            _draw(QPainter & p, const _ControlArea & controlArea);
         void            _drawRect3D(QPainter & p, const QRect & rc, const QColor & tl, const QColor & br);
 
@@ -237,7 +243,6 @@ namespace tt3::skin::slim
         Ui::MainFrame *const    _ui;
         QTimer          _trackPositionTimer;
         QTimer          _savePositionTimer;
-        QTimer          _refreshTimer;
         QSystemTrayIcon*_trayIcon = nullptr;
         std::unique_ptr<QMenu>  _contextMenu;
 
@@ -250,12 +255,15 @@ namespace tt3::skin::slim
         void            _trackPositionTimerTimeout();
         void            _savePositionTimerTimeout();
         void            _workspaceClosed(tt3::ws::WorkspaceClosedNotification);
+        void            _objectCreated(tt3::ws::ObjectCreatedNotification notification);
+        void            _objectDestroyed(tt3::ws::ObjectDestroyedNotification notification);
+        void            _objectModified(tt3::ws::ObjectModifiedNotification notification);
         void            _currentWorkspaceChanged(tt3::ws::Workspace, tt3::ws::Workspace);
         void            _currentCredentialsChanged(tt3::ws::Credentials, tt3::ws::Credentials);
         void            _currentActivityChanged(tt3::ws::Activity, tt3::ws::Activity);
         void            _currentThemeChanged(tt3::gui::ITheme*, tt3::gui::ITheme*);
         void            _currentLocaleChanged(QLocale, QLocale);
-        void            _refreshTimerTimeout();
+        void            _clockTicked();
         void            _onTrayIconActivated(QSystemTrayIcon::ActivationReason reason);
 
         void            _onActionMinimize();
@@ -0,0 +1,42 @@
+//
+//  tt3-test/API.hpp - tt3-test API
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#pragma once
+
+//////////
+//  Dependencies
+#include "tt3-tools-restore/API.hpp"
+#include "tt3-tools-backup/API.hpp"
+#include "tt3-ws/API.hpp"
+#include "tt3-db-xml/API.hpp"
+#include "tt3-db-api/API.hpp"
+#include "tt3-util/API.hpp"
+
+#include <thread>
+
+#include <QSemaphore>
+#include <QTemporaryDir>
+#include <QTest>
+
+//////////
+//  tt3-test components
+#include "tt3-test/BackupRestoreTests.hpp"
+#include "tt3-test/MessageDigestTests.hpp"
+#include "tt3-test/ReadWriteMutexTests.hpp"
+#include "tt3-test/WorkspaceReportTests.hpp"
+#include "tt3-test/WorkspaceValidationTests.hpp"
+
+//  End of tt3-test/API.hpp
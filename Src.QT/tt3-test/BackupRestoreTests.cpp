@@ -0,0 +1,284 @@
+//
+//  tt3-test/BackupRestoreTests.cpp - tt3::test::BackupRestoreTests class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-test/API.hpp"
+using namespace tt3::test;
+using Format = tt3::tools::backup::BackupWriter::Format;
+
+namespace
+{
+    const quint64 LeaseDurationMs = 60 * 60 * 1000;
+
+    //  Backups and restores pop up progress dialogs when run
+    //  on a thread with an event loop, so run them on one without
+    template <class F>
+    void runWithoutEventLoop(F f)
+    {
+        std::unique_ptr<tt3::util::Exception> error;
+        std::thread worker(
+            [&]()
+            {
+                try
+                {
+                    f();    //  may throw
+                }
+                catch (const tt3::util::Exception & ex)
+                {   //  OOPS! Re-throw on the caller's thread
+                    error.reset(ex.clone());
+                }
+            });
+        worker.join();
+        if (error != nullptr)
+        {
+            error->raise();
+        }
+    }
+}
+
+//////////
+//  Test cases
+void BackupRestoreTests::init()
+{
+    _directory = std::make_unique<QTemporaryDir>();
+    QVERIFY2(_directory->isValid(), qPrintable(_directory->errorString()));
+
+    _adminCredentials = tt3::ws::Credentials(AdminLogin, AdminPassword);
+    _workspace = _createWorkspace("source", AdminLogin, AdminPassword); //  may throw
+}
+
+void BackupRestoreTests::cleanup()
+{
+    for (const auto & workspace : std::as_const(_otherWorkspaces))
+    {
+        workspace->close(); //  may throw
+    }
+    _otherWorkspaces.clear();
+    if (_workspace != nullptr)
+    {
+        _workspace->close();    //  may throw
+        _workspace.reset();
+    }
+    _directory.reset();
+}
+
+void BackupRestoreTests::fullAndDeltaBackupsRoundTrip()
+{
+    tt3::ws::PublicActivity kept = _createPublicActivity(_workspace, "Kept");
+    tt3::ws::PublicActivity renamed = _createPublicActivity(_workspace, "Renamed");
+    tt3::ws::PublicActivity destroyed = _createPublicActivity(_workspace, "Destroyed");
+    tt3::ws::Oid destroyedOid = destroyed->oid();
+    QString full = _backup(_workspace, "full", Format::Binary, std::nullopt);
+
+    //  Changes since the full backup go to the 1st delta...
+    renamed->setDisplayName(_adminCredentials, "Renamed once");   //  may throw
+    destroyed->destroy(_adminCredentials);  //  may throw
+    QString delta1 =
+        _backup(
+            _workspace,
+            "delta1",
+            Format::Text,
+            tt3::tools::backup::BackupWriter::modificationStampOf(full));  //  may throw
+    //  ...and changes since that to the 2nd one
+    renamed->setDisplayName(_adminCredentials, "Renamed twice");  //  may throw
+    tt3::ws::PublicActivity created = _createPublicActivity(_workspace, "Created");
+    QString delta2 =
+        _backup(
+            _workspace,
+            "delta2",
+            Format::Binary,
+            tt3::tools::backup::BackupWriter::modificationStampOf(delta1));    //  may throw
+
+    //  The order of backup files doesn't matter
+    tt3::ws::Credentials restoreCredentials(RestoreLogin, RestorePassword);
+    tt3::ws::Workspace restored = _restore({ delta2, full, delta1 });
+    QCOMPARE(
+        _publicActivityNames(restored, restoreCredentials),
+        (QStringList{ "Created", "Kept", "Renamed twice" }));
+    QCOMPARE(
+        _publicActivityNames(restored, restoreCredentials),
+        _publicActivityNames(_workspace, _adminCredentials));
+    //  OIDs are preserved, and destroyed objects stay destroyed
+    QVERIFY(restored->findObjectByOid<tt3::ws::PublicActivity>(restoreCredentials, kept->oid()) != nullptr);
+    QVERIFY(restored->findObjectByOid<tt3::ws::PublicActivity>(restoreCredentials, renamed->oid()) != nullptr);
+    QVERIFY(restored->findObjectByOid<tt3::ws::PublicActivity>(restoreCredentials, created->oid()) != nullptr);
+    QVERIFY(restored->findObjectByOid<tt3::ws::PublicActivity>(restoreCredentials, destroyedOid) == nullptr);
+}
+
+void BackupRestoreTests::deltaOfAnotherDatabaseIsRejected()
+{
+    _createPublicActivity(_workspace, "Ours");
+    QString full = _backup(_workspace, "full", Format::Binary, std::nullopt);
+
+    //  A delta "against" our full backup, but of another database
+    tt3::ws::Workspace other = _createWorkspace("other", AdminLogin, AdminPassword);  //  may throw
+    _otherWorkspaces.append(other);
+    _createPublicActivity(other, "Theirs");
+    QString delta =
+        _backup(
+            other,
+            "other-delta",
+            Format::Binary,
+            tt3::tools::backup::BackupWriter::modificationStampOf(full));  //  may throw
+
+    QStringList backupFileNames{ full, delta };
+    QVERIFY_THROWS_EXCEPTION(
+        tt3::tools::restore::BackupFileMismatchException,
+        _restore(backupFileNames));
+}
+
+void BackupRestoreTests::tombstonesArePruned()
+{
+    tt3::ws::PublicActivity doomed = _createPublicActivity(_workspace, "Doomed");
+    tt3::ws::Oid doomedOid = doomed->oid();
+    doomed->destroy(_adminCredentials); //  may throw
+    QString full1 = _backup(_workspace, "full1", Format::Binary, std::nullopt);
+    quint64 full1Stamp = tt3::tools::backup::BackupWriter::modificationStampOf(full1);   //  may throw
+
+    //  Deltas against the 1st full backup need the tombstone...
+    tt3::ws::BackupCredentials backupCredentials =
+        _workspace->beginBackup(_adminCredentials, LeaseDurationMs);    //  may throw
+    QVERIFY(_workspace->destroyedOidsSince(backupCredentials, 0).contains(doomedOid));
+    QCOMPARE(_workspace->oldestBaseModificationStamp(backupCredentials), quint64(0));
+    _workspace->releaseCredentials(backupCredentials);  //  may throw
+
+    //  ...but once there's a later full backup, deltas can't
+    //  go further back than the 1st one, so it's forgotten
+    _createPublicActivity(_workspace, "Survivor");
+    _backup(_workspace, "full2", Format::Binary, std::nullopt);
+    backupCredentials =
+        _workspace->beginBackup(_adminCredentials, LeaseDurationMs);    //  may throw
+    QVERIFY(!_workspace->destroyedOidsSince(backupCredentials, 0).contains(doomedOid));
+    QCOMPARE(_workspace->oldestBaseModificationStamp(backupCredentials), full1Stamp);
+    _workspace->releaseCredentials(backupCredentials);  //  may throw
+
+    //  Deltas against an older base are refused...
+    QVERIFY_THROWS_EXCEPTION(
+        tt3::ws::CustomWorkspaceException,
+        _backup(_workspace, "too-old-delta", Format::Binary, full1Stamp - 1));
+    QVERIFY(!QFile::exists(_path("too-old-delta")));
+    //  ...while those against the 1st full backup still work
+    QString delta = _backup(_workspace, "delta", Format::Binary, full1Stamp);
+    tt3::ws::Credentials restoreCredentials(RestoreLogin, RestorePassword);
+    tt3::ws::Workspace restored = _restore({ full1, delta });
+    QCOMPARE(
+        _publicActivityNames(restored, restoreCredentials),
+        QStringList{ "Survivor" });
+}
+
+//////////
+//  Implementation helpers
+QString BackupRestoreTests::_path(const QString & name) const
+{
+    return QDir(_directory->path()).absoluteFilePath(name);
+}
+
+auto BackupRestoreTests::_createWorkspace(
+        const QString & name,
+        const QString & adminLogin,
+        const QString & adminPassword
+    ) -> tt3::ws::Workspace
+{
+    tt3::ws::WorkspaceType workspaceType =
+        tt3::ws::WorkspaceTypeManager::find(tt3::util::Mnemonic("XmlFile"));
+    Q_ASSERT(workspaceType != nullptr);
+    return workspaceType->createWorkspace(
+        workspaceType->parseWorkspaceAddress(
+            _path(name + tt3::db::xml::DatabaseType::PreferredExtension)), //  may throw
+        name,   //  restored Users keep their names, so be unique
+        adminLogin,
+        adminPassword); //  may throw
+}
+
+auto BackupRestoreTests::_createPublicActivity(
+        tt3::ws::Workspace workspace,
+        const QString & displayName
+    ) -> tt3::ws::PublicActivity
+{
+    return workspace->createPublicActivity(
+        _adminCredentials,
+        displayName,
+        QString(),
+        tt3::ws::InactivityTimeout(),
+        false,
+        false,
+        false,
+        nullptr,
+        nullptr);   //  may throw
+}
+
+QString BackupRestoreTests::_backup(
+        tt3::ws::Workspace workspace,
+        const QString & name,
+        tt3::tools::backup::BackupWriter::Format format,
+        std::optional<quint64> baseModificationStamp
+    )
+{
+    QString backupFileName = _path(name);
+    bool backupSuccessful = false;
+    runWithoutEventLoop(
+        [&]()
+        {
+            tt3::tools::backup::BackupWriter backupWriter(
+                workspace,
+                _adminCredentials,
+                backupFileName,
+                format,
+                baseModificationStamp); //  may throw
+            backupSuccessful = backupWriter.backupWorkspace();  //  may throw
+        });
+    Q_ASSERT(backupSuccessful); //  there's nobody to cancel it
+    return backupFileName;
+}
+
+auto BackupRestoreTests::_restore(
+        const QStringList & backupFileNames
+    ) -> tt3::ws::Workspace
+{
+    tt3::ws::Workspace workspace =
+        _createWorkspace(
+            "restored" + QString::number(_otherWorkspaces.size()),
+            RestoreLogin,
+            RestorePassword);   //  may throw
+    _otherWorkspaces.append(workspace);
+    bool restoreSuccessful = false;
+    runWithoutEventLoop(
+        [&]()
+        {
+            tt3::tools::restore::RestoreReader restoreReader(
+                workspace,
+                tt3::ws::Credentials(RestoreLogin, RestorePassword),
+                backupFileNames);   //  may throw
+            restoreSuccessful = restoreReader.restoreWorkspace();   //  may throw
+        });
+    Q_ASSERT(restoreSuccessful);    //  there's nobody to cancel it
+    return workspace;
+}
+
+QStringList BackupRestoreTests::_publicActivityNames(
+        tt3::ws::Workspace workspace,
+        const tt3::ws::Credentials & credentials
+    )
+{
+    QStringList result;
+    for (const auto & publicActivity : workspace->publicActivities(credentials))  //  may throw
+    {
+        result.append(publicActivity->displayName(credentials));  //  may throw
+    }
+    result.sort();
+    return result;
+}
+
+//  End of tt3-test/BackupRestoreTests.cpp
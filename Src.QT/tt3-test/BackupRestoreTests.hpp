@@ -0,0 +1,81 @@
+//
+//  tt3-test/BackupRestoreTests.hpp - tt3::test::BackupRestoreTests class
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#pragma once
+#include "tt3-test/API.hpp"
+
+namespace tt3::test
+{
+    /// \class BackupRestoreTests tt3-test/API.hpp
+    /// \brief Tests of full and delta backups, restored together.
+    class BackupRestoreTests final
+        :   public QObject
+    {
+        Q_OBJECT
+
+        //////////
+        //  Constants
+    private:
+        static inline const QString AdminLogin = "admin";
+        static inline const QString AdminPassword = "password";
+        static inline const QString RestoreLogin = "restorer";  //  restores into a fresh workspace
+        static inline const QString RestorePassword = "password";
+
+        //////////
+        //  Test cases
+    private slots:
+        void        init();
+        void        cleanup();
+        void        fullAndDeltaBackupsRoundTrip();
+        void        deltaOfAnotherDatabaseIsRejected();
+        void        tombstonesArePruned();
+
+        //////////
+        //  Implementation
+    private:
+        std::unique_ptr<QTemporaryDir>  _directory;
+        tt3::ws::Workspace  _workspace; //  backed up
+        QList<tt3::ws::Workspace>   _otherWorkspaces;   //  to close on cleanup
+        tt3::ws::Credentials    _adminCredentials;
+
+        //  Helpers
+        QString     _path(const QString & name) const;
+        auto        _createWorkspace(
+                            const QString & name,
+                            const QString & adminLogin,
+                            const QString & adminPassword
+                        ) -> tt3::ws::Workspace;
+        auto        _createPublicActivity(
+                            tt3::ws::Workspace workspace,
+                            const QString & displayName
+                        ) -> tt3::ws::PublicActivity;
+        QString     _backup(
+                            tt3::ws::Workspace workspace,
+                            const QString & name,
+                            tt3::tools::backup::BackupWriter::Format format,
+                            std::optional<quint64> baseModificationStamp
+                        );
+        auto        _restore(
+                            const QStringList & backupFileNames
+                        ) -> tt3::ws::Workspace;
+        QStringList _publicActivityNames(
+                            tt3::ws::Workspace workspace,
+                            const tt3::ws::Credentials & credentials
+                        );
+    };
+}
+
+//  End of tt3-test/BackupRestoreTests.hpp
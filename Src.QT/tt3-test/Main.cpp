@@ -0,0 +1,60 @@
+//
+//  tt3-test/Main.cpp - tt3-test entry point
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-test/API.hpp"
+using namespace tt3::test;
+
+//////////
+//  TT3 tests entry point
+int main(int argc, char *argv[])
+{
+    //  Tests have no windows, so don't
+    //  insist on a display being available
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+
+    //  Tests use the components linked in,
+    //  e.g. for database types and resources
+    tt3::util::ComponentManager::initializeComponents();
+    int failedTests = 0;
+    {
+        MessageDigestTests messageDigestTests;
+        failedTests += QTest::qExec(&messageDigestTests, argc, argv);
+    }
+    {
+        ReadWriteMutexTests readWriteMutexTests;
+        failedTests += QTest::qExec(&readWriteMutexTests, argc, argv);
+    }
+    {
+        WorkspaceReportTests workspaceReportTests;
+        failedTests += QTest::qExec(&workspaceReportTests, argc, argv);
+    }
+    {
+        WorkspaceValidationTests workspaceValidationTests;
+        failedTests += QTest::qExec(&workspaceValidationTests, argc, argv);
+    }
+    {
+        BackupRestoreTests backupRestoreTests;
+        failedTests += QTest::qExec(&backupRestoreTests, argc, argv);
+    }
+    tt3::util::ComponentManager::deinitializeComponents();
+    return (failedTests == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//  End of tt3-test/Main.cpp
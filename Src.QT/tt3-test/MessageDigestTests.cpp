@@ -0,0 +1,124 @@
+//
+//  tt3-test/MessageDigestTests.cpp - tt3::test::MessageDigestTests class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-test/API.hpp"
+using namespace tt3::test;
+
+namespace
+{   //  The FIPS 180 examples and the NIST "one million a's"
+    const QByteArray Empty;
+    const QByteArray Abc = "abc";
+    const QByteArray Message448 = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    const QByteArray Message896 =
+        "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+        "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+    const QByteArray MillionAs(1000000, 'a');
+}
+
+//////////
+//  Test cases
+void MessageDigestTests::sha1_data()
+{
+    _addKnownAnswers(
+        {
+            { Empty, "da39a3ee5e6b4b0d3255bfef95601890afd80709" },
+            { Abc, "a9993e364706816aba3e25717850c26c9cd0d89d" },
+            { Message448, "84983e441c3bd26ebaae4aa1f95129e5e54670f1" },
+            { Message896, "a49b2446a02c645bf419f995b67091253a04a259" },
+            { MillionAs, "34aa973cd4c4daa4f61eeb2bdbad27316534016f" }
+        });
+}
+
+void MessageDigestTests::sha1()
+{
+    _verify(tt3::util::StandardMessageDigests::Sha1::instance());
+}
+
+void MessageDigestTests::sha256_data()
+{
+    _addKnownAnswers(
+        {
+            { Empty, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+            { Abc, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+            { Message448, "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+            { Message896, "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1" },
+            { MillionAs, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" }
+        });
+}
+
+void MessageDigestTests::sha256()
+{
+    _verify(tt3::util::StandardMessageDigests::Sha256::instance());
+}
+
+void MessageDigestTests::cleanup()
+{
+    tt3::util::StandardMessageDigests::setShaInstructionsEnabled(true);
+}
+
+//////////
+//  Implementation helpers
+void MessageDigestTests::_addKnownAnswers(
+        const QList<QPair<QByteArray, QString>> & knownAnswers
+    )
+{
+    QTest::addColumn<QByteArray>("message");
+    QTest::addColumn<QString>("digest");
+    QTest::addColumn<bool>("useShaInstructions");
+
+    for (const auto & [message, digest] : knownAnswers)
+    {
+        for (bool useShaInstructions : { false, true })
+        {
+            QTest::addRow(
+                "%lld bytes, %s",
+                static_cast<long long>(message.size()),
+                useShaInstructions ? "SHA extensions" : "portable")
+                    << message << digest << useShaInstructions;
+        }
+    }
+}
+
+void MessageDigestTests::_verify(tt3::util::IMessageDigest * messageDigest)
+{
+    QFETCH(QByteArray, message);
+    QFETCH(QString, digest);
+    QFETCH(bool, useShaInstructions);
+
+    tt3::util::StandardMessageDigests::setShaInstructionsEnabled(useShaInstructions);
+    if (useShaInstructions && !tt3::util::StandardMessageDigests::isUsingShaInstructions())
+    {
+        QSKIP("The CPU has no SHA extensions");
+    }
+    std::unique_ptr<tt3::util::IMessageDigest::Builder> builder
+        { messageDigest->createBuilder() };
+
+    //  All at once...
+    builder->digestFragment(message.constData(), size_t(message.size()));
+    QCOMPARE(QString::fromLatin1(builder->digestAsBytes().toHex()), digest);
+
+    //  ...and in fragments that straddle the 64-byte blocks
+    builder->reset();
+    for (qsizetype offset = 0; offset < message.size(); offset += 37)
+    {
+        builder->digestFragment(
+            message.constData() + offset,
+            size_t(std::min(qsizetype(37), message.size() - offset)));
+    }
+    QCOMPARE(QString::fromLatin1(builder->digestAsBytes().toHex()), digest);
+}
+
+//  End of tt3-test/MessageDigestTests.cpp
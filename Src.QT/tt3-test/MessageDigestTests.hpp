@@ -0,0 +1,51 @@
+//
+//  tt3-test/MessageDigestTests.hpp - tt3::test::MessageDigestTests class
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#pragma once
+#include "tt3-test/API.hpp"
+
+namespace tt3::test
+{
+    /// \class MessageDigestTests tt3-test/API.hpp
+    /// \brief Known-answer tests of the standard message digests.
+    /// \details
+    ///     Every test is run twice - with the portable code and
+    ///     with the CPU's SHA extensions; the latter is skipped
+    ///     on CPUs that don't have them.
+    class MessageDigestTests final
+        :   public QObject
+    {
+        Q_OBJECT
+
+        //////////
+        //  Test cases
+    private slots:
+        void        sha1_data();
+        void        sha1();
+        void        sha256_data();
+        void        sha256();
+        void        cleanup();
+
+        //////////
+        //  Implementation
+    private:
+        //  Helpers
+        static void _addKnownAnswers(const QList<QPair<QByteArray, QString>> & knownAnswers);
+        static void _verify(tt3::util::IMessageDigest * messageDigest);
+    };
+}
+
+//  End of tt3-test/MessageDigestTests.hpp
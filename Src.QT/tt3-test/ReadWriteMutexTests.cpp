@@ -0,0 +1,113 @@
+//
+//  tt3-test/ReadWriteMutexTests.cpp - tt3::test::ReadWriteMutexTests class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-test/API.hpp"
+using namespace tt3::test;
+
+namespace
+{   //  Long enough for the other thread to start waiting
+    const unsigned long SettleTimeMs = 200;
+}
+
+//////////
+//  Test cases
+void ReadWriteMutexTests::upgradeWaitsForOtherReaders()
+{
+    tt3::util::ReadWriteMutex mutex;
+    QSemaphore reading;
+    std::atomic<bool> upgraded = false;
+
+    mutex.lockForReading();
+    std::thread upgrader(
+        [&]()
+        {
+            mutex.lockForReading();
+            reading.release();
+            mutex.lockForWriting();
+            upgraded = true;
+            mutex.unlock();
+            mutex.unlock();
+        });
+    reading.acquire();
+    QThread::msleep(SettleTimeMs);
+    //  The other reader must wait for this one to stop reading
+    bool upgradedTooSoon = upgraded;
+    mutex.unlock();
+    upgrader.join();
+    QVERIFY(!upgradedTooSoon);
+    QVERIFY(upgraded);
+    QVERIFY(!mutex.isLockedByCurrentThread());
+}
+
+void ReadWriteMutexTests::concurrentUpgradeIsRejected()
+{
+    tt3::util::ReadWriteMutex mutex;
+    QSemaphore reading;
+    std::atomic<bool> upgraded = false;
+    std::atomic<bool> upgradeRejected = false;
+
+    mutex.lockForReading();
+    std::thread upgrader(
+        [&]()
+        {
+            mutex.lockForReading();
+            reading.release();
+            try
+            {
+                mutex.lockForWriting();
+                upgraded = true;
+                mutex.unlock();
+            }
+            catch (const tt3::util::LockUpgradeError &)
+            {   //  Lost the race to this thread - not expected
+                upgradeRejected = true;
+            }
+            mutex.unlock();
+        });
+    reading.acquire();
+    QThread::msleep(SettleTimeMs);
+    //  The other reader is upgrading, so this one can't
+    bool tryUpgraded = mutex.tryLockForWriting(0);
+    bool upgradeThrew = false;
+    if (!tryUpgraded)
+    {
+        try
+        {
+            mutex.lockForWriting();
+            mutex.unlock();
+        }
+        catch (const tt3::util::LockUpgradeError &)
+        {   //  As expected
+            upgradeThrew = true;
+        }
+    }
+    else
+    {   //  OOPS! Undo, so that the other reader can proceed
+        mutex.unlock();
+    }
+    //  Once this thread stops reading, the other one upgrades
+    mutex.unlock();
+    upgrader.join();
+    QVERIFY(!tryUpgraded);
+    QVERIFY(upgradeThrew);
+    QVERIFY(!upgradeRejected);
+    QVERIFY(upgraded);
+    //  ...after which this thread can write again
+    QVERIFY(mutex.tryLockForWriting(0));
+    mutex.unlock();
+}
+
+//  End of tt3-test/ReadWriteMutexTests.cpp
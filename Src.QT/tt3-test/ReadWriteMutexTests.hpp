@@ -0,0 +1,37 @@
+//
+//  tt3-test/ReadWriteMutexTests.hpp - tt3::test::ReadWriteMutexTests class
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#pragma once
+#include "tt3-test/API.hpp"
+
+namespace tt3::test
+{
+    /// \class ReadWriteMutexTests tt3-test/API.hpp
+    /// \brief Tests of upgrading ReadWriteMutex read locks to write locks.
+    class ReadWriteMutexTests final
+        :   public QObject
+    {
+        Q_OBJECT
+
+        //////////
+        //  Test cases
+    private slots:
+        void        upgradeWaitsForOtherReaders();
+        void        concurrentUpgradeIsRejected();
+    };
+}
+
+//  End of tt3-test/ReadWriteMutexTests.hpp
@@ -0,0 +1,251 @@
+//
+//  tt3-test/WorkspaceReportTests.cpp - tt3::test::WorkspaceReportTests class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-test/API.hpp"
+using namespace tt3::test;
+
+namespace
+{
+    const quint64 LeaseDurationMs = 60 * 60 * 1000;
+    const int ModificationCount = 10000;
+    const int ReportedModificationCount = 1000;
+}
+
+//////////
+//  Test cases
+void WorkspaceReportTests::init()
+{
+    _directory = std::make_unique<QTemporaryDir>();
+    QVERIFY2(_directory->isValid(), qPrintable(_directory->errorString()));
+
+    tt3::ws::WorkspaceType workspaceType =
+        tt3::ws::WorkspaceTypeManager::find(tt3::util::Mnemonic("XmlFile"));
+    QVERIFY(workspaceType != nullptr);
+    _workspace =
+        workspaceType->createWorkspace(
+            workspaceType->parseWorkspaceAddress(_databasePath()),  //  may throw
+            "Administrator",
+            AdminLogin,
+            AdminPassword); //  may throw
+    _adminCredentials = tt3::ws::Credentials(AdminLogin, AdminPassword);
+}
+
+void WorkspaceReportTests::cleanup()
+{
+    if (_workspace != nullptr)
+    {
+        _workspace->close();    //  may throw
+        _workspace.reset();
+    }
+    _directory.reset();
+}
+
+void WorkspaceReportTests::readLockDefersRecycling()
+{   //  This is what "report credentials" hold on the database
+    tt3::db::api::IDatabaseAddress * address =
+        tt3::db::xml::DatabaseType::instance()->parseDatabaseAddress(
+            QDir(_directory->path()).absoluteFilePath(
+                "recycling" + tt3::db::xml::DatabaseType::PreferredExtension));  //  may throw
+    address->addReference();
+    std::unique_ptr<tt3::db::api::IDatabase> database
+        { tt3::db::xml::DatabaseType::instance()->createDatabase(address) };    //  may throw
+    //  Nobody holds a reference to the activity, so
+    //  normally destroying it would recycle it at once
+    tt3::db::api::IPublicActivity * activity =
+        database->createPublicActivity(
+            "Activity",
+            QString(),
+            tt3::db::api::InactivityTimeout(),
+            false,
+            false,
+            false,
+            nullptr,
+            nullptr);   //  may throw
+    std::unique_ptr<tt3::db::api::IDatabaseLock> readLock
+        { database->lock(tt3::db::api::IDatabaseLock::LockType::Read) };    //  may throw
+
+    //  The read lock does not keep the activity from being
+    //  destroyed, but it does keep the pointer to it valid
+    activity->destroy();    //  may throw
+    QVERIFY(!activity->isLive());
+    QVERIFY_THROWS_EXCEPTION(tt3::db::api::InstanceDeadException, activity->displayName());
+
+    readLock.reset();
+    database->close();  //  may throw
+    address->removeReference();
+}
+
+void WorkspaceReportTests::reportLockKeepsReportsConsistent()
+{   //  A "report" reads on a worker thread, under a ReportLock,
+    //  while the workspace is being modified on this one
+    tt3::ws::PublicActivity publicActivity = _createPublicActivity("0");
+    tt3::ws::ReportCredentials reportCredentials =
+        _workspace->beginReport(_adminCredentials, LeaseDurationMs);    //  may throw
+
+    std::atomic<bool> modificationsDone = false;
+    qint64 reportCount = 0;
+    QStringList inconsistentReports;
+    QString reportError;
+    std::thread reporter(
+        [&]()
+        {
+            try
+            {   //  Report at least once, however fast the modifications are
+                do
+                {
+                    tt3::ws::WorkspaceImpl::ReportLock reportLock(_workspace, reportCredentials);   //  may throw
+                    QString before = publicActivity->displayName(reportCredentials);    //  may throw
+                    QThread::msleep(1); //  give the writer a chance to interfere
+                    QString after = publicActivity->displayName(reportCredentials); //  may throw
+                    if (after != before)
+                    {   //  OOPS! Modified half-way through the report
+                        inconsistentReports.append(before + " -> " + after);
+                    }
+                    reportCount++;
+                }   while (!modificationsDone);
+            }
+            catch (const tt3::util::Exception & ex)
+            {   //  OOPS! Report on this thread
+                reportError = ex.errorMessage();
+            }
+        });
+    try
+    {
+        for (int i = 1; i <= ReportedModificationCount; i++)
+        {
+            publicActivity->setDisplayName(_adminCredentials, QString::number(i));  //  may throw
+        }
+    }
+    catch (...)
+    {   //  OOPS! Cleanup & re-throw
+        modificationsDone = true;
+        reporter.join();
+        throw;
+    }
+    modificationsDone = true;
+    reporter.join();
+
+    QVERIFY2(reportError.isEmpty(), qPrintable(reportError));
+    QVERIFY(reportCount > 0);
+    QVERIFY2(inconsistentReports.isEmpty(), qPrintable(inconsistentReports.join(", ")));
+    //  Writers only waited - every modification has taken effect
+    QCOMPARE(publicActivity->displayName(reportCredentials), QString::number(ReportedModificationCount));
+
+    //  Released report credentials can't lock the workspace
+    _workspace->releaseCredentials(reportCredentials);  //  may throw
+    QVERIFY_THROWS_EXCEPTION(
+        tt3::ws::AccessDeniedException,
+        tt3::ws::WorkspaceImpl::ReportLock(_workspace, reportCredentials));
+}
+
+void WorkspaceReportTests::readsAreAtomic()
+{   //  Report jobs read on a worker thread while
+    //  the workspace is being modified on this one
+    const QString alpha = "Alpha";
+    const QString omega = "Omega";
+    tt3::ws::PublicActivity publicActivity = _createPublicActivity(alpha);
+    tt3::ws::ReportCredentials reportCredentials =
+        _workspace->beginReport(_adminCredentials, LeaseDurationMs);    //  may throw
+
+    std::atomic<bool> modificationsDone = false;
+    qint64 readCount = 0;
+    QStringList tornReads;
+    QString readError;
+    std::thread reader(
+        [&]()
+        {
+            try
+            {   //  Read at least once, however fast the modifications are
+                do
+                {
+                    QString displayName = publicActivity->displayName(reportCredentials);   //  may throw
+                    if (displayName != alpha && displayName != omega)
+                    {   //  OOPS! Half-way through a modification
+                        tornReads.append(displayName);
+                    }
+                    readCount++;
+                }   while (!modificationsDone);
+            }
+            catch (const tt3::util::Exception & ex)
+            {   //  OOPS! Report on this thread
+                readError = ex.errorMessage();
+            }
+        });
+    try
+    {
+        for (int i = 0; i < ModificationCount; i++)
+        {
+            publicActivity->setDisplayName(_adminCredentials, (i % 2 == 0) ? omega : alpha);  //  may throw
+        }
+    }
+    catch (...)
+    {   //  OOPS! Cleanup & re-throw
+        modificationsDone = true;
+        reader.join();
+        throw;
+    }
+    modificationsDone = true;
+    reader.join();
+    _workspace->releaseCredentials(reportCredentials);  //  may throw
+
+    QVERIFY2(readError.isEmpty(), qPrintable(readError));
+    QVERIFY(readCount > 0);
+    QVERIFY2(tornReads.isEmpty(), qPrintable(tornReads.join(", ")));
+    //  The last modification has taken effect
+    QCOMPARE(publicActivity->displayName(_adminCredentials), alpha);
+}
+
+void WorkspaceReportTests::reportOwnerIsTheCaller()
+{
+    tt3::ws::ReportCredentials reportCredentials =
+        _workspace->beginReport(_adminCredentials, LeaseDurationMs);    //  may throw
+    //  Report credentials have a login of their own...
+    QVERIFY(reportCredentials.login() != AdminLogin);
+    //  ...but the workspace knows whom they were issued to
+    tt3::ws::Account owner = _workspace->reportOwner(reportCredentials);    //  may throw
+    QVERIFY(owner->oid() == _workspace->login(_adminCredentials)->oid());
+    QCOMPARE(owner->login(reportCredentials), AdminLogin);
+
+    //  Released report credentials have no owner
+    _workspace->releaseCredentials(reportCredentials);  //  may throw
+    QVERIFY_THROWS_EXCEPTION(tt3::ws::AccessDeniedException, _workspace->reportOwner(reportCredentials));
+}
+
+//////////
+//  Implementation helpers
+QString WorkspaceReportTests::_databasePath() const
+{
+    return QDir(_directory->path()).absoluteFilePath(
+        "test" + tt3::db::xml::DatabaseType::PreferredExtension);
+}
+
+auto WorkspaceReportTests::_createPublicActivity(
+        const QString & displayName
+    ) -> tt3::ws::PublicActivity
+{
+    return _workspace->createPublicActivity(
+        _adminCredentials,
+        displayName,
+        QString(),
+        tt3::ws::InactivityTimeout(),
+        false,
+        false,
+        false,
+        nullptr,
+        nullptr);   //  may throw
+}
+
+//  End of tt3-test/WorkspaceReportTests.cpp
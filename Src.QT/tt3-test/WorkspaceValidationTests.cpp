@@ -0,0 +1,140 @@
+//
+//  tt3-test/WorkspaceValidationTests.cpp - tt3::test::WorkspaceValidationTests class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-test/API.hpp"
+using namespace tt3::test;
+
+namespace
+{
+    const quint64 LeaseDurationMs = 60 * 60 * 1000;
+}
+
+//////////
+//  Test cases
+void WorkspaceValidationTests::init()
+{
+    _directory = std::make_unique<QTemporaryDir>();
+    QVERIFY2(_directory->isValid(), qPrintable(_directory->errorString()));
+
+    tt3::ws::WorkspaceType workspaceType =
+        tt3::ws::WorkspaceTypeManager::find(tt3::util::Mnemonic("XmlFile"));
+    QVERIFY(workspaceType != nullptr);
+    _workspace =
+        workspaceType->createWorkspace(
+            workspaceType->parseWorkspaceAddress(_databasePath()),  //  may throw
+            "Administrator",
+            AdminLogin,
+            AdminPassword); //  may throw
+    _adminCredentials = tt3::ws::Credentials(AdminLogin, AdminPassword);
+}
+
+void WorkspaceValidationTests::cleanup()
+{
+    if (_workspace != nullptr)
+    {
+        _workspace->close();    //  may throw
+        _workspace.reset();
+    }
+    _directory.reset();
+}
+
+void WorkspaceValidationTests::consistentWorkspaceValidates()
+{
+    _createPublicActivity("Alpha");
+    tt3::ws::PublicActivity omega = _createPublicActivity("Omega");
+    _workspace->validate(_adminCredentials);    //  may throw
+
+    //  ...and stays consistent after changes and a reload
+    omega->destroy(_adminCredentials);  //  may throw
+    _workspace->validate(_adminCredentials);    //  may throw
+    _workspace->close();    //  may throw
+    _workspace = _openWorkspace();  //  may throw
+    _workspace->validate(_adminCredentials);    //  may throw
+}
+
+void WorkspaceValidationTests::validationNeedsAdministrator()
+{
+    QVERIFY_THROWS_EXCEPTION(
+        tt3::ws::AccessDeniedException,
+        _workspace->validate(tt3::ws::Credentials(AdminLogin, "wrong" + AdminPassword)));
+    tt3::ws::ReportCredentials reportCredentials =
+        _workspace->beginReport(_adminCredentials, LeaseDurationMs);    //  may throw
+    QVERIFY_THROWS_EXCEPTION(
+        tt3::ws::AccessDeniedException,
+        _workspace->validate(reportCredentials));
+    _workspace->releaseCredentials(reportCredentials);  //  may throw
+}
+
+void WorkspaceValidationTests::corruptFileIsRejected()
+{
+    _createPublicActivity("Alpha");
+    _createPublicActivity("Omega");
+    _workspace->close();    //  may throw
+    _workspace.reset();
+
+    //  Sibling activities with the same name are well-formed
+    //  XML, but no consistent workspace can contain them
+    QFile file(_databasePath());
+    QVERIFY2(file.open(QIODevice::ReadOnly), qPrintable(file.errorString()));
+    QByteArray content = file.readAll();
+    file.close();
+    QVERIFY(content.contains("DisplayName=\"Omega\""));
+    content.replace("DisplayName=\"Omega\"", "DisplayName=\"Alpha\"");
+    QVERIFY2(file.open(QIODevice::WriteOnly | QIODevice::Truncate), qPrintable(file.errorString()));
+    file.write(content);
+    file.close();
+
+    QVERIFY_THROWS_EXCEPTION(
+        tt3::ws::WorkspaceCorruptException,
+        _openWorkspace());
+}
+
+//////////
+//  Implementation helpers
+QString WorkspaceValidationTests::_databasePath() const
+{
+    return QDir(_directory->path()).absoluteFilePath(
+        "test" + tt3::db::xml::DatabaseType::PreferredExtension);
+}
+
+auto WorkspaceValidationTests::_createPublicActivity(
+        const QString & displayName
+    ) -> tt3::ws::PublicActivity
+{
+    return _workspace->createPublicActivity(
+        _adminCredentials,
+        displayName,
+        QString(),
+        tt3::ws::InactivityTimeout(),
+        false,
+        false,
+        false,
+        nullptr,
+        nullptr);   //  may throw
+}
+
+auto WorkspaceValidationTests::_openWorkspace(
+    ) -> tt3::ws::Workspace
+{
+    tt3::ws::WorkspaceType workspaceType =
+        tt3::ws::WorkspaceTypeManager::find(tt3::util::Mnemonic("XmlFile"));
+    Q_ASSERT(workspaceType != nullptr);
+    return workspaceType->openWorkspace(
+        workspaceType->parseWorkspaceAddress(_databasePath()),  //  may throw
+        tt3::ws::OpenMode::ReadWrite);  //  may throw
+}
+
+//  End of tt3-test/WorkspaceValidationTests.cpp
@@ -0,0 +1,61 @@
+//
+//  tt3-test/WorkspaceValidationTests.hpp - tt3::test::WorkspaceValidationTests class
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#pragma once
+#include "tt3-test/API.hpp"
+
+namespace tt3::test
+{
+    /// \class WorkspaceValidationTests tt3-test/API.hpp
+    /// \brief Tests of full workspace consistency checks.
+    class WorkspaceValidationTests final
+        :   public QObject
+    {
+        Q_OBJECT
+
+        //////////
+        //  Constants
+    private:
+        static inline const QString AdminLogin = "admin";
+        static inline const QString AdminPassword = "password";
+
+        //////////
+        //  Test cases
+    private slots:
+        void        init();
+        void        cleanup();
+        void        consistentWorkspaceValidates();
+        void        validationNeedsAdministrator();
+        void        corruptFileIsRejected();
+
+        //////////
+        //  Implementation
+    private:
+        std::unique_ptr<QTemporaryDir>  _directory;
+        tt3::ws::Workspace  _workspace;
+        tt3::ws::Credentials    _adminCredentials;
+
+        //  Helpers
+        QString     _databasePath() const;
+        auto        _createPublicActivity(
+                            const QString & displayName
+                        ) -> tt3::ws::PublicActivity;
+        auto        _openWorkspace(
+                        ) -> tt3::ws::Workspace;
+    };
+}
+
+//  End of tt3-test/WorkspaceValidationTests.hpp
@@ -0,0 +1,31 @@
+include(../tt3.pri)
+
+QT += testlib
+CONFIG += console testcase
+
+SOURCES += \
+    BackupRestoreTests.cpp \
+    Main.cpp \
+    MessageDigestTests.cpp \
+    ReadWriteMutexTests.cpp \
+    WorkspaceReportTests.cpp \
+    WorkspaceValidationTests.cpp
+
+HEADERS += \
+    API.hpp \
+    BackupRestoreTests.hpp \
+    MessageDigestTests.hpp \
+    ReadWriteMutexTests.hpp \
+    WorkspaceReportTests.hpp \
+    WorkspaceValidationTests.hpp
+
+PRECOMPILED_HEADER = API.hpp
+
+LIBS += \
+    -ltt3-tools-restore$$TARGET_SUFFIX \
+    -ltt3-tools-backup$$TARGET_SUFFIX \
+    -ltt3-gui$$TARGET_SUFFIX \
+    -ltt3-ws$$TARGET_SUFFIX \
+    -ltt3-db-xml$$TARGET_SUFFIX \
+    -ltt3-db-api$$TARGET_SUFFIX \
+    -ltt3-util$$TARGET_SUFFIX
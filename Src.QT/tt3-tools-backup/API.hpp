@@ -27,8 +27,8 @@
 #include "tt3-tools-backup/Component.hpp"
 
 #include "tt3-tools-backup/BackupTool.hpp"
+#include "tt3-tools-backup/BackupWriter.hpp"
 #include "tt3-tools-backup/ConfigureBackupDialog.hpp"
 #include "tt3-tools-backup/BackupProgressDialog.hpp"
-#include "tt3-tools-backup/BackupWriter.hpp"
 
 //  End of tt3-tools-backup/API.hpp
@@ -116,13 +116,18 @@ void BackupTool::run(QWidget * parent)
     //  At this point, we have a) the workspace to backup
     //  and b) the credentials that allow to do so
     QString backupDestination = dlg.selectedBackupDestination();
+    QString baseBackup = dlg.selectedBaseBackup();
     bool backupSuccessful = false;
     try
     {
         BackupWriter backupWriter(
             workspace,
             credentials,
-            backupDestination);
+            backupDestination,
+            dlg.selectedBackupFormat(),
+            baseBackup.isEmpty() ?
+                std::optional<quint64>() :
+                BackupWriter::modificationStampOf(baseBackup)); //  may throw
         backupSuccessful =
             backupWriter.backupWorkspace(); //  may throw
         //  BackupWriter's destructor closes the backup file
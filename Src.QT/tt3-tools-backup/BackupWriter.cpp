@@ -76,6 +76,27 @@ namespace
         }
         return '"' + result + '"';
     }
+
+    //  Format::Binary timestamps are UTC milliseconds since epoch
+    qint64 binaryTimestamp(const QDateTime & dt)
+    {
+        return dt.isValid() ?
+                    dt.toMSecsSinceEpoch() :
+                    std::numeric_limits<qint64>::min();
+    }
+
+    qint32 binaryCapabilities(const tt3::ws::Capabilities & capabilities)
+    {
+        qint32 mask = 0;
+        for (qint32 bit = 0x0001; bit <= 0x1000; bit <<= 1)
+        {
+            if (capabilities.contains(tt3::ws::Capability(bit)))
+            {
+                mask |= bit;
+            }
+        }
+        return mask;
+    }
 }
 
 //////////
@@ -83,7 +104,9 @@ namespace
 BackupWriter::BackupWriter(
         tt3::ws::Workspace workspace,
         const tt3::ws::Credentials & credentials,
-        const QString & backupFileName
+        const QString & backupFileName,
+        Format format,
+        std::optional<quint64> baseModificationStamp
     ) : _workspace(workspace),
         _credentials(
             workspace->beginBackup(   //  may throw
@@ -91,12 +114,19 @@ BackupWriter::BackupWriter(
                 workspace->objectCount(credentials) * 85 + //  1,000,000 objects -> 1 day lease...
                 60 * 60 * 1000  //  ...+ 1 hour
               )),
+        _format(format),
+        _baseModificationStamp(baseModificationStamp),
         _backupFile(backupFileName),
         _backupStream(&_backupFile),
+        _binaryStream(&_backupFile),
         _objectsToWrite(_workspace->objectCount(_credentials)),
         _associationsToWrite(_workspace->objectCount(_credentials)),
         _oneObjectDelayMs(int(5000 / (_objectsToWrite + 1) + 1))
 {
+    _binaryStream.setVersion(QDataStream::Qt_6_0);
+    _binaryBlockStream.setVersion(QDataStream::Qt_6_0);
+    _binaryRecordStream.setVersion(QDataStream::Qt_6_0);
+    _binaryValueStream.setVersion(QDataStream::Qt_6_0);
 }
 
 BackupWriter::~BackupWriter()
@@ -117,13 +147,43 @@ BackupWriter::~BackupWriter()
 //  Operations
 bool BackupWriter::backupWorkspace()
 {
+    static Component::Resources *const resources = Component::Resources::instance();   //  idempotent
     Q_ASSERT(_objectsWritten == 0 && _associationsWritten == 0);
 
+    //  Can a delta be written against this base ?
+    if (_isDelta() &&
+        _baseModificationStamp.value() < _workspace->oldestBaseModificationStamp(_credentials)) //  may throw
+    {   //  OOPS! Objects destroyed since may be missed
+        throw tt3::ws::CustomWorkspaceException(
+            resources->string(RSID(BackupWriter), RID(BaseBackupTooOld)));
+    }
+
     //  Prepare to backup
     if (!_backupFile.open(QIODevice::WriteOnly))
     {   //  OOPS!
         throw tt3::ws::CustomWorkspaceException(_backupFile.fileName() + ": " + _backupFile.errorString());
     }
+    if (_format == Format::Binary)
+    {
+        _binaryStream.writeRawData(BinaryMagic.constData(), int(BinaryMagic.size()));
+        _binaryStream << BinaryVersion;
+    }
+
+    //  The workspace is read-locked, so these stay valid
+    //  throughout the backup. A delta backup only needs
+    //  to visit the objects changed since its base.
+    _modificationStamp = _workspace->modificationStamp(_credentials);  //  may throw
+    _instanceId = _workspace->instanceId(_credentials);  //  may throw
+    tt3::ws::Oids changedOids, destroyedOids;
+    if (_isDelta())
+    {
+        changedOids =
+            _workspace->modifiedOidsSince(_credentials, _baseModificationStamp.value()); //  may throw
+        destroyedOids =
+            _workspace->destroyedOidsSince(_credentials, _baseModificationStamp.value()); //  may throw
+        _objectsToWrite = changedOids.size() + destroyedOids.size();
+        _associationsToWrite = changedOids.size();
+    }
 
     //  Do we need a progress dialog ?
     if (QThread::currentThread()->eventDispatcher() != nullptr)
@@ -140,75 +200,14 @@ bool BackupWriter::backupWorkspace()
     try
     {
         //  All _backup...() services may throw
-
-        //  Objects...
-        _backupObjects( //  Users + Accounts
-            _workspace->users(_credentials));
-        _backupObjects( //  ActivityTypes
-            _workspace->activityTypes(_credentials));
-        _backupObjects( //  PublicActivities
-            _workspace->publicActivities(_credentials));
-        _backupObjects( //  PublicTasks incl. children
-            _workspace->rootPublicTasks(_credentials));
-        for (const auto & user :
-             _sortedByOid(_workspace->users(_credentials)))
+        _writeBackupHeader();
+        if (_isDelta())
         {
-            _backupObjects( //  PrivateActivities
-                user->privateActivities(_credentials));
-            _backupObjects( //  PrivateTasks incl. children
-                user->rootPrivateTasks(_credentials));
+            _backupChanges(changedOids, destroyedOids);
         }
-        _backupObjects( //  Projects incl. children
-            _workspace->rootProjects(_credentials));
-        _backupObjects( //  WorkStreams
-            _workspace->workStreams(_credentials));
-        _backupObjects( //  Beneficiaries
-            _workspace->beneficiaries(_credentials));
-        for (const auto & user :
-             _sortedByOid(_workspace->users(_credentials)))
+        else
         {
-            for (const auto & account : user->accounts(_credentials))
-            {
-                _backupObjects( //  Works
-                    account->works(_credentials));
-                _backupObjects( //  Events
-                    account->events(_credentials));
-            }
-        }
-
-        //  ...and associations
-        _backupOutgoingAssociations( //  Users + Accounts
-            _workspace->users(_credentials));
-        _backupOutgoingAssociations( //  ActivityTypes
-            _workspace->activityTypes(_credentials));
-        _backupOutgoingAssociations( //  PublicActivities
-            _workspace->publicActivities(_credentials));
-        _backupOutgoingAssociations( //  PublicTasks incl. children
-            _workspace->rootPublicTasks(_credentials));
-        for (const auto & user :
-             _sortedByOid(_workspace->users(_credentials)))
-        {
-            _backupOutgoingAssociations( //  PrivateActivities
-                user->privateActivities(_credentials));
-            _backupOutgoingAssociations( //  PrivateTasks incl. children
-                user->rootPrivateTasks(_credentials));
-        }
-        _backupOutgoingAssociations( //  Projects incl. children
-            _workspace->rootProjects(_credentials));
-        _backupOutgoingAssociations( //  WorkStreams
-            _workspace->workStreams(_credentials));
-        _backupOutgoingAssociations( //  Beneficiaries
-            _workspace->beneficiaries(_credentials));
-        for (const auto & user :
-             _sortedByOid(_workspace->users(_credentials)))
-        {
-            for (const auto & account : user->accounts(_credentials))
-            {
-                _backupOutgoingAssociations( //  Works
-                    account->works(_credentials));
-                _backupOutgoingAssociations( //  Events
-                    account->events(_credentials));
-            }
+            _backupEverything();
         }
 
         Q_ASSERT(_objectsWritten == _objectsToWrite);
@@ -220,15 +219,26 @@ bool BackupWriter::backupWorkspace()
         //  them leads to earlier lock release and
         //  better error diagnostics.
         _progressDialog.reset(nullptr);
-        _backupStream.flush();
+        _finishWriting();
         _backupFile.close();
-        _workspace->releaseCredentials(_credentials);   //  may throw
         if (_backupFile.error() != QFile::NoError)
         {   //  OOPS! Disk full, etc.
             QFile::remove(_backupFile.fileName());  //  may fail, but who cares at this point...
             throw tt3::ws::CustomWorkspaceException(
                 _backupFile.fileName() + ": " + _backupFile.errorString());
         }
+        if (!_isDelta() && !_workspace->isReadOnly())
+        {   //  Deltas can now be written against this backup
+            try
+            {
+                _workspace->recordFullBackup(_credentials, _modificationStamp);   //  may throw
+            }
+            catch (const tt3::util::Exception & ex)
+            {   //  OOPS! Log; the backup itself is fine
+                qCritical() << ex;
+            }
+        }
+        _workspace->releaseCredentials(_credentials);   //  may throw
         return true;
     }
     catch (const _CancelRequest &)
@@ -249,6 +259,100 @@ bool BackupWriter::backupWorkspace()
     }
 }
 
+quint64 BackupWriter::modificationStampOf(
+        const QString & backupFileName
+    )
+{
+    static Component::Resources *const resources = Component::Resources::instance();   //  idempotent
+
+    QFile file(backupFileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {   //  OOPS!
+        throw tt3::ws::CustomWorkspaceException(file.fileName() + ": " + file.errorString());
+    }
+    std::optional<quint64> modificationStamp;
+    if (file.peek(BinaryMagic.size()) == BinaryMagic)
+    {   //  Format::Binary - the header is the 1st record of the 1st block
+        QDataStream stream(&file);
+        stream.setVersion(QDataStream::Qt_6_0);
+        stream.skipRawData(int(BinaryMagic.size()));
+        quint32 version = 0, blockSize = 0;
+        stream >> version >> blockSize;
+        if (version >= 2 && blockSize > 0 && stream.status() == QDataStream::Ok)
+        {
+            QByteArray block = qUncompress(file.read(blockSize));
+            QDataStream blockStream(block);
+            blockStream.setVersion(QDataStream::Qt_6_0);
+            QByteArray record;
+            blockStream >> record;
+            QDataStream recordStream(record);
+            recordStream.setVersion(QDataStream::Qt_6_0);
+            QString recordType;
+            recordStream >> recordType;
+            while (recordType == "Backup:Header" && !recordStream.atEnd())
+            {
+                QString fieldName;
+                QByteArray fieldValue;
+                recordStream >> fieldName >> fieldValue;
+                if (recordStream.status() != QDataStream::Ok)
+                {   //  OOPS! Truncated record
+                    break;
+                }
+                if (fieldName == "ModificationStamp")
+                {
+                    QDataStream valueStream(fieldValue);
+                    valueStream.setVersion(QDataStream::Qt_6_0);
+                    quint64 value = 0;
+                    valueStream >> value;
+                    if (valueStream.status() == QDataStream::Ok)
+                    {
+                        modificationStamp = value;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    else
+    {   //  Format::Text - the header is the 1st record of the file
+        QTextStream stream(&file);
+        if (stream.readLine().trimmed() == "[Backup:Header]")
+        {
+            while (!stream.atEnd())
+            {
+                QString line = stream.readLine().trimmed();
+                if (line.isEmpty() || line.startsWith('['))
+                {   //  End of the header record
+                    break;
+                }
+                if (line.startsWith("ModificationStamp="))
+                {
+                    QString value = line.mid(18);
+                    qsizetype scan = 0;
+                    try
+                    {
+                        quint64 parsedValue = tt3::util::fromString<quint64>(value, scan);
+                        if (scan == value.length())
+                        {
+                            modificationStamp = parsedValue;
+                        }
+                    }
+                    catch (const tt3::util::ParseException &)
+                    {   //  Leave modificationStamp unset
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    if (!modificationStamp.has_value())
+    {   //  OOPS! Not a backup, or one written before delta backups
+        throw tt3::ws::CustomWorkspaceException(
+            resources->string(RSID(BackupWriter), RID(NotAStampedBackup), file.fileName()));
+    }
+    return modificationStamp.value();
+}
+
 //////////
 //  Implementation helpers
 void BackupWriter::_onObjectWritten()
@@ -279,6 +383,130 @@ void BackupWriter::_reportProgress()
     }
 }
 
+void BackupWriter::_backupEverything()
+{
+    //  Objects...
+    _backupObjects( //  Users + Accounts
+        _workspace->users(_credentials));
+    _backupObjects( //  ActivityTypes
+        _workspace->activityTypes(_credentials));
+    _backupObjects( //  PublicActivities
+        _workspace->publicActivities(_credentials));
+    _backupObjects( //  PublicTasks incl. children
+        _workspace->rootPublicTasks(_credentials));
+    for (const auto & user :
+         _sortedByOid(_workspace->users(_credentials)))
+    {
+        _backupObjects( //  PrivateActivities
+            user->privateActivities(_credentials));
+        _backupObjects( //  PrivateTasks incl. children
+            user->rootPrivateTasks(_credentials));
+    }
+    _backupObjects( //  Projects incl. children
+        _workspace->rootProjects(_credentials));
+    _backupObjects( //  WorkStreams
+        _workspace->workStreams(_credentials));
+    _backupObjects( //  Beneficiaries
+        _workspace->beneficiaries(_credentials));
+    for (const auto & user :
+         _sortedByOid(_workspace->users(_credentials)))
+    {
+        for (const auto & account : user->accounts(_credentials))
+        {
+            _backupObjects( //  Works
+                account->works(_credentials));
+            _backupObjects( //  Events
+                account->events(_credentials));
+        }
+    }
+
+    //  ...and associations
+    _backupOutgoingAssociations( //  Users + Accounts
+        _workspace->users(_credentials));
+    _backupOutgoingAssociations( //  ActivityTypes
+        _workspace->activityTypes(_credentials));
+    _backupOutgoingAssociations( //  PublicActivities
+        _workspace->publicActivities(_credentials));
+    _backupOutgoingAssociations( //  PublicTasks incl. children
+        _workspace->rootPublicTasks(_credentials));
+    for (const auto & user :
+         _sortedByOid(_workspace->users(_credentials)))
+    {
+        _backupOutgoingAssociations( //  PrivateActivities
+            user->privateActivities(_credentials));
+        _backupOutgoingAssociations( //  PrivateTasks incl. children
+            user->rootPrivateTasks(_credentials));
+    }
+    _backupOutgoingAssociations( //  Projects incl. children
+        _workspace->rootProjects(_credentials));
+    _backupOutgoingAssociations( //  WorkStreams
+        _workspace->workStreams(_credentials));
+    _backupOutgoingAssociations( //  Beneficiaries
+        _workspace->beneficiaries(_credentials));
+    for (const auto & user :
+         _sortedByOid(_workspace->users(_credentials)))
+    {
+        for (const auto & account : user->accounts(_credentials))
+        {
+            _backupOutgoingAssociations( //  Works
+                account->works(_credentials));
+            _backupOutgoingAssociations( //  Events
+                account->events(_credentials));
+        }
+    }
+}
+
+void BackupWriter::_backupChanges(
+        const tt3::ws::Oids & changedOids,
+        const tt3::ws::Oids & destroyedOids
+    )
+{
+    //  Changed objects, in the order a full backup
+    //  would write them...
+    QList<tt3::ws::Object> changedObjects;
+    changedObjects.reserve(changedOids.size());
+    for (const auto & oid : changedOids)
+    {
+        if (auto object =
+            _workspace->findObjectByOid<tt3::ws::Object>(_credentials, oid))
+        {
+            changedObjects.append(object);
+        }
+    }
+    std::sort(
+        changedObjects.begin(),
+        changedObjects.end(),
+        [](const auto & a, const auto & b)
+        {
+            int aOrder = _backupOrder(a), bOrder = _backupOrder(b);
+            return (aOrder != bOrder) ? (aOrder < bOrder) : (a->oid() < b->oid());
+        });
+    _objectsToWrite -= changedOids.size() - changedObjects.size();
+    _associationsToWrite -= changedOids.size() - changedObjects.size();
+    for (const auto & object : std::as_const(changedObjects))
+    {
+        _backupChangedObject(object);
+        _onObjectWritten();
+    }
+
+    //  ...with all their outgoing associations, which
+    //  replace those they had in the base backup...
+    for (const auto & object : std::as_const(changedObjects))
+    {
+        _backupChangedObjectOutgoingAssociations(object);
+        _onAssociationWritten();
+    }
+
+    //  ...and destroyed objects
+    QList<tt3::ws::Oid> sortedDestroyedOids = destroyedOids.values();
+    std::sort(sortedDestroyedOids.begin(), sortedDestroyedOids.end());
+    for (const auto & oid : std::as_const(sortedDestroyedOids))
+    {
+        _writeTombstone(oid);
+        _onObjectWritten();
+    }
+}
+
 void BackupWriter::_backupObject(
         tt3::ws::User user
     )
@@ -291,7 +519,10 @@ void BackupWriter::_backupObject(
     _writeObjectProperty("InactivityTimeout", user->inactivityTimeout(_credentials));
     _writeObjectProperty("UiLocale", user->uiLocale(_credentials));
 
-    _backupObjects(user->accounts(_credentials));
+    if (!_isDelta())
+    {   //  A delta backup visits aggregated objects on their own
+        _backupObjects(user->accounts(_credentials));
+    }
 }
 
 void BackupWriter::_backupObject(
@@ -353,7 +584,10 @@ void BackupWriter::_backupObject(
     _writeObjectProperty("RequireCommentOnCompletion", publicTask->requireCommentOnCompletion(_credentials));
     _writeObjectProperty("Completed", publicTask->completed(_credentials));
 
-    _backupObjects(publicTask->children(_credentials));
+    if (!_isDelta())
+    {   //  A delta backup visits aggregated objects on their own
+        _backupObjects(publicTask->children(_credentials));
+    }
 }
 
 void BackupWriter::_backupObject(
@@ -393,7 +627,10 @@ void BackupWriter::_backupObject(
     _writeObjectProperty("RequireCommentOnCompletion", privateTask->requireCommentOnCompletion(_credentials));
     _writeObjectProperty("Completed", privateTask->completed(_credentials));
 
-    _backupObjects(privateTask->children(_credentials));
+    if (!_isDelta())
+    {   //  A delta backup visits aggregated objects on their own
+        _backupObjects(privateTask->children(_credentials));
+    }
 }
 
 void BackupWriter::_backupObject(
@@ -410,7 +647,10 @@ void BackupWriter::_backupObject(
     _writeObjectProperty("Description", project->description(_credentials));
     _writeObjectProperty("Completed", project->completed(_credentials));
 
-    _backupObjects(project->children(_credentials));
+    if (!_isDelta())
+    {   //  A delta backup visits aggregated objects on their own
+        _backupObjects(project->children(_credentials));
+    }
 }
 
 void BackupWriter::_backupObject(
@@ -485,7 +725,10 @@ void BackupWriter::_backupOutgoingAssociations(    //  incl. Accounts
             workload);
     }
 
-    _backupOutgoingAssociations(user->accounts(_credentials));
+    if (!_isDelta())
+    {   //  A delta backup visits aggregated objects on their own
+        _backupOutgoingAssociations(user->accounts(_credentials));
+    }
 }
 
 void BackupWriter::_backupOutgoingAssociations(    //  incl. Accounts
@@ -548,7 +791,10 @@ void BackupWriter::_backupOutgoingAssociations(    //  incl. Accounts
             workload);
     }
 
-    _backupOutgoingAssociations(publicTask->children(_credentials));
+    if (!_isDelta())
+    {   //  A delta backup visits aggregated objects on their own
+        _backupOutgoingAssociations(publicTask->children(_credentials));
+    }
 }
 
 void BackupWriter::_backupOutgoingAssociations(    //  incl. Accounts
@@ -590,7 +836,10 @@ void BackupWriter::_backupOutgoingAssociations(    //  incl. Accounts
             workload);
     }
 
-    _backupOutgoingAssociations(privateTask->children(_credentials));
+    if (!_isDelta())
+    {   //  A delta backup visits aggregated objects on their own
+        _backupOutgoingAssociations(privateTask->children(_credentials));
+    }
 }
 
 void BackupWriter::_backupOutgoingAssociations(    //  incl. Accounts
@@ -607,7 +856,10 @@ void BackupWriter::_backupOutgoingAssociations(    //  incl. Accounts
             beneficiary);
     }
 
-    _backupOutgoingAssociations(project->children(_credentials));
+    if (!_isDelta())
+    {   //  A delta backup visits aggregated objects on their own
+        _backupOutgoingAssociations(project->children(_credentials));
+    }
 }
 
 void BackupWriter::_backupOutgoingAssociations(    //  incl. Accounts
@@ -643,25 +895,240 @@ void BackupWriter::_backupOutgoingAssociations(    //  incl. Accounts
 {   //  No outgoing associations
 }
 
-void BackupWriter::_writeObjectHeader(
+void BackupWriter::_backupChangedObject(
+        const tt3::ws::Object & object
+    )
+{   //  Tasks are also Activities, so they go first
+    if (auto user = std::dynamic_pointer_cast<tt3::ws::UserImpl>(object))
+    {
+        _backupObject(user);
+    }
+    else if (auto account = std::dynamic_pointer_cast<tt3::ws::AccountImpl>(object))
+    {
+        _backupObject(account);
+    }
+    else if (auto activityType = std::dynamic_pointer_cast<tt3::ws::ActivityTypeImpl>(object))
+    {
+        _backupObject(activityType);
+    }
+    else if (auto publicTask = std::dynamic_pointer_cast<tt3::ws::PublicTaskImpl>(object))
+    {
+        _backupObject(publicTask);
+    }
+    else if (auto publicActivity = std::dynamic_pointer_cast<tt3::ws::PublicActivityImpl>(object))
+    {
+        _backupObject(publicActivity);
+    }
+    else if (auto privateTask = std::dynamic_pointer_cast<tt3::ws::PrivateTaskImpl>(object))
+    {
+        _backupObject(privateTask);
+    }
+    else if (auto privateActivity = std::dynamic_pointer_cast<tt3::ws::PrivateActivityImpl>(object))
+    {
+        _backupObject(privateActivity);
+    }
+    else if (auto project = std::dynamic_pointer_cast<tt3::ws::ProjectImpl>(object))
+    {
+        _backupObject(project);
+    }
+    else if (auto workStream = std::dynamic_pointer_cast<tt3::ws::WorkStreamImpl>(object))
+    {
+        _backupObject(workStream);
+    }
+    else if (auto beneficiary = std::dynamic_pointer_cast<tt3::ws::BeneficiaryImpl>(object))
+    {
+        _backupObject(beneficiary);
+    }
+    else if (auto work = std::dynamic_pointer_cast<tt3::ws::WorkImpl>(object))
+    {
+        _backupObject(work);
+    }
+    else if (auto event = std::dynamic_pointer_cast<tt3::ws::EventImpl>(object))
+    {
+        _backupObject(event);
+    }
+    else
+    {   //  OOPS! Can't happen
+        Q_ASSERT(false);
+    }
+}
+
+void BackupWriter::_backupChangedObjectOutgoingAssociations(
+        const tt3::ws::Object & object
+    )
+{   //  Tasks are also Activities, so they go first
+    if (auto user = std::dynamic_pointer_cast<tt3::ws::UserImpl>(object))
+    {
+        _backupOutgoingAssociations(user);
+    }
+    else if (auto account = std::dynamic_pointer_cast<tt3::ws::AccountImpl>(object))
+    {
+        _backupOutgoingAssociations(account);
+    }
+    else if (auto activityType = std::dynamic_pointer_cast<tt3::ws::ActivityTypeImpl>(object))
+    {
+        _backupOutgoingAssociations(activityType);
+    }
+    else if (auto publicTask = std::dynamic_pointer_cast<tt3::ws::PublicTaskImpl>(object))
+    {
+        _backupOutgoingAssociations(publicTask);
+    }
+    else if (auto publicActivity = std::dynamic_pointer_cast<tt3::ws::PublicActivityImpl>(object))
+    {
+        _backupOutgoingAssociations(publicActivity);
+    }
+    else if (auto privateTask = std::dynamic_pointer_cast<tt3::ws::PrivateTaskImpl>(object))
+    {
+        _backupOutgoingAssociations(privateTask);
+    }
+    else if (auto privateActivity = std::dynamic_pointer_cast<tt3::ws::PrivateActivityImpl>(object))
+    {
+        _backupOutgoingAssociations(privateActivity);
+    }
+    else if (auto project = std::dynamic_pointer_cast<tt3::ws::ProjectImpl>(object))
+    {
+        _backupOutgoingAssociations(project);
+    }
+    else if (auto workStream = std::dynamic_pointer_cast<tt3::ws::WorkStreamImpl>(object))
+    {
+        _backupOutgoingAssociations(workStream);
+    }
+    else if (auto beneficiary = std::dynamic_pointer_cast<tt3::ws::BeneficiaryImpl>(object))
+    {
+        _backupOutgoingAssociations(beneficiary);
+    }
+    else if (auto work = std::dynamic_pointer_cast<tt3::ws::WorkImpl>(object))
+    {
+        _backupOutgoingAssociations(work);
+    }
+    else if (auto event = std::dynamic_pointer_cast<tt3::ws::EventImpl>(object))
+    {
+        _backupOutgoingAssociations(event);
+    }
+    else
+    {   //  OOPS! Can't happen
+        Q_ASSERT(false);
+    }
+}
+
+int BackupWriter::_backupOrder(
         const tt3::ws::Object & object
     )
+{   //  Same as that of a full backup, so that objects
+    //  come after the objects they refer to, if possible
+    if (std::dynamic_pointer_cast<tt3::ws::UserImpl>(object) != nullptr)
+    {
+        return 0;
+    }
+    else if (std::dynamic_pointer_cast<tt3::ws::AccountImpl>(object) != nullptr)
+    {
+        return 1;
+    }
+    else if (std::dynamic_pointer_cast<tt3::ws::ActivityTypeImpl>(object) != nullptr)
+    {
+        return 2;
+    }
+    else if (std::dynamic_pointer_cast<tt3::ws::PublicTaskImpl>(object) != nullptr)
+    {
+        return 4;
+    }
+    else if (std::dynamic_pointer_cast<tt3::ws::PublicActivityImpl>(object) != nullptr)
+    {
+        return 3;
+    }
+    else if (std::dynamic_pointer_cast<tt3::ws::PrivateTaskImpl>(object) != nullptr)
+    {
+        return 6;
+    }
+    else if (std::dynamic_pointer_cast<tt3::ws::PrivateActivityImpl>(object) != nullptr)
+    {
+        return 5;
+    }
+    else if (std::dynamic_pointer_cast<tt3::ws::ProjectImpl>(object) != nullptr)
+    {
+        return 7;
+    }
+    else if (std::dynamic_pointer_cast<tt3::ws::WorkStreamImpl>(object) != nullptr)
+    {
+        return 8;
+    }
+    else if (std::dynamic_pointer_cast<tt3::ws::BeneficiaryImpl>(object) != nullptr)
+    {
+        return 9;
+    }
+    else if (std::dynamic_pointer_cast<tt3::ws::WorkImpl>(object) != nullptr)
+    {
+        return 10;
+    }
+    else if (std::dynamic_pointer_cast<tt3::ws::EventImpl>(object) != nullptr)
+    {
+        return 11;
+    }
+    else
+    {   //  OOPS! Can't happen
+        Q_ASSERT(false);
+        return INT_MAX;
+    }
+}
+
+void BackupWriter::_writeBackupHeader()
+{
+    if (_format == Format::Binary)
+    {
+        _beginBinaryRecord("Backup:Header");
+    }
+    else
+    {   //  Don't put newline before the 1st record
+        _backupStream << "[Backup:Header]\n";
+    }
+    _writeObjectProperty("InstanceId", _instanceId.toString(QUuid::WithoutBraces));
+    _writeObjectProperty("ModificationStamp", _modificationStamp);
+    if (_isDelta())
+    {
+        _writeObjectProperty("BaseModificationStamp", _baseModificationStamp.value());
+    }
+}
+
+void BackupWriter::_writeTombstone(
+        const tt3::ws::Oid & oid
+    )
+{
+    _writeRecordHeader("Backup:Tombstone");
+    _writeObjectProperty("OID", oid);
+}
+
+void BackupWriter::_writeRecordHeader(
+        const QString & recordType
+    )
 {
-    if (_objectsWritten != 0 || _associationsWritten != 0)
-    {   //  Don't put newline before the 1st object
-        _backupStream << '\n';
+    if (_format == Format::Binary)
+    {
+        _beginBinaryRecord(recordType);
+        return;
     }
-    _backupStream << "[Object:"
-                  << object->type()->mnemonic().toString()
+    _backupStream << "\n["
+                  << recordType
                   << ']'
                   << '\n';
 }
 
+void BackupWriter::_writeObjectHeader(
+        const tt3::ws::Object & object
+    )
+{
+    _writeRecordHeader("Object:" + object->type()->mnemonic().toString());
+}
+
 void BackupWriter::_writeObjectProperty(
         const QString & propertyName,
         const tt3::ws::Oid & propertyValue
     )
 {
+    if (_format == Format::Binary)
+    {
+        _writeBinaryField(propertyName, propertyValue);
+        return;
+    }
     _backupStream << propertyName
                   << '='
                   << tt3::util::toString(propertyValue)
@@ -673,6 +1140,14 @@ void BackupWriter::_writeObjectProperty(
         const QList<tt3::ws::Oid> & propertyValue
     )
 {
+    if (_format == Format::Binary)
+    {
+        if (!propertyValue.isEmpty())
+        {
+            _writeBinaryField(propertyName, propertyValue);
+        }
+        return;
+    }
     if (!propertyValue.isEmpty())
     {
         _backupStream << propertyName
@@ -694,6 +1169,27 @@ void BackupWriter::_writeObjectProperty(
         bool propertyValue
     )
 {
+    if (_format == Format::Binary)
+    {
+        _writeBinaryField(propertyName, propertyValue);
+        return;
+    }
+    _backupStream << propertyName
+                  << '='
+                  << tt3::util::toString(propertyValue)
+                  << '\n';
+}
+
+void BackupWriter::_writeObjectProperty(
+        const QString & propertyName,
+        quint64 propertyValue
+    )
+{
+    if (_format == Format::Binary)
+    {
+        _writeBinaryField(propertyName, propertyValue);
+        return;
+    }
     _backupStream << propertyName
                   << '='
                   << tt3::util::toString(propertyValue)
@@ -705,6 +1201,11 @@ void BackupWriter::_writeObjectProperty(
         const QString & propertyValue
     )
 {
+    if (_format == Format::Binary)
+    {
+        _writeBinaryField(propertyName, propertyValue);
+        return;
+    }
     _backupStream << propertyName
                   << '='
                   << stringize(propertyValue)
@@ -716,6 +1217,11 @@ void BackupWriter::_writeObjectProperty(
         const QStringList & propertyValue
     )
 {
+    if (_format == Format::Binary)
+    {
+        _writeBinaryField(propertyName, propertyValue);
+        return;
+    }
     QString valueString;
     for (int i = 0; i < propertyValue.size(); i++)
     {
@@ -738,6 +1244,14 @@ void BackupWriter::_writeObjectProperty(
         const tt3::ws::UiLocale & propertyValue
     )
 {
+    if (_format == Format::Binary)
+    {
+        if (propertyValue.has_value())
+        {
+            _writeBinaryField(propertyName, tt3::util::toString(propertyValue.value()));
+        }
+        return;
+    }
     if (propertyValue.has_value())
     {
         _backupStream << propertyName
@@ -752,6 +1266,14 @@ void BackupWriter::_writeObjectProperty(
         const tt3::ws::InactivityTimeout & propertyValue
     )
 {
+    if (_format == Format::Binary)
+    {
+        if (propertyValue.has_value())
+        {
+            _writeBinaryField(propertyName, qint32(propertyValue->asMinutes()));
+        }
+        return;
+    }
     if (propertyValue.has_value())
     {
         _backupStream << propertyName
@@ -766,6 +1288,11 @@ void BackupWriter::_writeObjectProperty(
         const tt3::ws::Capabilities & propertyValue
     )
 {
+    if (_format == Format::Binary)
+    {
+        _writeBinaryField(propertyName, binaryCapabilities(propertyValue));
+        return;
+    }
     _backupStream << propertyName
                   << '='
                   << tt3::util::toString(propertyValue)
@@ -777,6 +1304,11 @@ void BackupWriter::_writeObjectProperty(
         const QDateTime & propertyValue
     )
 {
+    if (_format == Format::Binary)
+    {
+        _writeBinaryField(propertyName, binaryTimestamp(propertyValue));
+        return;
+    }
     _backupStream << propertyName
                   << '='
                   << tt3::util::toString(propertyValue)
@@ -789,6 +1321,14 @@ void BackupWriter::_writeAssociation(
         tt3::ws::Object to
     )
 {
+    if (_format == Format::Binary)
+    {
+        _beginBinaryRecord("Association:" + associationName);
+        _writeBinaryField(from->type()->mnemonic().toString() + "OID", from->oid());
+        _writeBinaryField(to->type()->mnemonic().toString() + "OID", to->oid());
+        _endBinaryRecord();
+        return;
+    }
     _backupStream << "\n[Association:"
                   << associationName
                   << "]\n";
@@ -802,4 +1342,57 @@ void BackupWriter::_writeAssociation(
                   << '\n';
 }
 
+void BackupWriter::_finishWriting()
+{
+    if (_format == Format::Binary)
+    {
+        if (!_binaryRecord.isEmpty())
+        {
+            _endBinaryRecord();
+        }
+        _flushBinaryBlock();
+        _binaryStream << quint32(0);    //  end of blocks
+    }
+    else
+    {
+        _backupStream.flush();
+    }
+}
+
+void BackupWriter::_beginBinaryRecord(
+        const QString & recordType
+    )
+{
+    if (!_binaryRecord.isEmpty())
+    {   //  The previous record ends here
+        _endBinaryRecord();
+    }
+    _binaryRecordStream << recordType;
+}
+
+void BackupWriter::_endBinaryRecord()
+{
+    Q_ASSERT(!_binaryRecord.isEmpty());
+
+    _binaryBlockStream << _binaryRecord;
+    _binaryRecord.clear();
+    _binaryRecordStream.device()->seek(0);
+    if (_binaryBlock.size() >= _BinaryBlockSize)
+    {
+        _flushBinaryBlock();
+    }
+}
+
+void BackupWriter::_flushBinaryBlock()
+{
+    if (!_binaryBlock.isEmpty())
+    {
+        QByteArray compressedBlock = qCompress(_binaryBlock);
+        _binaryStream << quint32(compressedBlock.size());
+        _binaryStream.writeRawData(compressedBlock.constData(), int(compressedBlock.size()));
+        _binaryBlock.clear();
+        _binaryBlockStream.device()->seek(0);
+    }
+}
+
 //  End of tt3-tools-backup/BackupWriter.cpp
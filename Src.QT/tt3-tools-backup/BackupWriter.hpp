@@ -25,6 +25,51 @@ namespace tt3::tools::backup
     {
         TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(BackupWriter)
 
+        //////////
+        //  Types
+    public:
+        /// \brief
+        ///     The backup file format.
+        /// \details
+        ///     In either format, the first record is a "Backup:Header"
+        ///     with the InstanceId of the database backed up, its
+        ///     ModificationStamp at the time of backup and, for a delta
+        ///     backup, the BaseModificationStamp it covers the changes
+        ///     since. A delta backup contains only the objects created
+        ///     or modified since then (each with all of its outgoing
+        ///     associations) and a "Backup:Tombstone" record with the
+        ///     OID of every object destroyed since then.
+        enum class Format
+        {
+            /// \brief
+            ///     Line-oriented text; a "[Object:...]" or
+            ///     "[Association:...]" line starts each record,
+            ///     followed by "name=value" lines. Larger and
+            ///     slower, but suitable for interchange.
+            Text,
+            /// \brief
+            ///     A versioned binary format. The file starts
+            ///     with BinaryMagic and a quint32 BinaryVersion,
+            ///     followed by blocks, each being a quint32 size
+            ///     and that many bytes of qCompress()-ed records;
+            ///     a 0 size ends the file. Each record is a
+            ///     QDataStream-serialized QByteArray containing
+            ///     the record type, then (name, QByteArray value)
+            ///     pairs, with OIDs, timestamps, etc. in binary.
+            Binary
+        };
+
+        //////////
+        //  Constants
+    public:
+        /// \brief
+        ///     The bytes a binary format backup file starts with.
+        inline static const QByteArray  BinaryMagic = QByteArrayLiteral("TT3BKUP\x1A");
+
+        /// \brief
+        ///     The version of the binary format written.
+        static constexpr quint32    BinaryVersion = 2;
+
         //////////
         //  Construction/destruction
     public:
@@ -36,12 +81,20 @@ namespace tt3::tools::backup
         ///     The credentials of the user requesting a backup.
         /// \param backupFileName
         ///     The name of the backup file to create and wrte.
+        /// \param format
+        ///     The format of the backup file.
+        /// \param baseModificationStamp
+        ///     The modification stamp of an earlier backup to write
+        ///     a delta backup against (see modificationStampOf());
+        ///     nullopt == write a full backup.
         /// \exception Exception
         ///     If an error occurs.
         BackupWriter(
                 tt3::ws::Workspace workspace,
                 const tt3::ws::Credentials & credentials,
-                const QString & backupFileName
+                const QString & backupFileName,
+                Format format = Format::Binary,
+                std::optional<quint64> baseModificationStamp = std::nullopt
             );
 
         /// \brief
@@ -65,16 +118,51 @@ namespace tt3::tools::backup
         ///     If an error occurs.
         bool        backupWorkspace();
 
+        /// \brief
+        ///     Returns the modification stamp recorded in the
+        ///     header of an existing (full or delta) backup file.
+        /// \details
+        ///     A delta backup written against this stamp contains
+        ///     the changes made since that backup, so it makes a
+        ///     differential backup if the file is a full backup
+        ///     and the next link of an incremental chain if the
+        ///     file is a delta backup.
+        /// \param backupFileName
+        ///     The name of the existing backup file.
+        /// \return
+        ///     The modification stamp recorded in its header.
+        /// \exception Exception
+        ///     If an error occurs, including the file not being
+        ///     a backup file with a modification stamp.
+        static quint64  modificationStampOf(
+                                const QString & backupFileName
+                            );
+
         //////////
         //  Implementation
     private:
         tt3::ws::Workspace  _workspace; //  to read from
         tt3::ws::BackupCredentials  _credentials;   //  for _workspace
+        const Format    _format;
+        const std::optional<quint64>    _baseModificationStamp; //  nullopt == full backup
+        quint64         _modificationStamp = 0; //  of _workspace, at backup time
+        QUuid           _instanceId;    //  of _workspace, so that deltas can't be mixed up
         QFile           _backupFile;    //  to write to
-        QTextStream     _backupStream;  //  to write to
+        QTextStream     _backupStream;  //  to write to (Format::Text)
+        QDataStream     _binaryStream;  //  to write to (Format::Binary)
+
+        //  Format::Binary records are collected into a block,
+        //  which is compressed & written when large enough
+        static constexpr qsizetype  _BinaryBlockSize = 256 * 1024;
+        QByteArray      _binaryBlock;   //  uncompressed
+        QDataStream     _binaryBlockStream{&_binaryBlock, QIODevice::WriteOnly};
+        QByteArray      _binaryRecord;  //  being written
+        QDataStream     _binaryRecordStream{&_binaryRecord, QIODevice::WriteOnly};
+        QByteArray      _binaryValue;   //  being written
+        QDataStream     _binaryValueStream{&_binaryValue, QIODevice::WriteOnly};
 
-        const quint64   _objectsToWrite;
-        const quint64   _associationsToWrite;
+        quint64         _objectsToWrite;
+        quint64         _associationsToWrite;
         quint64         _objectsWritten = 0;
         quint64         _associationsWritten = 0;
         const int       _oneObjectDelayMs;
@@ -88,6 +176,12 @@ namespace tt3::tools::backup
         void        _onObjectWritten();
         void        _onAssociationWritten();
         void        _reportProgress();
+        void        _backupEverything();
+        void        _backupChanges(
+                            const tt3::ws::Oids & changedOids,
+                            const tt3::ws::Oids & destroyedOids
+                        );
+        bool        _isDelta() const { return _baseModificationStamp.has_value(); }
 
         template <class T>
         void        _backupObjects(
@@ -187,6 +281,25 @@ namespace tt3::tools::backup
                             tt3::ws::Event event
                         );
 
+        //  Delta backups visit changed objects one by one,
+        //  regardless of their types
+        void        _backupChangedObject(
+                            const tt3::ws::Object & object
+                        );
+        void        _backupChangedObjectOutgoingAssociations(
+                            const tt3::ws::Object & object
+                        );
+        static int  _backupOrder(   //  lower values are written first
+                            const tt3::ws::Object & object
+                        );
+
+        void        _writeBackupHeader();
+        void        _writeTombstone(
+                            const tt3::ws::Oid & oid
+                        );
+        void        _writeRecordHeader(
+                            const QString & recordType
+                        );
         void        _writeObjectHeader(
                             const tt3::ws::Object & object
                         );
@@ -202,6 +315,10 @@ namespace tt3::tools::backup
                             const QString & propertyName,
                             bool propertyValue
                         );
+        void        _writeObjectProperty(
+                            const QString & propertyName,
+                            quint64 propertyValue
+                        );
         void        _writeObjectProperty(
                             const QString & propertyName,
                             const QString & propertyValue
@@ -231,6 +348,26 @@ namespace tt3::tools::backup
                             tt3::ws::Object from,
                             tt3::ws::Object to
                         );
+        void        _finishWriting();
+
+        //  Format::Binary helpers
+        void        _beginBinaryRecord(
+                            const QString & recordType
+                        );
+        void        _endBinaryRecord();
+        void        _flushBinaryBlock();
+        template <class T>
+        void        _writeBinaryField(
+                            const QString & fieldName,
+                            const T & fieldValue
+                        )
+        {   //  Values are length-prefixed, so that the reader
+            //  does not need to know their types to skip them
+            _binaryValue.clear();
+            _binaryValueStream.device()->seek(0);
+            _binaryValueStream << fieldValue;
+            _binaryRecordStream << fieldName << _binaryValue;
+        }
 
         template <class T>
         QList<T>        _sortedByOid(const QSet<T> & objects)
@@ -242,8 +379,8 @@ namespace tt3::tools::backup
                     result.begin(),
                     result.end(),
                     [](const T & a, const T & b)
-                    {
-                        return tt3::util::toString(a->oid()) < tt3::util::toString(b->oid());
+                    {   //  Same order as that of OID strings
+                        return a->oid() < b->oid();
                     });
             }
             return result;
@@ -61,6 +61,17 @@ Component::ISubsystem * Component::subsystem() const
     return tt3::util::StandardSubsystems::Storage::instance();
 }
 
+Component::Mnemonics Component::dependencies() const
+{
+    return Mnemonics
+        {
+            M(tt3-gui),
+            M(tt3-ws),
+            M(tt3-db-api),
+            M(tt3-util)
+        };
+}
+
 Component::Resources * Component::resources() const
 {
     return Resources::instance();
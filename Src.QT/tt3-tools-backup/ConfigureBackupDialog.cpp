@@ -66,6 +66,12 @@ ConfigureBackupDialog::ConfigureBackupDialog(
         rr.string(RID(BackupToLabel)));
     _ui->backupToPushButton->setText(
         rr.string(RID(BackupToPushButton)));
+    _ui->compressBackupCheckBox->setText(
+        rr.string(RID(CompressBackupCheckBox)));
+    _ui->changesSinceCheckBox->setText(
+        rr.string(RID(ChangesSinceCheckBox)));
+    _ui->changesSincePushButton->setText(
+        rr.string(RID(ChangesSincePushButton)));
 
     _ui->buttonBox->button(QDialogButtonBox::StandardButton::Ok)->
         setText(rr.string(RID(OkPushButton)));
@@ -122,10 +128,27 @@ QString ConfigureBackupDialog::selectedBackupDestination() const
     return _backupDestination;
 }
 
+auto ConfigureBackupDialog::selectedBackupFormat(
+    ) const -> BackupWriter::Format
+{
+    return _backupFormat;
+}
+
+QString ConfigureBackupDialog::selectedBaseBackup() const
+{
+    return _baseBackup;
+}
+
 //////////
 //  Implementation helpers
 void ConfigureBackupDialog::_refresh()
 {
+    _ui->changesSinceLineEdit->setEnabled(_ui->changesSinceCheckBox->isChecked());
+    _ui->changesSincePushButton->setEnabled(_ui->changesSinceCheckBox->isChecked());
+    bool baseBackupOk =
+        !_ui->changesSinceCheckBox->isChecked() ||
+        !_ui->changesSinceLineEdit->text().trimmed().isEmpty();
+
     if (_ui->backupCurrentWorkspaceRadioButton->isChecked())
     {   //  Choosing the "current" workspace
         _ui->workspaceTypeLabel->setEnabled(false);
@@ -134,7 +157,8 @@ void ConfigureBackupDialog::_refresh()
         _ui->locationLineEdit->setEnabled(false);
         _ui->browsePushButton->setEnabled(false);
         _ui->buttonBox->button(QDialogButtonBox::StandardButton::Ok)->setEnabled(
-            !_ui->backupToLineEdit->text().trimmed().isEmpty());
+            !_ui->backupToLineEdit->text().trimmed().isEmpty() &&
+            baseBackupOk);
     }
     else
     {   //  Choosing the "custom" workspace
@@ -160,7 +184,8 @@ void ConfigureBackupDialog::_refresh()
                     _customWorkspaceAddress->displayForm());
             _ui->buttonBox->button(QDialogButtonBox::StandardButton::Ok)->setEnabled(
                 _customWorkspaceAddress != nullptr &&
-                !_ui->backupToLineEdit->text().trimmed().isEmpty());
+                !_ui->backupToLineEdit->text().trimmed().isEmpty() &&
+                baseBackupOk);
         }
     }
 }
@@ -242,6 +267,28 @@ void ConfigureBackupDialog::_backupToPushButtonClicked()
     }
 }
 
+void ConfigureBackupDialog::_changesSinceCheckBoxClicked()
+{
+    _refresh();
+}
+
+void ConfigureBackupDialog::_changesSincePushButtonClicked()
+{
+    static Component::Resources *const resources = Component::Resources::instance();   //  idempotent
+
+    QString path =
+        QFileDialog::getOpenFileName(
+            this,
+            resources->string(RSID(ConfigureBackupDialog), RID(ChangesSinceDialogTitle)),
+            /*dir =*/ QString(),
+            resources->string(RSID(ConfigureBackupDialog), RID(BackupToDialogFilter), BackupTool::PreferredExtension));
+    if (!path.isEmpty())
+    {
+        _ui->changesSinceLineEdit->setText(path);
+        _refresh();
+    }
+}
+
 void ConfigureBackupDialog::accept()
 {
     if (_ui->backupCurrentWorkspaceRadioButton->isChecked())
@@ -256,6 +303,14 @@ void ConfigureBackupDialog::accept()
     }
     _backupDestination =
         QFileInfo(_ui->backupToLineEdit->text().trimmed()).absoluteFilePath();
+    _backupFormat =
+        _ui->compressBackupCheckBox->isChecked() ?
+            BackupWriter::Format::Binary :
+            BackupWriter::Format::Text;
+    _baseBackup =
+        _ui->changesSinceCheckBox->isChecked() ?
+            QFileInfo(_ui->changesSinceLineEdit->text().trimmed()).absoluteFilePath() :
+            QString();
     done(int(Result::Ok));
 }
 
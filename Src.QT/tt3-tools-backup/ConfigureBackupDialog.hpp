@@ -78,12 +78,32 @@ namespace tt3::tools::backup
         ///     The backup destination selected by the user.
         QString         selectedBackupDestination() const;
 
+        /// \brief
+        ///     Returns the backup file format selected by the user.
+        /// \return
+        ///     The backup file format selected by the user.
+        auto            selectedBackupFormat(
+                            ) const -> BackupWriter::Format;
+
+        /// \brief
+        ///     Returns the earlier backup selected by the user as
+        ///     the base of a delta backup.
+        /// \details
+        ///     This is the full path of a full or delta backup file;
+        ///     only the changes made since it shall be backed up.
+        /// \return
+        ///     The earlier backup selected by the user; an empty
+        ///     string if a full backup shall be made.
+        QString         selectedBaseBackup() const;
+
         //////////
         //  Implementation
     private:
         tt3::ws::WorkspaceAddress   _customWorkspaceAddress = nullptr;  //  nullptr == not selected
         tt3::ws::WorkspaceAddress   _workspaceAddress = nullptr;  //  nullptr == not selected
         QString         _backupDestination;
+        BackupWriter::Format    _backupFormat = BackupWriter::Format::Binary;
+        QString         _baseBackup;    //  "" == full backup
 
         //  Helpers
         void            _refresh();
@@ -105,6 +125,8 @@ namespace tt3::tools::backup
         void            _workspaceTypeComboBoxCurrentIndexChanged(int);
         void            _browsePushButtonClicked();
         void            _backupToPushButtonClicked();
+        void            _changesSinceCheckBoxClicked();
+        void            _changesSincePushButtonClicked();
         virtual void    accept() override;
         virtual void    reject() override;
     };
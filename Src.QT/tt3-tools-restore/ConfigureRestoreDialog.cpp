@@ -96,9 +96,9 @@ auto ConfigureRestoreDialog::doModal(
     return Result(this->exec());
 }
 
-QString ConfigureRestoreDialog::restoreSource() const
+QStringList ConfigureRestoreDialog::restoreSources() const
 {
-    return _restoreSource;
+    return _restoreSources;
 }
 
 auto ConfigureRestoreDialog::workspaceAddress(
@@ -165,15 +165,17 @@ void ConfigureRestoreDialog::_restoreFromPushButtonClicked()
 {
     static Component::Resources *const resources = Component::Resources::instance();   //  idempotent
 
-    QString path =
-        QFileDialog::getOpenFileName(
+    //  A full backup, possibly with delta backups on top
+    QStringList paths =
+        QFileDialog::getOpenFileNames(
             this,
             resources->string(RSID(ConfigureRestoreDialog), RID(RestoreFromDialogTitle)),
             /*dir =*/ QString(),
             resources->string(RSID(ConfigureRestoreDialog), RID(RestoreFromDialogFilter), RestoreTool::PreferredExtension));
-    if (!path.isEmpty())
+    if (!paths.isEmpty())
     {
-        _ui->restoreFromLineEdit->setText(path);
+        _selectedRestoreSources = paths;
+        _ui->restoreFromLineEdit->setText(paths.join("; "));
         _refresh();
     }
 }
@@ -208,8 +210,11 @@ void ConfigureRestoreDialog::accept()
 {
     tt3::gui::Component::Settings::instance()->lastUsedWorkspaceType =
         _selectedWorkspaceType()->mnemonic();
-    _restoreSource =
-        QFileInfo(_ui->restoreFromLineEdit->text().trimmed()).absoluteFilePath();
+    _restoreSources.clear();
+    for (const QString & path : std::as_const(_selectedRestoreSources))
+    {
+        _restoreSources.append(QFileInfo(path).absoluteFilePath());
+    }
     done(int(Result::Ok));
 }
 
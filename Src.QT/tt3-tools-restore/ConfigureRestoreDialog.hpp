@@ -63,12 +63,15 @@ namespace tt3::tools::restore
         Result          doModal();
 
         /// \brief
-        ///     Returns the full path to the backup file to restore
+        ///     Returns the full paths to the backup files to restore
         ///     a backed up workspace from.
+        /// \details
+        ///     These are a full backup, optionally followed by
+        ///     delta backups to apply on top of it.
         /// \return
-        ///     The full path to the backup file to restore
+        ///     The full paths to the backup files to restore
         ///     a backed up workspace from.
-        QString         restoreSource() const;
+        QStringList     restoreSources() const;
 
         /// \brief
         ///     Returns the workspace address to restore into.
@@ -83,7 +86,8 @@ namespace tt3::tools::restore
         //////////
         //  Implementation
     private:
-        QString         _restoreSource;
+        QStringList     _selectedRestoreSources;
+        QStringList     _restoreSources;
         tt3::ws::WorkspaceAddress   _workspaceAddress = nullptr;  //  nullptr == not selected
 
         //  Helpers
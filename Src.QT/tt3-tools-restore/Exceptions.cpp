@@ -34,4 +34,24 @@ QString BackupFileCorruptException::errorMessage() const
         _fileName);
 }
 
+//////////
+//  BackupFileMismatchException
+BackupFileMismatchException::BackupFileMismatchException(
+        const QString & fileName,
+        const QString & fullBackupFileName
+    ) : _fileName(fileName),
+        _fullBackupFileName(fullBackupFileName)
+{
+}
+
+QString BackupFileMismatchException::errorMessage() const
+{
+    static Component::Resources *const resources = Component::Resources::instance();   //  idempotent
+    return resources->string(
+        RSID(Errors),
+        RID(BackupFileMismatchException),
+        _fileName,
+        _fullBackupFileName);
+}
+
 //  End of tt3-tools-restore/Exceptions.cpp
@@ -64,6 +64,65 @@ namespace tt3::tools::restore
     private:
         QString         _fileName;
     };
+
+    /// \class BackupFileMismatchException tt3-tools-restore/API.hpp
+    /// \brief Thrown when a delta backup file was written against
+    ///     a different database than the full backup it's restored with.
+    class TT3_TOOLS_RESTORE_PUBLIC BackupFileMismatchException final
+        :   public virtual tt3::util::Exception
+    {
+        //////////
+        //  Types
+    public:
+        /// \brief A type alias to improve code readability.
+        using Self = BackupFileMismatchException;
+
+        //////////
+        //  Construction/destruction/assignment
+    public:
+        /// \brief
+        ///     Constructs the exception.
+        /// \param fileName
+        ///     The name of the mismatched delta backup file.
+        /// \param fullBackupFileName
+        ///     The name of the full backup file.
+        BackupFileMismatchException(
+                const QString & fileName,
+                const QString & fullBackupFileName
+            );
+
+        //////////
+        //  QException
+    public:
+        virtual Self *  clone() const override { return new Self(*this); }
+        virtual void    raise() const override { throw *this; }
+
+        //////////
+        //  tt3::util::Exception
+    public:
+        virtual QString errorMessage() const override;
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     Returns the name of the mismatched delta backup file.
+        /// \return
+        ///     The name of the mismatched delta backup file.
+        QString         fileName() const { return _fileName; }
+
+        /// \brief
+        ///     Returns the name of the full backup file.
+        /// \return
+        ///     The name of the full backup file.
+        QString         fullBackupFileName() const { return _fullBackupFileName; }
+
+        //////////
+        //  Implementayion
+    private:
+        QString         _fileName;
+        QString         _fullBackupFileName;
+    };
 }
 
 //  End of tt3-tools-restore/Exceptions.hpp
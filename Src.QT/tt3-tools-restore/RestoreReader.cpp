@@ -23,20 +23,39 @@ RestoreReader::RestoreReader(
         tt3::ws::Workspace workspace,
         const tt3::ws::Credentials & credentials,
         const QString & backupFileName
+    ) : RestoreReader(workspace, credentials, QStringList{backupFileName})
+{
+}
+
+RestoreReader::RestoreReader(
+        tt3::ws::Workspace workspace,
+        const tt3::ws::Credentials & credentials,
+        const QStringList & backupFileNames
     ) : _workspace(workspace),
         _adminCredentials(credentials),
-        _bytesToRead(QFileInfo(backupFileName).size()),
-        _recordCount(_bytesToRead / 217 + 1),   //  real backup files were measured
+        _bytesToRead(_totalSize(backupFileNames)),
+        _recordCount(   //  real backup files were measured
+            _bytesToRead / (_isBinaryBackup(backupFileNames.value(0)) ? 24 : 217) + 1),
         _oneRecordDelayMs(int(10000 / _recordCount)),
         _restoreCredentials(
             workspace->beginRestore(    //  may throw
                 credentials,
                 _recordCount * 85 +     //  1,000,000 objects -> 1 day lease...
                     60 * 60 * 1000)),   //  ...+ 1 hour
-        _restoreFile(backupFileName),
         _restoreStream(&_restoreFile)
 {
+    Q_ASSERT(!backupFileNames.isEmpty());
+
+    for (const QString & backupFileName : backupFileNames)
+    {
+        _BackupFile backupFile;
+        backupFile.fileName = backupFileName;
+        _backupFiles.append(backupFile);
+    }
+
     //  Prepare record handler dispatch table
+    _recordHandlers["Backup:Header"] = &RestoreReader::_processBackupHeaderRecord;
+    _recordHandlers["Backup:Tombstone"] = &RestoreReader::_processBackupTombstoneRecord;
     _recordHandlers["Object:User"] = &RestoreReader::_processUserRecord;
     _recordHandlers["Object:Account"] = &RestoreReader::_processAccountRecord;
     _recordHandlers["Object:ActivityType"] = &RestoreReader::_processActivityTypeRecord;
@@ -76,19 +95,21 @@ bool RestoreReader::restoreWorkspace()
     Q_ASSERT(_bytesRead == 0);
 
     //  Prepare to restore
-    if (!_restoreFile.open(QIODevice::ReadOnly))
-    {   //  OOPS!
-        throw tt3::ws::CustomWorkspaceException(_restoreFile.fileName() + ": " + _restoreFile.errorString());
-    }
+    _readBackupHeaders();   //  may throw
 
     //  Do we need a progress dialog ?
     if (QThread::currentThread()->eventDispatcher() != nullptr)
     {
+        QStringList backupFileNames;
+        for (const auto & backupFile : std::as_const(_backupFiles))
+        {
+            backupFileNames.append(backupFile.fileName);
+        }
         _progressDialog.reset(
             new RestoreProgressDialog(
                 gui::theCurrentSkin->mainWindow(),
                 _workspace->address()->displayForm(),
-                _restoreFile.fileName()));
+                backupFileNames.join('\n')));
         _progressDialog->setVisible(true);
     }
 
@@ -96,29 +117,24 @@ bool RestoreReader::restoreWorkspace()
     _record.reset();
     try
     {
-        //  All _restore...() services may throw
-        while (!_restoreStream.atEnd())
-        {
-            QString line = _restoreStream.readLine().trimmed();
-            if (line.startsWith("[") && line.endsWith("]"))
-            {   //  New recpord starts here
-                if (_record.isValid())
-                {
-                    _processRecord();
-                }
-                _record.reset(line.mid(1, line.length() - 2));
-                continue;
-            }
-            qsizetype eqIndex = line.indexOf('=');
-            if (eqIndex != -1)
-            {   //  name=value
-                _record.fields[line.left(eqIndex)] = line.mid(eqIndex + 1);
-            }
+        //  All _restore...() services may throw.
+        //  Objects are bulk-loaded with their OIDs from
+        //  the backup and validated once, at the end.
+        _workspace->beginBulkLoad(_restoreCredentials);
+        for (qsizetype i = 1; i < _backupFiles.size(); i++)
+        {   //  Deltas first, so that the full backup can be
+            //  restored with their changes in a single pass
+            _readBackupFile(_backupFiles[i].fileName, &RestoreReader::_collectDeltaRecord);
+            _bytesRead += QFileInfo(_backupFiles[i].fileName).size();
         }
-        if (_record.isValid())
-        {
-            _processRecord();
+        _readBackupFile(_backupFiles[0].fileName, &RestoreReader::_restoreFullBackupRecord);
+        _bytesRead += QFileInfo(_backupFiles[0].fileName).size();
+        _restoreDeltaRecords();
+        if (!_deferredRecords.isEmpty())
+        {   //  OOPS! Some records refer to objects that aren't there
+            throw BackupFileCorruptException(_backupFiles.last().fileName);
         }
+        _workspace->endBulkLoad(_restoreCredentials);
 
         //  Cleanup & we're done.
         //  Note, that these will be called from
@@ -152,10 +168,12 @@ void RestoreReader::_reportProgress()
 {
     if (_progressDialog != nullptr)
     {
+        quint64 bytesRead =
+            _bytesRead + (_restoreFile.isOpen() ? _restoreFile.pos() : 0);
         float progress =
             (_bytesToRead == 0) ?
                 0.0f :
-                float(_restoreFile.pos()) / float(_bytesToRead);
+                qMin(1.0f, float(bytesRead) / float(_bytesToRead));
         _progressDialog->reportProgress(progress);
         if (_progressDialog->cancelRequested())
         {
@@ -164,17 +182,430 @@ void RestoreReader::_reportProgress()
     }
 }
 
+void RestoreReader::_readBackupFile(
+        const QString & backupFileName,
+        _RecordHandler onRecordRead
+    )
+{
+    _restoreFile.close();
+    _restoreFile.setFileName(backupFileName);
+    if (!_restoreFile.open(QIODevice::ReadOnly))
+    {   //  OOPS!
+        throw tt3::ws::CustomWorkspaceException(_restoreFile.fileName() + ": " + _restoreFile.errorString());
+    }
+    _restoreStream.setDevice(&_restoreFile);    //  discard what's buffered
+    _onRecordRead = onRecordRead;
+    _stopReading = false;
+
+    _record.reset();
+    const QByteArray & binaryMagic = tt3::tools::backup::BackupWriter::BinaryMagic;
+    if (_restoreFile.peek(binaryMagic.size()) == binaryMagic)
+    {
+        _readBinaryRecords();
+    }
+    else
+    {
+        _readTextRecords();
+    }
+    _record.reset();
+    _restoreFile.close();
+}
+
+void RestoreReader::_readTextRecords()
+{
+    while (!_stopReading && !_restoreStream.atEnd())
+    {
+        QString line = _restoreStream.readLine().trimmed();
+        if (line.startsWith("[") && line.endsWith("]"))
+        {   //  New recpord starts here
+            if (_record.isValid())
+            {
+                (this->*_onRecordRead)();
+                _reportProgress();
+                if (_stopReading)
+                {
+                    break;
+                }
+            }
+            _record.reset(line.mid(1, line.length() - 2), _restoreFile.fileName());
+            continue;
+        }
+        qsizetype eqIndex = line.indexOf('=');
+        if (eqIndex != -1)
+        {   //  name=value
+            _record.fields[line.left(eqIndex)] = line.mid(eqIndex + 1);
+        }
+    }
+    if (!_stopReading && _record.isValid())
+    {
+        (this->*_onRecordRead)();
+        _reportProgress();
+    }
+}
+
+void RestoreReader::_readBinaryRecords()
+{
+    QDataStream fileStream(&_restoreFile);
+    fileStream.setVersion(QDataStream::Qt_6_0);
+
+    //  Header
+    quint32 version = 0;
+    fileStream.skipRawData(int(tt3::tools::backup::BackupWriter::BinaryMagic.size()));
+    fileStream >> version;
+    if (fileStream.status() != QDataStream::Ok ||
+        version == 0 || version > BinaryVersion)
+    {   //  OOPS! Truncated or too new
+        throw BackupFileCorruptException(_restoreFile.fileName());
+    }
+
+    //  Blocks of records; a 0-size block ends the file
+    while (!_stopReading)
+    {
+        quint32 compressedSize = 0;
+        fileStream >> compressedSize;
+        if (fileStream.status() != QDataStream::Ok)
+        {   //  OOPS! Truncated
+            throw BackupFileCorruptException(_restoreFile.fileName());
+        }
+        if (compressedSize == 0)
+        {   //  The end
+            break;
+        }
+        if (compressedSize > _restoreFile.size() - _restoreFile.pos())
+        {   //  OOPS! Truncated or garbage - and don't
+            //  allocate a block that can't possibly be there
+            throw BackupFileCorruptException(_restoreFile.fileName());
+        }
+        QByteArray compressedBlock(compressedSize, Qt::Uninitialized);
+        if (fileStream.readRawData(compressedBlock.data(), int(compressedSize)) != int(compressedSize))
+        {   //  OOPS! Truncated
+            throw BackupFileCorruptException(_restoreFile.fileName());
+        }
+        QByteArray block = qUncompress(compressedBlock);
+        if (block.isEmpty())
+        {   //  OOPS! Not a qCompress()-ed block
+            throw BackupFileCorruptException(_restoreFile.fileName());
+        }
+
+        QDataStream blockStream(block);
+        blockStream.setVersion(QDataStream::Qt_6_0);
+        while (!_stopReading && !blockStream.atEnd())
+        {
+            QByteArray recordBytes;
+            blockStream >> recordBytes;
+            QDataStream recordStream(recordBytes);
+            recordStream.setVersion(QDataStream::Qt_6_0);
+            QString recordType;
+            recordStream >> recordType;
+            _record.reset(recordType, _restoreFile.fileName());
+            while (!recordStream.atEnd() && recordStream.status() == QDataStream::Ok)
+            {
+                QString fieldName;
+                QByteArray fieldValue;
+                recordStream >> fieldName >> fieldValue;
+                _record.binaryFields.insert(fieldName, fieldValue);
+            }
+            if (blockStream.status() != QDataStream::Ok ||
+                recordStream.status() != QDataStream::Ok ||
+                !_recordHandlers.contains(recordType))
+            {   //  OOPS!
+                throw BackupFileCorruptException(_restoreFile.fileName());
+            }
+            (this->*_onRecordRead)();
+            _reportProgress();
+        }
+    }
+    _record.reset();
+}
+
+void RestoreReader::_readBackupHeaders()
+{
+    for (auto & backupFile : _backupFiles)
+    {
+        _backupFileBeingRead = &backupFile;
+        _readBackupFile(backupFile.fileName, &RestoreReader::_readBackupHeaderRecord);
+    }
+    _backupFileBeingRead = nullptr;
+
+    //  There must be exactly one full backup; it goes first...
+    std::stable_sort(
+        _backupFiles.begin(),
+        _backupFiles.end(),
+        [](const auto & a, const auto & b)
+        {
+            if (a.baseModificationStamp.has_value() != b.baseModificationStamp.has_value())
+            {   //  Full backup first
+                return !a.baseModificationStamp.has_value();
+            }
+            return a.modificationStamp < b.modificationStamp;
+        });
+    if (_backupFiles[0].baseModificationStamp.has_value())
+    {   //  OOPS! No full backup
+        throw BackupFileCorruptException(_backupFiles[0].fileName);
+    }
+    if (_backupFiles.size() > 1 && !_backupFiles[1].baseModificationStamp.has_value())
+    {   //  OOPS! More than one full backup
+        throw BackupFileCorruptException(_backupFiles[1].fileName);
+    }
+    //  ...the deltas must come from the same database, or
+    //  their modification stamps mean nothing...
+    for (qsizetype i = 1; i < _backupFiles.size(); i++)
+    {
+        if (_backupFiles[i].instanceId.isNull() ||
+            _backupFiles[i].instanceId != _backupFiles[0].instanceId)
+        {   //  OOPS!
+            throw BackupFileMismatchException(_backupFiles[i].fileName, _backupFiles[0].fileName);
+        }
+    }
+    //  ...and they must cover everything since, with
+    //  no gaps. Deltas no newer than what's covered already
+    //  carry nothing new and would only roll changes back.
+    quint64 coveredModificationStamp = _backupFiles[0].modificationStamp;
+    for (qsizetype i = 1; i < _backupFiles.size(); )
+    {
+        const _BackupFile & delta = _backupFiles[i];
+        if (delta.baseModificationStamp.value() > coveredModificationStamp)
+        {   //  OOPS! Changes made before this delta are missing
+            throw BackupFileCorruptException(delta.fileName);
+        }
+        if (delta.modificationStamp <= coveredModificationStamp)
+        {
+            _backupFiles.removeAt(i);
+            continue;
+        }
+        coveredModificationStamp = delta.modificationStamp;
+        i++;
+    }
+}
+
+void RestoreReader::_readBackupHeaderRecord()
+{
+    Q_ASSERT(_backupFileBeingRead != nullptr);
+
+    if (_record.type == "Backup:Header")
+    {
+        if (_record.hasField("InstanceId"))
+        {
+            _backupFileBeingRead->instanceId =
+                QUuid::fromString(_record.fetchField<QString>("InstanceId"));
+            if (_backupFileBeingRead->instanceId.isNull())
+            {   //  OOPS!
+                throw BackupFileCorruptException(_record.fileName);
+            }
+        }
+        _backupFileBeingRead->modificationStamp =
+            _record.fetchField<quint64>("ModificationStamp");
+        if (_record.hasField("BaseModificationStamp"))
+        {
+            _backupFileBeingRead->baseModificationStamp =
+                _record.fetchField<quint64>("BaseModificationStamp");
+        }
+    }
+    //  Else a full backup written before delta backups.
+    //  Either way, that's all we need from this file.
+    _stopReading = true;
+}
+
+void RestoreReader::_collectDeltaRecord()
+{
+    if (!_recordHandlers.contains(_record.type))
+    {   //  OOPS!
+        throw BackupFileCorruptException(_record.fileName);
+    }
+    if (_record.type == "Backup:Header")
+    {   //  Already taken into account
+        return;
+    }
+    if (_record.type == "Backup:Tombstone")
+    {   //  Whatever earlier deltas had to say about the
+        //  object no longer matters
+        auto oid = _record.fetchField<tt3::ws::Oid>("OID");
+        _destroyedOids.insert(oid);
+        _supersededOids.insert(oid);
+        _deltaObjects.remove(oid);
+        _deltaAssociations.remove(oid);
+        return;
+    }
+    if (_record.type.startsWith("Object:"))
+    {   //  The object's outgoing associations follow
+        auto oid = _record.fetchField<tt3::ws::Oid>("OID");
+        if (!_deltaObjects.contains(oid))
+        {
+            _deltaObjectOrder.append(oid);
+        }
+        _deltaObjects.insert(oid, _record);
+        _deltaAssociations.remove(oid);
+        _supersededOids.insert(oid);
+        return;
+    }
+    _deltaAssociations[_associationOwnerOid()].append(_record);
+}
+
+void RestoreReader::_restoreFullBackupRecord()
+{
+    if (!_recordHandlers.contains(_record.type))
+    {   //  OOPS!
+        throw BackupFileCorruptException(_record.fileName);
+    }
+    if (_record.type.startsWith("Object:"))
+    {
+        auto oid = _record.fetchField<tt3::ws::Oid>("OID");
+        if (_destroyedOids.contains(oid))
+        {   //  Gone since
+            return;
+        }
+        if (_deltaObjects.contains(oid))
+        {   //  Changed since - restore the latest version here,
+            //  so that objects aggregated within still follow it
+            _record = _deltaObjects.take(oid);
+        }
+    }
+    else if (_record.type.startsWith("Association:"))
+    {
+        if (_supersededOids.contains(_associationOwnerOid()))
+        {   //  Deltas have the latest associations (if any)
+            return;
+        }
+    }
+    _restoreRecord();
+}
+
+void RestoreReader::_restoreDeltaRecords()
+{   //  Objects created since the full backup...
+    for (const auto & oid : std::as_const(_deltaObjectOrder))
+    {
+        if (_deltaObjects.contains(oid))
+        {
+            _record = _deltaObjects.take(oid);
+            _restoreRecord();
+            _reportProgress();
+        }
+    }
+    //  ...then associations of all changed objects
+    for (const auto & records : std::as_const(_deltaAssociations))
+    {
+        for (const auto & record : records)
+        {
+            _record = record;
+            _restoreRecord();
+            _reportProgress();
+        }
+    }
+}
+
+void RestoreReader::_restoreRecord()
+{
+    auto referencedOids = _referencedOids();
+    if (_record.type.startsWith("Association:"))
+    {
+        for (const auto & oid : std::as_const(referencedOids))
+        {
+            if (_destroyedOids.contains(oid))
+            {   //  One end is gone - so is the association
+                return;
+            }
+        }
+    }
+    for (const auto & oid : std::as_const(referencedOids))
+    {
+        if (!_restoredOids.contains(oid))
+        {   //  Not yet - wait for it
+            _deferredRecords[oid].append(_record);
+            return;
+        }
+    }
+    _processRecord();   //  may throw
+    if (_record.type.startsWith("Object:"))
+    {   //  Can restore what's been waiting for this object
+        auto oid = _record.fetchField<tt3::ws::Oid>("OID");
+        _restoredOids.insert(oid);
+        if (_deferredRecords.contains(oid))
+        {
+            QList<_Record> deferredRecords = _deferredRecords.take(oid);
+            for (const auto & deferredRecord : std::as_const(deferredRecords))
+            {
+                _record = deferredRecord;
+                _restoreRecord();
+            }
+        }
+    }
+}
+
+auto RestoreReader::_referencedOids(
+    ) -> QList<tt3::ws::Oid>
+{   //  Fields named "...OID" or "...OIDs" refer to other objects
+    QSet<QString> fieldNames;
+    for (auto it = _record.fields.cbegin(); it != _record.fields.cend(); ++it)
+    {
+        fieldNames.insert(it.key());
+    }
+    for (auto it = _record.binaryFields.cbegin(); it != _record.binaryFields.cend(); ++it)
+    {
+        fieldNames.insert(it.key());
+    }
+
+    QList<tt3::ws::Oid> result;
+    for (const QString & fieldName : std::as_const(fieldNames))
+    {
+        if (fieldName == "OID")
+        {   //  That's the object itself
+            continue;
+        }
+        if (fieldName.endsWith("OID"))
+        {
+            result.append(_record.fetchField<tt3::ws::Oid>(fieldName));
+        }
+        else if (fieldName.endsWith("OIDs"))
+        {
+            result.append(_record.fetchField<QList<tt3::ws::Oid>>(fieldName));
+        }
+    }
+    return result;
+}
+
+auto RestoreReader::_associationOwnerOid(
+    ) -> tt3::ws::Oid
+{   //  The object whose outgoing association it is
+    static const QMap<QString, QStringList> ownerFieldNames
+    {
+        { "Association:QuickPicksList", { "AccountOID" } },
+        { "Association:PermittedWorkloads", { "UserOID" } },
+        { "Association:ActivityType", { "PublicActivityOID", "PublicTaskOID", "PrivateActivityOID", "PrivateTaskOID" } },
+        { "Association:ActivityWorkload", { "PublicActivityOID", "PublicTaskOID", "PrivateActivityOID", "PrivateTaskOID" } },
+        { "Association:WorkloadBeneficiaries", { "ProjectOID", "WorkStreamOID" } }
+    };
+    for (const QString & fieldName : ownerFieldNames.value(_record.type))
+    {
+        if (_record.hasField(fieldName))
+        {
+            return _record.fetchField<tt3::ws::Oid>(fieldName);
+        }
+    }
+    //  OOPS! Not an association record, or an incomplete one
+    throw BackupFileCorruptException(_record.fileName);
+}
+
 void RestoreReader::_processRecord()
 {
     Q_ASSERT(_recordHandlers.contains(_record.type));
     (this->*_recordHandlers[_record.type])();
-    _reportProgress();
+}
+
+void RestoreReader::_processBackupHeaderRecord()
+{   //  Nothing to restore
+}
+
+void RestoreReader::_processBackupTombstoneRecord()
+{   //  OOPS! Only delta backups have these - and they
+    //  are never restored on their own
+    throw BackupFileCorruptException(_record.fileName);
 }
 
 void RestoreReader::_processUserRecord()
 {
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     auto enabled =
         _record.fetchField<bool>("Enabled");
     auto emailAddresses =
@@ -186,16 +617,14 @@ void RestoreReader::_processUserRecord()
     auto uiLocale =
         _record.fetchOptionalField<tt3::ws::UiLocale>("UiLocale");
 
-    auto user =
-        _workspace->createUser( //  may throw
-            _restoreCredentials,
-            enabled,
-            emailAddresses,
-            realName,
-            inactivityTimeout,
-            uiLocale,
-            tt3::ws::Workloads());
-    user->setOid(_restoreCredentials, oid);
+    _workspace->createUser( //  may throw
+        _restoreCredentials,
+        enabled,
+        emailAddresses,
+        realName,
+        inactivityTimeout,
+        uiLocale,
+        tt3::ws::Workloads());
 }
 
 void RestoreReader::_processAccountRecord()
@@ -204,6 +633,7 @@ void RestoreReader::_processAccountRecord()
         _record.fetchField<tt3::ws::Oid>("UserOID");
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     auto enabled =
         _record.fetchField<bool>("Enabled");
     auto emailAddresses =
@@ -225,7 +655,6 @@ void RestoreReader::_processAccountRecord()
             login,
             "",
             capabilities);
-    account->setOid(_restoreCredentials, oid);
     account->_setPasswordHash(passwordHash);    //  may throw
 }
 
@@ -233,23 +662,23 @@ void RestoreReader::_processActivityTypeRecord()
 {
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     auto displayName =
         _record.fetchField<QString>("DisplayName");
     auto description =
         _record.fetchField<QString>("Description");
 
-    auto activityType =
-        _workspace->createActivityType( //  may throw
-            _restoreCredentials,
-            displayName,
-            description);
-    activityType->setOid(_restoreCredentials, oid); //  may throw
+    _workspace->createActivityType( //  may throw
+        _restoreCredentials,
+        displayName,
+        description);
 }
 
 void RestoreReader::_processPublicActivityRecord()
 {
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     auto displayName =
         _record.fetchField<QString>("DisplayName");
     auto description =
@@ -263,24 +692,23 @@ void RestoreReader::_processPublicActivityRecord()
     auto fullScreenReminder =
         _record.fetchField<bool>("FullScreenReminder");
 
-    auto publicActivity =
-        _workspace->createPublicActivity(   //  may throw
-            _restoreCredentials,
-            displayName,
-            description,
-            timeout,
-            requireCommentOnStart,
-            requireCommentOnStop,
-            fullScreenReminder,
-            nullptr,
-            nullptr);
-    publicActivity->setOid(_restoreCredentials, oid);   //  may throw
+    _workspace->createPublicActivity(   //  may throw
+        _restoreCredentials,
+        displayName,
+        description,
+        timeout,
+        requireCommentOnStart,
+        requireCommentOnStop,
+        fullScreenReminder,
+        nullptr,
+        nullptr);
 }
 
 void RestoreReader::_processPublicTaskRecord()
 {
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     auto displayName =
         _record.fetchField<QString>("DisplayName");
     auto description =
@@ -298,44 +726,40 @@ void RestoreReader::_processPublicTaskRecord()
     auto completed =
         _record.fetchField<bool>("Completed");
 
-    tt3::ws::PublicTask publicTask;
-    if (_record.fields.contains("ParentOID"))
+    if (_record.hasField("ParentOID"))
     {
         auto parentOid =
             _record.fetchField<tt3::ws::Oid>("ParentOID");
         auto parent =
             _workspace->getObjectByOid<tt3::ws::PublicTask>(_restoreCredentials, parentOid);
-        publicTask =
-            parent->createChild(
-                _restoreCredentials,
-                displayName,
-                description,
-                timeout,
-                requireCommentOnStart,
-                requireCommentOnStop,
-                fullScreenReminder,
-                nullptr,
-                nullptr,
-                completed,
-                requireCommentOnCompletion);
+        parent->createChild(
+            _restoreCredentials,
+            displayName,
+            description,
+            timeout,
+            requireCommentOnStart,
+            requireCommentOnStop,
+            fullScreenReminder,
+            nullptr,
+            nullptr,
+            completed,
+            requireCommentOnCompletion);
     }
     else
     {
-        publicTask =
-            _workspace->createPublicTask(
-                _restoreCredentials,
-                displayName,
-                description,
-                timeout,
-                requireCommentOnStart,
-                requireCommentOnStop,
-                fullScreenReminder,
-                nullptr,
-                nullptr,
-                completed,
-                requireCommentOnCompletion);
+        _workspace->createPublicTask(
+            _restoreCredentials,
+            displayName,
+            description,
+            timeout,
+            requireCommentOnStart,
+            requireCommentOnStop,
+            fullScreenReminder,
+            nullptr,
+            nullptr,
+            completed,
+            requireCommentOnCompletion);
     }
-    publicTask->setOid(_restoreCredentials, oid);   //  may throw
 }
 
 void RestoreReader::_processPrivateActivityRecord()
@@ -344,6 +768,7 @@ void RestoreReader::_processPrivateActivityRecord()
         _record.fetchField<tt3::ws::Oid>("OwnerOID");
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     auto displayName =
         _record.fetchField<QString>("DisplayName");
     auto description =
@@ -359,18 +784,16 @@ void RestoreReader::_processPrivateActivityRecord()
 
     auto owner =
         _workspace->getObjectByOid<tt3::ws::User>(_restoreCredentials, ownerOid);
-    auto privateActivity =
-        owner->createPrivateActivity(   //  may throw
-            _restoreCredentials,
-            displayName,
-            description,
-            timeout,
-            requireCommentOnStart,
-            requireCommentOnStop,
-            fullScreenReminder,
-            nullptr,
-            nullptr);
-    privateActivity->setOid(_restoreCredentials, oid);   //  may throw
+    owner->createPrivateActivity(   //  may throw
+        _restoreCredentials,
+        displayName,
+        description,
+        timeout,
+        requireCommentOnStart,
+        requireCommentOnStop,
+        fullScreenReminder,
+        nullptr,
+        nullptr);
 }
 
 void RestoreReader::_processPrivateTaskRecord()
@@ -379,6 +802,7 @@ void RestoreReader::_processPrivateTaskRecord()
         _record.fetchField<tt3::ws::Oid>("OwnerOID");
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     auto displayName =
         _record.fetchField<QString>("DisplayName");
     auto description =
@@ -396,52 +820,49 @@ void RestoreReader::_processPrivateTaskRecord()
     auto completed =
         _record.fetchField<bool>("Completed");
 
-    tt3::ws::PrivateTask privateTask;
-    if (_record.fields.contains("ParentOID"))
+    if (_record.hasField("ParentOID"))
     {
         auto parentOid =
             _record.fetchField<tt3::ws::Oid>("ParentOID");
         auto parent =
             _workspace->getObjectByOid<tt3::ws::PrivateTask>(_restoreCredentials, parentOid);
-        privateTask =
-            parent->createChild(
-                _restoreCredentials,
-                displayName,
-                description,
-                timeout,
-                requireCommentOnStart,
-                requireCommentOnStop,
-                fullScreenReminder,
-                nullptr,
-                nullptr,
-                completed,
-                requireCommentOnCompletion);
+        parent->createChild(
+            _restoreCredentials,
+            displayName,
+            description,
+            timeout,
+            requireCommentOnStart,
+            requireCommentOnStop,
+            fullScreenReminder,
+            nullptr,
+            nullptr,
+            completed,
+            requireCommentOnCompletion);
     }
     else
     {
         auto owner =
             _workspace->getObjectByOid<tt3::ws::User>(_restoreCredentials, ownerOid);
-        privateTask =
-            owner->createPrivateTask(
-                _restoreCredentials,
-                displayName,
-                description,
-                timeout,
-                requireCommentOnStart,
-                requireCommentOnStop,
-                fullScreenReminder,
-                nullptr,
-                nullptr,
-                completed,
-                requireCommentOnCompletion);
-    }
-    privateTask->setOid(_restoreCredentials, oid);   //  may throw
+        owner->createPrivateTask(
+            _restoreCredentials,
+            displayName,
+            description,
+            timeout,
+            requireCommentOnStart,
+            requireCommentOnStop,
+            fullScreenReminder,
+            nullptr,
+            nullptr,
+            completed,
+            requireCommentOnCompletion);
+    }
 }
 
 void RestoreReader::_processProjectRecord()
 {
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     auto displayName =
         _record.fetchField<QString>("DisplayName");
     auto description =
@@ -449,74 +870,69 @@ void RestoreReader::_processProjectRecord()
     auto completed =
         _record.fetchField<bool>("Completed");
 
-    tt3::ws::Project project;
-    if (_record.fields.contains("ParentOID"))
+    if (_record.hasField("ParentOID"))
     {
         auto parentOid =
             _record.fetchField<tt3::ws::Oid>("ParentOID");
         auto parent =
             _workspace->getObjectByOid<tt3::ws::Project>(_restoreCredentials, parentOid);
-        project =
-            parent->createChild(
-                _restoreCredentials,
-                displayName,
-                description,
-                tt3::ws::Beneficiaries(),
-                completed);
+        parent->createChild(
+            _restoreCredentials,
+            displayName,
+            description,
+            tt3::ws::Beneficiaries(),
+            completed);
     }
     else
     {
-        project =
-            _workspace->createProject(
-                _restoreCredentials,
-                displayName,
-                description,
-                tt3::ws::Beneficiaries(),
-                completed);
+        _workspace->createProject(
+            _restoreCredentials,
+            displayName,
+            description,
+            tt3::ws::Beneficiaries(),
+            completed);
     }
-    project->setOid(_restoreCredentials, oid);   //  may throw
 }
 
 void RestoreReader::_processWorkStreamRecord()
 {
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     auto displayName =
         _record.fetchField<QString>("DisplayName");
     auto description =
         _record.fetchField<QString>("Description");
 
-    tt3::ws::WorkStream workStream =
-        _workspace->createWorkStream(
-            _restoreCredentials,
-            displayName,
-            description,
-            tt3::ws::Beneficiaries());
-    workStream->setOid(_restoreCredentials, oid);   //  may throw
+    _workspace->createWorkStream(  //  may throw
+        _restoreCredentials,
+        displayName,
+        description,
+        tt3::ws::Beneficiaries());
 }
 
 void RestoreReader::_processBeneficiaryRecord()
 {
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     auto displayName =
         _record.fetchField<QString>("DisplayName");
     auto description =
         _record.fetchField<QString>("Description");
 
-    tt3::ws::Beneficiary beneficiary =
-        _workspace->createBeneficiary(
-            _restoreCredentials,
-            displayName,
-            description,
-            tt3::ws::Workloads());
-    beneficiary->setOid(_restoreCredentials, oid);   //  may throw
+    _workspace->createBeneficiary(  //  may throw
+        _restoreCredentials,
+        displayName,
+        description,
+        tt3::ws::Workloads());
 }
 
 void RestoreReader::_processWorkRecord()
 {
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     auto activityOid =
         _record.fetchField<tt3::ws::Oid>("ActivityOID");
     auto accountOid =
@@ -526,30 +942,27 @@ void RestoreReader::_processWorkRecord()
     auto finishedAt =
         _record.fetchField<QDateTime>("FinishedAt");
 
-    auto activity =
-        _workspace->getObjectByOid<tt3::ws::Activity>(_restoreCredentials, activityOid);
-    auto account =
-        _workspace->getObjectByOid<tt3::ws::Account>(_restoreCredentials, accountOid);
-    auto work =
-        account->createWork(
-            _restoreCredentials,
-            startedAt,
-            finishedAt,
-            activity);
-    work->setOid(_restoreCredentials, oid);   //  may throw
+    auto activity = _activityByOid(activityOid);    //  may throw
+    auto account = _accountByOid(accountOid);   //  may throw
+    account->createWork(
+        _restoreCredentials,
+        startedAt,
+        finishedAt,
+        activity);
 }
 
 void RestoreReader::_processEventRecord()
 {
     auto oid =
         _record.fetchField<tt3::ws::Oid>("OID");
+    _workspace->setBulkLoadOid(_restoreCredentials, oid);  //  may throw
     QList<tt3::ws::Oid> activityOids;
-    if (_record.fields.contains("ActivityOID"))
+    if (_record.hasField("ActivityOID"))
     {
         activityOids.append(
             _record.fetchField<tt3::ws::Oid>("ActivityOID"));
     }
-    else if (_record.fields.contains("ActivityOIDs"))
+    else if (_record.hasField("ActivityOIDs"))
     {
         activityOids =
             _record.fetchField<QList<tt3::ws::Oid>>("ActivityOIDs");
@@ -561,23 +974,20 @@ void RestoreReader::_processEventRecord()
     auto summary =
         _record.fetchField<QString>("Summary");
 
-    auto account =
-        _workspace->getObjectByOid<tt3::ws::Account>(_restoreCredentials, accountOid);
+    auto account = _accountByOid(accountOid);   //  may throw
     tt3::ws::Activities activities =
         tt3::util::transform(
             QSet<tt3::ws::Oid>(activityOids.cbegin(), activityOids.cend()),
             [&](const auto & o)
             {
-                return _workspace->getObjectByOid<tt3::ws::Activity>(_restoreCredentials, o);
+                return _activityByOid(o);   //  may throw
             });
 
-    auto event =
-        account->createEvent(
-            _restoreCredentials,
-            occurredAt,
-            summary,
-            activities);
-    event->setOid(_restoreCredentials, oid);   //  may throw
+    account->createEvent(
+        _restoreCredentials,
+        occurredAt,
+        summary,
+        activities);
 }
 
 void RestoreReader::_processQuickPicksListAssociationRecord()
@@ -645,25 +1055,25 @@ void RestoreReader::_processWorkloadBeneficiariesAssociationRecord()
 auto RestoreReader::_resolveActivity(
     ) -> tt3::ws::Activity
 {
-    if (_record.fields.contains("PublicActivityOID"))
+    if (_record.hasField("PublicActivityOID"))
     {
         auto publicActivityOid =
             _record.fetchField<tt3::ws::Oid>("PublicActivityOID");
         return _workspace->getObjectByOid<tt3::ws::PublicActivity>(_restoreCredentials, publicActivityOid);
     }
-    else if (_record.fields.contains("PublicTaskOID"))
+    else if (_record.hasField("PublicTaskOID"))
     {
         auto publicTaskOid =
             _record.fetchField<tt3::ws::Oid>("PublicTaskOID");
         return _workspace->getObjectByOid<tt3::ws::PublicTask>(_restoreCredentials, publicTaskOid);
     }
-    else if (_record.fields.contains("PrivateActivityOID"))
+    else if (_record.hasField("PrivateActivityOID"))
     {
         auto privateActivityOid =
             _record.fetchField<tt3::ws::Oid>("PrivateActivityOID");
         return _workspace->getObjectByOid<tt3::ws::PrivateActivity>(_restoreCredentials, privateActivityOid);
     }
-    else if (_record.fields.contains("PrivateTaskOID"))
+    else if (_record.hasField("PrivateTaskOID"))
     {
         auto privateTaskOid =
             _record.fetchField<tt3::ws::Oid>("PrivateTaskOID");
@@ -671,20 +1081,20 @@ auto RestoreReader::_resolveActivity(
     }
     else
     {
-        throw BackupFileCorruptException(_restoreFile.fileName());
+        throw BackupFileCorruptException(_record.fileName);
     }
 }
 
 auto RestoreReader::_resolveWorkload(
     ) -> tt3::ws::Workload
 {
-    if (_record.fields.contains("ProjectOID"))
+    if (_record.hasField("ProjectOID"))
     {
         auto projectOID =
             _record.fetchField<tt3::ws::Oid>("ProjectOID");
         return _workspace->getObjectByOid<tt3::ws::Project>(_restoreCredentials, projectOID);
     }
-    else if (_record.fields.contains("WorkStreamOID"))
+    else if (_record.hasField("WorkStreamOID"))
     {
         auto workStreamOID =
             _record.fetchField<tt3::ws::Oid>("WorkStreamOID");
@@ -692,8 +1102,56 @@ auto RestoreReader::_resolveWorkload(
     }
     else
     {
-        throw BackupFileCorruptException(_restoreFile.fileName());
+        throw BackupFileCorruptException(_record.fileName);
+    }
+}
+
+auto RestoreReader::_accountByOid(
+        const tt3::ws::Oid & oid
+    ) -> tt3::ws::Account
+{
+    auto it = _accountsByOid.constFind(oid);
+    if (it != _accountsByOid.cend())
+    {
+        return it.value();
+    }
+    auto account =
+        _workspace->getObjectByOid<tt3::ws::Account>(_restoreCredentials, oid); //  may throw
+    _accountsByOid.insert(oid, account);
+    return account;
+}
+
+auto RestoreReader::_activityByOid(
+        const tt3::ws::Oid & oid
+    ) -> tt3::ws::Activity
+{
+    auto it = _activitiesByOid.constFind(oid);
+    if (it != _activitiesByOid.cend())
+    {
+        return it.value();
     }
+    auto activity =
+        _workspace->getObjectByOid<tt3::ws::Activity>(_restoreCredentials, oid);    //  may throw
+    _activitiesByOid.insert(oid, activity);
+    return activity;
+}
+
+bool RestoreReader::_isBinaryBackup(const QString & backupFileName)
+{
+    QFile file(backupFileName);
+    const QByteArray & binaryMagic = tt3::tools::backup::BackupWriter::BinaryMagic;
+    return file.open(QIODevice::ReadOnly) &&
+           file.read(binaryMagic.size()) == binaryMagic;
+}
+
+quint64 RestoreReader::_totalSize(const QStringList & backupFileNames)
+{
+    quint64 result = 0;
+    for (const QString & backupFileName : backupFileNames)
+    {
+        result += QFileInfo(backupFileName).size();
+    }
+    return result;
 }
 
 //////////
@@ -954,4 +1412,54 @@ QList<tt3::ws::Oid> tt3::tools::restore::parse<QList<tt3::ws::Oid>>(const QStrin
     return result;
 }
 
+//////////
+//  Decoding
+template <> TT3_TOOLS_RESTORE_PUBLIC
+tt3::ws::InactivityTimeout tt3::tools::restore::decode<tt3::ws::InactivityTimeout>(QDataStream & stream)
+{   //  Stored as minutes
+    qint32 minutes = 0;
+    stream >> minutes;
+    return tt3::util::TimeSpan::minutes(minutes);
+}
+
+template <> TT3_TOOLS_RESTORE_PUBLIC
+tt3::ws::UiLocale tt3::tools::restore::decode<tt3::ws::UiLocale>(QDataStream & stream)
+{   //  Stored as the locale string
+    QString s;
+    stream >> s;
+    qsizetype scan = 0;
+    QLocale result = tt3::util::fromString<QLocale>(s, scan);  //  may throw
+    if (scan != s.length())
+    {   //  OOPS!
+        throw tt3::util::ParseException(s, scan);
+    }
+    return result;
+}
+
+template <> TT3_TOOLS_RESTORE_PUBLIC
+tt3::ws::Capabilities tt3::tools::restore::decode<tt3::ws::Capabilities>(QDataStream & stream)
+{   //  Stored as a Capability bit mask
+    qint32 mask = 0;
+    stream >> mask;
+    tt3::ws::Capabilities result;
+    for (qint32 bit = 0x0001; bit <= 0x1000; bit <<= 1)
+    {
+        if ((mask & bit) != 0)
+        {
+            result |= tt3::ws::Capability(bit);
+        }
+    }
+    return result;
+}
+
+template <> TT3_TOOLS_RESTORE_PUBLIC
+QDateTime tt3::tools::restore::decode<QDateTime>(QDataStream & stream)
+{   //  Stored as UTC milliseconds since epoch
+    qint64 ms = 0;
+    stream >> ms;
+    return (ms == std::numeric_limits<qint64>::min()) ?
+                QDateTime() :
+                QDateTime::fromMSecsSinceEpoch(ms, QTimeZone::UTC);
+}
+
 //  End of tt3-tools-restore/RestoreReader.cpp
@@ -34,6 +34,25 @@ namespace tt3::tools::restore
     TT3_TOOLS_RESTORE_DECLARE_PARSE(QList<tt3::ws::Oid>)
 #undef TT3_TOOLS_RESTORE_DECLARE_PARSE
 
+    //  All decode() methods may throw; they decode
+    //  binary backup format field values
+    template <class T>
+    T decode(QDataStream & stream)
+    {
+        T result;
+        stream >> result;
+        return result;
+    }
+#define TT3_TOOLS_RESTORE_DECLARE_DECODE(T)         \
+    template <> TT3_TOOLS_RESTORE_PUBLIC            \
+    T decode<T>(QDataStream & stream);
+
+    TT3_TOOLS_RESTORE_DECLARE_DECODE(tt3::ws::InactivityTimeout)
+    TT3_TOOLS_RESTORE_DECLARE_DECODE(tt3::ws::UiLocale)
+    TT3_TOOLS_RESTORE_DECLARE_DECODE(tt3::ws::Capabilities)
+    TT3_TOOLS_RESTORE_DECLARE_DECODE(QDateTime)
+#undef TT3_TOOLS_RESTORE_DECLARE_DECODE
+
     class RestoreProgressDialog;
 
     /// \class RestoreReader tt3-tools-restore/API.hpp
@@ -42,6 +61,13 @@ namespace tt3::tools::restore
     {
         TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(RestoreReader)
 
+        //////////
+        //  Constants
+    public:
+        /// \brief
+        ///     The latest version of the binary format understood.
+        static constexpr quint32    BinaryVersion = 2;
+
         //////////
         //  Construction/destruction
     public:
@@ -61,6 +87,30 @@ namespace tt3::tools::restore
                 const QString & backupFileName
             );
 
+        /// \brief
+        ///     Constructs the RestoreReader that restores a full
+        ///     backup with delta backups applied on top of it.
+        /// \details
+        ///     The backup files can be listed in any order; they
+        ///     are ordered by their modification stamps. Exactly
+        ///     one of them must be a full backup, and the delta
+        ///     backups must form an unbroken chain from it, with
+        ///     each delta backup based on a modification stamp
+        ///     no later than that covered by the ones before it.
+        /// \param workspace
+        ///     The workspace to restore into.
+        /// \param credentials
+        ///     The credentials of the service caller.
+        /// \param backupFileNames
+        ///     The names of the backup files created earlier.
+        /// \exception Exception
+        ///     If an error occurs.
+        RestoreReader(
+                tt3::ws::Workspace workspace,
+                const tt3::ws::Credentials & credentials,
+                const QStringList & backupFileNames
+            );
+
         /// \brief
         ///     The class destructor.
         ~RestoreReader();
@@ -92,9 +142,19 @@ namespace tt3::tools::restore
         const int       _oneRecordDelayMs;
         const tt3::ws::RestoreCredentials _restoreCredentials;   //  for _workspace
 
+        struct _BackupFile
+        {
+            QString     fileName;
+            QUuid       instanceId; //  of the database backed up; null == unknown
+            quint64     modificationStamp = 0;  //  0 == predates delta backups
+            std::optional<quint64>  baseModificationStamp;  //  nullopt == full backup
+        };
+        QList<_BackupFile>  _backupFiles;   //  full backup 1st, then deltas by modificationStamp
+        _BackupFile *   _backupFileBeingRead = nullptr;
+
         QFile           _restoreFile;   //  to read from
-        QTextStream     _restoreStream; //  to read from
-        quint64         _bytesRead = 0;
+        QTextStream     _restoreStream; //  to read from (text format)
+        quint64         _bytesRead = 0; //  from files read completely
 
         std::unique_ptr<RestoreProgressDialog>  _progressDialog = nullptr;
 
@@ -106,32 +166,51 @@ namespace tt3::tools::restore
 
         //  All methods may throw
         static int      _xdigit(QChar c);
+        static bool     _isBinaryBackup(const QString & backupFileName);
+        static quint64  _totalSize(const QStringList & backupFileNames);
 
         struct _Record
         {
-            _Record(RestoreReader * rr) : restoreReader(rr) {}
-
-            RestoreReader *const    restoreReader;
             QString     type;   //  == backup section name
-            QMap<QString,QString>   fields;
+            QString     fileName;   //  of the backup file the record comes from
+            QMap<QString,QString>   fields;     //  text format
+            QMap<QString,QByteArray>    binaryFields;   //  binary format
 
             bool        isValid() const
             {
                 return !type.isEmpty();
             }
 
-            void        reset(const QString & recordType = "")
+            void        reset(const QString & recordType = "", const QString & recordFileName = "")
             {
                 type = recordType;
+                fileName = recordFileName;
                 fields.clear();
+                binaryFields.clear();
+            }
+
+            bool        hasField(const QString & field) const
+            {
+                return fields.contains(field) || binaryFields.contains(field);
             }
 
             template <class T>
             T           fetchField(const QString & field)
             {
+                if (binaryFields.contains(field))
+                {
+                    QDataStream stream(binaryFields[field]);
+                    stream.setVersion(QDataStream::Qt_6_0);
+                    T result = decode<T>(stream);
+                    if (stream.status() != QDataStream::Ok || !stream.atEnd())
+                    {   //  OOPS!
+                        throw BackupFileCorruptException(fileName);
+                    }
+                    return result;
+                }
                 if (!fields.contains(field))
                 {   //  OOPS!
-                    throw BackupFileCorruptException(restoreReader->_restoreFile.fileName());
+                    throw BackupFileCorruptException(fileName);
                 }
                 qsizetype scan = 0;
                 T result = parse<T>(fields[field], scan);
@@ -145,15 +224,54 @@ namespace tt3::tools::restore
             template <class T>
             T           fetchOptionalField(const QString & field)
             {
-                return fields.contains(field) ?
+                return hasField(field) ?
                         fetchField<T>(field) :  //  may throw
                         T();
             }
         };
-        _Record         _record{this};  //  currently being read/processed
+        _Record         _record;    //  currently being read/processed
+        _RecordHandler  _onRecordRead = nullptr;
+        bool            _stopReading = false;
+
+        //  Delta backups are read before the full backup; the
+        //  latest version of each object and of its outgoing
+        //  associations replaces whatever the full backup has.
+        QSet<tt3::ws::Oid>  _destroyedOids;
+        QSet<tt3::ws::Oid>  _supersededOids;    //  by delta objects or destroyed
+        QHash<tt3::ws::Oid, _Record>    _deltaObjects;
+        QList<tt3::ws::Oid> _deltaObjectOrder;  //  of 1st appearance
+        QMap<tt3::ws::Oid, QList<_Record>>  _deltaAssociations; //  by owner OID
+
+        //  With deltas applied, a record may refer to an object
+        //  that comes later; such records wait until it's there
+        QSet<tt3::ws::Oid>  _restoredOids;
+        QHash<tt3::ws::Oid, QList<_Record>> _deferredRecords;   //  by awaited OID
+
+        //  Works and Events are the bulk of a backup, yet refer
+        //  to few Accounts and Activities - resolve each just once
+        QHash<tt3::ws::Oid, tt3::ws::Account>   _accountsByOid;
+        QHash<tt3::ws::Oid, tt3::ws::Activity>  _activitiesByOid;
 
         void            _reportProgress();
+        void            _readBackupFile(
+                                const QString & backupFileName,
+                                _RecordHandler onRecordRead
+                            );
+        void            _readTextRecords();
+        void            _readBinaryRecords();
+        void            _readBackupHeaders();
+        void            _readBackupHeaderRecord();  //  an _onRecordRead
+        void            _collectDeltaRecord();      //  an _onRecordRead
+        void            _restoreFullBackupRecord(); //  an _onRecordRead
+        void            _restoreDeltaRecords();
+        void            _restoreRecord();
+        auto            _referencedOids(
+                            ) -> QList<tt3::ws::Oid>;
+        auto            _associationOwnerOid(
+                            ) -> tt3::ws::Oid;
         void            _processRecord();
+        void            _processBackupHeaderRecord();
+        void            _processBackupTombstoneRecord();
         void            _processUserRecord();
         void            _processAccountRecord();
         void            _processActivityTypeRecord();
@@ -176,6 +294,12 @@ namespace tt3::tools::restore
                             ) -> tt3::ws::Activity;
         auto            _resolveWorkload(
                             ) -> tt3::ws::Workload;
+        auto            _accountByOid(
+                                const tt3::ws::Oid & oid
+                            ) -> tt3::ws::Account;
+        auto            _activityByOid(
+                                const tt3::ws::Oid & oid
+                            ) -> tt3::ws::Activity;
     };
 }
 
@@ -82,7 +82,7 @@ void RestoreTool::run(QWidget * parent)
             adminLogin,
             adminPassword);
     //  Go!
-    QString restoreSource = dlg.restoreSource();
+    QStringList restoreSources = dlg.restoreSources();
     bool restoreSuccessful = false;
     tt3::ws::Credentials adminCredentials(adminLogin, adminPassword);
     try
@@ -90,7 +90,7 @@ void RestoreTool::run(QWidget * parent)
         RestoreReader restoreReader(
             workspace,
             adminCredentials,
-            restoreSource);
+            restoreSources);
         try
         {
             restoreSuccessful =
@@ -99,7 +99,7 @@ void RestoreTool::run(QWidget * parent)
         catch (const tt3::util::ParseException & ex)
         {   //  Log & translate
             qCritical() << ex;
-            throw BackupFileCorruptException(restoreSource);
+            throw BackupFileCorruptException(restoreSources.join("; "));
         }
         //  Cleanup before returning
         workspace->close(); //  may throw
@@ -129,7 +129,7 @@ void RestoreTool::run(QWidget * parent)
             rr.string(RID(Title)),
             rr.string(RID(Message),
                       workspaceAddress->displayForm(),
-                      restoreSource));
+                      restoreSources.join('\n')));
     }
     else
     {   //  Need to destroy the partually restored workspace
@@ -24,6 +24,7 @@ HEADERS += \
 PRECOMPILED_HEADER = API.hpp
 
 LIBS += \
+    -ltt3-tools-backup$$TARGET_SUFFIX \
     -ltt3-gui$$TARGET_SUFFIX \
     -ltt3-ws$$TARGET_SUFFIX \
     -ltt3-db-api$$TARGET_SUFFIX \
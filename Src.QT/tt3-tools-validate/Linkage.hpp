@@ -0,0 +1,25 @@
+//
+//  tt3-tools-validate/Linkage.hpp - tt3-tools-validate linkage definitions
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+
+#if defined(TT3_TOOLS_VALIDATE_LIBRARY)
+    #define TT3_TOOLS_VALIDATE_PUBLIC Q_DECL_EXPORT
+#else
+    #define TT3_TOOLS_VALIDATE_PUBLIC Q_DECL_IMPORT
+#endif
+
+//  End of tt3-tools-validate/Linkage.hpp
+
@@ -0,0 +1,113 @@
+//
+//  tt3-tools-validate/ValidateTool.cpp - ValidateTool class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-tools-validate/API.hpp"
+using namespace tt3::tools::validate;
+
+//////////
+//  Singleton
+TT3_IMPLEMENT_SINGLETON(ValidateTool)
+ValidateTool::ValidateTool() {}
+ValidateTool::~ValidateTool() {}
+
+//////////
+//  tt3::uti::ITool
+ValidateTool::Mnemonic ValidateTool::mnemonic() const
+{
+    return M(Validate);
+}
+
+QString ValidateTool::displayName() const
+{
+    static Component::Resources *const resources = Component::Resources::instance();   //  idempotent
+    return resources->string(RSID(ValidateTool), RID(DisplayName));
+}
+
+QString ValidateTool::description() const
+{
+    static Component::Resources *const resources = Component::Resources::instance();   //  idempotent
+    return resources->string(RSID(ValidateTool), RID(Description));
+}
+
+QIcon ValidateTool::smallIcon() const
+{
+    static const QIcon icon(":/tt3-tools-validate/Resources/Images/Misc/ValidateSmall.png");
+    return icon;
+}
+
+QIcon ValidateTool::largeIcon() const
+{
+    static const QIcon icon(":/tt3-tools-validate/Resources/Images/Misc/ValidateLarge.png");
+    return icon;
+}
+
+bool ValidateTool::isEnabled() const
+{
+    return tt3::gui::theCurrentWorkspace != nullptr;
+}
+
+void ValidateTool::run(QWidget * parent)
+{
+    Q_ASSERT(QThread::currentThread()->eventDispatcher() != nullptr);
+
+    tt3::ws::Workspace workspace = tt3::gui::theCurrentWorkspace;
+    if (workspace == nullptr)
+    {   //  OOPS! Nothing to validate
+        return;
+    }
+    //  Make sure we're using the Credentials that
+    //  grant the Administrator capability
+    tt3::ws::Credentials credentials = tt3::gui::theCurrentCredentials;
+    while (!credentials.isValid() ||
+           !workspace->grantsAll(credentials, tt3::ws::Capability::Administrator))  //  may throw
+    {   //  Need to use different credentials
+        tt3::gui::ChooseReloginDialog dlg1(parent, workspace->address());
+        if (dlg1.doModal() != tt3::gui::ChooseReloginDialog::Result::Yes)
+        {   //  Abort
+            return;
+        }
+        //  The user has confirmed they want to re-login
+        tt3::gui::LoginDialog dlg2(parent, QString());
+        if (dlg2.doModal() != tt3::gui::LoginDialog::Result::Ok)
+        {   //  Abort
+            return;
+        }
+        credentials = dlg2.credentials();
+    }
+
+    //  A full check visits every object, so it can take a while
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    try
+    {
+        workspace->validate(credentials);   //  may throw
+    }
+    catch (...)
+    {   //  OOPS! Cleanup & re-throw
+        QApplication::restoreOverrideCursor();
+        throw;
+    }
+    QApplication::restoreOverrideCursor();
+
+    //  Pop up the "validation completed" message
+    tt3::util::ResourceReader rr(Component::Resources::instance(), RSID(ValidationCompletedDialog));
+    tt3::gui::MessageDialog::show(
+        parent,
+        rr.string(RID(Title)),
+        rr.string(RID(Message),
+                  workspace->address()->displayForm()));
+}
+
+//  End of tt3-tools-validate/ValidateTool.cpp
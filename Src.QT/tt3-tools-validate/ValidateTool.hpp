@@ -0,0 +1,42 @@
+//
+//  tt3-tools-validate/ValidateTool.hpp - tt3 Validate tool
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+
+namespace tt3::tools::validate
+{
+    /// \class ValidateTool tt3-tools-validate/API.hpp
+    /// \brief The "TT3 Validate" tool.
+    /// \details
+    ///     Performs a full consistency check of the current workspace.
+    class TT3_TOOLS_VALIDATE_PUBLIC ValidateTool final
+        :   public virtual tt3::util::ITool
+    {
+        TT3_DECLARE_SINGLETON(ValidateTool)
+
+        //////////
+        //  ITool
+    public:
+        virtual Mnemonic    mnemonic() const override;
+        virtual QString     displayName() const override;
+        virtual QString     description() const override;
+        virtual QIcon       smallIcon() const override;
+        virtual QIcon       largeIcon() const override;
+        virtual bool        isEnabled() const override;
+        virtual void        run(QWidget * parent) override;
+    };
+}
+
+//  End of tt3-tools-validate/ValidateTool.hpp
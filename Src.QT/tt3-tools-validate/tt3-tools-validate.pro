@@ -0,0 +1,25 @@
+include(../tt3.pri)
+
+TEMPLATE = lib
+DEFINES += TT3_TOOLS_VALIDATE_LIBRARY
+
+SOURCES += \
+    Component.cpp \
+    ValidateTool.cpp
+
+HEADERS += \
+    API.hpp \
+    Component.hpp \
+    Linkage.hpp \
+    ValidateTool.hpp
+
+PRECOMPILED_HEADER = API.hpp
+
+RESOURCES += \
+    tt3-tools-validate.qrc
+
+LIBS += \
+    -ltt3-gui$$TARGET_SUFFIX \
+    -ltt3-ws$$TARGET_SUFFIX \
+    -ltt3-db-api$$TARGET_SUFFIX \
+    -ltt3-util$$TARGET_SUFFIX
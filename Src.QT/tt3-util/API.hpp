@@ -41,6 +41,9 @@
     #error Unsupported C++ toolchain
 #endif
 
+#include <atomic>
+#include <cstring>
+#include <exception>
 #include <regex>
 
 #include <QtCore/qglobal.h>
@@ -53,13 +56,17 @@
 #include <QChartView>
 #include <QClipboard>
 #include <QCollator>
+#include <QDataStream>
 #include <QDateTime>
+#include <QDeadlineTimer>
 #include <QDebug>
 #include <QDesktopServices>
 #include <QDialog>
 #include <QDir>
 #include <QDomDocument>
 #include <QDomElement>
+#include <QElapsedTimer>
+#include <QEventLoop>
 #include <QException>
 #include <QFileDialog>
 #include <QGraphicsLayout>
@@ -73,6 +80,7 @@
 #include <QMenuBar>
 #include <QMessageBox>
 #include <QMessageLogger>
+#include <QMetaMethod>
 #include <QMoveEvent>
 #include <QMutex>
 #include <QMutexLocker>
@@ -93,14 +101,19 @@
 #include <QTemporaryFile>
 #include <QTextDocumentFragment>
 #include <QThread>
+#include <QThreadPool>
 #include <QTimer>
 #include <QToolTip>
 #include <QTreeWidgetItem>
+#include <QTreeWidgetItemIterator>
 #include <QUrl>
 #include <QUuid>
 #include <QVariant>
 #include <QVersionNumber>
+#include <QWaitCondition>
 #include <QWidget>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 
 #include <QWebEngineView>
 
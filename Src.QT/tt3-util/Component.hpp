@@ -29,6 +29,8 @@ namespace tt3::util
         /// \brief A type alias to improve code readability.
         using Mnemonic = tt3::util::Mnemonic;
         /// \brief A type alias to improve code readability.
+        using Mnemonics = QSet<tt3::util::Mnemonic>;
+        /// \brief A type alias to improve code readability.
         using ISubsystem = tt3::util::ISubsystem;
 
         //////////
@@ -113,6 +115,20 @@ namespace tt3::util
         virtual auto    subsystem(
                             ) const -> ISubsystem * = 0;
 
+        /// \brief
+        ///     Returns the mnemonics of the components this
+        ///     component depends on.
+        /// \details
+        ///     Those of these components that are known are
+        ///     initialized before, and deinitialized after,
+        ///     this component. The default implementation
+        ///     returns an empty set.
+        /// \return
+        ///     The mnemonics of the components this component
+        ///     depends on.
+        virtual auto    dependencies(
+                            ) const -> Mnemonics;
+
         /// \brief
         ///     Returns the resource factory used by this component.
         /// \details
@@ -244,10 +260,14 @@ namespace tt3::util
         ///     Initializes all known Components by calling
         ///     initialize() on each of them.
         /// \details
-        ///     Any exceptions thrown by Component initializers
-        ///     are logged, but do not stop the initialization
-        ///     process. This was as many Cmponents as possible
-        ///     are initialized.
+        ///     Components are initialized in the order of their
+        ///     dependencies(). Any exceptions thrown by Component
+        ///     initializers are logged, but do not stop the
+        ///     initialization process. This was as many Cmponents
+        ///     as possible are initialized; Components that have
+        ///     failed to initialize, and those depending on them,
+        ///     are retried for as long as this makes progress (and
+        ///     again by the next call).
         /// \param progressListener
         ///     The listener to notify of the component initialization
         ///     progress, nullptr == none.
@@ -257,7 +277,8 @@ namespace tt3::util
 
         /// \brief
         ///     Deinitializes all known Components by calling
-        ///     deinitialize() on each of them.
+        ///     deinitialize() on each of them, in the order
+        ///     opposite to that of their initialization.
         static void     deinitializeComponents();
 
         /// \brief
@@ -286,6 +307,12 @@ namespace tt3::util
         //  Helpers
         static _Impl *  _impl();
         static void     _loadLibrary(const QString & fileName);
+        static bool     _initializeComponent(IComponent * component);
+        static bool     _isInDependencyCycle(
+                                IComponent * component,
+                                const QHash<Mnemonic, IComponent*> & componentsByMnemonic,
+                                const QSet<IComponent*> & failedComponents
+                            );
     };
 
 //  A helper macro for Component declaration - use within a .hpp
@@ -23,6 +23,7 @@ struct ComponentManager::_Impl
 
     Mutex       guard;
     Registry    registry;
+    QList<IComponent*>  initializationOrder;    //  of the initialized components
 };
 
 namespace
@@ -127,7 +128,18 @@ void ComponentManager::discoverComponents(
     QString startupDirectory = QCoreApplication::applicationDirPath();
     QString exeFile = QCoreApplication::applicationFilePath();
     //  Discover DLLs/SOs and load Components from them
-    const auto entryInfos = QDir(startupDirectory).entryInfoList();
+    //  (only list the candidates - the startup directory
+    //  may contain many other files)
+    const auto entryInfos =
+        QDir(startupDirectory).entryInfoList(
+#if defined(Q_OS_WINDOWS)
+            QStringList("tt3-*.dll"),
+#elif defined(Q_OS_LINUX)
+            QStringList("libtt3-*.so"),
+#else
+    #error Unsupported platform
+#endif
+            QDir::Files);
     if (progressListener != nullptr)
     {
         progressListener(
@@ -182,12 +194,50 @@ void ComponentManager::initializeComponents(
     //  to report initialization progress
     qsizetype totalComponents = impl->registry.values().size();
     qsizetype initializedComponents = 0;
+    //  Dependencies are by mnemonic - use the latest
+    //  version of each component
+    QHash<Mnemonic, IComponent*> componentsByMnemonic;
     for (auto component : impl->registry.values())
     {
         if (component->_initialized)
         {
             initializedComponents++;
         }
+        IComponent *& latest = componentsByMnemonic[component->mnemonic()];
+        if (latest == nullptr || component->version() > latest->version())
+        {
+            latest = component;
+        }
+    }
+    //  Order the uninitialized components topologically:
+    //  a component becomes "ready" once all the (known)
+    //  components it depends on have been initialized
+    QHash<IComponent*, qsizetype> numPendingDependencies;
+    QHash<IComponent*, QList<IComponent*>> dependents;
+    QQueue<IComponent*> readyComponents;
+    for (auto component : impl->registry.values())
+    {
+        if (component->_initialized)
+        {
+            continue;
+        }
+        qsizetype numPending = 0;
+        for (const Mnemonic & dependency : component->dependencies())
+        {
+            IComponent * dependencyComponent = componentsByMnemonic.value(dependency);
+            if (dependencyComponent != nullptr &&
+                dependencyComponent != component &&
+                !dependencyComponent->_initialized)
+            {
+                dependents[dependencyComponent].append(component);
+                numPending++;
+            }
+        }
+        numPendingDependencies[component] = numPending;
+        if (numPending == 0)
+        {
+            readyComponents.enqueue(component);
+        }
     }
     //  Go!
     if (progressListener != nullptr)
@@ -197,13 +247,72 @@ void ComponentManager::initializeComponents(
             "",
             0.0);
     }
-    for (bool keepGoing = true; keepGoing; )
+    QSet<IComponent*> failedComponents;
+    for (; ; )
+    {
+        while (!readyComponents.isEmpty())
+        {
+            IComponent * component = readyComponents.dequeue();
+            Q_ASSERT(!component->_initialized);
+            if (progressListener != nullptr)
+            {
+                progressListener(
+                    rr.string(RID(InitializingComponents)),
+                    component->displayName(),
+                    float(initializedComponents) / float(totalComponents));
+            }
+            if (!_initializeComponent(component))
+            {   //  Components that depend on this one stay
+                //  uninitialized until the retry pass below
+                failedComponents.insert(component);
+                continue;
+            }
+            initializedComponents++;
+            for (IComponent * dependent : dependents.value(component))
+            {
+                if (--numPendingDependencies[dependent] == 0)
+                {
+                    readyComponents.enqueue(dependent);
+                }
+            }
+        }
+        //  Whatever remains is either waiting for a component
+        //  that has failed, or for a dependency cycle. Be
+        //  defensive and break the cycle by initializing one
+        //  of its components anyway.
+        IComponent * cycleBreaker = nullptr;
+        for (auto component : impl->registry.values())
+        {
+            if (!component->_initialized &&
+                !failedComponents.contains(component) &&
+                numPendingDependencies.value(component) != 0 &&
+                _isInDependencyCycle(component, componentsByMnemonic, failedComponents))
+            {
+                cycleBreaker = component;
+                break;
+            }
+        }
+        if (cycleBreaker == nullptr)
+        {   //  All done
+            break;
+        }
+        qWarning() << "Component dependency cycle at"
+                   << cycleBreaker->mnemonic().toString();
+        numPendingDependencies[cycleBreaker] = 0;
+        readyComponents.enqueue(cycleBreaker);
+    }
+    //  A component may fail to initialize until some other
+    //  component it does not declare a dependency on has been
+    //  initialized. So keep retrying all components that are
+    //  still uninitialized (the failed ones and those depending
+    //  on them) for as long as that makes any progress.
+    for (bool keepGoing = !failedComponents.isEmpty(); keepGoing; )
     {
         keepGoing = false;
         for (auto component : impl->registry.values())
         {
             if (!component->_initialized)
-            {   //  Try this one!
+            {   //  Try this one again!
                 if (progressListener != nullptr)
                 {
                     progressListener(
@@ -211,27 +320,13 @@ void ComponentManager::initializeComponents(
                         component->displayName(),
                         float(initializedComponents) / float(totalComponents));
                 }
-                try
+                if (_initializeComponent(component))
                 {
-                    component->initialize(); //  may throw
-                    component->_initialized = true;
                     initializedComponents++;
                     keepGoing = true;
                 }
-                catch (const Exception & ex)
-                {   //  OOPS! Log, but suppress
-                    qCritical() << ex;
-                }
-                catch (const Error & ex)
-                {   //  OOPS! Log, but suppress
-                    qCritical() << ex;
-                }
-                catch (...)
-                {   //  OOPS! Suppress, though
-                }
             }
         }
-
     }
     if (progressListener != nullptr)
     {
@@ -247,27 +342,27 @@ void ComponentManager::deinitializeComponents()
     _Impl * impl = _impl();
     Lock _(impl->guard);
 
-    for (auto component : impl->registry.values())
+    //  Dependents go before the components they depend on
+    while (!impl->initializationOrder.isEmpty())
     {
-        if (component->_initialized)
-        {
-            try
-            {   //  Be defensive - cleanup as many as possible
-                component->deinitialize();
-            }
-            catch (const Exception & ex)
-            {   //  OOPS! Log, but suppress
-                qCritical() << ex;
-            }
-            catch (const Error & ex)
-            {   //  OOPS! Log, but suppress
-                qCritical() << ex;
-            }
-            catch (...)
-            {   //  OOPS! Suppress, though
-            }
-            component->_initialized = false;
+        IComponent * component = impl->initializationOrder.takeLast();
+        Q_ASSERT(component->_initialized);
+        try
+        {   //  Be defensive - cleanup as many as possible
+            component->deinitialize();
+        }
+        catch (const Exception & ex)
+        {   //  OOPS! Log, but suppress
+            qCritical() << ex;
+        }
+        catch (const Error & ex)
+        {   //  OOPS! Log, but suppress
+            qCritical() << ex;
         }
+        catch (...)
+        {   //  OOPS! Suppress, though
+        }
+        component->_initialized = false;
     }
 }
 
@@ -388,6 +483,64 @@ ComponentManager::_Impl * ComponentManager::_impl()
     return &impl;
 }
 
+bool ComponentManager::_initializeComponent(IComponent * component)
+{
+    _Impl * impl = _impl();
+    Q_ASSERT(impl->guard.isLockedByCurrentThread());
+    Q_ASSERT(!component->_initialized);
+
+    try
+    {
+        component->initialize(); //  may throw
+        component->_initialized = true;
+        impl->initializationOrder.append(component);
+        return true;
+    }
+    catch (const Exception & ex)
+    {   //  OOPS! Log, but suppress
+        qCritical() << ex;
+    }
+    catch (const Error & ex)
+    {   //  OOPS! Log, but suppress
+        qCritical() << ex;
+    }
+    catch (...)
+    {   //  OOPS! Suppress, though
+    }
+    return false;
+}
+
+bool ComponentManager::_isInDependencyCycle(
+        IComponent * component,
+        const QHash<Mnemonic, IComponent*> & componentsByMnemonic,
+        const QSet<IComponent*> & failedComponents
+    )
+{   //  Can we get back to the component by following
+    //  the uninitialized (but not failed) dependencies ?
+    QSet<IComponent*> visited;
+    QStack<IComponent*> toVisit;
+    toVisit.push(component);
+    while (!toVisit.isEmpty())
+    {
+        IComponent * c = toVisit.pop();
+        for (const Mnemonic & dependency : c->dependencies())
+        {
+            IComponent * d = componentsByMnemonic.value(dependency);
+            if (d == component)
+            {
+                return true;
+            }
+            if (d != nullptr && !d->_initialized &&
+                !failedComponents.contains(d) && !visited.contains(d))
+            {
+                visited.insert(d);
+                toVisit.push(d);
+            }
+        }
+    }
+    return false;
+}
+
 void ComponentManager::_loadLibrary(const QString & fileName)
 {
     _Impl * impl = _impl();
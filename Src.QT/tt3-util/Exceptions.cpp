@@ -75,4 +75,12 @@ QString NotImplementedError::errorMessage() const
     return resources->string(RSID(Errors), RID(NotImplementedError));
 }
 
+//////////
+//  LockUpgradeError
+QString LockUpgradeError::errorMessage() const
+{
+    static Component::Resources *const resources = Component::Resources::instance();   //  idempotent
+    return resources->string(RSID(Errors), RID(LockUpgradeError));
+}
+
 //  End of tt3-util/Exceptions.cpp
@@ -308,6 +308,38 @@ namespace tt3::util
         virtual QString errorMessage(
                             ) const override;
     };
+
+    /// \class LockUpgradeError tt3-util/API.hpp
+    /// \brief Thrown when a thread holding a read lock tries to
+    ///     upgrade it to a write lock while another thread is
+    ///     already doing the same, which would deadlock them both.
+    class TT3_UTIL_PUBLIC LockUpgradeError
+        :   public ProgramError
+    {
+        using Self = LockUpgradeError;
+
+        //////////
+        //  Construction/destruction/assignment
+    public:
+        /// \brief
+        ///     Constructs the error.
+        LockUpgradeError() = default;
+        //  The default copy constructor, assignment operator
+        //  and destructor are all OK.
+
+        //////////
+        //  QException
+    public:
+        Q_NORETURN
+        void            raise() const override { throw *this; }
+        Self *          clone() const override { return new Self(*this); }
+
+        //////////
+        //  Error
+    public:
+        virtual QString errorMessage(
+                            ) const override;
+    };
 }
 
 //////////
@@ -26,6 +26,7 @@ FileResourceFactory::FileResourceFactory(const QString & baseFileName)
 
 FileResourceFactory::~FileResourceFactory()
 {
+    qDeleteAll(_catalogs);
 }
 
 //////////
@@ -43,24 +44,38 @@ QLocale FileResourceFactory::baseLocale() const
 
 Locales FileResourceFactory::supportedLocales() const
 {
-    const_cast<FileResourceFactory*>(this)->_loadResources();
+    Lock _(_guard);
+
+    const_cast<FileResourceFactory*>(this)->_findResourceFiles();
     return _supportedLocales;
 }
 
 QString FileResourceFactory::string(const ResourceSectionId & sectionId, const ResourceId & resourceId) const
 {
-    const_cast<FileResourceFactory*>(this)->_loadResources();
+    Lock _(_guard);
+
+    auto self = const_cast<FileResourceFactory*>(this);
     //  Do we have a mapping for the current default locale ?
-    QString key = _key(sectionId, resourceId);
-    if (_stringResources.contains(key))
+    QLocale locale;
+    if (!_currentCatalogKnown || locale != _currentLocale)
+    {   //  First lookup, or the default locale has changed since
+        self->_currentCatalog = self->_catalog(locale);  //  may throw
+        self->_currentLocale = locale;
+        self->_currentCatalogKnown = true;
+    }
+    if (const QString * s = _find(_currentCatalog, sectionId, resourceId))
     {   //  Use this one
-        return _stringResources[key];
+        return *s;
     }
     //  Do we have a mapping for the base locale ?
-    key = _key(baseLocale(), sectionId, resourceId);
-    if (_stringResources.contains(key))
+    if (_baseCatalog == nullptr)
+    {
+        self->_baseCatalog = self->_catalog(baseLocale());  //  may throw
+        Q_ASSERT(_baseCatalog != nullptr);
+    }
+    if (const QString * s = _find(_baseCatalog, sectionId, resourceId))
     {   //  Use this one
-        return _stringResources[key];
+        return *s;
     }
     //  OOPS!
     throw MissingResourceException(_baseFileName, sectionId, resourceId);
@@ -68,46 +83,95 @@ QString FileResourceFactory::string(const ResourceSectionId & sectionId, const R
 
 //////////
 //  Implementation helpers
-void FileResourceFactory::_loadResources()
+void FileResourceFactory::_findResourceFiles()
 {
-    //  Only load ONCE
-    if (_loaded)
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+
+    //  Only look ONCE
+    if (_resourceFilesFound)
     {
         return;
     }
-    _loaded = true;
+    _resourceFilesFound = true;
     _supportedLocales.insert(baseLocale());
-    //  Break base file name into prefix/suffix at
-    //  the last extension separator
-    qsizetype n = _baseFileName.lastIndexOf('.');
-    Q_ASSERT(n >= 0 && n < _baseFileName.length());
-    QString prefix = _baseFileName.left(n);
-    QString suffix = _baseFileName.mid(n);
-    //  Locate & load per-locale resource files
-    QList<QLocale> locales =
-        QLocale::matchingLocales(
-            QLocale::AnyLanguage,
-            QLocale::AnyScript,
-            QLocale::AnyCountry);
-    for (const QLocale & locale : std::as_const(locales))
-    {   //  There are locales (e.g. "en-Shaw") wjose "name()"
-        //  is the same as that of the proper "en_GB" locale.
-        //  We don't want these duplicates!
-        _loadResourceFile(QLocale(locale.name()), prefix + "_" + locale.name() + suffix);
+    //  Per-locale resource files are "<prefix>_<locale>.<suffix>"
+    //  next to the base file - just list them, instead of trying
+    //  all known locales one by one
+    QFileInfo baseFileInfo(_baseFileName);
+    QString prefix = baseFileInfo.completeBaseName() + "_";
+    QString suffix = "." + baseFileInfo.suffix();
+    QDir directory = baseFileInfo.dir();
+    const QStringList fileNames =
+        directory.entryList(
+            QStringList(prefix + "*" + suffix),
+            QDir::Files);
+    for (const QString & fileName : fileNames)
+    {
+        QString localeName =
+            fileName.mid(prefix.length(),
+                         fileName.length() - prefix.length() - suffix.length());
+        QLocale locale(localeName);
+        if (locale.name() != localeName)
+        {   //  Not a locale name, or an alias (e.g. "en-Shaw"
+            //  for "en_GB") - we don't want these duplicates!
+            continue;
+        }
+        _supportedLocales.insert(locale);
+        _resourceFileNames[locale] = directory.filePath(fileName);
     }
-    //  If _supportedLocales does not include baseLocale()
-    //  we have an error, so assert
-    Q_ASSERT(_supportedLocales.contains(baseLocale()));
+    //  If there is no file for baseLocale() we have
+    //  an error, so assert
+    Q_ASSERT(_resourceFileNames.contains(baseLocale()));
 }
 
-void FileResourceFactory::_loadResourceFile(const QLocale & locale, const QString & fileName)
+FileResourceFactory::_Catalog * FileResourceFactory::_catalog(const QLocale & locale)
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+
+    if (_catalogs.contains(locale))
+    {   //  Already loaded
+        return _catalogs[locale];
+    }
+    _findResourceFiles();
+    if (!_resourceFileNames.contains(locale))
+    {   //  Not supported
+        return nullptr;
+    }
+    //  Register the catalog BEFORE loading it, so that
+    //  re-entrant lookups (e.g. when reporting a parse
+    //  error) see what has been loaded so far
+    _Catalog * catalog = new _Catalog();
+    _catalogs[locale] = catalog;
+    try
+    {
+        _loadResourceFile(*catalog, _resourceFileNames[locale]);    //  may throw
+    }
+    catch (...)
+    {   //  OOPS! Forget the half-loaded catalog (re-entrant
+        //  lookups may have cached it, too) & re-throw
+        _catalogs.remove(locale);
+        if (_currentCatalog == catalog)
+        {
+            _currentCatalog = nullptr;
+            _currentCatalogKnown = false;
+        }
+        if (_baseCatalog == catalog)
+        {
+            _baseCatalog = nullptr;
+        }
+        delete catalog;
+        throw;
+    }
+    return catalog;
+}
+
+void FileResourceFactory::_loadResourceFile(_Catalog & catalog, const QString & fileName)
 {
     QFile file(fileName);
     if (file.open(QIODevice::ReadOnly | QIODevice::Text))
     {
-        _supportedLocales.insert(locale);
         QTextStream stream(&file);
-        QString sectionName = "";
+        ResourceSectionId sectionId;
         while (!stream.atEnd())
         {
             QString line = stream.readLine().trimmed();
@@ -121,7 +185,7 @@ void FileResourceFactory::_loadResourceFile(const QLocale & locale, const QStrin
             //  New section ?
             if (line.startsWith("[") && line.endsWith("]"))
             {
-                sectionName = line.mid(1, line.length() - 2).trimmed();
+                sectionId = ResourceSectionId(line.mid(1, line.length() - 2).trimmed());
                 continue;
             }
             //  <name>=<value>
@@ -134,8 +198,7 @@ void FileResourceFactory::_loadResourceFile(const QLocale & locale, const QStrin
             {
                 QString resourceName = line.left(eqIndex).trimmed();
                 QString resourceValue = _unescape(line.mid(eqIndex + 1).trimmed());
-                QString key = _key(locale, ResourceSectionId(sectionName), ResourceId(resourceName));
-                _stringResources[key] = resourceValue;
+                catalog[sectionId][ResourceId(resourceName)] = resourceValue;
             }
             catch (const tt3::util::ParseException & ex)
             {   //  OOPS! _unescape() failed!
@@ -146,18 +209,25 @@ void FileResourceFactory::_loadResourceFile(const QLocale & locale, const QStrin
     }
 }
 
-QString FileResourceFactory::_key(const QLocale & locale, const ResourceSectionId & sectionId, const ResourceId & resourceId)
-{
-    return locale.name() +
-           "[" +
-           sectionId.toString() +
-           "]" +
-           resourceId.toString();
-}
-
-QString FileResourceFactory::_key(const ResourceSectionId & sectionId, const ResourceId & resourceId)
+auto FileResourceFactory::_find(
+        const _Catalog * catalog,
+        const ResourceSectionId & sectionId,
+        const ResourceId & resourceId
+    ) -> const QString *
 {
-    return _key(QLocale(), sectionId, resourceId);
+    if (catalog != nullptr)
+    {
+        auto sectionIt = catalog->constFind(sectionId);
+        if (sectionIt != catalog->cend())
+        {
+            auto resourceIt = sectionIt->constFind(resourceId);
+            if (resourceIt != sectionIt->cend())
+            {
+                return &resourceIt.value();
+            }
+        }
+    }
+    return nullptr;
 }
 
 int FileResourceFactory::_xdigit(const QChar & c)
@@ -49,6 +49,39 @@ namespace
             return -1;
         }
     }
+
+    //  Parses exactly "digits" decimal digits starting
+    //  at "s[from]"; -1 if any of them is not a digit
+    int parseFixedDigits(QStringView s, qsizetype from, int digits)
+    {
+        int result = 0;
+        for (qsizetype i = from; i < from + digits; i++)
+        {
+            unsigned digit = unsigned(s[i].unicode()) - '0';
+            if (digit > 9)
+            {
+                return -1;
+            }
+            result = result * 10 + int(digit);
+        }
+        return result;
+    }
+
+    //  Checks if "s" has the specified lower-case ASCII
+    //  "word" at "from"; ASCII letters are compared
+    //  case-insensitively
+    bool hasWordAt(QStringView s, qsizetype from, const char * word)
+    {
+        for (qsizetype i = 0; word[i] != 0; i++, from++)
+        {
+            if (from >= s.size() ||
+                (s[from].unicode() | 0x20) != word[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 }
 
 //  C++ types
@@ -59,74 +92,51 @@ bool tt3::util::fromString<bool>(const QString & s, qsizetype & scan)
     {
         throw ParseException(s, scan);
     }
+    QStringView v(s);
     //  true/false
-    if (scan + 4 <= s.length() &&
-        s[scan + 0].toLower() == 't' &&
-        s[scan + 1].toLower() == 'r' &&
-        s[scan + 2].toLower() == 'u' &&
-        s[scan + 3].toLower() == 'e')
+    if (hasWordAt(v, scan, "true"))
     {
         scan += 4;
         return true;
     }
-    if (scan + 5 <= s.length() &&
-        s[scan + 0].toLower() == 'f' &&
-        s[scan + 1].toLower() == 'a' &&
-        s[scan + 2].toLower() == 'l' &&
-        s[scan + 3].toLower() == 's' &&
-        s[scan + 4].toLower() == 'e')
+    if (hasWordAt(v, scan, "false"))
     {
         scan += 5;
         return false;
     }
     //  yes/no
-    if (scan + 3 <= s.length() &&
-        s[scan + 0].toLower() == 'y' &&
-        s[scan + 1].toLower() == 'e' &&
-        s[scan + 2].toLower() == 's')
+    if (hasWordAt(v, scan, "yes"))
     {
         scan += 3;
         return true;
     }
-    if (scan + 2 <= s.length() &&
-        s[scan + 0].toLower() == 'n' &&
-        s[scan + 1].toLower() == 'o')
+    if (hasWordAt(v, scan, "no"))
     {
         scan += 2;
         return false;
     }
-    //  t/f
-    if (scan < s.length() && s[scan].toLower() == 't')
-    {
-        scan++;
-        return true;
-    }
-    if (scan < s.length() && s[scan].toLower() == 'f')
-    {
-        scan++;
-        return false;
-    }
-    //  y/n
-    if (scan < s.length() && s[scan].toLower() == 'y')
-    {
-        scan++;
-        return true;
-    }
-    if (scan < s.length() && s[scan].toLower() == 'n')
-    {
-        scan++;
-        return false;
-    }
-    //  1/0
-    if (scan < s.length() && s[scan].toLower() == '1')
-    {
-        scan++;
-        return true;
-    }
-    if (scan < s.length() && s[scan].toLower() == '0')
+    //  t/f, y/n, 1/0
+    if (scan < v.size())
     {
-        scan++;
-        return false;
+        switch (v[scan].unicode())
+        {
+            case 't':
+            case 'T':
+            case 'y':
+            case 'Y':
+            case '1':
+                scan++;
+                return true;
+            case 'f':
+            case 'F':
+            case 'n':
+            case 'N':
+            case '0':
+                scan++;
+                return false;
+            default:
+                break;
+        }
     }
     //  Give up
     throw ParseException(s, scan);
@@ -285,20 +295,25 @@ unsigned long long tt3::util::fromString<unsigned long long>(const QString & s,
     {
         throw ParseException(s, scan);
     }
+    constexpr unsigned long long maxTemp = std::numeric_limits<unsigned long long>::max();
+    const QChar * data = s.constData();
+    qsizetype length = s.length();
     unsigned long long temp = 0;
     qsizetype numDigits = 0;
     qsizetype prescan = scan;
-    while (prescan < s.length() && s[prescan] >= '0' && s[prescan] <= '9')
+    for (; prescan < length; prescan++, numDigits++)
     {
-        int digit = s[prescan].unicode() - '0';
-        unsigned long long newTemp = temp * 10 + digit;
-        if (newTemp / 10 != temp)
+        unsigned digit = unsigned(data[prescan].unicode()) - '0';
+        if (digit > 9)
+        {
+            break;
+        }
+        if (temp > maxTemp / 10 ||
+            (temp == maxTemp / 10 && digit > maxTemp % 10))
         {   //  OOPS! Overflow!
             throw ParseException(s, scan);
         }
-        temp = newTemp;
-        prescan++;
-        numDigits++;
+        temp = temp * 10 + digit;
     }
     if (numDigits == 0)
     {
@@ -612,81 +627,78 @@ QColor tt3::util::fromString<QColor>(const QString & s, qsizetype & scan)
 template <> TT3_UTIL_PUBLIC
 QDateTime tt3::util::fromString<QDateTime>(const QString & s, qsizetype & scan)
 {
-    static QRegularExpression regex("([0-9]{4})([0-9]{2})([0-9]{2})T([0-9]{2})([0-9]{2})([0-9]{2})\\.([0-9]{3})");
-
     if (scan < 0 || scan >= s.length())
     {
         throw ParseException(s, scan);
     }
     //  Special cases
-    if (scan < s.length() && s[scan] == '-')
+    if (s[scan] == '-')
     {   //  Invalid QDateTime!
         scan++;
         return QDateTime();
     }
-    //  General case
+    //  General case - fixed format YYYYMMDDThhmmss.sss
     if (scan + 19 > s.length())
     {
         throw ParseException(s, scan);
     }
-    QRegularExpressionMatch regexMatch = regex.match(s.mid(scan));
-    if (regexMatch.hasMatch())
-    {
-        int year = fromString<int>(regexMatch.captured(1), 0);
-        int month = fromString<int>(regexMatch.captured(2), 0);
-        int day = fromString<int>(regexMatch.captured(3), 0);
-        int hour = fromString<int>(regexMatch.captured(4), 0);
-        int minute = fromString<int>(regexMatch.captured(5), 0);
-        int second = fromString<int>(regexMatch.captured(6), 0);
-        int msec = fromString<int>(regexMatch.captured(7), 0);
-        QDateTime result(QDate(year, month, day),
-                         QTime(hour, minute, second, msec),
-                         QTimeZone::UTC);
-        if (!result.isValid())
-        {
-            throw ParseException(s, scan);
-        }
-        scan += 19;
-        return result;
+    QStringView v = QStringView(s).mid(scan, 19);
+    int year = parseFixedDigits(v, 0, 4);
+    int month = parseFixedDigits(v, 4, 2);
+    int day = parseFixedDigits(v, 6, 2);
+    int hour = parseFixedDigits(v, 9, 2);
+    int minute = parseFixedDigits(v, 11, 2);
+    int second = parseFixedDigits(v, 13, 2);
+    int msec = parseFixedDigits(v, 16, 3);
+    if ((year | month | day | hour | minute | second | msec) < 0 ||
+        v[8] != 'T' || v[15] != '.')
+    {
+        throw ParseException(s, scan);
     }
-    throw ParseException(s, scan);
+    QDateTime result(QDate(year, month, day),
+                     QTime(hour, minute, second, msec),
+                     QTimeZone::UTC);
+    if (!result.isValid())
+    {
+        throw ParseException(s, scan);
+    }
+    scan += 19;
+    return result;
 }
 
 template <> TT3_UTIL_PUBLIC
 QDate tt3::util::fromString<QDate>(const QString & s, qsizetype & scan)
 {
-    static QRegularExpression regex("([0-9]{4})([0-9]{2})([0-9]{2})");
-
     if (scan < 0 || scan >= s.length())
     {
         throw ParseException(s, scan);
     }
     //  Special cases
-    if (scan < s.length() && s[scan] == '-')
+    if (s[scan] == '-')
     {   //  Invalid QDate!
         scan++;
         return QDate();
     }
-    //  General case
+    //  General case - fixed format YYYYMMDD
     if (scan + 8 > s.length())
     {
         throw ParseException(s, scan);
     }
-    QRegularExpressionMatch regexMatch = regex.match(s.mid(scan));
-    if (regexMatch.hasMatch())
+    QStringView v = QStringView(s).mid(scan, 8);
+    int year = parseFixedDigits(v, 0, 4);
+    int month = parseFixedDigits(v, 4, 2);
+    int day = parseFixedDigits(v, 6, 2);
+    if ((year | month | day) < 0)
     {
-        int year = fromString<int>(regexMatch.captured(1), 0);
-        int month = fromString<int>(regexMatch.captured(2), 0);
-        int day = fromString<int>(regexMatch.captured(3), 0);
-        QDate result(year, month, day);
-        if (!result.isValid())
-        {
-            throw ParseException(s, scan);
-        }
-        scan += 8;
-        return result;
+        throw ParseException(s, scan);
     }
-    throw ParseException(s, scan);
+    QDate result(year, month, day);
+    if (!result.isValid())
+    {
+        throw ParseException(s, scan);
+    }
+    scan += 8;
+    return result;
 }
 
 template <> TT3_UTIL_PUBLIC
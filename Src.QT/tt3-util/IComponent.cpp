@@ -36,4 +36,9 @@ ILicense * IComponent::license() const
     return StandardLicenses::Gpl3::instance();
 }
 
+IComponent::Mnemonics IComponent::dependencies() const
+{
+    return Mnemonics();
+}
+
 //  End of tt3-util/IComponent.cpp
@@ -25,6 +25,29 @@ void IMessageDigest::Builder::digestFragment(const QString & s)
     digestFragment(bytes.data(), bytes.size());
 }
 
+bool IMessageDigest::Builder::digestFragment(QIODevice & device)
+{
+    Q_ASSERT(device.isReadable());
+
+    //  Large enough to make the per-read overheads negligible,
+    //  small enough to stay in the CPU cache
+    static constexpr qint64 ChunkSize = 64 * 1024;
+    QByteArray chunk(ChunkSize, Qt::Uninitialized);
+    for (; ; )
+    {
+        qint64 numBytesRead = device.read(chunk.data(), ChunkSize);
+        if (numBytesRead < 0)
+        {   //  OOPS! Read error
+            return false;
+        }
+        if (numBytesRead == 0)
+        {   //  All done
+            return true;
+        }
+        digestFragment(chunk.constData(), static_cast<size_t>(numBytesRead));
+    }
+}
+
 QString IMessageDigest::Builder::digestAsString()
 {
     return this->digestAsBytes().toHex().toUpper();
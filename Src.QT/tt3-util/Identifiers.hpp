@@ -329,8 +329,9 @@ namespace tt3::util
 
 //  Helper macros for creation of identifiers
 #define M(value)    tt3::util::Mnemonic(#value)
-#define RSID(value) tt3::util::ResourceSectionId(#value)
-#define RID(value)  tt3::util::ResourceId(#value)
+//  (resource IDs are looked up very often, so avoid allocating them)
+#define RSID(value) tt3::util::ResourceSectionId(QStringLiteral(#value))
+#define RID(value)  tt3::util::ResourceId(QStringLiteral(#value))
 
 //////////
 //  Helper algorithms
@@ -80,6 +80,21 @@ namespace tt3::util
             ///     The string to digest.
             virtual void        digestFragment(const QString & s);
 
+            /// \brief
+            ///     Modifies the state of this builder by processing
+            ///     all bytes that can be read from the specified device.
+            /// \details
+            ///     The device must be open for reading; the data is
+            ///     read in large chunks until the end of the device
+            ///     is reached, so files of any size can be digested
+            ///     without being loaded into memory.
+            /// \param device
+            ///     The device to read the bytes to digest from.
+            /// \return
+            ///     True on success, false if reading from the device
+            ///     has failed (the bytes read so far are digested anyway).
+            virtual bool        digestFragment(QIODevice & device);
+
             /// \brief
             ///     Finalises the state of this builder and calculates
             ///     the "final" message digest.
@@ -152,6 +167,25 @@ namespace tt3::util
         ///     The set of all standard message digests.
         static MessageDigests   all();
 
+        /// \brief
+        ///     Checks whether the SHA message digests use the
+        ///     CPU's SHA extensions, which must be both present
+        ///     and enabled for that.
+        /// \return
+        ///     True if the SHA extensions are used, else false.
+        static bool     isUsingShaInstructions();
+
+        /// \brief
+        ///     Enables or disables the use of the CPU's SHA
+        ///     extensions by the SHA message digests (they are
+        ///     enabled by default). The digests are the same
+        ///     either way, so this is only needed to test or
+        ///     benchmark the portable code on CPUs that have them.
+        /// \param enabled
+        ///     True to use the SHA extensions if the CPU has
+        ///     them, false to never use them.
+        static void     setShaInstructionsEnabled(bool enabled);
+
         //////////
         //  Members
     public:
@@ -199,21 +233,85 @@ namespace tt3::util
             private:
                 bool                _finalised = false;
 
-                uint32_t            _H[5];          //  Message digest buffers
-                uint32_t            _lengthLo = 0;  //  Message length in bits
-                uint32_t            _lengthHi = 0;  //  Message length in bits
+                uint32_t            _H[5];              //  Message digest buffers
+                uint64_t            _messageLength = 0; //  Message length in bytes
+
+                uint8_t             _messageBlock[64];      //  512-bit message blocks
+                size_t              _messageBlockIndex = 0; //  Index into message block array
+
+                QByteArray          _result;    //  empty unless finalized
+
+                //  Helpers
+                void                _processMessageBlocks(const uint8_t * blocks, size_t numBlocks);
+                void                _padMessage();
+            };
+        };
+
+        /// \class Sha256 tt3-util/API.hpp
+        /// \brief SHA-256 message digest.
+        class TT3_UTIL_PUBLIC Sha256 final
+            :   public virtual IMessageDigest
+        {
+            TT3_DECLARE_SINGLETON(Sha256)
+
+            //////////
+            //  IMessageDigest
+        public:
+            virtual Mnemonic        mnemonic() const override;
+            virtual QString         displayName() const override;
+            virtual Builder *       createBuilder() override;
+
+            //////////
+            //  Implementation
+        private:
+            class TT3_UTIL_PUBLIC _Builder final
+                :   public Builder
+            {
+                TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(_Builder)
+
+                //////////
+                //  Construction/destruction
+            public:
+                _Builder();
+                virtual ~_Builder();
+
+                //////////
+                //  Builder
+            public:
+                using Builder::digestFragment;
+
+                virtual IMessageDigest *messageDigest() const override;
+                virtual void        reset() override;
+                virtual void        digestFragment(const void * data, size_t numBytes) override;
+                virtual void        finalise() override;
+                virtual QByteArray  digestAsBytes() override;
+
+                //////////
+                //  Implementation
+            private:
+                bool                _finalised = false;
+
+                uint32_t            _H[8];              //  Message digest buffers
+                uint64_t            _messageLength = 0; //  Message length in bytes
 
                 uint8_t             _messageBlock[64];      //  512-bit message blocks
-                int                 _messageBlockIndex = 0; //  Index into message block array
+                size_t              _messageBlockIndex = 0; //  Index into message block array
 
                 QByteArray          _result;    //  empty unless finalized
 
                 //  Helpers
-                void                _processMessageBlock();
+                void                _processMessageBlocks(const uint8_t * blocks, size_t numBlocks);
                 void                _padMessage();
-                inline uint32_t     _circularShift(int bits, uint32_t word) { return (word << bits) | (word >> (32 - bits)); }
             };
         };
+
+        //////////
+        //  Implementation
+    private:
+        static std::atomic<bool>    _shaInstructionsEnabled;
+
+        //  Helpers
+        static bool     _hasShaInstructions();  //  true if the CPU has SHA extensions
     };
 
     /// \class MessageDigestManager tt3-util/API.hpp
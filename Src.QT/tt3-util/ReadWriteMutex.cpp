@@ -0,0 +1,227 @@
+//
+//  tt3-util/ReadWriteMutex.cpp - the tt3::util::ReadWriteMutex class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-util/API.hpp"
+using namespace tt3::util;
+
+//////////
+//  Operations
+void ReadWriteMutex::lockForReading()
+{
+    QThread * currentThread = QThread::currentThread();
+
+    QMutexLocker lock(&_stateGuard);
+    if (_writingThread == currentThread)
+    {   //  Reading under our own write lock is a nested write
+        _writeCount++;
+        return;
+    }
+    while (!_canLockForReading(currentThread))
+    {
+        _stateChanged.wait(&_stateGuard);
+    }
+    _readCounts[currentThread]++;
+}
+
+bool ReadWriteMutex::tryLockForReading(int timeoutMs)
+{
+    QThread * currentThread = QThread::currentThread();
+    QDeadlineTimer deadline(timeoutMs);
+
+    QMutexLocker lock(&_stateGuard);
+    if (_writingThread == currentThread)
+    {   //  Reading under our own write lock is a nested write
+        _writeCount++;
+        return true;
+    }
+    while (!_canLockForReading(currentThread))
+    {
+        if (!_stateChanged.wait(&_stateGuard, deadline))
+        {   //  Timed out - but state may have changed just now
+            if (!_canLockForReading(currentThread))
+            {
+                return false;
+            }
+            break;
+        }
+    }
+    _readCounts[currentThread]++;
+    return true;
+}
+
+void ReadWriteMutex::lockForWriting()
+{
+    QThread * currentThread = QThread::currentThread();
+
+    QMutexLocker lock(&_stateGuard);
+    if (_writingThread == currentThread)
+    {   //  Nested write
+        _writeCount++;
+        return;
+    }
+    bool upgrading = _readCounts.contains(currentThread);
+    if (upgrading)
+    {   //  Only one reader at a time can upgrade to a writer
+        if (_upgradingThread != nullptr)
+        {   //  OOPS! Each would wait for the other to stop reading
+            throw LockUpgradeError();
+        }
+        _upgradingThread = currentThread;
+    }
+    _waitingWriters++;
+    while (!_canLockForWriting(currentThread))
+    {
+        _stateChanged.wait(&_stateGuard);
+    }
+    _waitingWriters--;
+    if (upgrading)
+    {
+        _upgradingThread = nullptr;
+    }
+    _writingThread = currentThread;
+    _writeCount = 1;
+}
+
+bool ReadWriteMutex::tryLockForWriting(int timeoutMs)
+{
+    QThread * currentThread = QThread::currentThread();
+    QDeadlineTimer deadline(timeoutMs);
+
+    QMutexLocker lock(&_stateGuard);
+    if (_writingThread == currentThread)
+    {   //  Nested write
+        _writeCount++;
+        return true;
+    }
+    bool upgrading = _readCounts.contains(currentThread);
+    if (upgrading)
+    {   //  Only one reader at a time can upgrade to a writer
+        if (_upgradingThread != nullptr)
+        {   //  OOPS! Each would wait for the other to stop reading
+            return false;
+        }
+        _upgradingThread = currentThread;
+    }
+    _waitingWriters++;
+    while (!_canLockForWriting(currentThread))
+    {
+        if (!_stateChanged.wait(&_stateGuard, deadline) &&
+            !_canLockForWriting(currentThread))
+        {   //  Timed out - readers held back on our
+            //  account can now proceed
+            _waitingWriters--;
+            if (upgrading)
+            {
+                _upgradingThread = nullptr;
+            }
+            _stateChanged.wakeAll();
+            return false;
+        }
+    }
+    _waitingWriters--;
+    if (upgrading)
+    {
+        _upgradingThread = nullptr;
+    }
+    _writingThread = currentThread;
+    _writeCount = 1;
+    return true;
+}
+
+void ReadWriteMutex::unlock()
+{
+    QThread * currentThread = QThread::currentThread();
+
+    QMutexLocker lock(&_stateGuard);
+    //  Locks are undone in reverse order, and anything
+    //  locked while writing counts as a nested write
+    if (_writingThread == currentThread)
+    {
+        Q_ASSERT(_writeCount > 0);
+        if (--_writeCount == 0)
+        {
+            _writingThread = nullptr;
+            _stateChanged.wakeAll();
+        }
+    }
+    else if (auto it = _readCounts.find(currentThread);
+             it != _readCounts.end())
+    {
+        Q_ASSERT(it.value() > 0);
+        if (--it.value() == 0)
+        {
+            _readCounts.erase(it);
+            if (_readCounts.size() <= 1)
+            {   //  Someone may be waiting for the last reader(s) to leave
+                _stateChanged.wakeAll();
+            }
+        }
+    }
+    else
+    {   //  ...else the current thread has no business 'unlock'ing this mutex
+        Q_ASSERT(false);
+    }
+}
+
+bool ReadWriteMutex::isLockedBy(QThread * thread)
+{
+    Q_ASSERT(thread != nullptr);
+    QMutexLocker lock(&_stateGuard);
+    return _writingThread == thread || _readCounts.contains(thread);
+}
+
+bool ReadWriteMutex::isLockedByCurrentThread()
+{
+    QThread * currentThread = QThread::currentThread();
+    QMutexLocker lock(&_stateGuard);
+    return _writingThread == currentThread || _readCounts.contains(currentThread);
+}
+
+bool ReadWriteMutex::isLockedForWritingByCurrentThread()
+{
+    QMutexLocker lock(&_stateGuard);
+    return _writingThread == QThread::currentThread();
+}
+
+//////////
+//  Implementation helpers
+bool ReadWriteMutex::_canLockForReading(QThread * thread) const
+{
+    if (_writingThread != nullptr)
+    {   //  Someone else is writing
+        return false;
+    }
+    if (_readCounts.contains(thread))
+    {   //  Nested read - must not wait for waiting
+        //  writers, which are waiting for us
+        return true;
+    }
+    return _waitingWriters == 0;
+}
+
+bool ReadWriteMutex::_canLockForWriting(QThread * thread) const
+{
+    if (_writingThread != nullptr)
+    {   //  Someone else is writing
+        return false;
+    }
+    //  A reader "upgrading" to a writer (there can be
+    //  only one) waits until it is the only reader left
+    return _readCounts.isEmpty() ||
+           (_readCounts.size() == 1 && _readCounts.contains(thread));
+}
+
+//  End of tt3-util/ReadWriteMutex.cpp
@@ -485,7 +485,8 @@ namespace tt3::util
     /// \details
     ///     Which files are found becomes the "set of supported
     ///     locales" for the FileResourceFactory; the default
-    ///     base locale is "en_GB".
+    ///     base locale is "en_GB". A per-locale file is only
+    ///     parsed when a resource for that locale is first needed.
     class TT3_UTIL_PUBLIC FileResourceFactory
         :   public virtual IResourceFactory
     {
@@ -522,16 +523,27 @@ namespace tt3::util
         //////////
         //  Implementation
     private:
+        //  The resources of one locale, indexed by section and resource ID
+        using _Catalog = QHash<ResourceSectionId, QHash<ResourceId, QString>>;
+
         const QString   _baseFileName;
-        bool            _loaded = false;
+        mutable Mutex   _guard;     //  for all access synchronization
+        bool            _resourceFilesFound = false;
         Locales         _supportedLocales;
-        QMap<QString, QString>  _stringResources;   //  key == <ll>_<CC>[<section>]<resource>
+        QHash<QLocale, QString>     _resourceFileNames; //  per supported locale
+        QHash<QLocale, _Catalog*>   _catalogs;          //  loaded on first use
+        //  Cached for the (frequent) lookups - the current default
+        //  locale changes rarely, if ever
+        bool            _currentCatalogKnown = false;
+        QLocale         _currentLocale;
+        _Catalog *      _currentCatalog = nullptr;  //  nullptr == locale not supported
+        _Catalog *      _baseCatalog = nullptr;     //  nullptr == not loaded yet
 
         //  Helpers
-        void            _loadResources();
-        void            _loadResourceFile(const QLocale & locale, const QString & fileName);
-        static QString  _key(const QLocale & locale, const ResourceSectionId & sectionId, const ResourceId & resourceId);
-        static QString  _key(const ResourceSectionId & sectionId, const ResourceId & resourceId);
+        void            _findResourceFiles();
+        _Catalog *      _catalog(const QLocale & locale);   //  nullptr == locale not supported
+        void            _loadResourceFile(_Catalog & catalog, const QString & fileName);
+        static auto     _find(const _Catalog * catalog, const ResourceSectionId & sectionId, const ResourceId & resourceId) -> const QString *;
         static int      _xdigit(const QChar & c);
         static QString  _unescape(const QString & s);   //  throws ParseException on error
     };
@@ -16,6 +16,168 @@
 //////////
 #include "tt3-util/API.hpp"
 using namespace tt3::util;
+#if defined(Q_PROCESSOR_X86) && (defined(__GNUC__) || defined(_MSC_VER))
+    #include <immintrin.h>
+    #define TT3_SHA_NI_SUPPORTED
+    #if defined(__GNUC__)
+        #define TT3_SHA_NI_TARGET __attribute__((target("sha,sse4.1")))
+    #else
+        #define TT3_SHA_NI_TARGET
+    #endif
+#endif
+
+namespace
+{
+    const uint32_t K[] =
+        {   // Constants defined for SHA-1
+            0x5A827999,
+            0x6ED9EBA1,
+            0x8F1BBCDC,
+            0xCA62C1D6
+        };
+
+    inline uint32_t circularShift(int bits, uint32_t word)
+    {
+        return (word << bits) | (word >> (32 - bits));
+    }
+
+    void processMessageBlocks(uint32_t H[5], const uint8_t * blocks, size_t numBlocks)
+    {
+        uint32_t    temp;             //  Temporary word value
+        uint32_t    W[80];            //  Word sequence
+        uint32_t    A, B, C, D, E;    //  Word buffers
+
+        for (; numBlocks != 0; numBlocks--, blocks += 64)
+        {
+            //  Initialize the first 16 words in the array W
+            for (int t = 0; t < 16; t++)
+            {
+                W[t]  = static_cast<uint32_t>(blocks[t * 4]) << 24;
+                W[t] |= static_cast<uint32_t>(blocks[t * 4 + 1]) << 16;
+                W[t] |= static_cast<uint32_t>(blocks[t * 4 + 2]) << 8;
+                W[t] |= static_cast<uint32_t>(blocks[t * 4 + 3]);
+            }
+
+            for (int t = 16; t < 80; t++)
+            {
+               W[t] = circularShift(1, W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16]);
+            }
+
+            A = H[0];
+            B = H[1];
+            C = H[2];
+            D = H[3];
+            E = H[4];
+
+            for (int t = 0; t < 20; t++)
+            {
+                temp = circularShift(5, A) + ((B & C) | ((~B) & D)) + E + W[t] + K[0];
+                E = D;
+                D = C;
+                C = circularShift(30, B);
+                B = A;
+                A = temp;
+            }
+
+            for (int t = 20; t < 40; t++)
+            {
+                temp = circularShift(5, A) + (B ^ C ^ D) + E + W[t] + K[1];
+                E = D;
+                D = C;
+                C = circularShift(30, B);
+                B = A;
+                A = temp;
+            }
+
+            for (int t = 40; t < 60; t++)
+            {
+                temp = circularShift(5, A) +
+                       ((B & C) | (B & D) | (C & D)) + E + W[t] + K[2];
+                E = D;
+                D = C;
+                C = circularShift(30, B);
+                B = A;
+                A = temp;
+            }
+
+            for (int t = 60; t < 80; t++)
+            {
+                temp = circularShift(5, A) + (B ^ C ^ D) + E + W[t] + K[3];
+                E = D;
+                D = C;
+                C = circularShift(30, B);
+                B = A;
+                A = temp;
+            }
+
+            H[0] += A;
+            H[1] += B;
+            H[2] += C;
+            H[3] += D;
+            H[4] += E;
+        }
+    }
+
+#if defined(TT3_SHA_NI_SUPPORTED)
+    //  Each step performs 4 rounds, using the round function F
+    //  (which must be a compile-time constant for SHA1RNDS4)
+    template <int F>
+    TT3_SHA_NI_TARGET
+    inline void shaNiSteps(__m128i & abcd, __m128i & e, __m128i W[4], int firstStep)
+    {
+        for (int i = firstStep; i < firstStep + 5; i++)
+        {
+            __m128i & w = W[i % 4];
+            if (i >= 4)
+            {   //  W[i] depends on W[i-4] (which it replaces),
+                //  W[i-3], W[i-2] and W[i-1]
+                w = _mm_sha1msg2_epu32(
+                        _mm_xor_si128(
+                            _mm_sha1msg1_epu32(w, W[(i + 1) % 4]),
+                            W[(i + 2) % 4]),
+                        W[(i + 3) % 4]);
+            }
+            __m128i nextE = abcd;
+            abcd = _mm_sha1rnds4_epu32(abcd, (i == 0) ? _mm_add_epi32(e, w) : _mm_sha1nexte_epu32(e, w), F);
+            e = nextE;
+        }
+    }
+
+    TT3_SHA_NI_TARGET
+    void processMessageBlocksShaNi(uint32_t H[5], const uint8_t * blocks, size_t numBlocks)
+    {
+        const __m128i byteSwap = _mm_set_epi64x(0x0001020304050607LL, 0x08090A0B0C0D0E0FLL);
+
+        __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(H)), 0x1B);
+        __m128i e0 = _mm_set_epi32(static_cast<int>(H[4]), 0, 0, 0);
+
+        for (; numBlocks != 0; numBlocks--, blocks += 64)
+        {
+            const __m128i savedAbcd = abcd;
+            const __m128i savedE0 = e0;
+
+            __m128i W[4];
+            for (int i = 0; i < 4; i++)
+            {
+                W[i] = _mm_shuffle_epi8(
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks + i * 16)),
+                            byteSwap);
+            }
+            __m128i e = e0;
+            shaNiSteps<0>(abcd, e, W, 0);
+            shaNiSteps<1>(abcd, e, W, 5);
+            shaNiSteps<2>(abcd, e, W, 10);
+            shaNiSteps<3>(abcd, e, W, 15);
+
+            e0 = _mm_sha1nexte_epu32(e, savedE0);
+            abcd = _mm_add_epi32(abcd, savedAbcd);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(H), _mm_shuffle_epi32(abcd, 0x1B));
+        H[4] = static_cast<uint32_t>(_mm_extract_epi32(e0, 3));
+    }
+#endif
+}
 
 //////////
 //  Singleton
@@ -61,8 +223,7 @@ IMessageDigest * StandardMessageDigests::Sha1::_Builder::messageDigest() const
 
 void StandardMessageDigests::Sha1::_Builder::reset()
 {
-    _lengthLo = 0;
-    _lengthHi = 0;
+    _messageLength = 0;
     _messageBlockIndex = 0;
 
     _H[0] = 0x67452301;
@@ -83,29 +244,33 @@ void StandardMessageDigests::Sha1::_Builder::digestFragment(const void * data, s
     Q_ASSERT(data != nullptr);
     const uint8_t * bytes = static_cast<const uint8_t *>(data);
 
-    if (numBytes == 0)
-    {
-        return;
-    }
+    _messageLength += numBytes;
 
-    while (numBytes-- != 0)
+    //  Complete the partially filled message block first...
+    if (_messageBlockIndex != 0)
     {
-        _messageBlock[_messageBlockIndex++] = *bytes;
-
-        _lengthLo += 8;
-        _lengthLo &= 0xFFFFFFFF;               // Force it to 32 bits
-        if (_lengthLo == 0)
-        {
-            _lengthHi++;
+        size_t chunkSize = qMin(numBytes, sizeof(_messageBlock) - _messageBlockIndex);
+        memcpy(_messageBlock + _messageBlockIndex, bytes, chunkSize);
+        _messageBlockIndex += chunkSize;
+        bytes += chunkSize;
+        numBytes -= chunkSize;
+        if (_messageBlockIndex < sizeof(_messageBlock))
+        {   //  ...not enough data yet
+            return;
         }
-
-        if (_messageBlockIndex == 64)
-        {
-            _processMessageBlock();
-        }
-
-        bytes++;
+        _processMessageBlocks(_messageBlock, 1);
+        _messageBlockIndex = 0;
     }
+    //  ...then process whole blocks straight from the input...
+    if (size_t numBlocks = numBytes / 64; numBlocks != 0)
+    {
+        _processMessageBlocks(bytes, numBlocks);
+        bytes += numBlocks * 64;
+        numBytes -= numBlocks * 64;
+    }
+    //  ...and keep the tail for later
+    memcpy(_messageBlock, bytes, numBytes);
+    _messageBlockIndex = numBytes;
 }
 
 void StandardMessageDigests::Sha1::_Builder::finalise()
@@ -135,92 +300,19 @@ QByteArray StandardMessageDigests::Sha1::_Builder::digestAsBytes()
     return _result;
 }
 
-void StandardMessageDigests::Sha1::_Builder::_processMessageBlock()
+void StandardMessageDigests::Sha1::_Builder::_processMessageBlocks(
+        const uint8_t * blocks,
+        size_t numBlocks
+    )
 {
-    static const uint32_t K[] =
-        {   // Constants defined for SHA-1
-            0x5A827999,
-            0x6ED9EBA1,
-            0x8F1BBCDC,
-            0xCA62C1D6
-        };
-
-    uint32_t    temp;             //  Temporary word value
-    uint32_t    W[80];            //  Word sequence
-    uint32_t    A, B, C, D, E;    //  Word buffers
-
-    //  Initialize the first 16 words in the array W
-    for (int t = 0; t < 16; t++)
-    {
-        W[t]  = static_cast<uint32_t>(_messageBlock[t * 4 ]) << 24;
-        W[t] |= static_cast<uint32_t>(_messageBlock[t * 4 + 1]) << 16;
-        W[t] |= static_cast<uint32_t>(_messageBlock[t * 4 + 2]) << 8;
-        W[t] |= static_cast<uint32_t>(_messageBlock[t * 4 + 3]);
-    }
-
-    for (int t = 16; t < 80; t++)
-    {
-       W[t] = _circularShift(1,W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16]);
-    }
-
-    A = _H[0];
-    B = _H[1];
-    C = _H[2];
-    D = _H[3];
-    E = _H[4];
-
-    for (int t = 0; t < 20; t++)
+#if defined(TT3_SHA_NI_SUPPORTED)
+    if (isUsingShaInstructions())
     {
-        temp = _circularShift(5,A) + ((B & C) | ((~B) & D)) + E + W[t] + K[0];
-        temp &= 0xFFFFFFFF;
-        E = D;
-        D = C;
-        C = _circularShift(30,B);
-        B = A;
-        A = temp;
-    }
-
-    for (int t = 20; t < 40; t++)
-    {
-        temp = _circularShift(5,A) + (B ^ C ^ D) + E + W[t] + K[1];
-        temp &= 0xFFFFFFFF;
-        E = D;
-        D = C;
-        C = _circularShift(30,B);
-        B = A;
-        A = temp;
-    }
-
-    for (int t = 40; t < 60; t++)
-    {
-        temp = _circularShift(5,A) +
-               ((B & C) | (B & D) | (C & D)) + E + W[t] + K[2];
-        temp &= 0xFFFFFFFF;
-        E = D;
-        D = C;
-        C = _circularShift(30,B);
-        B = A;
-        A = temp;
-    }
-
-    for (int t = 60; t < 80; t++)
-    {
-        temp = _circularShift(5,A) + (B ^ C ^ D) + E + W[t] + K[3];
-        temp &= 0xFFFFFFFF;
-        E = D;
-        D = C;
-        C = _circularShift(30,B);
-        B = A;
-        A = temp;
+        processMessageBlocksShaNi(_H, blocks, numBlocks);
+        return;
     }
-
-    _H[0] = (_H[0] + A) & 0xFFFFFFFF;
-    _H[1] = (_H[1] + B) & 0xFFFFFFFF;
-    _H[2] = (_H[2] + C) & 0xFFFFFFFF;
-    _H[3] = (_H[3] + D) & 0xFFFFFFFF;
-    _H[4] = (_H[4] + E) & 0xFFFFFFFF;
-
-    _messageBlockIndex = 0;
+#endif
+    processMessageBlocks(_H, blocks, numBlocks);
 }
 
 void StandardMessageDigests::Sha1::_Builder::_padMessage()
@@ -228,41 +320,24 @@ void StandardMessageDigests::Sha1::_Builder::_padMessage()
     //  Check to see if the current message block is too small to hold
     //  the initial padding bits and length.  If so, we will pad the
     //  block, process it, and then continue padding into a second block.
-    if (_messageBlockIndex > 55)
+    _messageBlock[_messageBlockIndex++] = 0x80;
+    if (_messageBlockIndex > 56)
     {
-        _messageBlock[_messageBlockIndex++] = 0x80;
-        while (_messageBlockIndex < 64)
-        {
-            _messageBlock[_messageBlockIndex++] = 0;
-        }
-
-        _processMessageBlock();
-
-        while (_messageBlockIndex < 56)
-        {
-            _messageBlock[_messageBlockIndex++] = 0;
-        }
+        memset(_messageBlock + _messageBlockIndex, 0, 64 - _messageBlockIndex);
+        _processMessageBlocks(_messageBlock, 1);
+        _messageBlockIndex = 0;
     }
-    else
+    memset(_messageBlock + _messageBlockIndex, 0, 56 - _messageBlockIndex);
+
+    //  Store the message length in bits as the last 8 octets
+    uint64_t lengthInBits = _messageLength << 3;
+    for (int i = 0; i < 8; i++)
     {
-        _messageBlock[_messageBlockIndex++] = 0x80;
-        while (_messageBlockIndex < 56)
-        {
-            _messageBlock[_messageBlockIndex++] = 0;
-        }
+        _messageBlock[56 + i] = static_cast<uint8_t>(lengthInBits >> ((7 - i) * 8));
     }
 
-    //  Store the message length as the last 8 octets
-    _messageBlock[56] = static_cast<uint8_t>(_lengthHi >> 24);
-    _messageBlock[57] = static_cast<uint8_t>(_lengthHi >> 16);
-    _messageBlock[58] = static_cast<uint8_t>(_lengthHi >> 8);
-    _messageBlock[59] = static_cast<uint8_t>(_lengthHi);
-    _messageBlock[60] = static_cast<uint8_t>(_lengthLo >> 24);
-    _messageBlock[61] = static_cast<uint8_t>(_lengthLo >> 16);
-    _messageBlock[62] = static_cast<uint8_t>(_lengthLo >> 8);
-    _messageBlock[63] = static_cast<uint8_t>(_lengthLo);
-
-    _processMessageBlock();
+    _processMessageBlocks(_messageBlock, 1);
+    _messageBlockIndex = 0;
 }
 
 //  End of tt3-util/StandardMessageDigests.Sha1.cpp
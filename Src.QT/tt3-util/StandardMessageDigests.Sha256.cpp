@@ -0,0 +1,334 @@
+//
+//  tt3-util/StandardMessageDigests.Sha256.cpp - The tt3::util::StandardMessageDigests::Sha256 class implementation
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+#include "tt3-util/API.hpp"
+using namespace tt3::util;
+#if defined(Q_PROCESSOR_X86) && (defined(__GNUC__) || defined(_MSC_VER))
+    #include <immintrin.h>
+    #define TT3_SHA_NI_SUPPORTED
+    #if defined(__GNUC__)
+        #define TT3_SHA_NI_TARGET __attribute__((target("sha,sse4.1")))
+    #else
+        #define TT3_SHA_NI_TARGET
+    #endif
+#endif
+
+namespace
+{
+    const uint32_t K[] =
+        {   // Constants defined for SHA-256
+            0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+            0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+            0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+            0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+            0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+            0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+            0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+            0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+            0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+            0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+            0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+            0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+            0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+            0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+            0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+            0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+        };
+
+    inline uint32_t circularShiftRight(int bits, uint32_t word)
+    {
+        return (word >> bits) | (word << (32 - bits));
+    }
+
+    void processMessageBlocks(uint32_t H[8], const uint8_t * blocks, size_t numBlocks)
+    {
+        uint32_t    W[64];  //  Word sequence
+
+        for (; numBlocks != 0; numBlocks--, blocks += 64)
+        {
+            //  Initialize the first 16 words in the array W
+            for (int t = 0; t < 16; t++)
+            {
+                W[t]  = static_cast<uint32_t>(blocks[t * 4]) << 24;
+                W[t] |= static_cast<uint32_t>(blocks[t * 4 + 1]) << 16;
+                W[t] |= static_cast<uint32_t>(blocks[t * 4 + 2]) << 8;
+                W[t] |= static_cast<uint32_t>(blocks[t * 4 + 3]);
+            }
+
+            for (int t = 16; t < 64; t++)
+            {
+                uint32_t s0 = circularShiftRight(7, W[t-15]) ^ circularShiftRight(18, W[t-15]) ^ (W[t-15] >> 3);
+                uint32_t s1 = circularShiftRight(17, W[t-2]) ^ circularShiftRight(19, W[t-2]) ^ (W[t-2] >> 10);
+                W[t] = W[t-16] + s0 + W[t-7] + s1;
+            }
+
+            uint32_t A = H[0];
+            uint32_t B = H[1];
+            uint32_t C = H[2];
+            uint32_t D = H[3];
+            uint32_t E = H[4];
+            uint32_t F = H[5];
+            uint32_t G = H[6];
+            uint32_t Hh = H[7];
+
+            for (int t = 0; t < 64; t++)
+            {
+                uint32_t S1 = circularShiftRight(6, E) ^ circularShiftRight(11, E) ^ circularShiftRight(25, E);
+                uint32_t ch = (E & F) ^ ((~E) & G);
+                uint32_t temp1 = Hh + S1 + ch + K[t] + W[t];
+                uint32_t S0 = circularShiftRight(2, A) ^ circularShiftRight(13, A) ^ circularShiftRight(22, A);
+                uint32_t maj = (A & B) ^ (A & C) ^ (B & C);
+                uint32_t temp2 = S0 + maj;
+                Hh = G;
+                G = F;
+                F = E;
+                E = D + temp1;
+                D = C;
+                C = B;
+                B = A;
+                A = temp1 + temp2;
+            }
+
+            H[0] += A;
+            H[1] += B;
+            H[2] += C;
+            H[3] += D;
+            H[4] += E;
+            H[5] += F;
+            H[6] += G;
+            H[7] += Hh;
+        }
+    }
+
+#if defined(TT3_SHA_NI_SUPPORTED)
+    TT3_SHA_NI_TARGET
+    void processMessageBlocksShaNi(uint32_t H[8], const uint8_t * blocks, size_t numBlocks)
+    {
+        const __m128i byteSwap = _mm_set_epi64x(0x0C0D0E0F08090A0BLL, 0x0405060700010203LL);
+
+        //  SHA256RNDS2 wants the state as ABEF and CDGH
+        __m128i temp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(H)), 0xB1);
+        __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(H + 4)), 0x1B);
+        __m128i state0 = _mm_alignr_epi8(temp, state1, 8);
+        state1 = _mm_blend_epi16(state1, temp, 0xF0);
+
+        for (; numBlocks != 0; numBlocks--, blocks += 64)
+        {
+            const __m128i savedState0 = state0;
+            const __m128i savedState1 = state1;
+
+            __m128i W[4];
+            for (int i = 0; i < 16; i++)
+            {   //  Each step performs 4 rounds
+                __m128i & w = W[i % 4];
+                if (i < 4)
+                {
+                    w = _mm_shuffle_epi8(
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks + i * 16)),
+                            byteSwap);
+                }
+                else
+                {   //  W[i] depends on W[i-4] (which it replaces),
+                    //  W[i-3], W[i-2] and W[i-1]
+                    w = _mm_sha256msg2_epu32(
+                            _mm_add_epi32(
+                                _mm_sha256msg1_epu32(w, W[(i + 1) % 4]),
+                                _mm_alignr_epi8(W[(i + 3) % 4], W[(i + 2) % 4], 4)),
+                            W[(i + 3) % 4]);
+                }
+                __m128i message = _mm_add_epi32(w, _mm_loadu_si128(reinterpret_cast<const __m128i *>(K + i * 4)));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, message);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(message, 0x0E));
+            }
+
+            state0 = _mm_add_epi32(state0, savedState0);
+            state1 = _mm_add_epi32(state1, savedState1);
+        }
+
+        //  Back from ABEF and CDGH to ABCD and EFGH
+        temp = _mm_shuffle_epi32(state0, 0x1B);
+        state1 = _mm_shuffle_epi32(state1, 0xB1);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(H), _mm_blend_epi16(temp, state1, 0xF0));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(H + 4), _mm_alignr_epi8(state1, temp, 8));
+    }
+#endif
+}
+
+//////////
+//  Singleton
+TT3_IMPLEMENT_SINGLETON(StandardMessageDigests::Sha256)
+StandardMessageDigests::Sha256::Sha256() {}
+StandardMessageDigests::Sha256::~Sha256() {}
+
+//////////
+//  StockObject
+Mnemonic StandardMessageDigests::Sha256::mnemonic() const
+{
+    return M(SHA-256);
+}
+
+QString StandardMessageDigests::Sha256::displayName() const
+{
+    static Component::Resources *const resources = Component::Resources::instance();   //  idempotent
+    return resources->string(RSID(MessageDigests), RID(Sha256.DisplayName));
+}
+
+//////////
+//  MessageDigest
+IMessageDigest::Builder * StandardMessageDigests::Sha256::createBuilder()
+{
+    return new _Builder();
+}
+
+//////////
+//  StandardMessageDigests::Sha256::_Builder
+StandardMessageDigests::Sha256::_Builder::_Builder()
+{
+    reset();
+}
+
+StandardMessageDigests::Sha256::_Builder::~_Builder()
+{
+}
+
+IMessageDigest * StandardMessageDigests::Sha256::_Builder::messageDigest() const
+{
+    return StandardMessageDigests::Sha256::instance();
+}
+
+void StandardMessageDigests::Sha256::_Builder::reset()
+{
+    _messageLength = 0;
+    _messageBlockIndex = 0;
+
+    _H[0] = 0x6A09E667;
+    _H[1] = 0xBB67AE85;
+    _H[2] = 0x3C6EF372;
+    _H[3] = 0xA54FF53A;
+    _H[4] = 0x510E527F;
+    _H[5] = 0x9B05688C;
+    _H[6] = 0x1F83D9AB;
+    _H[7] = 0x5BE0CD19;
+
+    _result.clear();
+    _finalised = false;
+}
+
+void StandardMessageDigests::Sha256::_Builder::digestFragment(const void * data, size_t numBytes)
+{
+    Q_ASSERT(!_finalised);
+
+    Q_ASSERT(_result.isEmpty());
+    Q_ASSERT(data != nullptr);
+    const uint8_t * bytes = static_cast<const uint8_t *>(data);
+
+    _messageLength += numBytes;
+
+    //  Complete the partially filled message block first...
+    if (_messageBlockIndex != 0)
+    {
+        size_t chunkSize = qMin(numBytes, sizeof(_messageBlock) - _messageBlockIndex);
+        memcpy(_messageBlock + _messageBlockIndex, bytes, chunkSize);
+        _messageBlockIndex += chunkSize;
+        bytes += chunkSize;
+        numBytes -= chunkSize;
+        if (_messageBlockIndex < sizeof(_messageBlock))
+        {   //  ...not enough data yet
+            return;
+        }
+        _processMessageBlocks(_messageBlock, 1);
+        _messageBlockIndex = 0;
+    }
+    //  ...then process whole blocks straight from the input...
+    if (size_t numBlocks = numBytes / 64; numBlocks != 0)
+    {
+        _processMessageBlocks(bytes, numBlocks);
+        bytes += numBlocks * 64;
+        numBytes -= numBlocks * 64;
+    }
+    //  ...and keep the tail for later
+    memcpy(_messageBlock, bytes, numBytes);
+    _messageBlockIndex = numBytes;
+}
+
+void StandardMessageDigests::Sha256::_Builder::finalise()
+{
+    Q_ASSERT(!_finalised);
+
+    _padMessage();
+    _result.resize(32);
+    for (int i = 0; i < 8; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            _result[4 * i + j] = static_cast<uint8_t>(_H[i] >> ((3 - j) * 8));
+        }
+    }
+    _finalised = true;
+}
+
+QByteArray StandardMessageDigests::Sha256::_Builder::digestAsBytes()
+{
+    if (!_finalised)
+    {
+        finalise();
+    }
+
+    Q_ASSERT(!_result.isEmpty());
+    return _result;
+}
+
+void StandardMessageDigests::Sha256::_Builder::_processMessageBlocks(
+        const uint8_t * blocks,
+        size_t numBlocks
+    )
+{
+#if defined(TT3_SHA_NI_SUPPORTED)
+    if (isUsingShaInstructions())
+    {
+        processMessageBlocksShaNi(_H, blocks, numBlocks);
+        return;
+    }
+#endif
+    processMessageBlocks(_H, blocks, numBlocks);
+}
+
+void StandardMessageDigests::Sha256::_Builder::_padMessage()
+{
+    //  Check to see if the current message block is too small to hold
+    //  the initial padding bits and length.  If so, we will pad the
+    //  block, process it, and then continue padding into a second block.
+    _messageBlock[_messageBlockIndex++] = 0x80;
+    if (_messageBlockIndex > 56)
+    {
+        memset(_messageBlock + _messageBlockIndex, 0, 64 - _messageBlockIndex);
+        _processMessageBlocks(_messageBlock, 1);
+        _messageBlockIndex = 0;
+    }
+    memset(_messageBlock + _messageBlockIndex, 0, 56 - _messageBlockIndex);
+
+    //  Store the message length in bits as the last 8 octets
+    uint64_t lengthInBits = _messageLength << 3;
+    for (int i = 0; i < 8; i++)
+    {
+        _messageBlock[56 + i] = static_cast<uint8_t>(lengthInBits >> ((7 - i) * 8));
+    }
+
+    _processMessageBlocks(_messageBlock, 1);
+    _messageBlockIndex = 0;
+}
+
+//  End of tt3-util/StandardMessageDigests.Sha256.cpp
@@ -16,6 +16,11 @@
 //////////
 #include "tt3-util/API.hpp"
 using namespace tt3::util;
+#if defined(Q_PROCESSOR_X86) && defined(__GNUC__)
+    #include <cpuid.h>
+#elif defined(Q_PROCESSOR_X86) && defined(_MSC_VER)
+    #include <intrin.h>
+#endif
 
 //////////
 //  Operations
@@ -23,9 +28,63 @@ MessageDigests StandardMessageDigests::all()
 {
     static const MessageDigests result
     {
-        Sha1::instance()
+        Sha1::instance(),
+        Sha256::instance()
     };
     return result;
 }
 
+bool StandardMessageDigests::isUsingShaInstructions()
+{
+    static const bool hasShaInstructions = _hasShaInstructions();   //  idempotent
+    return hasShaInstructions &&
+           _shaInstructionsEnabled.load(std::memory_order_relaxed);
+}
+
+void StandardMessageDigests::setShaInstructionsEnabled(bool enabled)
+{
+    _shaInstructionsEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+//////////
+//  Implementation
+std::atomic<bool> StandardMessageDigests::_shaInstructionsEnabled = true;
+
+//////////
+//  Implementation helpers
+bool StandardMessageDigests::_hasShaInstructions()
+{   //  SHA extensions are CPUID.(EAX=7,ECX=0):EBX[29]; the
+    //  accelerated code also needs SSSE3 and SSE4.1, which
+    //  are CPUID.(EAX=1):ECX[9] and ECX[19]
+#if defined(Q_PROCESSOR_X86) && defined(__GNUC__)
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+        (ecx & (1u << 9)) == 0 || (ecx & (1u << 19)) == 0)
+    {
+        return false;
+    }
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+    {
+        return false;
+    }
+    return (ebx & (1u << 29)) != 0;
+#elif defined(Q_PROCESSOR_X86) && defined(_MSC_VER)
+    int registers[4];   //  EAX, EBX, ECX, EDX
+    __cpuid(registers, 0);
+    if (registers[0] < 7)
+    {
+        return false;
+    }
+    __cpuid(registers, 1);
+    if ((registers[2] & (1 << 9)) == 0 || (registers[2] & (1 << 19)) == 0)
+    {
+        return false;
+    }
+    __cpuidex(registers, 7, 0);
+    return (registers[1] & (1 << 29)) != 0;
+#else
+    return false;
+#endif
+}
+
 //  End of tt3-util/StandardMessageDigests.cpp
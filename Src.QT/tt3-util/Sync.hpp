@@ -174,6 +174,167 @@ namespace tt3::util
         QThread *       _lockingThread = nullptr;
     };
 
+    /// \class ReadWriteMutex tt3-util/API.hpp
+    /// \brief A mutex that can be "locked" either for reading
+    ///        (by any number of threads at a time) or for
+    ///        writing (by one thread at a time, with no readers).
+    /// \details
+    ///     Both modes are recursive. A thread that has locked
+    ///     the ReadWriteMutex for writing may re-lock it in
+    ///     either mode; a thread that has locked it for reading
+    ///     may re-lock it for reading even if a writer is waiting.
+    ///     Waiting writers take precedence over new readers.
+    ///     A thread that has locked the ReadWriteMutex for reading
+    ///     only should not attempt to lock it for writing - two
+    ///     threads doing so concurrently would deadlock.
+    ///     As a SynchronisationObject, a ReadWriteMutex is
+    ///     "grabbed" for writing.
+    class TT3_UTIL_PUBLIC ReadWriteMutex final
+        :   public SynchronisationObject
+    {
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ReadWriteMutex)
+
+        //////////
+        //  Construction/destruction
+    public:
+        /// \brief
+        ///     Constructs an initially un-"locked" mutex.
+        ReadWriteMutex() = default;
+
+        /// \brief
+        ///     The class destructor.
+        virtual ~ReadWriteMutex() = default;
+
+        //////////
+        //  SynchronisationObject
+    public:
+        virtual void    grab() override { lockForWriting(); }
+        virtual bool    tryGrab(int timeoutMs) override { return tryLockForWriting(timeoutMs); }
+        virtual void    release() override { unlock(); }
+
+        //////////
+        //  Operations
+    public:
+        /// \brief
+        ///     "Locks" this ReadWriteMutex for reading,
+        ///     idle-waiting until it is available for that.
+        void            lockForReading();
+
+        /// \brief
+        ///     "Locks" this ReadWriteMutex for reading, waiting
+        ///     until it is available for that OR the specified
+        ///     timeout expires.
+        /// \param timeoutMs
+        ///     The timeout, in milliseconds, to want for.
+        /// \return
+        ///     True on lock success, false on timeout.
+        bool            tryLockForReading(int timeoutMs);
+
+        /// \brief
+        ///     "Locks" this ReadWriteMutex for writing,
+        ///     idle-waiting until it is available for that.
+        /// \details
+        ///     Same as "grab()". A thread that has locked this
+        ///     ReadWriteMutex for reading can "upgrade" to
+        ///     writing, waiting until all other readers leave;
+        ///     but only one thread at a time can do so.
+        /// \exception LockUpgradeError
+        ///     If the current thread is a reader and another
+        ///     reader is already upgrading to writing.
+        void            lockForWriting();
+
+        /// \brief
+        ///     "Locks" this ReadWriteMutex for writing, waiting
+        ///     until it is available for that OR the specified
+        ///     timeout expires.
+        /// \details
+        ///     Same as "tryGrab(timeoutMs)". Fails at once if
+        ///     the current thread is a reader and another reader
+        ///     is already upgrading to writing (see lockForWriting()).
+        /// \param timeoutMs
+        ///     The timeout, in milliseconds, to want for.
+        /// \return
+        ///     True on lock success, false on timeout or failure.
+        bool            tryLockForWriting(int timeoutMs);
+
+        /// \brief
+        ///     Undoes the most recent "lock" of this
+        ///     ReadWriteMutex by the current thread.
+        /// \details
+        ///     Same as "release()".
+        void            unlock();
+
+        /// \brief
+        ///     Checks whether this ReadWriteMutex is locked
+        ///     (in any mode) by the specified thread.
+        /// \param thread
+        ///     The thread to check toe ReadWriteMutex state for.
+        /// \return
+        ///     True if this ReadWriteMutex is locked by the
+        ///     specified thread, else false.
+        bool            isLockedBy(QThread * thread);
+
+        /// \brief
+        ///     Checks whether this ReadWriteMutex is locked
+        ///     (in any mode) by the current thread.
+        /// \return
+        ///     True if this ReadWriteMutex is locked by the
+        ///     current thread, else false.
+        bool            isLockedByCurrentThread();
+
+        /// \brief
+        ///     Checks whether this ReadWriteMutex is locked
+        ///     for writing by the current thread.
+        /// \return
+        ///     True if this ReadWriteMutex is locked for
+        ///     writing by the current thread, else false.
+        bool            isLockedForWritingByCurrentThread();
+
+        //////////
+        //  Implementation
+    private:
+        QMutex          _stateGuard;
+        QWaitCondition  _stateChanged;
+        QThread *       _writingThread = nullptr;
+        int             _writeCount = 0;
+        QHash<QThread*, int>    _readCounts;    //  reading thread -> lock count
+        int             _waitingWriters = 0;
+        QThread *       _upgradingThread = nullptr; //  the reader waiting to write
+
+        //  Helpers
+        bool            _canLockForReading(QThread * thread) const;
+        bool            _canLockForWriting(QThread * thread) const;
+    };
+
+    /// \class ReadLock tt3-util/API.hpp
+    /// \brief
+    ///     A helper object that "locks" a ReadWriteMutex for
+    ///     reading in constructor and "unlocks" it in destructor.
+    class TT3_UTIL_PUBLIC ReadLock final
+    {
+        TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ReadLock)
+
+        //////////
+        //  Construction/destruction
+    public:
+        /// \brief
+        ///     The class constructor; "locks" the ReadWriteMutex for reading.
+        /// \param guard
+        ///     The ReadWriteMutex to "lock" for reading.
+        explicit ReadLock(ReadWriteMutex & guard)
+            :   _guard(guard) { _guard.lockForReading(); }
+
+        /// \brief
+        ///     The class destructor; "unlocks" the ReadWriteMutex
+        ///     specified to the lock constructor.
+        ~ReadLock() { _guard.unlock(); }
+
+        //////////
+        //  Implementation
+    private:
+        ReadWriteMutex &    _guard;
+    };
+
     /// \class BlockingQueue tt3-util/API.hpp
     /// \brief A "blocking inter-thread queue" ADT.
     template <class T>
@@ -224,6 +385,20 @@ namespace tt3::util
         ///     True on success (storing the value), false on timeout.
         bool        tryDequeue(T & value, int timeoutMs);
 
+        /// \brief
+        ///     Attempts to remove all items currently in the queue,
+        ///     appending them (in order) to the specified list.
+        /// \param values
+        ///     The list to append the removed values to.
+        ///     Remains unchanged if the call times out.
+        /// \param timeoutMs
+        ///     The timeout, in milliseconds, to wait for the queue
+        ///     to provide at least one value before giving up.
+        /// \return
+        ///     True on success (appending at least one value),
+        ///     false on timeout.
+        bool        tryDequeueAll(QList<T> & values, int timeoutMs);
+
         //////////
         //  Implementaion
     private:
@@ -259,6 +434,32 @@ namespace tt3::util
         }
         return false;
     }
+
+    template <class T>
+    bool BlockingQueue<T>::tryDequeueAll(QList<T> & values, int timeoutMs)
+    {
+        if (_dataSize.tryAcquire(1, timeoutMs))
+        {
+            QMutexLocker lock(&_dataGuard);
+            //  One value is already ours; claim the rest
+            //  in one go, leaving alone those values that
+            //  other consumers have already acquired
+            int count = 1;
+            int extra = static_cast<int>(
+                qMin(qsizetype(_dataSize.available()), _data.size() - 1));
+            if (extra > 0 && _dataSize.tryAcquire(extra))
+            {
+                count += extra;
+            }
+            values.reserve(values.size() + count);
+            for (; count > 0; count--)
+            {
+                values.append(_data.dequeue());
+            }
+            return true;
+        }
+        return false;
+    }
 }
 
 //  End of tt3-util/Sync.hpp
@@ -16,6 +16,35 @@
 //////////
 #include "tt3-util/API.hpp"
 
+namespace
+{
+    //  Writes "digits" decimal digits of "value" (zero-padded),
+    //  returns the pointer just past the last written character
+    QChar * formatFixedDigits(QChar * buffer, int value, int digits)
+    {
+        for (int i = digits - 1; i >= 0; i--)
+        {
+            buffer[i] = QChar(char16_t('0' + value % 10));
+            value /= 10;
+        }
+        return buffer + digits;
+    }
+
+    //  Formats the decimal digits of "value" into the END
+    //  of the "buffer" of the specified size, returns the
+    //  pointer to the 1st written character
+    QChar * formatDigitsBackwards(QChar * buffer, qsizetype bufferSize, unsigned long long value)
+    {
+        QChar * p = buffer + bufferSize;
+        do
+        {
+            *--p = QChar(char16_t('0' + value % 10));
+            value /= 10;
+        }   while (value != 0);
+        return p;
+    }
+}
+
 //  C++ types
 template <> TT3_UTIL_PUBLIC
 QString tt3::util::toString<nullptr_t>(const nullptr_t & /*value*/)
@@ -26,7 +55,10 @@ QString tt3::util::toString<nullptr_t>(const nullptr_t & /*value*/)
 template <> TT3_UTIL_PUBLIC
 QString tt3::util::toString<bool>(const bool & value)
 {
-    return value ? "true" : "false";
+    static const QString trueString = "true";
+    static const QString falseString = "false";
+
+    return value ? trueString : falseString;
 }
 
 template <> TT3_UTIL_PUBLIC
@@ -86,17 +118,27 @@ QString tt3::util::toString<unsigned long>(const unsigned long & value)
 template <> TT3_UTIL_PUBLIC
 QString tt3::util::toString<signed long long>(const signed long long & value)
 {
-    char s[64];
-    sprintf(s, "%lld", value);
-    return s;
+    QChar s[24];
+    //  Negating the most negative value is only
+    //  safe on the unsigned magnitude
+    unsigned long long magnitude =
+        (value < 0) ?
+            (0ULL - static_cast<unsigned long long>(value)) :
+            static_cast<unsigned long long>(value);
+    QChar * p = formatDigitsBackwards(s, std::size(s), magnitude);
+    if (value < 0)
+    {
+        *--p = '-';
+    }
+    return QString(p, s + std::size(s) - p);
 }
 
 template <> TT3_UTIL_PUBLIC
 QString tt3::util::toString<unsigned long long>(const unsigned long long & value)
 {
-    char s[64];
-    sprintf(s, "%llu", value);
-    return s;
+    QChar s[24];
+    QChar * p = formatDigitsBackwards(s, std::size(s), value);
+    return QString(p, s + std::size(s) - p);
 }
 
 template <> TT3_UTIL_PUBLIC
@@ -203,15 +245,32 @@ QString tt3::util::toString<QDateTime>(const QDateTime & value)
 {
     if (value.isValid())
     {
+        QDate date = value.date();
+        QTime time = value.time();
+        if (date.year() >= 0 && date.year() <= 9999)
+        {   //  The usual case - fixed format YYYYMMDDThhmmss.sss
+            QString result(19, Qt::Uninitialized);
+            QChar * p = result.data();
+            p = formatFixedDigits(p, date.year(), 4);
+            p = formatFixedDigits(p, date.month(), 2);
+            p = formatFixedDigits(p, date.day(), 2);
+            *p++ = 'T';
+            p = formatFixedDigits(p, time.hour(), 2);
+            p = formatFixedDigits(p, time.minute(), 2);
+            p = formatFixedDigits(p, time.second(), 2);
+            *p++ = '.';
+            formatFixedDigits(p, time.msec(), 3);
+            return result;
+        }
         char s[32];
         sprintf(s, "%04d%02d%02dT%02d%02d%02d.%03d",
-                value.date().year(),
-                value.date().month(),
-                value.date().day(),
-                value.time().hour(),
-                value.time().minute(),
-                value.time().second(),
-                value.time().msec());
+                date.year(),
+                date.month(),
+                date.day(),
+                time.hour(),
+                time.minute(),
+                time.second(),
+                time.msec());
         return s;
     }
     return "-";
@@ -222,6 +281,15 @@ QString tt3::util::toString<QDate>(const QDate & value)
 {
     if (value.isValid())
     {
+        if (value.year() >= 0 && value.year() <= 9999)
+        {   //  The usual case - fixed format YYYYMMDD
+            QString result(8, Qt::Uninitialized);
+            QChar * p = result.data();
+            p = formatFixedDigits(p, value.year(), 4);
+            p = formatFixedDigits(p, value.month(), 2);
+            formatFixedDigits(p, value.day(), 2);
+            return result;
+        }
         char s[16];
         sprintf(s, "%04d%02d%02d",
                 value.year(),
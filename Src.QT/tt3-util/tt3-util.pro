@@ -23,10 +23,12 @@ SOURCES += \
     Mutex.cpp \
     NaturalStringOrder.cpp \
     ProductInformation.cpp \
+    ReadWriteMutex.cpp \
     ResourceReader.cpp \
     Settings.cpp \
     StandardLicenses.cpp \
     StandardMessageDigests.Sha1.cpp \
+    StandardMessageDigests.Sha256.cpp \
     StandardMessageDigests.cpp \
     StandardSubsystems.cpp \
     SubsystemManager.cpp \
@@ -32,6 +32,7 @@
 #include "tt3-ws/Exceptions.hpp"
 #include "tt3-ws/WorkspaceType.hpp"
 #include "tt3-ws/WorkspaceAddress.hpp"
+#include "tt3-ws/Records.hpp"
 
 #include "tt3-ws/Object.hpp"    //  GCC needs ObjectImpl defined befors Workspace
 #include "tt3-ws/Workspace.hpp"
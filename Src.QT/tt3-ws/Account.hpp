@@ -233,6 +233,53 @@ namespace tt3::ws
                             const QDateTime & to
                         ) const -> Events;
 
+        /// \brief
+        ///     Returns the snapshots of all Works logged by this
+        ///     Account that fall, fully or partially, within the
+        ///     given UTC date+time range.
+        /// \details
+        ///     Unlike calling the property getters of every Work,
+        ///     this checks the caller's access rights once for
+        ///     all Works and once for each distinct Activity.
+        /// \param credentials
+        ///     The credentials of the service caller.
+        /// \param from
+        ///     The UTC date+time when the range begins (inclusive).
+        /// \param to
+        ///     The UTC date+time when the range ends (inclusive).
+        /// \return
+        ///     The snapshots of the Works, in chronological order.
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        auto        workRecords(
+                            const Credentials & credentials,
+                            const QDateTime & from,
+                            const QDateTime & to
+                        ) const -> WorkRecords;
+
+        /// \brief
+        ///     Returns the snapshots of all Events logged by this
+        ///     Account that fall within the given UTC date+time range.
+        /// \details
+        ///     Unlike calling the property getters of every Event,
+        ///     this checks the caller's access rights once for
+        ///     all Events and once for each distinct Activity.
+        /// \param credentials
+        ///     The credentials of the service caller.
+        /// \param from
+        ///     The UTC date+time when the range begins (inclusive).
+        /// \param to
+        ///     The UTC date+time when the range ends (inclusive).
+        /// \return
+        ///     The snapshots of the Events, in chronological order.
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        auto        eventRecords(
+                            const Credentials & credentials,
+                            const QDateTime & from,
+                            const QDateTime & to
+                        ) const -> EventRecords;
+
         //////////
         //  Operations (life cycle)
     public:
@@ -305,6 +352,18 @@ namespace tt3::ws
                             ) const override;
         virtual bool    _destroyingLosesAccess(
                             ) const override;
+
+        //  Bulk queries
+        using _ActivityRecordsCache = QHash<tt3::db::api::IActivity*, ActivityRecord>;
+
+        bool            _canReadWorksAndEvents( //  throws WorkspaceException
+                                const Credentials & credentials
+                            ) const;
+        auto            _activityRecord(        //  throws tt3::util::Exception
+                                const Credentials & credentials,
+                                tt3::db::api::IActivity * dataActivity,
+                                _ActivityRecordsCache & cache
+                            ) const -> ActivityRecord;
     };
 }
 
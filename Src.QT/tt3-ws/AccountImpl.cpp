@@ -37,7 +37,7 @@ QString AccountImpl::login(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -97,7 +97,7 @@ QString AccountImpl::passwordHash(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -146,7 +146,7 @@ auto AccountImpl::capabilities(
         const Credentials & credentials
     ) const -> Capabilities
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -217,7 +217,7 @@ auto AccountImpl::user(
         const Credentials & credentials
     ) const -> User
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -241,7 +241,7 @@ auto AccountImpl::quickPicksList(
         const Credentials & credentials
     ) const -> QList<Activity>
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -302,7 +302,7 @@ auto AccountImpl::works(
         const Credentials & credentials
     ) const -> Works
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -333,7 +333,7 @@ auto AccountImpl::works(
         const QDateTime & to
     ) const -> Works
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -362,7 +362,7 @@ auto AccountImpl::events(
         const Credentials & credentials
     ) const -> Events
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -393,7 +393,7 @@ auto AccountImpl::events(
         const QDateTime & to
     ) const -> Events
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -418,6 +418,103 @@ auto AccountImpl::events(
     }
 }
 
+auto AccountImpl::workRecords(
+        const Credentials & credentials,
+        const QDateTime & from,
+        const QDateTime & to
+    ) const -> WorkRecords
+{
+    tt3::util::ReadLock _(_workspace->_guard);
+    _ensureLive();  //  may throw
+
+    try
+    {
+        //  Validate access rights - once for all Works
+        if (!_canReadWorksAndEvents(credentials))   //  may throw
+        {
+            throw AccessDeniedException();
+        }
+
+        //  Do the work
+        _ActivityRecordsCache activityRecords;
+        WorkRecords result;
+        for (auto dataWork : _dataAccount->works(from, to)) //  may throw
+        {
+            result.append(
+                WorkRecord
+                {
+                    _workspace->_getProxy(dataWork),
+                    dataWork->startedAt(),  //  may throw
+                    dataWork->finishedAt(), //  may throw
+                    _activityRecord(credentials, dataWork->activity(), activityRecords)  //  may throw
+                });
+        }
+        std::sort(
+            result.begin(),
+            result.end(),
+            [](const auto & a, const auto & b)
+            {
+                return a.startedAt < b.startedAt;
+            });
+        return result;
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
+auto AccountImpl::eventRecords(
+        const Credentials & credentials,
+        const QDateTime & from,
+        const QDateTime & to
+    ) const -> EventRecords
+{
+    tt3::util::ReadLock _(_workspace->_guard);
+    _ensureLive();  //  may throw
+
+    try
+    {
+        //  Validate access rights - once for all Events
+        if (!_canReadWorksAndEvents(credentials))   //  may throw
+        {
+            throw AccessDeniedException();
+        }
+
+        //  Do the work
+        _ActivityRecordsCache activityRecords;
+        EventRecords result;
+        for (auto dataEvent : _dataAccount->events(from, to))   //  may throw
+        {
+            EventRecord eventRecord
+            {
+                _workspace->_getProxy(dataEvent),
+                dataEvent->occurredAt(),    //  may throw
+                dataEvent->summary(),       //  may throw
+                {}
+            };
+            for (auto dataActivity : dataEvent->activities())   //  may throw
+            {
+                eventRecord.activities.append(
+                    _activityRecord(credentials, dataActivity, activityRecords));   //  may throw
+            }
+            result.append(eventRecord);
+        }
+        std::sort(
+            result.begin(),
+            result.end(),
+            [](const auto & a, const auto & b)
+            {
+                return a.occurredAt < b.occurredAt;
+            });
+        return result;
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
 /////////
 //  Operations (life cycle)
 auto AccountImpl::createWork(
@@ -448,7 +545,7 @@ auto AccountImpl::createWork(
             {   //  Can log Work items aganst public Activities/Tasks and
                 //  caller's own private Activities/Tasks
                 tt3::db::api::IAccount * callerAccount =
-                    _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+                    _workspace->_tryLogin(credentials); //  may throw
                 if (callerAccount == nullptr ||
                     callerAccount->user() != this->_dataAccount->user())
                 {   //  OOPS! Can't!
@@ -511,7 +608,7 @@ auto AccountImpl::createEvent(
             {   //  Can log Events aganst public Activities/Tasks and
                 //  caller's own private Activities/Tasks
                 tt3::db::api::IAccount * callerAccount =
-                    _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+                    _workspace->_tryLogin(credentials); //  may throw
                 if (callerAccount == nullptr ||
                     callerAccount->user() != this->_dataAccount->user())
                 {   //  OOPS! Can't!
@@ -602,7 +699,7 @@ bool AccountImpl::_canRead(
         }
         //  The caller can only see his own accounts
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+            _workspace->_tryLogin(credentials); //  may throw
         return callerAccount != nullptr &&
                callerAccount->user() == _dataAccount->user();
     }
@@ -641,7 +738,7 @@ bool AccountImpl::_canModify(
         }
         //  The caller can only modify his own accounts
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+            _workspace->_tryLogin(credentials); //  may throw
         return callerAccount != nullptr &&
                callerAccount->user() == _dataAccount->user();
     }
@@ -718,4 +815,75 @@ bool AccountImpl::_destroyingLosesAccess(
     }
 }
 
+//////////
+//  Implementation helpers (bulk queries)
+bool AccountImpl::_canReadWorksAndEvents(
+        const Credentials & credentials
+    ) const
+{
+    Q_ASSERT(_workspace->_guard.isLockedByCurrentThread());
+
+    //  Same rules as WorkImpl/EventImpl::_canRead(), but
+    //  all Works/Events of this Account share the verdict
+    try
+    {
+        if (_workspace->_isBackupCredentials(credentials) ||
+            _workspace->_isRestoreCredentials(credentials) ||
+            _workspace->_isReportCredentials(credentials))
+        {   //  Special access - can read anything
+            return true;
+        }
+        Capabilities clientCapabilities = _workspace->_validateAccessRights(credentials); //  may throw
+        if (clientCapabilities.contains(Capability::Administrator))
+        {   //  Can read any Works/Events
+            return true;
+        }
+        //  An ordinary user can only see their own Works/Events
+        tt3::db::api::IAccount * callerAccount =
+            _workspace->_tryLogin(credentials); //  may throw
+        return callerAccount != nullptr &&
+               callerAccount->user() == _dataAccount->user();
+    }
+    catch (const AccessDeniedException &)
+    {   //  This is a special case!
+        return false;
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
+auto AccountImpl::_activityRecord(
+        const Credentials & credentials,
+        tt3::db::api::IActivity * dataActivity,
+        _ActivityRecordsCache & cache
+    ) const -> ActivityRecord
+{
+    Q_ASSERT(_workspace->_guard.isLockedByCurrentThread());
+    Q_ASSERT(dataActivity != nullptr);
+
+    if (cache.contains(dataActivity))
+    {   //  Already checked & captured
+        return cache[dataActivity];
+    }
+    Activity activity = _workspace->_getProxy(dataActivity);    //  may throw
+    if (!activity->_canRead(credentials))   //  may throw
+    {
+        throw AccessDeniedException();
+    }
+    auto dataActivityType = dataActivity->activityType();   //  may throw
+    ActivityRecord activityRecord
+    {
+        activity,
+        dataActivity->displayName(),    //  may throw
+        dataActivity->description(),    //  may throw
+        (dataActivityType != nullptr) ?
+            _workspace->_getProxy(dataActivityType) :
+            ActivityType()
+    };
+    cache.insert(dataActivity, activityRecord);
+    return activityRecord;
+}
+
 //  End of tt3-ws/AccountImpl.cpp
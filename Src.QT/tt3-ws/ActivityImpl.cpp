@@ -39,7 +39,7 @@ QString ActivityImpl::displayName(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -88,7 +88,7 @@ QString ActivityImpl::description(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -137,7 +137,7 @@ auto ActivityImpl::timeout(
         const Credentials & credentials
     ) const -> InactivityTimeout
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -186,7 +186,7 @@ bool ActivityImpl::requireCommentOnStart(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -235,7 +235,7 @@ bool ActivityImpl::requireCommentOnStop(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -284,7 +284,7 @@ bool ActivityImpl::fullScreenReminder(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -335,7 +335,7 @@ auto ActivityImpl::activityType(
         const Credentials & credentials
     ) const -> ActivityType
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -396,7 +396,7 @@ auto ActivityImpl::workload(
         const Credentials & credentials
     ) const -> Workload
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -462,7 +462,7 @@ auto ActivityImpl::works(
         const Credentials & credentials
     ) const -> Works
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -495,7 +495,7 @@ auto ActivityImpl::events(
         const Credentials & credentials
     ) const -> Events
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -530,7 +530,7 @@ bool ActivityImpl::canStart(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -580,7 +580,7 @@ bool ActivityImpl::canStop(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -39,7 +39,7 @@ QString ActivityTypeImpl::displayName(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -88,7 +88,7 @@ QString ActivityTypeImpl::description(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -139,7 +139,7 @@ auto ActivityTypeImpl::activities(
         const Credentials & credentials
     ) const -> Activities
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
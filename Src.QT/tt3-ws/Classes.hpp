@@ -83,6 +83,14 @@ namespace tt3::ws
     using WorkStreams = QSet<WorkStream>;
     using Beneficiaries = QSet<Beneficiary>;
 
+    //  Flat read-only projections
+    struct ActivityRecord;
+    struct WorkRecord;
+    struct EventRecord;
+
+    using WorkRecords = QList<WorkRecord>;
+    using EventRecords = QList<EventRecord>;
+
     //  Exceptins & notifications
     class WorkspaceException;
     class WorkspaceClosedNotification;
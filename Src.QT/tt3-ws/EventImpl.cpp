@@ -39,7 +39,7 @@ auto EventImpl::occurredAt(
         const tt3::ws::Credentials & credentials
     ) const -> QDateTime
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -62,7 +62,7 @@ QString EventImpl::summary(
         const tt3::ws::Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -87,7 +87,7 @@ auto EventImpl::account(
         const tt3::ws::Credentials & credentials
     ) const -> Account
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -116,7 +116,7 @@ auto EventImpl::activities(
         const tt3::ws::Credentials & credentials
     ) const -> Activities
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -167,7 +167,7 @@ bool EventImpl::_canRead(
         }
         //  An ordinary user can only see their own Events
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+            _workspace->_tryLogin(credentials); //  may throw
         return callerAccount != nullptr &&
                callerAccount->user() == _dataEvent->account()->user();
     }
@@ -74,6 +74,25 @@ namespace tt3::ws
         //  Default copy-constructor and assigmnent are OK
     };
 
+    /// \class WorkspaceReloadedNotification tt3-ws/API.hpp
+    /// \brief Emitted after the contents of a workspace have changed wholesale.
+    class TT3_WS_PUBLIC WorkspaceReloadedNotification
+        :   public ChangeNotification
+    {
+        //////////
+        //  Construction/destruction/assignment
+    public:
+        /// \brief
+        ///     Constructs the notification.
+        /// \param workspace
+        ///     The workspace where the change has occurred.
+        WorkspaceReloadedNotification(
+                const Workspace & workspace
+            ) : ChangeNotification(workspace) {}
+
+        //  Default copy-constructor and assigmnent are OK
+    };
+
     /// \class ObjectCreatedNotification tt3-ws/API.hpp
     /// \brief Emitted after a new object is created.
     class TT3_WS_PUBLIC ObjectCreatedNotification
@@ -233,6 +252,7 @@ namespace tt3::ws
 
 Q_DECLARE_METATYPE(tt3::ws::ChangeNotification)
 Q_DECLARE_METATYPE(tt3::ws::WorkspaceClosedNotification)
+Q_DECLARE_METATYPE(tt3::ws::WorkspaceReloadedNotification)
 Q_DECLARE_METATYPE(tt3::ws::ObjectCreatedNotification)
 Q_DECLARE_METATYPE(tt3::ws::ObjectDestroyedNotification)
 Q_DECLARE_METATYPE(tt3::ws::ObjectModifiedNotification)
@@ -127,7 +127,7 @@ bool ObjectImpl::canRead(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();
 
     return _canRead(credentials);
@@ -137,7 +137,7 @@ bool ObjectImpl::canModify(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();
 
     return _canModify(credentials);
@@ -147,7 +147,7 @@ bool ObjectImpl::canDestroy(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();
 
     return _canDestroy(credentials);
@@ -37,7 +37,7 @@ bool PrincipalImpl::enabled(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -96,7 +96,7 @@ auto PrincipalImpl::emailAddresses(
         const Credentials & credentials
     ) const -> QStringList
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
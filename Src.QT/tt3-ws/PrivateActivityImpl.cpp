@@ -39,7 +39,7 @@ auto PrivateActivityImpl::owner(
         const Credentials & credentials
     ) const -> User
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -87,7 +87,7 @@ bool PrivateActivityImpl::_canRead(
         }
         //  The caller can only see his own private activities
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+            _workspace->_tryLogin(credentials); //  may throw
         return callerAccount != nullptr &&
                callerAccount->user() == _dataPrivateActivity->owner();   //  may throw
     }
@@ -126,7 +126,7 @@ bool PrivateActivityImpl::_canModify(
         //  The caller can only modify his own private activities
         //  IF they ALSO have the corresponding capability
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+            _workspace->_tryLogin(credentials); //  may throw
         return clientCapabilities.contains(Capability::ManagePrivateActivities) &&
                callerAccount != nullptr &&
                callerAccount->user() == _dataPrivateActivity->owner();   //  may throw
@@ -166,7 +166,7 @@ bool PrivateActivityImpl::_canDestroy(
         //  The caller can only destroy his own private activities
         //  IF they ALSO have the corresponding capability
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+            _workspace->_tryLogin(credentials); //  may throw
         return clientCapabilities.contains(Capability::ManagePrivateActivities) &&
                callerAccount != nullptr &&
                callerAccount->user() == _dataPrivateActivity->owner();   //  may throw
@@ -41,7 +41,7 @@ auto PrivateTaskImpl::parent(
         const Credentials & credentials
     ) const -> PrivateTask
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -105,7 +105,7 @@ auto PrivateTaskImpl::children(
         const Credentials & credentials
     ) const -> PrivateTasks
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -213,7 +213,7 @@ bool PrivateTaskImpl::_canRead(
         }
         //  The caller can only see his own private tasks
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+            _workspace->_tryLogin(credentials); //  may throw
         return callerAccount != nullptr &&
                callerAccount->user() == _dataPrivateActivity->owner();   //  may throw
     }
@@ -252,7 +252,7 @@ bool PrivateTaskImpl::_canModify(
         //  The caller can only modify his own private tasks
         //  IF they ALSO have the corresponding capability
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+            _workspace->_tryLogin(credentials); //  may throw
         return clientCapabilities.contains(Capability::ManagePrivateTasks) &&
                callerAccount != nullptr &&
                callerAccount->user() == _dataPrivateActivity->owner();   //  may throw
@@ -292,7 +292,7 @@ bool PrivateTaskImpl::_canDestroy(
         //  The caller can only destroy his own private tasks
         //  IF they ALSO have the corresponding capability
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+            _workspace->_tryLogin(credentials); //  may throw
         return clientCapabilities.contains(Capability::ManagePrivateTasks) &&
                callerAccount != nullptr &&
                callerAccount->user() == _dataPrivateActivity->owner();   //  may throw
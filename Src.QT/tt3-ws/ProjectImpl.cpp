@@ -39,7 +39,7 @@ bool ProjectImpl::completed(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -90,7 +90,7 @@ auto ProjectImpl::parent(
         const Credentials & credentials
     ) const -> Project
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -151,7 +151,7 @@ auto ProjectImpl::children(
         const Credentials & credentials
     ) const -> Projects
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
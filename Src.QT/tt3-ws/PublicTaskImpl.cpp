@@ -41,7 +41,7 @@ auto PublicTaskImpl::parent(
         const Credentials & credentials
     ) const -> PublicTask
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -102,7 +102,7 @@ auto PublicTaskImpl::children(
         const Credentials & credentials
     ) const -> PublicTasks
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -0,0 +1,97 @@
+//
+//  tt3-ws/Records.hpp - flat read-only projections of workspace objects
+//
+//  TimeTracker3
+//  Copyright (C) 2026, Andrey Kapustin
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//////////
+
+namespace tt3::ws
+{
+    /// \class ActivityRecord tt3-ws/API.hpp
+    /// \brief The snapshot of an Activity's properties, taken
+    ///     when the access rights to that Activity were checked.
+    struct TT3_WS_PUBLIC ActivityRecord
+    {
+        //////////
+        //  Properties
+
+        /// \brief
+        ///     The Activity itself.
+        Activity        activity;
+
+        /// \brief
+        ///     The user-readable display name of the Activity.
+        QString         displayName;
+
+        /// \brief
+        ///     The multi-line description of the Activity.
+        QString         description;
+
+        /// \brief
+        ///     The type of the Activity, nullptr if none.
+        ActivityType    activityType;
+    };
+
+    /// \class WorkRecord tt3-ws/API.hpp
+    /// \brief The snapshot of a Work's properties, as returned
+    ///     by the bulk queries of an Account.
+    struct TT3_WS_PUBLIC WorkRecord
+    {
+        //////////
+        //  Properties
+
+        /// \brief
+        ///     The Work itself.
+        Work            work;
+
+        /// \brief
+        ///     The UTC date+time when the Work was started.
+        QDateTime       startedAt;
+
+        /// \brief
+        ///     The UTC date+time when the Work was finished.
+        QDateTime       finishedAt;
+
+        /// \brief
+        ///     The Activity against which the Work was logged.
+        ActivityRecord  activity;
+    };
+
+    /// \class EventRecord tt3-ws/API.hpp
+    /// \brief The snapshot of an Event's properties, as returned
+    ///     by the bulk queries of an Account.
+    struct TT3_WS_PUBLIC EventRecord
+    {
+        //////////
+        //  Properties
+
+        /// \brief
+        ///     The Event itself.
+        Event           event;
+
+        /// \brief
+        ///     The UTC date+time when the Event has occurred.
+        QDateTime       occurredAt;
+
+        /// \brief
+        ///     The 1-line summary of the Event.
+        QString         summary;
+
+        /// \brief
+        ///     The Activities against which the Event was
+        ///     logged, in no particular order; can be empty.
+        QList<ActivityRecord>   activities;
+    };
+}
+
+//  End of tt3-ws/Records.hpp
@@ -37,7 +37,7 @@ QString UserImpl::realName(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -86,7 +86,7 @@ auto UserImpl::inactivityTimeout(
         const Credentials & credentials
     ) const -> InactivityTimeout
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -135,7 +135,7 @@ auto UserImpl::uiLocale(
         const Credentials & credentials
     ) const -> UiLocale
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -186,7 +186,7 @@ auto UserImpl::accounts(
         const Credentials & credentials
     ) const -> Accounts
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -240,7 +240,7 @@ auto UserImpl::privateActivities(
         const Credentials & credentials
     ) const -> PrivateActivities
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -293,7 +293,7 @@ auto UserImpl::privateActivitiesAndTasks(
         const Credentials & credentials
     ) const -> PrivateActivities
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -346,7 +346,7 @@ auto UserImpl::privateTasks(
         const Credentials & credentials
     ) const -> PrivateTasks
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -399,7 +399,7 @@ auto UserImpl::rootPrivateTasks(
         const Credentials & credentials
     ) const -> PrivateTasks
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -452,7 +452,7 @@ auto UserImpl::permittedWorkloads(
         const Credentials & credentials
     ) const -> Workloads
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -756,7 +756,7 @@ bool UserImpl::_canRead(
         }
         //  Otherwise user can only read himself
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password);    //  may throw
+            _workspace->_tryLogin(credentials);    //  may throw
         return callerAccount != nullptr &&
                callerAccount->user() == _dataUser;
     }
@@ -795,7 +795,7 @@ bool UserImpl::_canModify(
         }
         //  Otherwise user can only modify himself
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password);    //  may throw
+            _workspace->_tryLogin(credentials);    //  may throw
         return callerAccount != nullptr &&
                callerAccount->user() == _dataUser;
     }
@@ -39,7 +39,7 @@ auto WorkImpl::startedAt(
         const tt3::ws::Credentials & credentials
     ) const -> QDateTime
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -63,7 +63,7 @@ auto WorkImpl::finishedAt(
         const tt3::ws::Credentials & credentials
     ) const -> QDateTime
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -89,7 +89,7 @@ auto WorkImpl::account(
         const tt3::ws::Credentials & credentials
     ) const -> Account
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -118,7 +118,7 @@ auto WorkImpl::activity(
         const tt3::ws::Credentials & credentials
     ) const -> Activity
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -166,7 +166,7 @@ bool WorkImpl::_canRead(
         }
         //  An ordinary user can only see their own Works
         tt3::db::api::IAccount * callerAccount =
-            _workspace->_database->tryLogin(credentials._login, credentials._password); //  may throw
+            _workspace->_tryLogin(credentials); //  may throw
         return callerAccount != nullptr &&
                callerAccount->user() == _dataWork->account()->user();
     }
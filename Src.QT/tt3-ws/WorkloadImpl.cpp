@@ -39,7 +39,7 @@ QString WorkloadImpl::displayName(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -88,7 +88,7 @@ QString WorkloadImpl::description(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -139,7 +139,7 @@ auto WorkloadImpl::contributingActivities(
         const Credentials & credentials
     ) const -> Activities
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -172,7 +172,7 @@ auto WorkloadImpl::beneficiaries(
         const Credentials & credentials
     ) const -> Beneficiaries
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
@@ -306,7 +306,7 @@ auto WorkloadImpl::assignedUsers(
         const Credentials & credentials
     ) const -> Users
 {
-    tt3::util::Lock _(_workspace->_guard);
+    tt3::util::ReadLock _(_workspace->_guard);
     _ensureLive();  //  may throw
 
     try
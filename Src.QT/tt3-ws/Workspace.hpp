@@ -83,6 +83,55 @@ namespace tt3::ws
         friend class WorkImpl;
         friend class EventImpl;
 
+        //////////
+        //  Types
+    public:
+        /// \class ReportLock tt3-ws/API.hpp
+        /// \brief Keeps a workspace from being modified while
+        ///     a report is generated from it.
+        /// \details
+        ///     "Report credentials" alone only keep the objects
+        ///     destroyed during a report session from being
+        ///     recycled. While a ReportLock exists, the workspace
+        ///     is also read-locked, so everything read under it
+        ///     is a consistent view of the workspace; attempts to
+        ///     modify the workspace (by any thread) wait until
+        ///     the ReportLock is destroyed. Hold a ReportLock while
+        ///     the report data is gathered, and no longer; it must
+        ///     be destroyed by the same thread that has created it.
+        class TT3_WS_PUBLIC ReportLock final
+        {
+            TT3_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ReportLock)
+
+            //////////
+            //  Construction/destruction
+        public:
+            /// \brief
+            ///     The class constructor; read-locks the workspace,
+            ///     waiting until the modifications underway end.
+            /// \param workspace
+            ///     The workspace to read-lock.
+            /// \param reportCredentials
+            ///     The report credentials of the service caller.
+            /// \exception WorkspaceException
+            ///     If the workspace is closed or the report
+            ///     credentials are not valid.
+            ReportLock(
+                    Workspace workspace,
+                    const ReportCredentials & reportCredentials
+                );
+
+            /// \brief
+            ///     The class destructor; releases the read lock.
+            ~ReportLock() = default;
+
+            //////////
+            //  Implementation
+        private:
+            const Workspace     _workspace;
+            tt3::util::ReadLock _lock;
+        };
+
         //////////
         //  Construction/destruction - from friends only
     private:
@@ -159,6 +208,18 @@ namespace tt3::ws
         ///     If an error occurs.
         void        refresh();
 
+        /// \brief
+        ///     Performs a full consistency check of this Workspace.
+        /// \param credentials
+        ///     The credentials of the service caller; must
+        ///     grant the Administrator capability.
+        /// \exception WorkspaceException
+        ///     If an error occurs or the Workspace is found
+        ///     to be inconsistent.
+        void        validate(
+                            const Credentials & credentials
+                        ) const;
+
         //////////
         //  Operations (associations)
     public:
@@ -785,11 +846,12 @@ namespace tt3::ws
         ///     determined automatically based on e.g. the
         ///     database size.
         ///     Once the "report credentials" are created, the
-        ///     workspace is placed under a "read lock", which
-        ///     means no process can modify the worksoace (not
-        ///     even the process that caused the creation of the
-        ///     lock) until the "report credentials" are released
-        ///     or until they expire, whichever comes first.
+        ///     objects destroyed in the workspace are not recycled
+        ///     until the "report credentials" are released or until
+        ///     they expire, whichever comes first, so references to
+        ///     them stay valid. To keep the workspace from being
+        ///     modified while the report data is gathered, hold
+        ///     a ReportLock meanwhile.
         /// \param credentials
         ///     The credentials of the service caller.
         /// \param leaseDurationMs
@@ -806,6 +868,180 @@ namespace tt3::ws
                             quint64 leaseDurationMs
                         ) -> ReportCredentials;
 
+        /// \brief
+        ///     Returns the account on whose behalf a report
+        ///     generation session has been started.
+        /// \details
+        ///     "Report credentials" have a random login of their
+        ///     own; this is how a report finds out whom it is
+        ///     generated for (e.g. to name its creator).
+        /// \param reportCredentials
+        ///     The report credentials of the service caller.
+        /// \return
+        ///     The account whose credentials were passed to
+        ///     the beginReport() call that has issued the
+        ///     "reportCredentials".
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        auto        reportOwner(
+                            const ReportCredentials & reportCredentials
+                        ) const -> Account;
+
+        /// \brief
+        ///     Starts a bulk-load session within a restore session.
+        /// \details
+        ///     While a bulk-load session is underway, objects can be
+        ///     created with the OIDs supplied by the caller (see
+        ///     setBulkLoadOid()), validation of the workspace is
+        ///     deferred until the session ends and no per-object
+        ///     change notifications are emitted; instead, a single
+        ///     workspaceReloaded() signal is emitted when the session
+        ///     ends. The bulk-load session ends no later than the
+        ///     restore session it belongs to.
+        /// \param restoreCredentials
+        ///     The restore credentials of the service caller.
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        void        beginBulkLoad(
+                            const RestoreCredentials & restoreCredentials
+                        );
+
+        /// \brief
+        ///     Specifies the OID to assign to the next object
+        ///     created in this workspace during a bulk-load session.
+        /// \param restoreCredentials
+        ///     The restore credentials of the service caller; must
+        ///     be the ones that have started the bulk-load session.
+        /// \param oid
+        ///     The OID to assign to the next object created.
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        void        setBulkLoadOid(
+                            const RestoreCredentials & restoreCredentials,
+                            const Oid & oid
+                        );
+
+        /// \brief
+        ///     Ends a bulk-load session.
+        /// \details
+        ///     Validates everything loaded during the session; has
+        ///     no effect if no bulk-load session is underway.
+        /// \param restoreCredentials
+        ///     The restore credentials of the service caller; must
+        ///     be the ones that have started the bulk-load session.
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        void        endBulkLoad(
+                            const RestoreCredentials & restoreCredentials
+                        );
+
+        /// \brief
+        ///     Returns the latest modification stamp issued
+        ///     by this workspace.
+        /// \details
+        ///     Every change to a workspace object (its creation,
+        ///     modification or destruction) is given the next stamp
+        ///     from an ever-increasing sequence, so the changes made
+        ///     since a backup are those with stamps exceeding the
+        ///     value this method returned during that backup.
+        /// \param backupCredentials
+        ///     The backup credentials of the service caller.
+        /// \return
+        ///     The latest modification stamp issued by this
+        ///     workspace; 0 if none.
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        quint64     modificationStamp(
+                            const BackupCredentials & backupCredentials
+                        ) const;
+
+        /// \brief
+        ///     Returns the OIDs of all objects created or
+        ///     modified since the specified modification stamp.
+        /// \param backupCredentials
+        ///     The backup credentials of the service caller.
+        /// \param modificationStamp
+        ///     The modification stamp to look after.
+        /// \return
+        ///     The OIDs of all live objects created or modified
+        ///     since "modificationStamp" was issued.
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        auto        modifiedOidsSince(
+                            const BackupCredentials & backupCredentials,
+                            quint64 modificationStamp
+                        ) const -> Oids;
+
+        /// \brief
+        ///     Returns the OIDs of all objects destroyed (or
+        ///     given different OIDs) since the specified
+        ///     modification stamp.
+        /// \param backupCredentials
+        ///     The backup credentials of the service caller.
+        /// \param modificationStamp
+        ///     The modification stamp to look after.
+        /// \return
+        ///     The OIDs that have ceased to belong to live
+        ///     objects since "modificationStamp" was issued.
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        auto        destroyedOidsSince(
+                            const BackupCredentials & backupCredentials,
+                            quint64 modificationStamp
+                        ) const -> Oids;
+
+        /// \brief
+        ///     Returns the UUID that identifies the database
+        ///     behind this workspace.
+        /// \details
+        ///     Modification stamps issued by two workspaces are
+        ///     only comparable if their instance IDs are the same;
+        ///     backups record it to tell deltas written against
+        ///     a different database.
+        /// \param backupCredentials
+        ///     The backup credentials of the service caller.
+        /// \return
+        ///     The UUID that identifies the database behind
+        ///     this workspace.
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        QUuid       instanceId(
+                            const BackupCredentials & backupCredentials
+                        ) const;
+
+        /// \brief
+        ///     Records that a full backup of this workspace has
+        ///     been taken.
+        /// \details
+        ///     Delta backups can then be written against that full
+        ///     backup, the one before it, or deltas since; what is
+        ///     only needed for deltas against older backups is
+        ///     forgotten.
+        /// \param backupCredentials
+        ///     The backup credentials of the service caller.
+        /// \param modificationStamp
+        ///     The modification stamp the full backup was taken at.
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        void        recordFullBackup(
+                            const BackupCredentials & backupCredentials,
+                            quint64 modificationStamp
+                        );
+
+        /// \brief
+        ///     Returns the oldest modification stamp that a delta
+        ///     backup can be written against.
+        /// \param backupCredentials
+        ///     The backup credentials of the service caller.
+        /// \return
+        ///     The oldest modification stamp that a delta backup
+        ///     can be written against; 0 == any.
+        /// \exception WorkspaceException
+        ///     If an error occurs.
+        quint64     oldestBaseModificationStamp(
+                            const BackupCredentials & backupCredentials
+                        ) const;
+
         /// \brief
         ///     Releases a "backup credentials" obtained at
         ///     the beginning of a backup session.
@@ -875,6 +1111,17 @@ namespace tt3::ws
                             WorkspaceClosedNotification notification
                         );
 
+        /// \brief
+        ///     Emitted after the contents of the workspace have
+        ///     changed wholesale (e.g. at the end of a bulk load),
+        ///     instead of per-object notifications.
+        /// \param notification
+        ///     The object specifying the source and details
+        ///     of the changes made to a Workspace.
+        void        workspaceReloaded(
+                            WorkspaceReloadedNotification notification
+                        );
+
         /// \brief
         ///     Emitted after a new object is created
         /// \param notification
@@ -905,17 +1152,47 @@ namespace tt3::ws
         //////////
         //  Implementation
     private:
-        mutable tt3::util::Mutex    _guard;     //  for synchronizing all accesses to workspace
+        mutable tt3::util::ReadWriteMutex   _guard; //  for synchronizing all accesses to workspace
+        //  Readers share the "_guard", so the caches below,
+        //  which readers update, need a guard of their own.
+        //  Writers, who own the "_guard", need not bother.
+        mutable tt3::util::Mutex    _cacheGuard;
 
         const WorkspaceAddress      _address;
         tt3::db::api::IDatabase *const _database;   //  never nullptr
         bool                        _isOpen = true; //  all Workspaces start off as "open"
         const bool                  _isReadOnly;
 
-        //  Access control "cache"
-        static inline const int _AccessCacheSizeCap = 16;
-        mutable QMap<Credentials, Capabilities> _goodCredentialsCache;
-        mutable QSet<Credentials>               _badCredentialsCache;
+        //  Access control "cache". Credentials that have logged
+        //  in successfully map to a "session", and bad credentials
+        //  to the Account with their login (if any). Either stays
+        //  valid while that Account's "access key" - everything a
+        //  login depends on - stays the same; other changes (e.g.
+        //  a Work recorded for the Account) don't matter. The key
+        //  is checked on every hit, as change notifications arrive
+        //  too late for that.
+        struct _AccessKey
+        {
+            Oid             accountOid;     //  invalid == no such Account
+            QString         login;
+            QString         passwordHash;
+            bool            accountEnabled = false;
+            bool            userEnabled = false;
+            Capabilities    capabilities;
+
+            bool            operator == (const _AccessKey & op2) const = default;
+        };
+        struct _Session
+        {
+            Oid             accountOid;
+            Oid             userOid;
+            Capabilities    capabilities;
+            _AccessKey      accessKey;
+        };
+        static inline const int _SessionCacheSizeCap = 256;
+        static inline const int _BadCredentialsCacheSizeCap = 16;
+        mutable QMap<Credentials, _Session>     _sessions;
+        mutable QMap<Credentials, _AccessKey>   _badCredentialsCache;   //  -> key of the Account with that login
 
         //  Object proxy cache
         mutable QMap<Oid, Object>   _proxyCache;
@@ -924,6 +1201,8 @@ namespace tt3::ws
         mutable QMap<BackupCredentials, tt3::db::api::IDatabaseLock*>   _backupCredentials;
         mutable QMap<RestoreCredentials, tt3::db::api::IDatabaseLock*>  _restoreCredentials;
         mutable QMap<ReportCredentials, tt3::db::api::IDatabaseLock*>   _reportCredentials;
+        mutable QMap<ReportCredentials, Oid>    _reportOwners;  //  -> OID of the Account
+        std::optional<RestoreCredentials>   _bulkLoadCredentials;   //  nullopt == not bulk loading
 
         //  Helpers
         void        _ensureOpen() const;    //  throws WorkspaceException
@@ -931,6 +1210,21 @@ namespace tt3::ws
         auto        _validateAccessRights(  //  throws WorkspaceException
                             const Credentials & credentials
                         ) const -> Capabilities;
+        auto        _tryLogin(  //  throws tt3::util::Exception
+                            const Credentials & credentials
+                        ) const -> tt3::db::api::IAccount *;
+        auto        _findSession(   //  throws tt3::util::Exception
+                            const Credentials & credentials
+                        ) const -> std::optional<_Session>; //  nullopt == bad credentials
+        bool        _isCurrent(     //  throws tt3::util::Exception
+                            const _Session & session
+                        ) const;
+        auto        _accessKeyOf(   //  throws tt3::util::Exception
+                            tt3::db::api::IAccount * dataAccount
+                        ) const -> _AccessKey;  //  nullptr == no such Account
+        void        _dropSessions(
+                            const Oid & oid
+                        );  //  ...of the Account or User with this OID
 
         auto        _getProxy(  //  throws WorkspaceException
                             tt3::db::api::IObject * dataObject
@@ -984,6 +1278,7 @@ namespace tt3::ws
         bool        _isBackupCredentials(const Credentials & credentials) const
         {   //  Inlined definition for better chance of inlining
             Q_ASSERT(_guard.isLockedByCurrentThread());
+            tt3::util::Lock _(_cacheGuard);
 
             if (!_backupCredentials.isEmpty())
             {   //  The "if" takes fast care of most accsses
@@ -1009,6 +1304,7 @@ namespace tt3::ws
         bool        _isRestoreCredentials(const Credentials & credentials) const
         {   //  Inlined definition for better chance of inlining
             Q_ASSERT(_guard.isLockedByCurrentThread());
+            tt3::util::Lock _(_cacheGuard);
 
             if (!_restoreCredentials.isEmpty())
             {   //  The "if" takes fast care of most accsses
@@ -1034,6 +1330,7 @@ namespace tt3::ws
         bool        _isReportCredentials(const Credentials & credentials) const
         {   //  Inlined definition for better chance of inlining
             Q_ASSERT(_guard.isLockedByCurrentThread());
+            tt3::util::Lock _(_cacheGuard);
 
             if (!_reportCredentials.isEmpty())
             {   //  The "if" takes fast care of most accsses
@@ -1066,6 +1363,9 @@ namespace tt3::ws
         void        _onDatabaseClosed(
                             tt3::db::api::DatabaseClosedNotification notification
                         );
+        void        _onDatabaseReloaded(
+                            tt3::db::api::DatabaseReloadedNotification notification
+                        );
         void        _onObjectCreated(
                             tt3::db::api::ObjectCreatedNotification notification
                         );
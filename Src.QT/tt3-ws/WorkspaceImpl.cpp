@@ -34,6 +34,10 @@ WorkspaceImpl::WorkspaceImpl(
             &tt3::db::api::ChangeNotifier::databaseClosed,
             this,
             &WorkspaceImpl::_onDatabaseClosed);
+    connect(_database->changeNotifier(),
+            &tt3::db::api::ChangeNotifier::databaseReloaded,
+            this,
+            &WorkspaceImpl::_onDatabaseReloaded);
     connect(_database->changeNotifier(),
             &tt3::db::api::ChangeNotifier::objectCreated,
             this,
@@ -76,7 +80,7 @@ auto WorkspaceImpl::address(
 
 bool WorkspaceImpl::isOpen() const
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
 
     return _isOpen;
 }
@@ -119,6 +123,9 @@ void WorkspaceImpl::refresh()
     {
         _ensureOpen();
         _database->refresh();
+        //  0.  Logins must be re-validated
+        _sessions.clear();
+        _badCredentialsCache.clear();
         //  1.  Any proxy referring to a "dead" DB Object
         //      we don't need in the proxy cache - no DB
         //      query will ever return one of those,
@@ -139,13 +146,37 @@ void WorkspaceImpl::refresh()
     }
 }
 
+void WorkspaceImpl::validate(
+        const Credentials & credentials
+    ) const
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();  //  may throw
+
+    try
+    {
+        //  Validate access rights
+        Capabilities clientCapabilities = _validateAccessRights(credentials); //  may throw
+        if (!clientCapabilities.contains(Capability::Administrator))
+        {   //  OOPS! Can't!
+            throw AccessDeniedException();
+        }
+        //  Do the work
+        _database->validate();  //  may throw
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
 //////////
 //  Operations (associations)
 quint64 WorkspaceImpl::objectCount(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -172,7 +203,7 @@ auto WorkspaceImpl::users(
         const Credentials & credentials
     ) const -> Users
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -218,7 +249,7 @@ Accounts WorkspaceImpl::accounts(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -268,7 +299,7 @@ Account WorkspaceImpl::findAccount(
         const QString & login
     ) const
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -317,7 +348,7 @@ auto WorkspaceImpl::activityTypes(
         const Credentials & credentials
     ) const -> ActivityTypes
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -349,7 +380,7 @@ auto WorkspaceImpl::publicActivities(
         const Credentials & credentials
     ) const -> PublicActivities
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -381,7 +412,7 @@ auto WorkspaceImpl::publicActivitiesAndTasks(
         const Credentials & credentials
     ) const -> PublicActivities
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -413,7 +444,7 @@ auto WorkspaceImpl::publicTasks(
         const Credentials & credentials
     ) const -> PublicTasks
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -445,7 +476,7 @@ auto WorkspaceImpl::rootPublicTasks(
         const Credentials & credentials
     ) const -> PublicTasks
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -477,7 +508,7 @@ auto WorkspaceImpl::projects(
         const Credentials & credentials
     ) const -> Projects
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -509,7 +540,7 @@ auto WorkspaceImpl::rootProjects(
         const Credentials & credentials
     ) const -> Projects
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -541,7 +572,7 @@ auto WorkspaceImpl::workStreams(
         const Credentials & credentials
     ) const -> WorkStreams
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -573,7 +604,7 @@ auto WorkspaceImpl::beneficiaries(
         const Credentials & credentials
     ) const -> Beneficiaries
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();  //  may throw
 
     try
@@ -607,7 +638,7 @@ bool WorkspaceImpl::canAccess(
         const Credentials & credentials
     ) const
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();
 
     try
@@ -638,7 +669,7 @@ auto WorkspaceImpl::capabilities(
         const Credentials & credentials
     ) const -> Capabilities
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();
 
     try
@@ -662,7 +693,7 @@ bool WorkspaceImpl::grantsAll(
         Capabilities requiredCapabilities
     ) const
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();
 
     try
@@ -694,7 +725,7 @@ bool WorkspaceImpl::grantsAny(
         Capabilities requiredCapabilities
     ) const
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();
 
     try
@@ -725,14 +756,13 @@ auto WorkspaceImpl::tryLogin(
         const Credentials & credentials
     ) const -> Account
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();
 
     try
     {
         //  Special access credentials do not allow to login
-        tt3::db::api::IAccount * dataAccount =
-            _database->tryLogin(credentials._login, credentials._password);
+        tt3::db::api::IAccount * dataAccount = _tryLogin(credentials);  //  may throw
         return (dataAccount != nullptr) ?
                     _getProxy(dataAccount) :
                    Account();
@@ -747,15 +777,17 @@ auto WorkspaceImpl::login(
         const Credentials & credentials
     ) const -> Account
 {
-    tt3::util::Lock _(_guard);
+    tt3::util::ReadLock _(_guard);
     _ensureOpen();
 
     try
     {
         //  Special access credentials do not allow to login
-        tt3::db::api::IAccount * dataAccount =
-            _database->login(credentials._login, credentials._password);
-        return _getProxy(dataAccount);
+        if (tt3::db::api::IAccount * dataAccount = _tryLogin(credentials))   //  may throw
+        {
+            return _getProxy(dataAccount);
+        }
+        throw AccessDeniedException();
     }
     catch (const tt3::util::Exception & ex)
     {   //  OOPS! Translate & re-throw
@@ -1223,6 +1255,12 @@ auto WorkspaceImpl::beginReport(
             if (_database->findAccount(login) == nullptr &&     //  may throw!
                 !_reportCredentials.contains(reportCredentials))
             {   //  Np conflict
+                tt3::db::api::IAccount * dataAccount = _tryLogin(credentials);  //  may throw
+                if (dataAccount == nullptr)
+                {   //  OOPS! Special access credentials can't own a report
+                    throw AccessDeniedException();  //  releases the dataLock
+                }
+                _reportOwners[reportCredentials] = dataAccount->oid();  //  may throw
                 _reportCredentials[reportCredentials] = dataLock.release();
                 return reportCredentials;
             }   //  else keep randomizing
@@ -1234,6 +1272,261 @@ auto WorkspaceImpl::beginReport(
     }
 }
 
+auto WorkspaceImpl::reportOwner(
+        const ReportCredentials & reportCredentials
+    ) const -> Account
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();
+
+    try
+    {
+        //  Validate access rights
+        if (!_isReportCredentials(reportCredentials))
+        {   //  OOPS! Can't!
+            throw AccessDeniedException();
+        }
+        //  Do the work
+        Oid ownerOid;
+        {   //  Readers may be clearing expired report credentials
+            tt3::util::Lock _(_cacheGuard);
+            ownerOid = _reportOwners.value(reportCredentials);
+        }
+        auto dataAccount =
+            dynamic_cast<tt3::db::api::IAccount*>(
+                _database->findObjectByOid(ownerOid));  //  may throw
+        if (dataAccount == nullptr)
+        {   //  OOPS! The owner is gone since the report began
+            throw AccessDeniedException();
+        }
+        return _getProxy(dataAccount);
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
+void WorkspaceImpl::beginBulkLoad(
+        const RestoreCredentials & restoreCredentials
+    )
+{
+    tt3::util::Lock _(_guard);
+    _ensureOpen();
+
+    try
+    {
+        //  Validate access rights
+        if (!_isRestoreCredentials(restoreCredentials) ||
+            _bulkLoadCredentials.has_value())
+        {   //  OOPS! Can't!
+            throw AccessDeniedException();
+        }
+        //  Do the work
+        _database->beginBulkLoad(); //  may throw
+        _bulkLoadCredentials = restoreCredentials;
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
+void WorkspaceImpl::setBulkLoadOid(
+        const RestoreCredentials & restoreCredentials,
+        const Oid & oid
+    )
+{
+    tt3::util::Lock _(_guard);
+    _ensureOpen();
+
+    try
+    {
+        //  Validate access rights
+        if (!_isRestoreCredentials(restoreCredentials) ||
+            _bulkLoadCredentials != restoreCredentials)
+        {   //  OOPS! Can't!
+            throw AccessDeniedException();
+        }
+        //  Do the work
+        _database->setBulkLoadOid(oid); //  may throw
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
+void WorkspaceImpl::endBulkLoad(
+        const RestoreCredentials & restoreCredentials
+    )
+{
+    tt3::util::Lock _(_guard);
+    _ensureOpen();
+
+    try
+    {
+        //  Validate access rights
+        if (!_bulkLoadCredentials.has_value())
+        {   //  Nothing to do
+            return;
+        }
+        if (!_isRestoreCredentials(restoreCredentials) ||
+            _bulkLoadCredentials != restoreCredentials)
+        {   //  OOPS! Can't!
+            throw AccessDeniedException();
+        }
+        //  Do the work
+        _bulkLoadCredentials.reset();
+        _database->endBulkLoad();   //  may throw
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
+quint64 WorkspaceImpl::modificationStamp(
+        const BackupCredentials & backupCredentials
+    ) const
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();  //  may throw
+
+    try
+    {
+        //  Validate access rights
+        if (!_isBackupCredentials(backupCredentials))
+        {   //  OOPS! Can't!
+            throw AccessDeniedException();
+        }
+        //  Do the work
+        return _database->modificationStamp();    //  may throw
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
+auto WorkspaceImpl::modifiedOidsSince(
+        const BackupCredentials & backupCredentials,
+        quint64 modificationStamp
+    ) const -> Oids
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();  //  may throw
+
+    try
+    {
+        //  Validate access rights
+        if (!_isBackupCredentials(backupCredentials))
+        {   //  OOPS! Can't!
+            throw AccessDeniedException();
+        }
+        //  Do the work
+        return _database->modifiedOidsSince(modificationStamp);    //  may throw
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
+auto WorkspaceImpl::destroyedOidsSince(
+        const BackupCredentials & backupCredentials,
+        quint64 modificationStamp
+    ) const -> Oids
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();  //  may throw
+
+    try
+    {
+        //  Validate access rights
+        if (!_isBackupCredentials(backupCredentials))
+        {   //  OOPS! Can't!
+            throw AccessDeniedException();
+        }
+        //  Do the work
+        return _database->destroyedOidsSince(modificationStamp);    //  may throw
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
+QUuid WorkspaceImpl::instanceId(
+        const BackupCredentials & backupCredentials
+    ) const
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();  //  may throw
+
+    try
+    {
+        //  Validate access rights
+        if (!_isBackupCredentials(backupCredentials))
+        {   //  OOPS! Can't!
+            throw AccessDeniedException();
+        }
+        //  Do the work
+        return _database->instanceId(); //  may throw
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
+void WorkspaceImpl::recordFullBackup(
+        const BackupCredentials & backupCredentials,
+        quint64 modificationStamp
+    )
+{
+    tt3::util::Lock _(_guard);
+    _ensureOpen();  //  may throw
+
+    try
+    {
+        //  Validate access rights
+        if (!_isBackupCredentials(backupCredentials))
+        {   //  OOPS! Can't!
+            throw AccessDeniedException();
+        }
+        //  Do the work
+        _database->recordFullBackup(modificationStamp); //  may throw
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
+quint64 WorkspaceImpl::oldestBaseModificationStamp(
+        const BackupCredentials & backupCredentials
+    ) const
+{
+    tt3::util::ReadLock _(_guard);
+    _ensureOpen();  //  may throw
+
+    try
+    {
+        //  Validate access rights
+        if (!_isBackupCredentials(backupCredentials))
+        {   //  OOPS! Can't!
+            throw AccessDeniedException();
+        }
+        //  Do the work
+        return _database->oldestBaseModificationStamp();    //  may throw
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Translate & re-throw
+        WorkspaceException::translateAndThrow(ex);
+    }
+}
+
 void WorkspaceImpl::releaseCredentials(
         const BackupCredentials & backupCredentials
     )
@@ -1270,6 +1563,12 @@ void WorkspaceImpl::releaseCredentials(
         {
             delete _restoreCredentials[restoreCredentials];
             _restoreCredentials.remove(restoreCredentials);
+            //  An unfinished bulk load ends with its restore session
+            if (_bulkLoadCredentials == restoreCredentials)
+            {
+                _bulkLoadCredentials.reset();
+                _database->endBulkLoad();   //  may throw
+            }
         }
     }
     catch (const tt3::util::Exception & ex)
@@ -1292,6 +1591,7 @@ void WorkspaceImpl::releaseCredentials(
         {
             delete _reportCredentials[reportCredentials];
             _reportCredentials.remove(reportCredentials);
+            _reportOwners.remove(reportCredentials);
         }
     }
     catch (const tt3::util::Exception & ex)
@@ -1322,7 +1622,7 @@ void WorkspaceImpl::_markClosed()
 
     _isOpen = false;
     //  Clear caches
-    _goodCredentialsCache.clear();
+    _sessions.clear();
     _badCredentialsCache.clear();
     _proxyCache.clear();
     for (auto dataDatabaseLock : _backupCredentials.values())
@@ -1340,6 +1640,7 @@ void WorkspaceImpl::_markClosed()
     _backupCredentials.clear();
     _restoreCredentials.clear();
     _reportCredentials.clear();
+    _reportOwners.clear();
     //  The "database closed" notification fro m the
     //  database will be missed, as database (along with
     //  its change notifier) no longer existsm so we
@@ -1354,39 +1655,167 @@ auto WorkspaceImpl::_validateAccessRights(
     Q_ASSERT(_guard.isLockedByCurrentThread());
     Q_ASSERT(_isOpen);
 
-    //  Is the answer already known ?
-    if (_goodCredentialsCache.contains(credentials))
+    try
     {
-        return _goodCredentialsCache[credentials];
+        if (auto session = _findSession(credentials))   //  may throw
+        {
+            return session->capabilities;
+        }
     }
-    if (_badCredentialsCache.contains(credentials))
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Data layer error
+        WorkspaceException::translateAndThrow(ex);
+    }
+    throw AccessDeniedException();
+}
+
+auto WorkspaceImpl::_tryLogin(
+        const Credentials & credentials
+    ) const -> tt3::db::api::IAccount *
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+    Q_ASSERT(_isOpen);
+
+    if (auto session = _findSession(credentials))   //  may throw
     {
-        throw AccessDeniedException();
+        return dynamic_cast<tt3::db::api::IAccount*>(
+            _database->findObjectByOid(session->accountOid));   //  may throw
     }
-    //  We need to query, but keep access cache size in check
-    if (_goodCredentialsCache.size() + _badCredentialsCache.size() > _AccessCacheSizeCap)
+    return nullptr;
+}
+
+auto WorkspaceImpl::_findSession(
+        const Credentials & credentials
+    ) const -> std::optional<_Session>
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+    Q_ASSERT(_isOpen);
+
+    //  Is the answer already known ? Sessions are copied
+    //  out, as other readers may update the caches, and
+    //  the database is not queried while holding the cache
+    //  guard, so that readers do not take turns there.
+    std::optional<_Session> session;
+    std::optional<_AccessKey> badCredentialsKey;
     {
-        _goodCredentialsCache.clear();
-        _badCredentialsCache.clear();
+        tt3::util::Lock _(_cacheGuard);
+        if (auto it = _sessions.constFind(credentials); it != _sessions.cend())
+        {
+            session = it.value();
+        }
+        else if (auto badIt = _badCredentialsCache.constFind(credentials); badIt != _badCredentialsCache.cend())
+        {
+            badCredentialsKey = badIt.value();
+        }
     }
-    try
+    if (session.has_value())
+    {   //  The Account or User may have changed (or gone
+        //  away) while its change notification is still
+        //  in transit
+        if (_isCurrent(session.value()))    //  may throw
+        {
+            return session;
+        }
+        tt3::util::Lock _(_cacheGuard);
+        _sessions.remove(credentials);
+        session.reset();
+    }
+    else if (badCredentialsKey.has_value())
+    {   //  A new Account with that login, a new password,
+        //  etc. may have made bad credentials good
+        if (_accessKeyOf(_database->findAccount(credentials._login)) == badCredentialsKey.value())  //  may throw
+        {
+            return std::nullopt;
+        }
+        tt3::util::Lock _(_cacheGuard);
+        _badCredentialsCache.remove(credentials);
+    }
+
+    //  We need to query, noting the database state we query...
+    quint64 databaseStamp = _database->modificationStamp(); //  may throw
+    if (auto dataAccount = _database->tryLogin(credentials._login, credentials._password))  //  may throw
     {
-        if (auto dataAccount = _database->tryLogin(credentials._login, credentials._password))  //  may throw
+        _AccessKey accessKey = _accessKeyOf(dataAccount);   //  may throw
+        session = _Session
+        {
+            accessKey.accountOid,
+            dataAccount->user()->oid(), //  may throw
+            accessKey.capabilities,
+            accessKey
+        };
+        //  ...and don't cache what may have changed since...
+        if (_database->modificationStamp() != databaseStamp)    //  may throw
         {
-            Capabilities capabilities = dataAccount->capabilities();    //  may throw
-            _goodCredentialsCache.insert(credentials, capabilities);
-            return capabilities;
+            return session;
         }
-        else
+        //  ...and keep access caches size in check
+        tt3::util::Lock _(_cacheGuard);
+        if (_sessions.size() >= _SessionCacheSizeCap)
         {
-            _badCredentialsCache.insert(credentials);
-            throw AccessDeniedException();
+            _sessions.clear();
         }
+        _sessions.insert(credentials, session.value());
+        return session;
     }
-    catch (const tt3::util::Exception & ex)
-    {   //  OOPS! Data layer error
-        WorkspaceException::translateAndThrow(ex);
+    _AccessKey accessKey = _accessKeyOf(_database->findAccount(credentials._login));  //  may throw
+    if (_database->modificationStamp() != databaseStamp)    //  may throw
+    {   //  Don't cache what may have changed since
+        return std::nullopt;
     }
+    tt3::util::Lock _(_cacheGuard);
+    if (_badCredentialsCache.size() >= _BadCredentialsCacheSizeCap)
+    {
+        _badCredentialsCache.clear();
+    }
+    _badCredentialsCache.insert(credentials, accessKey);
+    return std::nullopt;
+}
+
+bool WorkspaceImpl::_isCurrent(
+        const _Session & session
+    ) const
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+
+    auto dataAccount =
+        dynamic_cast<tt3::db::api::IAccount*>(
+            _database->findObjectByOid(session.accountOid));    //  may throw
+    return dataAccount != nullptr &&
+           _accessKeyOf(dataAccount) == session.accessKey;  //  may throw
+}
+
+auto WorkspaceImpl::_accessKeyOf(
+        tt3::db::api::IAccount * dataAccount
+    ) const -> _AccessKey
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+
+    if (dataAccount == nullptr)
+    {   //  No Account - no access
+        return _AccessKey();
+    }
+    return _AccessKey
+    {
+        dataAccount->oid(),
+        dataAccount->login(),           //  may throw
+        dataAccount->passwordHash(),    //  may throw
+        dataAccount->enabled(),         //  may throw
+        dataAccount->user()->enabled(), //  may throw
+        dataAccount->capabilities()     //  may throw
+    };
+}
+
+void WorkspaceImpl::_dropSessions(
+        const Oid & oid
+    )
+{
+    Q_ASSERT(_guard.isLockedByCurrentThread());
+
+    _sessions.removeIf(
+        [&](auto it)
+        {
+            return it->accountOid == oid || it->userOid == oid;
+        });
 }
 
 auto WorkspaceImpl::_getProxy(
@@ -1465,6 +1894,8 @@ User WorkspaceImpl::_getProxy(tt3::db::api::IUser * dataUser) const
     Q_ASSERT(dataUser != nullptr);
 
     Oid oid = dataUser->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         User user = std::dynamic_pointer_cast<UserImpl>(_proxyCache[oid]);
@@ -1487,6 +1918,8 @@ Account WorkspaceImpl::_getProxy(tt3::db::api::IAccount * dataAccount) const
     Q_ASSERT(dataAccount != nullptr);
 
     Oid oid = dataAccount->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         Account account = std::dynamic_pointer_cast<AccountImpl>(_proxyCache[oid]);
@@ -1509,6 +1942,8 @@ ActivityType WorkspaceImpl::_getProxy(tt3::db::api::IActivityType * dataActivity
     Q_ASSERT(dataActivityType != nullptr);
 
     Oid oid = dataActivityType->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         ActivityType activityType = std::dynamic_pointer_cast<ActivityTypeImpl>(_proxyCache[oid]);
@@ -1572,6 +2007,8 @@ PublicActivity WorkspaceImpl::_getProxy(
     Q_ASSERT(dataPublicActivity != nullptr);
 
     Oid oid = dataPublicActivity->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         PublicActivity publicActivity = std::dynamic_pointer_cast<PublicActivityImpl>(_proxyCache[oid]);
@@ -1596,6 +2033,8 @@ PublicTask WorkspaceImpl::_getProxy(
     Q_ASSERT(dataPublicTask != nullptr);
 
     Oid oid = dataPublicTask->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         PublicTask publicTask = std::dynamic_pointer_cast<PublicTaskImpl>(_proxyCache[oid]);
@@ -1627,6 +2066,8 @@ PrivateActivity WorkspaceImpl::_getProxy(
     Q_ASSERT(dataPrivateActivity != nullptr);
 
     Oid oid = dataPrivateActivity->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         PrivateActivity privateActivity = std::dynamic_pointer_cast<PrivateActivityImpl>(_proxyCache[oid]);
@@ -1651,6 +2092,8 @@ auto WorkspaceImpl::_getProxy(
     Q_ASSERT(dataPrivateTask != nullptr);
 
     Oid oid = dataPrivateTask->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         PrivateTask privateTask = std::dynamic_pointer_cast<PrivateTaskImpl>(_proxyCache[oid]);
@@ -1697,6 +2140,8 @@ Project WorkspaceImpl::_getProxy(
     Q_ASSERT(dataProject != nullptr);
 
     Oid oid = dataProject->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         Project project = std::dynamic_pointer_cast<ProjectImpl>(_proxyCache[oid]);
@@ -1721,6 +2166,8 @@ WorkStream WorkspaceImpl::_getProxy(
     Q_ASSERT(dataWorkStream != nullptr);
 
     Oid oid = dataWorkStream->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         WorkStream workStream = std::dynamic_pointer_cast<WorkStreamImpl>(_proxyCache[oid]);
@@ -1745,6 +2192,8 @@ Beneficiary WorkspaceImpl::_getProxy(
     Q_ASSERT(dataBeneficiary != nullptr);
 
     Oid oid = dataBeneficiary->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         Beneficiary beneficiary = std::dynamic_pointer_cast<BeneficiaryImpl>(_proxyCache[oid]);
@@ -1769,6 +2218,8 @@ Work WorkspaceImpl::_getProxy(
     Q_ASSERT(dataWork != nullptr);
 
     Oid oid = dataWork->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         Work work = std::dynamic_pointer_cast<WorkImpl>(_proxyCache[oid]);
@@ -1793,6 +2244,8 @@ Event WorkspaceImpl::_getProxy(
     Q_ASSERT(dataEvent != nullptr);
 
     Oid oid = dataEvent->oid();
+    tt3::util::Lock _(_cacheGuard);  //  protect the cache!
+
     if (_proxyCache.contains(oid))
     {
         Event event = std::dynamic_pointer_cast<EventImpl>(_proxyCache[oid]);
@@ -1830,6 +2283,18 @@ void WorkspaceImpl::_clearExpiredRestoreCredentials()
         {
             delete _restoreCredentials[key]; //  release the lock
             _restoreCredentials.remove(key);
+            if (_bulkLoadCredentials == key)
+            {   //  An unfinished bulk load ends with its restore session
+                _bulkLoadCredentials.reset();
+                try
+                {
+                    _database->endBulkLoad();   //  may throw
+                }
+                catch (const tt3::util::Exception & ex)
+                {   //  OOPS! Suppress, but log
+                    qCritical() << ex;
+                }
+            }
         }
     }
 }
@@ -1843,6 +2308,7 @@ void WorkspaceImpl::_clearExpiredReportCredentials()
         {
             delete _reportCredentials[key]; //  release the lock
             _reportCredentials.remove(key);
+            _reportOwners.remove(key);
         }
     }
 }
@@ -1857,6 +2323,10 @@ void WorkspaceImpl::_onDatabaseClosed(tt3::db::api::DatabaseClosedNotification n
                &tt3::db::api::ChangeNotifier::databaseClosed,
                this,
                &WorkspaceImpl::_onDatabaseClosed);
+    disconnect(_database->changeNotifier(),
+               &tt3::db::api::ChangeNotifier::databaseReloaded,
+               this,
+               &WorkspaceImpl::_onDatabaseReloaded);
     disconnect(_database->changeNotifier(),
                &tt3::db::api::ChangeNotifier::objectCreated,
                this,
@@ -1875,18 +2345,28 @@ void WorkspaceImpl::_onDatabaseClosed(tt3::db::api::DatabaseClosedNotification n
             _address->_workspaceType->_mapWorkspace(this)));
 }
 
-void WorkspaceImpl::_onObjectCreated(tt3::db::api::ObjectCreatedNotification notification)
+void WorkspaceImpl::_onDatabaseReloaded(tt3::db::api::DatabaseReloadedNotification notification)
 {
     Q_ASSERT(notification.database() == _database);
-    //  Any change to users/accounts must drop the access rights cache
-    if (notification.objectType() == ObjectTypes::User::instance() ||
-        notification.objectType() == ObjectTypes::Account::instance())
+    //  Any user/account may have changed, so
+    //  access control caches are no longer valid
     {
         tt3::util::Lock _(_guard);
-        _goodCredentialsCache.clear();
+        _sessions.clear();
         _badCredentialsCache.clear();
     }
     //  Translate & re-issue
+    emit workspaceReloaded(
+        WorkspaceReloadedNotification(
+            _address->_workspaceType->_mapWorkspace(this)));
+}
+
+void WorkspaceImpl::_onObjectCreated(tt3::db::api::ObjectCreatedNotification notification)
+{
+    Q_ASSERT(notification.database() == _database);
+    //  A new account can make bad credentials good, but
+    //  _findSession() notices that by itself
+    //  Translate & re-issue
     emit objectCreated(
         ObjectCreatedNotification(
             _address->_workspaceType->_mapWorkspace(this),
@@ -1897,13 +2377,13 @@ void WorkspaceImpl::_onObjectCreated(tt3::db::api::ObjectCreatedNotification not
 void WorkspaceImpl::_onObjectDestroyed(tt3::db::api::ObjectDestroyedNotification notification)
 {
     Q_ASSERT(notification.database() == _database);
-    //  Any change to users/accounts must drop the access rights cache
+    //  Sessions of a destroyed user/account are no longer
+    //  current (see _findSession()), so don't keep them
     if (notification.objectType() == ObjectTypes::User::instance() ||
         notification.objectType() == ObjectTypes::Account::instance())
     {
         tt3::util::Lock _(_guard);
-        _goodCredentialsCache.clear();
-        _badCredentialsCache.clear();
+        _dropSessions(notification.oid());
         //  There's no need to cache destroyed objects
         _proxyCache.remove(notification.oid());
     }
@@ -1923,14 +2403,9 @@ void WorkspaceImpl::_onObjectDestroyed(tt3::db::api::ObjectDestroyedNotification
 void WorkspaceImpl::_onObjectModified(tt3::db::api::ObjectModifiedNotification notification)
 {
     Q_ASSERT(notification.database() == _database);
-    //  Any change to users/accounts must drop the access rights cache
-    if (notification.objectType() == ObjectTypes::User::instance() ||
-        notification.objectType() == ObjectTypes::Account::instance())
-    {
-        tt3::util::Lock _(_guard);
-        _goodCredentialsCache.clear();
-        _badCredentialsCache.clear();
-    }
+    //  Most changes to an account (e.g. a Work recorded for
+    //  it) don't affect its sessions, and _findSession()
+    //  notices those that do by itself
     //  Translate & re-issue
     emit objectModified(
         ObjectModifiedNotification(
@@ -1939,4 +2414,20 @@ void WorkspaceImpl::_onObjectModified(tt3::db::api::ObjectModifiedNotification n
             notification.oid()));
 }
 
+//////////
+//  WorkspaceImpl::ReportLock
+WorkspaceImpl::ReportLock::ReportLock(
+        Workspace workspace,
+        const ReportCredentials & reportCredentials
+    ) : _workspace(workspace),
+        _lock(workspace->_guard)
+{
+    _workspace->_ensureOpen();  //  may throw
+    //  Validate access rights
+    if (!_workspace->_isReportCredentials(reportCredentials))
+    {   //  OOPS! Can't! The destructor won't run, but the _lock's will
+        throw AccessDeniedException();
+    }
+}
+
 //  End of tt3-ws/WorkspaceImpl.cpp
@@ -52,6 +52,7 @@ HEADERS += \
     Project.hpp \
     PublicActivity.hpp \
     PublicTask.hpp \
+    Records.hpp \
     Task.hpp \
     User.hpp \
     Validator.hpp \
@@ -106,6 +106,40 @@ int Application::exec()
     }
 }
 
+int Application::execReportBatch(const QString & batchFileName)
+{
+    //  All components are needed (report types are
+    //  optional ones), but no theme, skin or login
+    tt3::util::ComponentManager::initializeComponents();
+    tt3::util::ComponentManager::loadComponentSettings();
+    tt3::util::theCurrentLocale = tt3::gui::Component::Settings::instance()->uiLocale;
+    tt3::util::ComponentManager::discoverComponents();
+    tt3::util::ComponentManager::initializeComponents();
+    tt3::util::ComponentManager::loadComponentSettings();
+
+    //  Messages go to the console, not to the log file
+    int exitCode;
+    try
+    {
+        tt3::report::ReportBatch reportBatch(batchFileName);  //  may throw
+        qsizetype failedReports = reportBatch.run();    //  may throw
+        qInfo() << "Reports generated:"
+                << (reportBatch.reportCount() - failedReports)
+                << "of" << reportBatch.reportCount();
+        exitCode = (failedReports == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (const tt3::util::Exception & ex)
+    {   //  OOPS! Report
+        qCritical() << ex;
+        exitCode = EXIT_FAILURE;
+    }
+
+    //  Nothing the user can change has changed, so
+    //  there's no need to save component settings
+    tt3::util::ComponentManager::deinitializeComponents();
+    return exitCode;
+}
+
 //////////
 //  Implementation helpers
 void Application::_prepareForLogging()
@@ -175,6 +209,9 @@ void Application::_initialize()
     }
     _initialized = true;
 
+    QElapsedTimer startupTimer;
+    startupTimer.start();
+
     //  Core (preloaded) components can be initialzed
     //  NOW - we need these settings for SplashScreen
     //  localization. ComponentManager takes care of
@@ -190,10 +227,14 @@ void Application::_initialize()
     {
         splashScreen.show();
     }
-    QDateTime closeSplashScreenAt =
-        QDateTime::currentDateTimeUtc().addMSecs(tt3::gui::SplashScreen::PreferredStartupDurationMs);
+    //  The splash screen stays for a while, but we don't
+    //  wait for that - the startup goes on meanwhile
+    QTimer splashScreenTimer;
+    splashScreenTimer.setSingleShot(true);
+    splashScreenTimer.start(tt3::gui::SplashScreen::PreferredStartupDurationMs);
 
     _prepareForLogging();
+    qInfo() << "Startup: core components initialized after" << startupTimer.elapsed() << "ms";
 
     QPixmap pm;
     pm.load(":/tt3/Resources/Images/Misc/Tt3Large.png");
@@ -209,25 +250,31 @@ void Application::_initialize()
         {
             splashScreen.showStartupProgress(a, c, r * 0.5f);
         });
+    qInfo() << "Startup: components discovered after" << startupTimer.elapsed() << "ms";
     tt3::util::ComponentManager::initializeComponents(
         [&](auto a, auto c, auto r)
         {
             splashScreen.showStartupProgress(a, c, 0.5f + r * 0.5f);
         });
     tt3::util::ComponentManager::loadComponentSettings();
+    qInfo() << "Startup: all components initialized after" << startupTimer.elapsed() << "ms";
 
     //  Close splash screen BEFORE UI (skin) is activated
-    if (splashScreen.isVisible())
-    {   //  No point in delays if invisible
-        while (QDateTime::currentDateTimeUtc() < closeSplashScreenAt)
-        {
-            QCoreApplication::processEvents();
-        }
+    if (splashScreen.isVisible() && splashScreenTimer.isActive())
+    {   //  No point in delays if invisible; otherwise keep
+        //  handling events (but without spinning) until then
+        QEventLoop splashScreenLoop;
+        connect(&splashScreenTimer,
+                &QTimer::timeout,
+                &splashScreenLoop,
+                &QEventLoop::quit);
+        splashScreenLoop.exec();
     }
     splashScreen.hide();
 
     _selectActiveTheme();
     _selectActiveSkin();
+    qInfo() << "Startup: skin activated after" << startupTimer.elapsed() << "ms";
 
     //  Perform initial login
     tt3::gui::LoginDialog loginDialog(
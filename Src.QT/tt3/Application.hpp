@@ -61,6 +61,19 @@ namespace tt3
         ///     The application exit code.
         int             exec();
 
+        /// \brief
+        ///     Runs the application in the headless batch mode,
+        ///     generating the reports listed in a report batch file.
+        /// \details
+        ///     No splash screen, skin or login dialog is shown and
+        ///     no event loop is run; errors are logged, not shown.
+        /// \param batchFileName
+        ///     The name of the report batch file.
+        /// \return
+        ///     The application exit code; EXIT_SUCCESS only
+        ///     if all reports were generated successfully.
+        int             execReportBatch(const QString & batchFileName);
+
         //////////
         //  Implementation
     private:
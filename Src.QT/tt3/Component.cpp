@@ -62,6 +62,19 @@ auto Component::subsystem(
     return tt3::util::StandardSubsystems::Applications::instance();
 }
 
+Component::Mnemonics Component::dependencies() const
+{
+    return Mnemonics
+        {
+            M(tt3-help),
+            M(tt3-report),
+            M(tt3-gui),
+            M(tt3-ws),
+            M(tt3-db-api),
+            M(tt3-util)
+        };
+}
+
 auto Component::resources(
     ) const -> Component::Resources *
 {
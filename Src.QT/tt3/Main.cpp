@@ -21,7 +21,37 @@ using namespace tt3;
 //  TT3 entry point
 int main(int argc, char *argv[])
 {
+    //  In the headless batch mode there are no windows,
+    //  so don't insist on a display being available
+    //  Copy the batch file name now: QApplication's constructor
+    //  removes the options it recognizes from argv, which
+    //  would leave an argv index pointing at something else
+    bool reportBatch = false;
+    QString reportBatchFileName;
+    for (int i = 1; i < argc; i++)
+    {
+        if (qstrcmp(argv[i], "--report-batch") == 0)
+        {
+            if (i + 1 == argc)
+            {   //  OOPS! No batch file to run
+                qCritical() << "--report-batch: report batch file name expected";
+                return 1;
+            }
+            reportBatch = true;
+            reportBatchFileName = QString::fromLocal8Bit(argv[i + 1]);
+            break;
+        }
+    }
+    if (reportBatch && !qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
     Application app(argc, argv);
+    if (reportBatch)
+    {   //  Generate reports, no UI
+        return app.execReportBatch(reportBatchFileName);
+    }
     //  TODO Move the next line to Application::_initialize(),
     //  right before the _selectActiveTheme() call
     app.setStyle(QStyleFactory::create("Fusion"));    //  TODO what about Linux?
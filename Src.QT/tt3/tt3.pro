@@ -21,6 +21,7 @@ RC_FILE = tt3.rc
 
 LIBS += \
     -ltt3-help$$TARGET_SUFFIX \
+    -ltt3-report$$TARGET_SUFFIX \
     -ltt3-gui$$TARGET_SUFFIX \
     -ltt3-ws$$TARGET_SUFFIX \
     -ltt3-db-api$$TARGET_SUFFIX \